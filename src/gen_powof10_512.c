@@ -0,0 +1,836 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ gen_powof10_512.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/*!
+ * \file  gen_powof10_512.c
+ * \brief Build time generator for powof10_512.c, the power of ten
+ * and reciprocal tables for 256-bit and 512-bit integers.
+ *
+ * This program runs on the build machine (CC_FOR_BUILD) so it uses
+ * only portable C99: numbers are little endian arrays of 32-bit
+ * limbs. It writes the C source for
+ *
+ * - vec256_powof10[0-77], 10**k as __VEC_U_256.
+ * - vec512_powof10[0-154], 10**k as __VEC_U_512.
+ * - vec128_recipof10[1-38], multipliers for n / 10**k, n < 2**128.
+ * - vec256_recipof10[1-77], multipliers for n / 10**k, n < 2**256.
+ * - vec512_recipof10[1-154], multipliers for n / 10**k, n < 2**512.
+ * - vec_recipof10_sh[1-154], the final shift for all three.
+ * - vec128_powof5[0-55], vec256_powof5[0-91], vec256_recipof5[0-91],
+ *   vec_powof5_err[] and vec_recipof5_err[], the compressed 5**n
+ *   and 2**j / 5**n tables for the binary128 decimal conversions.
+ * - vec128_f64powof5[0-325] and vec128_f64recipof5[0-341], the full
+ *   125-bit 5**n and 2**j / 5**n tables for the double and float
+ *   decimal conversions.
+ * - vec_dpd2bin[0-1023] and vec_bin2dpd[0-999], the densely packed
+ *   decimal declet to binary (0-999) decode and encode tables for
+ *   the _Decimal128 and _Decimal64 batch arithmetic.
+ *
+ * The reciprocals follow Granlund and Montgomery, "Division by
+ * Invariant Integers using Multiplication" (Theorem 4.2). For an
+ * N-bit n and 10**k = 2**k * 5**k, shift out the factor 2**k first,
+ * so n' = n >> k has N' = N - k bits. With l = ceil(log2(5**k)) and
+ * m = ceil(2**(N'+l) / 5**k) we have m * 5**k - 2**(N'+l) < 2**l,
+ * so for all n' < 2**N'
+ *
+ * floor(n' / 5**k) = floor(n' * m / 2**(N'+l))
+ *
+ * and m < 2**N fits in the table element. The shift N' + l is
+ * N + sh where sh = l - k, so the quotient is the high N bits of
+ * the 2N-bit product shifted right by sh.
+ *
+ * Each multiplier is checked against that bound, and each power
+ * against the element size, before it is written. A failure exits
+ * non zero and fails the build.
+ *
+ * The binary128 decimal conversions need the leading 249 bits of
+ * 5**n and of 2**j / 5**n for n = [0-5096]. As in Ryu (Ulf Adams,
+ * "Ryu: fast float-to-string conversion") only every 56th entry is
+ * stored. The others are 5**(n % 56) (128 bits) times the stored
+ * entry, shifted right, which is low by at most a few units. The
+ * exact difference (0-3) is kept in a 2-bit per entry table. The
+ * exact values come from a running 5**n and a running
+ * floor (2**K / 5**n), divided by 5 at each step, in a separate wide
+ * number type.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 1280 bits, enough for 2**(N'+l) with N = 512, k = 154.  */
+#define GEN_LIMBS 40
+
+typedef struct
+{
+  uint32_t w[GEN_LIMBS];
+} gen_num_t;
+
+static void
+gen_set (gen_num_t *r, uint32_t v)
+{
+  memset (r, 0, sizeof (*r));
+  r->w[0] = v;
+}
+
+static int
+gen_bits (const gen_num_t *a)
+{
+  int i;
+
+  for (i = GEN_LIMBS - 1; i >= 0; i--)
+    if (a->w[i] != 0)
+      {
+	int b = 32;
+	while (!(a->w[i] & (1u << (b - 1))))
+	  b--;
+	return (i * 32) + b;
+      }
+  return 0;
+}
+
+static int
+gen_cmp (const gen_num_t *a, const gen_num_t *b)
+{
+  int i;
+
+  for (i = GEN_LIMBS - 1; i >= 0; i--)
+    if (a->w[i] != b->w[i])
+      return (a->w[i] < b->w[i]) ? -1 : 1;
+  return 0;
+}
+
+static void
+gen_mul_small (gen_num_t *r, const gen_num_t *a, uint32_t m)
+{
+  uint64_t c = 0;
+  int i;
+
+  for (i = 0; i < GEN_LIMBS; i++)
+    {
+      c += (uint64_t) a->w[i] * m;
+      r->w[i] = (uint32_t) c;
+      c >>= 32;
+    }
+  if (c != 0)
+    {
+      fprintf (stderr, "gen_powof10_512: overflow\n");
+      exit (1);
+    }
+}
+
+static void
+gen_add_small (gen_num_t *r, uint32_t v)
+{
+  uint64_t c = v;
+  int i;
+
+  for (i = 0; i < GEN_LIMBS && c != 0; i++)
+    {
+      c += r->w[i];
+      r->w[i] = (uint32_t) c;
+      c >>= 32;
+    }
+}
+
+static void
+gen_sub (gen_num_t *r, const gen_num_t *a, const gen_num_t *b)
+{
+  int64_t c = 0;
+  int i;
+
+  for (i = 0; i < GEN_LIMBS; i++)
+    {
+      c += (int64_t) a->w[i] - b->w[i];
+      r->w[i] = (uint32_t) c;
+      c = (c < 0) ? -1 : 0;
+    }
+}
+
+static void
+gen_mul (gen_num_t *r, const gen_num_t *a, const gen_num_t *b)
+{
+  gen_num_t t;
+  int i, j;
+
+  memset (&t, 0, sizeof (t));
+  for (i = 0; i < GEN_LIMBS; i++)
+    {
+      uint64_t c = 0;
+      if (a->w[i] == 0)
+	continue;
+      for (j = 0; i + j < GEN_LIMBS; j++)
+	{
+	  c += (uint64_t) a->w[i] * b->w[j] + t.w[i + j];
+	  t.w[i + j] = (uint32_t) c;
+	  c >>= 32;
+	}
+    }
+  *r = t;
+}
+
+static void
+gen_pow2 (gen_num_t *r, int e)
+{
+  gen_set (r, 0);
+  r->w[e / 32] = 1u << (e % 32);
+}
+
+/* q = ceil (a / d), by shift and subtract.  */
+static void
+gen_div_ceil (gen_num_t *q, const gen_num_t *a, const gen_num_t *d)
+{
+  gen_num_t rem, t;
+  int i;
+
+  gen_set (q, 0);
+  gen_set (&rem, 0);
+  for (i = gen_bits (a) - 1; i >= 0; i--)
+    {
+      /* rem = rem * 2 + bit i of a.  */
+      gen_mul_small (&rem, &rem, 2);
+      rem.w[0] |= (a->w[i / 32] >> (i % 32)) & 1;
+      if (gen_cmp (&rem, d) >= 0)
+	{
+	  gen_sub (&rem, &rem, d);
+	  q->w[i / 32] |= 1u << (i % 32);
+	}
+    }
+  gen_set (&t, 0);
+  if (gen_cmp (&rem, &t) != 0)
+    gen_add_small (q, 1);
+}
+
+/* q = a >> s.  */
+static void
+gen_shr (gen_num_t *q, const gen_num_t *a, int s)
+{
+  gen_num_t t;
+  int i, iw = s / 32, sh = s % 32;
+
+  gen_set (&t, 0);
+  for (i = 0; i + iw < GEN_LIMBS; i++)
+    {
+      t.w[i] = a->w[i + iw] >> sh;
+      if (sh != 0 && i + iw + 1 < GEN_LIMBS)
+	t.w[i] |= a->w[i + iw + 1] << (32 - sh);
+    }
+  *q = t;
+}
+
+/* Print the low bits of a as nquads CONST_VUINT128_QxW constants,
+   high to low order, followed by sep.  */
+static void
+gen_print_quads (const gen_num_t *a, int nquads, const char *indent,
+		 const char *sep)
+{
+  int q;
+
+  for (q = nquads - 1; q >= 0; q--)
+    printf ("%sCONST_VUINT128_QxW (0x%08x, 0x%08x, 0x%08x, 0x%08x)%s\n",
+	    indent, a->w[q * 4 + 3], a->w[q * 4 + 2], a->w[q * 4 + 1],
+	    a->w[q * 4], (q != 0) ? "," : sep);
+}
+
+/* Print one table element. vec128 tables are plain vui128_t.  */
+static void
+gen_print_elem (const gen_num_t *a, int bits, int last)
+{
+  if (bits == 128)
+    {
+      gen_print_quads (a, 1, "  ", last ? "" : ",");
+      return;
+    }
+  printf ("  CONST_VINT%d_Q (\n", bits);
+  gen_print_quads (a, bits / 128, "    ", "");
+  printf ("  )%s\n", last ? "" : ",");
+}
+
+static const char *
+gen_type (int bits)
+{
+  static char buf[16];
+
+  if (bits == 128)
+    return "vui128_t";
+  snprintf (buf, sizeof (buf), "__VEC_U_%d", bits);
+  return buf;
+}
+
+static void
+gen_powof10 (int bits, int kmax)
+{
+  gen_num_t p, t;
+  int k;
+
+  printf ("/* 10**k for k = [0-%d] as %d-bit integers.  */\n", kmax, bits);
+  printf ("const %s vec%d_powof10[] =\n{\n", gen_type (bits), bits);
+  gen_set (&p, 1);
+  for (k = 0; k <= kmax; k++)
+    {
+      if (k > 0)
+	{
+	  gen_mul_small (&t, &p, 10);
+	  p = t;
+	}
+      if (gen_bits (&p) > bits)
+	{
+	  fprintf (stderr, "gen_powof10_512: 10**%d exceeds %d bits\n", k,
+		   bits);
+	  exit (1);
+	}
+      printf ("  /* 10**%d */\n", k);
+      gen_print_elem (&p, bits, k == kmax);
+    }
+  printf ("};\n\n");
+}
+
+static void
+gen_recipof10 (int bits, int kmax)
+{
+  gen_num_t p5, m, t, u, lim;
+  int k, l;
+
+  printf ("/* Multipliers for n / 10**k = ((n >> k) * m) >> (%d + sh)\n"
+	  "   for k = [1-%d]. Entry 0 is not used.  */\n", bits, kmax);
+  printf ("const %s vec%d_recipof10[] =\n{\n", gen_type (bits), bits);
+  printf ("  /* 10**0 (not used) */\n");
+  gen_set (&t, 0);
+  gen_print_elem (&t, bits, 0);
+
+  gen_set (&p5, 1);
+  for (k = 1; k <= kmax; k++)
+    {
+      gen_mul_small (&t, &p5, 5);
+      p5 = t;
+      /* l = ceil (log2 (5**k)), 5**k is never a power of 2.  */
+      l = gen_bits (&p5);
+      gen_pow2 (&t, bits - k + l);
+      gen_div_ceil (&m, &t, &p5);
+
+      /* Check m < 2**N and m * 5**k - 2**(N'+l) < 2**l.  */
+      gen_mul (&u, &m, &p5);
+      gen_sub (&u, &u, &t);
+      gen_pow2 (&lim, l);
+      if (gen_bits (&m) > bits || gen_cmp (&u, &lim) >= 0)
+	{
+	  fprintf (stderr, "gen_powof10_512: no %d-bit multiplier for "
+		   "10**%d\n", bits, k);
+	  exit (1);
+	}
+      printf ("  /* 10**%d, sh %d */\n", k, l - k);
+      gen_print_elem (&m, bits, k == kmax);
+    }
+  printf ("};\n\n");
+}
+
+/* The shift sh = l - k does not depend on N, so one table serves
+   all sizes.  */
+static void
+gen_recipof10_sh (int kmax)
+{
+  gen_num_t p5, t;
+  int k, sh;
+
+  printf ("/* Right shift (sh) after the high half of the product.  */\n");
+  printf ("const unsigned char vec_recipof10_sh[] =\n{");
+  gen_set (&p5, 1);
+  for (k = 0; k <= kmax; k++)
+    {
+      sh = 0;
+      if (k > 0)
+	{
+	  gen_mul_small (&t, &p5, 5);
+	  p5 = t;
+	  sh = gen_bits (&p5) - k;
+	}
+      printf ("%s%3d%s", (k % 12 == 0) ? "\n  " : " ", sh,
+	      (k < kmax) ? "," : "");
+    }
+  printf ("\n};\n");
+}
+
+/* The binary128 conversion tables. pow5bits (n) is the formula the
+   runtime uses for ceil (log2 (5**n)), n > 0, checked here against
+   the exact value.  */
+#define GEN_POW5_BITS 249
+#define GEN_POW5_STEP 56
+#define GEN_POW5_BASES 92
+#define GEN_POW5_MAX ((GEN_POW5_BASES - 1) * GEN_POW5_STEP)
+/* 12160 bits, enough for 5**5096 and 2**(pow5bits (5096) + 248).  */
+#define GEN_WIDE_LIMBS 380
+
+typedef struct
+{
+  uint32_t w[GEN_WIDE_LIMBS];
+} gen_wide_t;
+
+static int
+gen_pow5bits (int n)
+{
+  return (int) (((uint64_t) n * 163391164108059ull) >> 46) + 1;
+}
+
+static int
+gen_wide_bits (const gen_wide_t *a)
+{
+  int i;
+
+  for (i = GEN_WIDE_LIMBS - 1; i >= 0; i--)
+    if (a->w[i] != 0)
+      {
+	int b = 32;
+	while (!(a->w[i] & (1u << (b - 1))))
+	  b--;
+	return (i * 32) + b;
+      }
+  return 0;
+}
+
+static void
+gen_wide_mul5 (gen_wide_t *a)
+{
+  uint64_t c = 0;
+  int i;
+
+  for (i = 0; i < GEN_WIDE_LIMBS; i++)
+    {
+      c += (uint64_t) a->w[i] * 5;
+      a->w[i] = (uint32_t) c;
+      c >>= 32;
+    }
+  if (c != 0)
+    {
+      fprintf (stderr, "gen_powof10_512: wide overflow\n");
+      exit (1);
+    }
+}
+
+static void
+gen_wide_div5 (gen_wide_t *a)
+{
+  uint64_t r = 0;
+  int i;
+
+  for (i = GEN_WIDE_LIMBS - 1; i >= 0; i--)
+    {
+      r = (r << 32) | a->w[i];
+      a->w[i] = (uint32_t) (r / 5);
+      r %= 5;
+    }
+}
+
+/* r = a >> s for s >= 0, a << -s for s < 0. The result must fit
+   gen_num_t.  */
+static void
+gen_wide_window (gen_num_t *r, const gen_wide_t *a, int s)
+{
+  gen_num_t t;
+  int i, j, sh;
+
+  if (gen_wide_bits (a) - s > GEN_LIMBS * 32)
+    {
+      fprintf (stderr, "gen_powof10_512: window overflow\n");
+      exit (1);
+    }
+  gen_set (r, 0);
+  if (s < 0)
+    {
+      for (i = 0; i < GEN_LIMBS; i++)
+	r->w[i] = a->w[i];
+      gen_pow2 (&t, -s);
+      gen_mul (r, r, &t);
+      return;
+    }
+  sh = s % 32;
+  for (i = 0; i < GEN_LIMBS; i++)
+    {
+      j = i + (s / 32);
+      if (j >= GEN_WIDE_LIMBS)
+	break;
+      r->w[i] = a->w[j] >> sh;
+      if (sh != 0 && j + 1 < GEN_WIDE_LIMBS)
+	r->w[i] |= a->w[j + 1] << (32 - sh);
+    }
+}
+
+/* 2**gen_inv_k is the dividend for all of floor (2**K / 5**n),
+   K = pow5bits (n) + 248 <= gen_inv_k.  */
+static int gen_inv_k;
+
+/* Set p to the leading 249 bits of 5**n and ri to
+   floor (2**(pow5bits (n) + 248) / 5**n), given p5 = 5**n and
+   x = floor (2**gen_inv_k / 5**n).  */
+static void
+gen_pow5_get (gen_num_t *p, gen_num_t *ri, const gen_wide_t *p5,
+	      const gen_wide_t *x, int n)
+{
+  int pb = gen_pow5bits (n);
+
+  if (n > 0 && pb != gen_wide_bits (p5))
+    {
+      fprintf (stderr, "gen_powof10_512: pow5bits (%d) is wrong\n", n);
+      exit (1);
+    }
+  gen_wide_window (p, p5, pb - GEN_POW5_BITS);
+  gen_wide_window (ri, x, gen_inv_k - (pb - 1 + GEN_POW5_BITS));
+  if (gen_bits (p) > 256 || gen_bits (ri) > 256)
+    {
+      fprintf (stderr, "gen_powof10_512: 5**%d exceeds 256 bits\n", n);
+      exit (1);
+    }
+}
+
+/* Check t <= e and e - t < 4, return e - t.  */
+static unsigned int
+gen_pow5_diff (const gen_num_t *e, const gen_num_t *t, int n)
+{
+  gen_num_t d;
+
+  if (gen_cmp (t, e) > 0)
+    goto fail;
+  gen_sub (&d, e, t);
+  if (gen_bits (&d) > 2)
+    goto fail;
+  return d.w[0];
+fail:
+  fprintf (stderr, "gen_powof10_512: no 2-bit correction for 5**%d\n", n);
+  exit (1);
+}
+
+static void
+gen_print_err (const char *name, const unsigned int *err, int n)
+{
+  int i, j;
+  uint64_t v;
+
+  printf ("/* 2-bit corrections, entry n in bits 2*(n%%32) of word n/32.  */\n");
+  printf ("const unsigned long long %s[] =\n{", name);
+  for (i = 0; i <= n / 32; i++)
+    {
+      v = 0;
+      for (j = 0; j < 32 && (i * 32 + j) <= n; j++)
+	v |= (uint64_t) err[i * 32 + j] << (2 * j);
+      printf ("%s0x%08x%08xULL%s", (i % 3 == 0) ? "\n  " : " ",
+	      (uint32_t) (v >> 32), (uint32_t) v, (i < n / 32) ? "," : "");
+    }
+  printf ("\n};\n\n");
+}
+
+static void
+gen_powof5 (void)
+{
+  static gen_wide_t p5, x;
+  static gen_num_t base[GEN_POW5_BASES], ibase[GEN_POW5_BASES];
+  static unsigned int err[GEN_POW5_MAX + 1], ierr[GEN_POW5_MAX + 1];
+  gen_num_t p, ri, m5, t;
+  int pass, n, b, off;
+
+  gen_inv_k = gen_pow5bits (GEN_POW5_MAX) - 1 + GEN_POW5_BITS;
+  for (pass = 0; pass < 2; pass++)
+    {
+      memset (&p5, 0, sizeof (p5));
+      memset (&x, 0, sizeof (x));
+      p5.w[0] = 1;
+      x.w[gen_inv_k / 32] = 1u << (gen_inv_k % 32);
+      for (n = 0; n <= GEN_POW5_MAX; n++)
+	{
+	  gen_pow5_get (&p, &ri, &p5, &x, n);
+	  off = n % GEN_POW5_STEP;
+	  if (pass == 0)
+	    {
+	      if (off == 0)
+		{
+		  base[n / GEN_POW5_STEP] = p;
+		  ibase[n / GEN_POW5_STEP] = ri;
+		}
+	    }
+	  else
+	    {
+	      err[n] = ierr[n] = 0;
+	      if (off != 0)
+		{
+		  // 5**off * 5**(56*b) >> delta, low by err[n].
+		  b = n / GEN_POW5_STEP;
+		  gen_set (&m5, 1);
+		  while (off-- > 0)
+		    gen_mul_small (&m5, &m5, 5);
+		  gen_mul (&t, &m5, &base[b]);
+		  gen_shr (&t, &t, gen_pow5bits (n)
+			   - gen_pow5bits (b * GEN_POW5_STEP));
+		  err[n] = gen_pow5_diff (&p, &t, n);
+		  // 5**off * (2**K / 5**(56*b)) >> delta, low by ierr[n].
+		  b = (n + GEN_POW5_STEP - 1) / GEN_POW5_STEP;
+		  gen_set (&m5, 1);
+		  for (off = b * GEN_POW5_STEP - n; off > 0; off--)
+		    gen_mul_small (&m5, &m5, 5);
+		  gen_mul (&t, &m5, &ibase[b]);
+		  gen_shr (&t, &t, gen_pow5bits (b * GEN_POW5_STEP)
+			   - gen_pow5bits (n));
+		  ierr[n] = gen_pow5_diff (&ri, &t, n);
+		}
+	    }
+	  gen_wide_mul5 (&p5);
+	  gen_wide_div5 (&x);
+	}
+    }
+
+  printf ("/* 5**k for k = [0-%d] as 128-bit integers.  */\n",
+	  GEN_POW5_STEP - 1);
+  printf ("const vui128_t vec128_powof5[] =\n{\n");
+  gen_set (&p, 1);
+  for (n = 0; n < GEN_POW5_STEP; n++)
+    {
+      printf ("  /* 5**%d */\n", n);
+      gen_print_elem (&p, 128, n == GEN_POW5_STEP - 1);
+      gen_mul_small (&p, &p, 5);
+    }
+  printf ("};\n\n");
+
+  printf ("/* The leading %d bits of 5**(%d*b) for b = [0-%d].  */\n",
+	  GEN_POW5_BITS, GEN_POW5_STEP, GEN_POW5_BASES - 1);
+  printf ("const __VEC_U_256 vec256_powof5[] =\n{\n");
+  for (b = 0; b < GEN_POW5_BASES; b++)
+    {
+      printf ("  /* 5**%d */\n", b * GEN_POW5_STEP);
+      gen_print_elem (&base[b], 256, b == GEN_POW5_BASES - 1);
+    }
+  printf ("};\n\n");
+
+  printf ("/* floor (2**(pow5bits (n) + %d) / 5**n) for n = %d*b,\n"
+	  "   b = [0-%d].  */\n", GEN_POW5_BITS - 1, GEN_POW5_STEP,
+	  GEN_POW5_BASES - 1);
+  printf ("const __VEC_U_256 vec256_recipof5[] =\n{\n");
+  for (b = 0; b < GEN_POW5_BASES; b++)
+    {
+      printf ("  /* 5**-%d */\n", b * GEN_POW5_STEP);
+      gen_print_elem (&ibase[b], 256, b == GEN_POW5_BASES - 1);
+    }
+  printf ("};\n\n");
+
+  gen_print_err ("vec_powof5_err", err, GEN_POW5_MAX);
+  gen_print_err ("vec_recipof5_err", ierr, GEN_POW5_MAX);
+}
+
+/* The double (Ryu d2s) tables are small enough to keep every entry:
+   the leading 125 bits of 5**n, n = [0-325], and
+   floor (2**(pow5bits (n) + 124) / 5**n) + 1, n = [0-341].  */
+#define GEN_F64_BITS 125
+#define GEN_F64_POW5_MAX 325
+#define GEN_F64_RECIP5_MAX 341
+
+static void
+gen_powof5_f64 (void)
+{
+  gen_num_t p5, t, d;
+  int n, pb;
+
+  printf ("/* The leading %d bits of 5**n for n = [0-%d].  */\n",
+	  GEN_F64_BITS, GEN_F64_POW5_MAX);
+  printf ("const vui128_t vec128_f64powof5[] =\n{\n");
+  gen_set (&p5, 1);
+  for (n = 0; n <= GEN_F64_POW5_MAX; n++)
+    {
+      pb = gen_pow5bits (n);
+      if (pb >= GEN_F64_BITS)
+	gen_shr (&t, &p5, pb - GEN_F64_BITS);
+      else
+	{
+	  gen_pow2 (&d, GEN_F64_BITS - pb);
+	  gen_mul (&t, &p5, &d);
+	}
+      if (gen_bits (&t) != GEN_F64_BITS)
+	{
+	  fprintf (stderr, "gen_powof10_512: pow5bits (%d) is wrong\n", n);
+	  exit (1);
+	}
+      printf ("  /* 5**%d */\n", n);
+      gen_print_elem (&t, 128, n == GEN_F64_POW5_MAX);
+      gen_mul_small (&p5, &p5, 5);
+    }
+  printf ("};\n\n");
+
+  printf ("/* floor (2**(pow5bits (n) + %d) / 5**n) + 1 for n = [0-%d].  */\n",
+	  GEN_F64_BITS - 1, GEN_F64_RECIP5_MAX);
+  printf ("const vui128_t vec128_f64recipof5[] =\n{\n");
+  gen_set (&p5, 1);
+  for (n = 0; n <= GEN_F64_RECIP5_MAX; n++)
+    {
+      // floor (a / d) + 1 == ceil ((a + 1) / d).
+      gen_pow2 (&d, gen_pow5bits (n) + GEN_F64_BITS - 1);
+      gen_add_small (&d, 1);
+      gen_div_ceil (&t, &d, &p5);
+      if (gen_bits (&t) > 128)
+	{
+	  fprintf (stderr, "gen_powof10_512: 5**-%d exceeds 128 bits\n", n);
+	  exit (1);
+	}
+      printf ("  /* 5**-%d */\n", n);
+      gen_print_elem (&t, 128, n == GEN_F64_RECIP5_MAX);
+      gen_mul_small (&p5, &p5, 5);
+    }
+  printf ("};\n");
+}
+
+/* Decode the DPD declet pqr stu v wxy (bits 9-0) to 0-999, following
+   IEEE 754-2008 Table 3.3. The 24 non-canonical declets decode as
+   the standard requires.  */
+static unsigned int
+gen_dpd_decode (unsigned int b)
+{
+  unsigned int p = (b >> 9) & 1, q = (b >> 8) & 1, r = (b >> 7) & 1;
+  unsigned int st = (b >> 5) & 3, u = (b >> 4) & 1, v = (b >> 3) & 1;
+  unsigned int wx = (b >> 1) & 3, y = b & 1;
+  unsigned int pqr = b >> 7, stu = (b >> 4) & 7, wxy = b & 7;
+  unsigned int d2, d1, d0;
+
+  if (v == 0)
+    {
+      d2 = pqr;
+      d1 = stu;
+      d0 = wxy;
+    }
+  else if (wx == 0)
+    {
+      d2 = pqr;
+      d1 = stu;
+      d0 = 8 + y;
+    }
+  else if (wx == 1)
+    {
+      d2 = pqr;
+      d1 = 8 + u;
+      d0 = (st << 1) | y;
+    }
+  else if (wx == 2)
+    {
+      d2 = 8 + r;
+      d1 = stu;
+      d0 = (p << 2) | (q << 1) | y;
+    }
+  else if (st == 0)
+    {
+      d2 = 8 + r;
+      d1 = 8 + u;
+      d0 = (p << 2) | (q << 1) | y;
+    }
+  else if (st == 1)
+    {
+      d2 = 8 + r;
+      d1 = (p << 2) | (q << 1) | u;
+      d0 = 8 + y;
+    }
+  else if (st == 2)
+    {
+      d2 = pqr;
+      d1 = 8 + u;
+      d0 = 8 + y;
+    }
+  else
+    {
+      d2 = 8 + r;
+      d1 = 8 + u;
+      d0 = 8 + y;
+    }
+  return (d2 * 100) + (d1 * 10) + d0;
+}
+
+/* Encode 0-999 as the canonical DPD declet.  */
+static unsigned int
+gen_dpd_encode (unsigned int n)
+{
+  unsigned int d2 = n / 100, d1 = (n / 10) % 10, d0 = n % 10;
+  unsigned int aei = ((d2 >> 3) << 2) | ((d1 >> 3) << 1) | (d0 >> 3);
+  unsigned int b = d2 & 7, f = d1 & 7, j = d0 & 7;
+  unsigned int m = d0 & 1, d = d2 & 1, h = d1 & 1;
+
+  // b, f and j are the low 3 bits, d, h and m the low bit of each
+  // digit (Table 3.4).
+  switch (aei)
+    {
+    case 0:
+      return (b << 7) | (f << 4) | j;
+    case 1:
+      return (b << 7) | (f << 4) | 0x8 | m;
+    case 2:
+      return (b << 7) | ((j >> 1) << 5) | (h << 4) | 0xa | m;
+    case 3:
+      return (b << 7) | (0x2 << 5) | (h << 4) | 0xe | m;
+    case 4:
+      return ((j >> 1) << 8) | (d << 7) | (f << 4) | 0xc | m;
+    case 5:
+      return ((f >> 1) << 8) | (d << 7) | (0x1 << 5) | (h << 4) | 0xe | m;
+    case 6:
+      return ((j >> 1) << 8) | (d << 7) | (h << 4) | 0xe | m;
+    default:
+      return (d << 7) | (0x3 << 5) | (h << 4) | 0xe | m;
+    }
+}
+
+static void
+gen_dpd (void)
+{
+  unsigned int n;
+
+  for (n = 0; n < 1000; n++)
+    if (gen_dpd_decode (gen_dpd_encode (n)) != n)
+      {
+	fprintf (stderr, "gen_powof10_512: DPD encode of %u is wrong\n", n);
+	exit (1);
+      }
+
+  printf ("/* DPD declet to binary 0-999.  */\n");
+  printf ("const unsigned short vec_dpd2bin[] =\n{");
+  for (n = 0; n < 1024; n++)
+    printf ("%s%u%s", (n % 16 == 0) ? "\n  " : " ", gen_dpd_decode (n),
+	    (n < 1023) ? "," : "");
+  printf ("\n};\n\n");
+
+  printf ("/* Binary 0-999 to canonical DPD declet.  */\n");
+  printf ("const unsigned short vec_bin2dpd[] =\n{");
+  for (n = 0; n < 1000; n++)
+    printf ("%s0x%03x%s", (n % 12 == 0) ? "\n  " : " ", gen_dpd_encode (n),
+	    (n < 999) ? "," : "");
+  printf ("\n};\n");
+}
+
+int
+main (void)
+{
+  printf ("/* Generated by gen_powof10_512.c, do not edit.  */\n\n");
+  printf ("#include <pveclib/vec_int512_ppc.h>\n\n");
+
+  gen_powof10 (256, 77);
+  gen_powof10 (512, 154);
+  gen_recipof10 (128, 38);
+  gen_recipof10 (256, 77);
+  gen_recipof10 (512, 154);
+  gen_recipof10_sh (154);
+  printf ("\n");
+  gen_powof5 ();
+  gen_powof5_f64 ();
+  printf ("\n");
+  gen_dpd ();
+
+  return 0;
+}
@@ -33,6 +33,7 @@
 #include <pveclib/vec_common_ppc.h>
 #include <pveclib/vec_char_ppc.h>
 #include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_f128_ppc.h>
 
 /*!
  * \file  vec_bcd_ppc.h
@@ -585,6 +586,8 @@ vec_cbcdaddcsq (vBCD_t *cout, vBCD_t a, vBCD_t b)
  * The net seems to be that for BCD multiple precision difference to
  * work correctly, the larger magnitude must be the first
  * operand.
+ * The N quadword operations (\ref bcd128_extended_0_2_4) do this by
+ * comparing the magnitudes before the difference.
  *
  * \subsubsection bcd128_muldiv_0_2_1 Vector BCD Multiply/Divide Quadword example
  *
@@ -1544,6 +1547,199 @@ example_longbcdct_10e32 (vui128_t *d, vBCD_t decimal,
  * - Return the updated quadword count. Passed back as current
  * quadword count on the next iteration.
  *
+ * \subsubsection bcd128_extended_0_2_4 Multiple quadword signed BCD arithmetic
+ *
+ * For 62, 93, 124 or more digits, pveclib provides out-of-line
+ * operations over arrays of N signed 31 digit BCD quadwords.
+ * Element 0 holds the high order 31 digits and element N-1 the low
+ * order 31 digits. All elements carry the sign of the number. For
+ * example -1234567890123456789012345678901234567890 as a 2 quadword
+ * (62 digit) value is:
+ * \code
+  vBCD_t x[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0, 0, 0x00000012, 0x3456789d),
+      (vBCD_t) CONST_VINT128_W (0x01234567, 0x89012345, 0x67890123,
+				0x4567890d)
+    };
+ * \endcode
+ * The results are written with the preferred sign codes (0xC/0xD)
+ * and zero is always positive. The input signs are taken from the
+ * nonzero elements, so elements that are zero may have either sign.
+ *
+ * The sum and difference look at the signs first. If the effective
+ * signs match the magnitudes are summed in a single carry chain. If
+ * not, the smaller magnitude is subtracted from the larger, so
+ * the borrow correction of vec_cbcdaddecsq() is always applied
+ * against the larger first operand. In both cases the carries stay
+ * in vector registers from one quadword to the next.
+ *
+ * The product is a schoolbook multiply of 31 digit blocks. Each block
+ * product is 62 digits (the high and low 31 digits) and is summed
+ * into the product array with carries. POWER8 and later
+ * form the block products through the binary quadword
+ * multiply (as vec_bcdmul_rdx()/vec_bcdmulh_rdx()), POWER7 uses
+ * vec_cbcdmul().
+ *
+ * The shifts move digits across element boundaries, as
+ * vec_bcdslqi() and vec_bcdsrrqi() do within a quadword. The right
+ * shift and round adds one to the magnitude if the last digit
+ * shifted out is 5 or more.
+ *
+ * These operations are in libpvec.so (selected by IFUNC) and in
+ * libpvecstatic.a (platform suffixed).
+ *
+ * \subsubsection bcd128_records_0_2_5 Packed and zoned decimal records
+ *
+ * Records from mainframe files are fixed layouts of character,
+ * binary, packed decimal (COMP-3) and zoned decimal fields. The
+ * decimal fields are at any byte offset, so vec_bcdrec_decode() loads
+ * the aligned quadwords holding the first and last byte of each field
+ * (these never touch a page outside the field) and uses vec_perm to
+ * right justify the field bytes as a quadword. A packed field is then
+ * already a signed BCD value. Zoned fields go through vec_bcdcfz(),
+ * with the high digits of fields over 16 bytes merged from a second
+ * load.
+ *
+ * From signed BCD the columns use vec_bcdctsq() for long long and
+ * vi128_t and vec_BCD2DFP() for _Decimal128. vec_bcdrec_encode()
+ * reverses this with vec_bcdcfsq(), vec_DFP2BCD() and vec_bcdctz().
+ * A schema describes the fields, for example:
+ * \code
+  // 01 ACCT.
+  //    05 ID      PIC S9(9)   COMP-3.   offset 0, 5 bytes
+  //    05 NAME    PIC X(20).
+  //    05 BALANCE PIC S9(13)V99.        offset 25, 15 bytes
+  vec_bcdrec_field_t schema[2] =
+    {
+      { 0, 5, VEC_BCDREC_PACKED, VEC_BCDREC_INT64, 0, id },
+      { 25, 15, VEC_BCDREC_ZONED, VEC_BCDREC_DEC128, 2, balance }
+    };
+
+  bad = vec_bcdrec_decode (buf, 40, nrec, schema, 2);
+ * \endcode
+ * The conversion runs a column at a time, so the field and column
+ * types are fixed for the inner loop.
+ *
+ * \subsubsection bcd128_dfpconv_0_2_6 Binary to/from _Decimal128 conversions
+ *
+ * The C casts between binary types and _Decimal128 call the libgcc
+ * (or libdfp) soft conversions, which go through decimal strings or
+ * long multiprecision loops. PVECLIB already has both halves of a
+ * faster bridge: vec_bcdcfsq()/vec_bcdctsq() between __int128 and
+ * BCD, and vec_BCD2DFP()/vec_DFP2BCD() between BCD and DPD.
+ *
+ * The quadword integer conversions vec_dfp128_cfsq(),
+ * vec_dfp128_cfuq(), vec_dfp128_ctsqz() and vec_dfp128_ctuqz() are
+ * inline. An __int128 has up to 39 digits, so it is converted as the
+ * high digits and low 31 digits and summed by one DFP add. That add
+ * is the only rounding, in the current DFP rounding mode. POWER10
+ * has the dcffixqq and dctfixqq instructions for these.
+ *
+ * The floating point conversions vec_dfp128_cff64(),
+ * vec_dfp128_cff128(), vec_dfp128_ctf64() and vec_dfp128_ctf128()
+ * are out of line. Binary m * 2**e with m < 2**112 and |e| <= 112
+ * multiplies or divides by the exact decpowof2[] entry, again one
+ * rounding. Other values build the exact decimal integer with the
+ * N quadword operations (vec_mul10k_byN(), vec_div10k_byN()), then
+ * round once to 34 digits. _Decimal128 to double uses the exact
+ * double powers of ten (Clinger's fast path) when the coefficient
+ * has 53 bits or less and the exponent is at most 22. Other values
+ * take the leading bits of the exact quotient or product and round
+ * to nearest even, including subnormal results.
+ *
+ * The array forms (vec_dfp128_cfsq_array(), ...) run the conversion
+ * over n elements.
+ *
+ * \subsubsection bcd128_rescale_0_2_7 Decimal rescale with rounding mode
+ *
+ * Fixed-point currency columns are often rescaled, for example from
+ * mills to cents, and the rounding rule is set by the application
+ * (banker's rounding, round half up, or round toward zero).
+ * The BCD shift and round operations only round half up.
+ *
+ * The rounding modes of vec_round_t apply to each representation:
+ * - vec_bcdsr_rnd() shifts a signed BCD value right k digits.
+ * - vec_div10k_rnd_sq() divides a signed __int128 by 10**k.
+ * - vec_dfp128_quantize() rounds a _Decimal128 to a fixed number of
+ * fraction digits.
+ *
+ * The array forms vec_bcdrescale_array(), vec_rescalesq_array() and
+ * vec_dfp128_rescale_array() also scale up, and report the elements
+ * that overflow in a byte array and the returned count. This keeps
+ * the inner loop free of error handling, the caller checks the
+ * count once per column.
+ *
+ * \subsubsection bcd128_f128str_0_2_8 Binary128 to/from decimal strings
+ *
+ * quadmath_snprintf() and strtoflt128() work through long
+ * multiprecision loops for every value. vec_f128_ctstr() and
+ * vec_f128_cfstr() use the quadword integer and BCD operations
+ * instead.
+ *
+ * vec_f128_ctstr() is Ryu (Ulf Adams, "Ryu: fast float-to-string
+ * conversion") for the 113-bit significand. It writes the shortest
+ * digit string that converts back to the same value, in the
+ * "%.*e" format ("1.5e+00", "-6e-4966", "inf", "nan"). Where more
+ * than one shortest string converts back it is the one closest to
+ * the value, which is the same digits as quadmath_snprintf() with
+ * "%.*Qe" at that precision, except for some powers of 2 where
+ * the closest digits do not convert back. The 249-bit powers of 5 are
+ * rebuilt from every 56th power (vec256_powof5[],
+ * vec256_recipof5[]) with vec_mul128x128() and a 2-bit correction
+ * table, all generated at build time. The digits are converted by
+ * vec_divuq_10e32(), vec_bcdcfuq() and vec_bcdctz().
+ *
+ * vec_f128_cfstr() accepts the strtod() decimal syntax (no
+ * hexadecimal) and rounds to nearest even. Following Eisel and
+ * Lemire, the leading 38 digits times the 249-bit power of 5 place
+ * the value in a small interval. When both ends of the interval
+ * round to the same binary128, which is nearly always, that is the
+ * result. Otherwise the value is rounded from the exact N quadword
+ * integer, as for vec_dfp128_ctf128().
+ *
+ * vec_f64_ctstr() and vec_f32_ctstr() are the same Ryu algorithm
+ * for double and float, in the same format. The 125-bit powers of 5
+ * fit a full table (vec128_f64powof5[], vec128_f64recipof5[]), and
+ * the products are 64 x 128-bit, so the _array forms take the
+ * values in pairs, one per doubleword lane. vec_vmuleud() and
+ * vec_vmuloud() compute the products for both lanes and one
+ * vec_bcdcfud() converts both sets of digits. Only the loop that
+ * drops the unneeded digits runs per value. The
+ * vec_f64_ctstr_array() output, with ',' as the separator, is a
+ * JSON array body (except for inf and nan).
+ *
+ * \subsubsection bcd128_dfpbatch_0_2_9 Decimal batch sum, dot product and scale
+ *
+ * SQL DECIMAL columns stored as _Decimal128 or _Decimal64 are summed
+ * and multiplied element by element. A loop of DFP adds rounds every
+ * partial sum and waits on the DFP unit, which does not pipeline.
+ * vec_dfp128_sum_array(), vec_dfp128_dot_array() and the _Decimal64
+ * forms accumulate exactly instead, and round once to the
+ * _Decimal128 result.
+ *
+ * For POWER8 and later the DPD coefficients are decoded in software
+ * (vec_dpd2bin[]) and the terms added to the exact sums of the
+ * positive and negative terms, N quadword integers scaled to the
+ * smallest exponent seen. Terms of the same exponent, as in a column
+ * of fixed scale, are just quadword adds. The result is converted
+ * by the N quadword to _Decimal128 conversion of
+ * vec_dfp128_cff128(). It is the exact sum correctly rounded in the
+ * current DFP rounding mode, with the exponent of the exact sum
+ * (the smallest exponent) when that fits 34 digits.
+ *
+ * vec_dfp128_scale_array() and vec_dfp64_scale_array() multiply by
+ * a scalar. When the product fits the coefficient it is exact, and
+ * is encoded in software (vec_bin2dpd[]). Other elements use the DFP
+ * multiply, so the results are the same as the DFP multiply in all
+ * cases.
+ *
+ * POWER7 lacks the doubleword multiply and uses the DFP add and
+ * multiply for each element, as do the binary path for infinity,
+ * NaN, or exponents too far apart for the exact sums (about 1200
+ * digits). The DFP loop rounds each step, so its result can differ
+ * from the exact sum when a partial sum needs more than 34 digits.
+ *
  * \section bcd128_perf_0_0 Performance data.
  * High level performance estimates are provided as an aid to function
  * selection when evaluating algorithms. For background on how
@@ -2097,6 +2293,43 @@ vec_bcdcfuq (vui128_t vra)
 #endif
 }
 
+/** \brief Vector Decimal Convert From Unsigned Quadword
+ *  without the DFP unit.
+ *
+ *  Same result as vec_bcdcfuq(), but the doubleword to BCD stage uses
+ *  the vec_rdxcf10E16d(), vec_rdxcf100mw(), vec_rdxcf10kh() and
+ *  vec_rdxcf100b() kernels instead of the DFP conversion.
+ *  Everything stays in the vector unit and pipelines on processors
+ *  where the DFP unit does not.
+ *
+ *  \note If the value of vra is greater than 10**32-1 the result is
+ *  too large for the unsigned BCD format and the result is undefined.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |125-140| 1/cycle  |
+ *  |power9   | 90-105| 1/cycle  |
+ *
+ *  @param vra a 128-bit vector as an unsigned __int128
+ *  number in the range 0-99999999999999999999999999999999.
+ *  @return 128-bit vector unsigned BCD value in
+ *  the range 0-99999999999999999999999999999999.
+ */
+static inline vBCD_t
+vec_bcdcfuq_rdx (vui128_t vra)
+{
+  vui8_t d100;
+  vui16_t d10k;
+  vui32_t d100m;
+  vui64_t d10e;
+
+  d10e = vec_rdxcf10e32q (vra);
+  d100m = vec_rdxcf10E16d (d10e);
+  d10k = vec_rdxcf100mw (d100m);
+  d100 = vec_rdxcf10kh (d10k);
+  return (vBCD_t) vec_rdxcf100b (d100);
+}
+
 /** \brief Vector Decimal Convert From Zoned.
  *
  * Given a Signed 16-digit signed Zoned value vrb,
@@ -2777,6 +3010,44 @@ vec_bcdctuq (vBCD_t vra)
   return vrt;
 }
 
+/** \brief Vector Decimal Convert groups of 32 BCD digits
+ *  to binary unsigned quadword without the DFP unit.
+ *
+ *  Same result as vec_bcdctuq(). Before POWER9 vec_bcdctuq() converts
+ *  the doubleword halves with the DFP unit. This version always uses
+ *  the vec_rdxct100b(), vec_rdxct10kh(), vec_rdxct100mw() and
+ *  vec_rdxct10E16d() kernels. POWER9 uses vec_bcdctuq(), which is
+ *  already based on the vector BCD instructions.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 60-75 | 1/cycle  |
+ *  |power9   | 28-37 |1/12 cycle|
+ *
+ *  @param vra a 128-bit vector treated as an unsigned 32-digit BCD
+ *  number.
+ *  @return 128-bit vector unsigned __int128 in
+ *  the range 0-99999999999999999999999999999999.
+ */
+static inline vui128_t
+vec_bcdctuq_rdx (vBCD_t vra)
+{
+#ifdef  _ARCH_PWR9
+  return vec_bcdctuq (vra);
+#else
+  vui8_t d100;
+  vui16_t d10k;
+  vui32_t d100m;
+  vui64_t d10e;
+
+  d100 = vec_rdxct100b ((vui8_t) vra);
+  d10k = vec_rdxct10kh (d100);
+  d100m = vec_rdxct100mw (d10k);
+  d10e = vec_rdxct10E16d (d100m);
+  return vec_rdxct10e32q (d10e);
+#endif
+}
+
 /** \brief Vector Decimal Convert To Zoned.
  *
  * Given a Signed 16-digit signed BCD value vrb,
@@ -2852,6 +3123,98 @@ vec_bcdctz (vBCD_t vrb)
   return (vrt);
 }
 
+///@cond INTERNAL
+/* Signed 31-digit BCD result of the binary (_rdx) multiply and divide.
+   vra is the magnitude (< 10**31) and the sign is the sign of a * b.
+   A zero magnitude returns +0, like the DFP implementations.  */
+static inline vBCD_t
+vec_bcdsgnuq_rdx (vui128_t vra, vBCD_t a, vBCD_t b)
+{
+  const vui128_t zero = (vui128_t) vec_splats ((int) 0);
+  vb128_t negbool;
+
+  negbool = (vb128_t) vec_xor ((vui32_t) vec_setbool_bcdsq (a),
+			       (vui32_t) vec_setbool_bcdsq (b));
+#ifdef _ARCH_PWR9
+  // bcdcfsq converts a signed zero to +0
+  vra = (vui128_t) vec_sel ((vui32_t) vra,
+			    (vui32_t) vec_subuqm (zero, vra),
+			    (vb32_t) negbool);
+  return vec_bcdcfsq ((vi128_t) vra);
+#else
+  vBCD_t t, bcdsign;
+
+  negbool = (vb128_t) vec_andc ((vui32_t) negbool,
+				(vui32_t) vec_cmpequq (vra, zero));
+  bcdsign = (vBCD_t) vec_sel ((vui32_t) _BCD_CONST_PLUS_ONE,
+			      (vui32_t) _BCD_CONST_MINUS_ONE,
+			      (vb32_t) negbool);
+  t = (vBCD_t) vec_slqi ((vui128_t) vec_bcdcfuq_rdx (vra), 4);
+  return vec_bcdcpsgn (t, bcdsign);
+#endif
+}
+
+/* Quotient of the 256-bit dividend (vra||vrb) / vrc and the remainder
+   in *r. Requires vra < vrc, so the quotient fits in a quadword.
+   Restoring shift and subtract, one quotient bit per iteration.
+   The dividend is first shifted left so that vra holds its top
+   (bits(vrc) - 1) bits, which skips the quotient bits that must be
+   zero. Used before POWER10, which has vdivuq.  */
+static inline vui128_t
+vec_bcddivduq_rdx (vui128_t *r, vui128_t vra, vui128_t vrb, vui128_t vrc)
+{
+  const vui128_t zero = (vui128_t) vec_splats ((int) 0);
+  const vui32_t one = CONST_VINT128_W (0, 0, 0, 1);
+  __VEC_U_128 cza, czb, czc;
+  vui128_t q, sh;
+  vb128_t c, ge;
+  long n;
+
+  cza.vx1 = vec_clzq (vra);
+  czb.vx1 = vec_clzq (vrb);
+  czc.vx1 = vec_clzq (vrc);
+  // Significant bits of the dividend less those of the divisor
+  if (vec_cmpuq_all_ne (vra, zero))
+    n = (128 - (long) cza.ulong.lower) + (long) czc.ulong.lower + 1;
+  else
+    n = (long) czc.ulong.lower - (long) czb.ulong.lower + 1;
+
+  if (n <= 0)
+    {
+      // Then vra is 0 and vrb < vrc
+      *r = vrb;
+      return zero;
+    }
+  if (n < 128)
+    {
+      // vec_sldq needs a shift count 1-127
+      sh = (vui128_t) vec_splats ((unsigned char) (128 - n));
+      vra = vec_sldq (vra, vrb, sh);
+      vrb = vec_slq (vrb, sh);
+    }
+  else
+    n = 128;
+
+  q = zero;
+  for (; n > 0; n--)
+    {
+      // Shift the next dividend bit into the partial remainder.
+      // A carry out of vra means the remainder is >= vrc.
+      c = vec_setb_sq ((vi128_t) vra);
+      vra = vec_sldqi (vra, vrb, 1);
+      vrb = vec_slqi (vrb, 1);
+      q = vec_slqi (q, 1);
+      ge = (vb128_t) vec_or ((vui32_t) c, (vui32_t) vec_cmpgeuq (vra, vrc));
+      vra = (vui128_t) vec_sel ((vui32_t) vra,
+				(vui32_t) vec_subuqm (vra, vrc),
+				(vb32_t) ge);
+      q = (vui128_t) vec_or ((vui32_t) q, vec_and ((vui32_t) ge, one));
+    }
+  *r = vra;
+  return q;
+}
+///@endcond
+
 /** \brief Divide a Vector Signed BCD 31 digit value by another BCD value.
  *
  * One Signed 31 digit value is divided by a second 31 digit value
@@ -2878,13 +3241,57 @@ vec_bcddiv (vBCD_t a, vBCD_t b)
   return (t);
 }
 
+/** \brief Divide a Vector Signed BCD 31 digit value by another BCD
+ *  value without the DFP unit.
+ *
+ * Same result as vec_bcddiv(). The magnitudes are converted to binary
+ * with vec_bcdctuq_rdx() and divided as unsigned __int128. POWER10
+ * uses the Vector Divide Unsigned Quadword instruction. Older
+ * processors use a shift and subtract loop with one iteration per
+ * possible quotient bit, so this is only faster than vec_bcddiv() on
+ * POWER10. The quotient is converted back with vec_bcdcfuq_rdx() (or
+ * bcdcfsq on POWER9 and later).
+ *
+ * |processor|Latency|Throughput|
+ * |--------:|:-----:|:---------|
+ * |power8   |250-1600| 1/cycle |
+ * |power9   |180-1400| 1/cycle |
+ *
+ * @param a a 128-bit vector treated as a signed BCD 31 digit value.
+ * @param b a 128-bit vector treated as a signed BCD 31 digit value.
+ * @return a 128-bit vector which is the lower 31 digits of (a / b).
+ */
+static inline vBCD_t
+vec_bcddiv_rdx (vBCD_t a, vBCD_t b)
+{
+  vui128_t ua, ub, q;
+
+  ua = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) a, 4));
+  ub = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) b, 4));
+#if defined (_ARCH_PWR10)  && (__GNUC__ >= 10)
+  __asm__(
+      "vdivuq %0,%1,%2;\n"
+      : "=v" (q)
+      : "v" (ua), "v" (ub)
+      : );
+#else
+  {
+    const vui128_t zero = (vui128_t) vec_splats ((int) 0);
+    vui128_t r;
+    q = vec_bcddivduq_rdx (&r, zero, ua, ub);
+  }
+#endif
+  return vec_bcdsgnuq_rdx (q, a, b);
+}
+
 /** \brief Decimal Divide Extended.
  *
  * The dividend <I>a</I> is a Signed BCD 31 digit value extended to
- * right internally with 31 decimal 0s.
+ * right internally with 32 decimal 0s (multiplied by 10**32).
  * The divisor <I>b</I> is Signed BCD 31 digit value.
- * The quotient of <I>a || 0<SUP>31</SUP></I> / <I>b</I> is truncated
- * to a Decimal integer and returned in Signed BCD format.
+ * The quotient of <I>a || 0<SUP>32</SUP></I> / <I>b</I> is truncated
+ * to a Decimal integer and the low order 31 digits are returned in
+ * Signed BCD format.
  *
  * |processor|Latency|Throughput|
  * |--------:|:-----:|:---------|
@@ -2910,6 +3317,73 @@ vec_bcddive (vBCD_t a, vBCD_t b)
   return (t);
 }
 
+/** \brief Decimal Divide Extended without the DFP unit.
+ *
+ * Same result as vec_bcddive(). The magnitude of <I>a</I> is
+ * converted to binary and multiplied by 10**32 (vec_cmul10k_cuq())
+ * giving a 256-bit dividend, which is divided by the binary
+ * magnitude of <I>b</I>. The truncated quotient is reduced modulo
+ * 10**31 (the low order 31 digits) before conversion to BCD.
+ *
+ * On POWER10 the division is done as decimal long division, 7 digits
+ * per step (4 in the last), each step a Vector Divide Unsigned
+ * Quadword. Older processors use a shift and subtract loop over the
+ * 256-bit dividend (see vec_bcddiv_rdx()).
+ *
+ * \note The binary quotient must be less than 2**128
+ * (|a| * 10**32 / |b| < 2**128). Otherwise the result is undefined.
+ *
+ * |processor|Latency|Throughput|
+ * |--------:|:-----:|:---------|
+ * |power8   |800-1600| 1/cycle |
+ * |power9   |700-1400| 1/cycle |
+ *
+ * @param a a 128-bit vector treated as the high 31-digits of a
+ * 62-digit value extended with 0's.
+ * @param b a 128-bit vector treated as a signed BCD 31 digit value.
+ * @return a 128-bit vector quotient of (a / b).
+ */
+static inline vBCD_t
+vec_bcddive_rdx (vBCD_t a, vBCD_t b)
+{
+  vui128_t ua, ub, q;
+
+  ua = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) a, 4));
+  ub = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) b, 4));
+#if defined (_ARCH_PWR10)  && (__GNUC__ >= 10)
+  {
+    // ub < 10**31 < 2**104, so r * 10**7 fits in a quadword
+    const unsigned int steps[5] = { 7, 7, 7, 7, 4 };
+    vui128_t r, t, qi;
+    int i;
+
+    q = (vui128_t) vec_splats ((int) 0);
+    r = ua;
+    for (i = 0; i < 5; i++)
+      {
+	t = vec_mul10k_uq (r, steps[i]);
+	__asm__(
+	    "vdivuq %0,%2,%3;\n"
+	    "vmoduq %1,%2,%3;\n"
+	    : "=&v" (qi), "=v" (r)
+	    : "v" (t), "v" (ub)
+	    : );
+	q = vec_adduqm (vec_mul10k_uq (q, steps[i]), qi);
+      }
+  }
+#else
+  {
+    vui128_t ph, pl, r;
+
+    pl = vec_cmul10k_cuq (&ph, ua, 32);
+    q = vec_bcddivduq_rdx (&r, ph, pl, ub);
+  }
+#endif
+  // Keep the low order 31 digits, as the DFP conversion does.
+  q = vec_moduq_10e31 (q, vec_divuq_10e31 (q));
+  return vec_bcdsgnuq_rdx (q, a, b);
+}
+
 /** \brief Multiply two Vector Signed BCD 31 digit values.
  *
  * Two Signed 31 digit values are multiplied and the lower 31 digits
@@ -2995,6 +3469,42 @@ vec_bcdmul (vBCD_t a, vBCD_t b)
   return (t);
 }
 
+/** \brief Multiply two Vector Signed BCD 31 digit values without the
+ *  DFP unit.
+ *
+ * Same result as vec_bcdmul(). Instead of splitting the operands
+ * into DFP sized halves, convert the 31-digit magnitudes to binary
+ * (vec_bcdctuq_rdx()) and form the full 256-bit product with
+ * vec_muludq(). The product is less than 10**62, so one
+ * vec_divudq_10e31() / vec_modudq_10e31() step splits it into
+ * the high and low 31 digits. The low digits are converted back
+ * with vec_bcdcfuq_rdx() (or bcdcfsq on POWER9 and later).
+ *
+ * All of this is vector integer code. It has longer latency than
+ * vec_bcdmul() but pipelines, where the DFP multiply does not.
+ *
+ * |processor|Latency|Throughput|
+ * |--------:|:-----:|:---------|
+ * |power8   |230-300| 1/cycle  |
+ * |power9   |140-200| 1/cycle  |
+ *
+ * @param a a 128-bit vector treated as a signed BCD 31 digit value.
+ * @param b a 128-bit vector treated as a signed BCD 31 digit value.
+ * @return a 128-bit vector which is the lower 31 digits of (a * b).
+ */
+static inline vBCD_t
+vec_bcdmul_rdx (vBCD_t a, vBCD_t b)
+{
+  vui128_t ua, ub, ph, pl, qh, ql, r;
+
+  ua = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) a, 4));
+  ub = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) b, 4));
+  pl = vec_muludq (&ph, ua, ub);
+  ql = vec_divudq_10e31 (&qh, ph, pl);
+  r = vec_modudq_10e31 (ph, pl, &ql);
+  return vec_bcdsgnuq_rdx (r, a, b);
+}
+
 /** \brief Vector Signed BCD Multiply High.
  *
  * Two Signed 31 digit values are multiplied and the higher 31 digits
@@ -3080,6 +3590,35 @@ vec_bcdmulh (vBCD_t a, vBCD_t b)
   return (t);
 }
 
+/** \brief Vector Signed BCD Multiply High without the DFP unit.
+ *
+ * Same result as vec_bcdmulh(). As for vec_bcdmul_rdx(), but return
+ * the quotient of the 256-bit binary product by 10**31, which is
+ * the high 31 digits. vec_modudq_10e31() corrects the quotient
+ * estimate from vec_divudq_10e31().
+ *
+ * |processor|Latency|Throughput|
+ * |--------:|:-----:|:---------|
+ * |power8   |230-300| 1/cycle  |
+ * |power9   |140-200| 1/cycle  |
+ *
+ * @param a a 128-bit vector treated as a signed BCD 31 digit value.
+ * @param b a 128-bit vector treated as a signed BCD 31 digit value.
+ * @return a 128-bit vector which is the higher 31 digits of (a * b).
+ */
+static inline vBCD_t
+vec_bcdmulh_rdx (vBCD_t a, vBCD_t b)
+{
+  vui128_t ua, ub, ph, pl, qh, ql;
+
+  ua = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) a, 4));
+  ub = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) b, 4));
+  pl = vec_muludq (&ph, ua, ub);
+  ql = vec_divudq_10e31 (&qh, ph, pl);
+  vec_modudq_10e31 (ph, pl, &ql);
+  return vec_bcdsgnuq_rdx (ql, a, b);
+}
+
 /** \brief Decimal Shift.
  * Shift a vector signed BCD value, left or right a variable
  * amount of digits (nibbles). The sign nibble is preserved.
@@ -3318,6 +3857,96 @@ vec_bcdsr (vBCD_t vra, vi8_t vrb)
   return (vrt);
 }
 
+/** \brief Vector BCD Shift Right and Round Signed Quadword, with
+ *  rounding mode.
+ *
+ * Shift a vector signed BCD value right k digits, rounded as
+ * specified by rnd. This is vra / 10**k, the BCD form of
+ * vec_div10k_rnd_sq(). The sign nibble is preserved.
+ *
+ * The last digit shifted out and a sticky bit (any other nonzero
+ * digit shifted out) decide the increment, then one vec_bcdadd()
+ * of +/-1 rounds the magnitude. VEC_ROUND_FLOOR and VEC_ROUND_CEIL
+ * round the magnitude up or truncate by the sign of vra. For k
+ * greater than 30 all digits are shifted out.
+ *
+ * |processor|Latency|Throughput|
+ * |--------:|:-----:|:---------|
+ * |power8   | 30-40 | 1/cycle  |
+ * |power9   | 14-20 | 1/cycle  |
+ *
+ * @param vra 128-bit vector treated as a signed BCD 31 digit value.
+ * @param k the number of digits to shift right.
+ * @param rnd the rounding mode.
+ * @return a 128-bit vector BCD value shifted right k digits and
+ * rounded.
+ */
+static inline vBCD_t
+vec_bcdsr_rnd (vBCD_t vra, unsigned int k, vec_round_t rnd)
+{
+  const vui32_t sign_mask = (vui32_t) _BCD_CONST_SIGN_MASK;
+  vui128_t t, q;
+  unsigned __int128 x;
+  unsigned int sign, rd, sticky, odd;
+  int inc;
+  vBCD_t vrt;
+
+  if (k == 0)
+    return vra;
+
+  // Clear sign nibble before shift.
+  t = (vui128_t) vec_andc ((vui32_t) vra, sign_mask);
+  x = vec_transfer_vui128t_to_uint128 ((vui128_t) vra);
+  sign = x & 0xf;
+  x = x - sign;
+  if (k < 32)
+    {
+      q = vec_srq (t, (vui128_t) vec_splats ((unsigned char) (k * 4)));
+      // The last digit shifted out, then the digits below it.
+      rd = (x >> (k * 4)) & 0xf;
+      sticky = (x << (128 - (k * 4))) != 0;
+      odd = (k < 31) ? (x >> ((k * 4) + 4)) & 1 : 0;
+      q = (vui128_t) vec_andc ((vui32_t) q, sign_mask);
+    }
+  else
+    {
+      q = (vui128_t) _BCD_CONST_ZERO;
+      rd = 0;
+      sticky = x != 0;
+      odd = 0;
+    }
+  vrt = vec_bcdcpsgn ((vBCD_t) q, vra);
+
+  if (rnd == VEC_ROUND_FLOOR)
+    rnd = (sign == 0xb || sign == 0xd) ? VEC_ROUND_UP : VEC_ROUND_TRUNC;
+  else if (rnd == VEC_ROUND_CEIL)
+    rnd = (sign == 0xb || sign == 0xd) ? VEC_ROUND_TRUNC : VEC_ROUND_UP;
+
+  switch (rnd)
+    {
+    case VEC_ROUND_UP:
+      inc = (rd != 0) || sticky;
+      break;
+    case VEC_ROUND_HALF_UP:
+      inc = rd >= 5;
+      break;
+    case VEC_ROUND_HALF_EVEN:
+      inc = (rd > 5) || ((rd == 5) && (sticky || odd));
+      break;
+    default:
+      inc = 0;
+      break;
+    }
+
+  if (inc)
+    {
+      vrt = vec_bcdadd (vrt, vec_bcdcpsgn (_BCD_CONST_PLUS_ONE, vra));
+      // bcdadd may return the preferred sign, keep the original.
+      vrt = vec_bcdcpsgn (vrt, vra);
+    }
+  return (vrt);
+}
+
 /** \brief Vector BCD Shift Right Signed Quadword Immediate
  *
  * Shift a vector signed BCD value right _N digits.
@@ -4184,6 +4813,239 @@ vec_cbcdsubcsq (vBCD_t *cout, vBCD_t a, vBCD_t b)
   return (t);
 }
 
+/** \brief Convert a signed __int128 to _Decimal128.
+ *
+ *  The __int128 may have up to 39 digits, more than the 34 digits of
+ *  the _Decimal128 coefficient. Split the value into the high digits
+ *  and the low 31 digits (vec_divsq_10e31()), convert each part via
+ *  BCD, then sum the parts. The sum is a single rounding, in the
+ *  current DFP rounding mode.
+ *  POWER10 uses the DFP Convert From Fixed Quadword Quad instruction.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |  ~200 | 1/cycle  |
+ *  |power9   |  ~90  | 1/cycle  |
+ *
+ *  @param vra a 128-bit vector treated as a signed __int128.
+ *  @return the _Decimal128 value of vra.
+ */
+static inline _Decimal128
+vec_dfp128_cfsq (vi128_t vra)
+{
+  _Decimal128 t;
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 10)
+  __asm__(
+      "dcffixqq %0,%1;\n"
+      : "=d" (t)
+      : "v" (vra)
+      : );
+#else
+  vi128_t q, r;
+  _Decimal128 d_h, d_l;
+  q = vec_divsq_10e31 (vra);
+  r = vec_modsq_10e31 (vra, q);
+  // q and r have the same sign so the sum is the only rounding.
+  d_h = vec_BCD2DFP (vec_bcdcfsq (q));
+  d_h = __builtin_diexq (6176 + 31, d_h);
+  d_l = vec_BCD2DFP (vec_bcdcfsq (r));
+  t = d_h + d_l;
+#endif
+  return (t);
+}
+
+/** \brief Convert an unsigned __int128 to _Decimal128.
+ *
+ *  As vec_dfp128_cfsq() for the unsigned range. The result is
+ *  rounded to 34 digits in the current DFP rounding mode.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |  ~200 | 1/cycle  |
+ *  |power9   |  ~90  | 1/cycle  |
+ *
+ *  @param vra a 128-bit vector treated as an unsigned __int128.
+ *  @return the _Decimal128 value of vra.
+ */
+static inline _Decimal128
+vec_dfp128_cfuq (vui128_t vra)
+{
+  vui128_t q, r;
+  _Decimal128 d_h, d_l;
+  q = vec_divuq_10e31 (vra);
+  r = vec_moduq_10e31 (vra, q);
+  d_h = vec_BCD2DFP (vec_bcdcfsq ((vi128_t) q));
+  d_h = __builtin_diexq (6176 + 31, d_h);
+  d_l = vec_BCD2DFP (vec_bcdcfsq ((vi128_t) r));
+  return (d_h + d_l);
+}
+
+/** \brief Convert a _Decimal128 to signed __int128, truncating any
+ *  fraction digits.
+ *
+ *  Fraction digits are truncated (vec_quantize0_Decimal128()), then
+ *  the 34 digit coefficient is converted via BCD as the high 3 and
+ *  low 31 digits. A positive exponent is applied as a multiply by
+ *  vtipowof10[].
+ *  POWER10 uses the DFP Convert To Fixed Quadword Quad instruction.
+ *
+ *  \note The result is undefined for infinity, NaN and values
+ *  outside the __int128 range.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |  ~180 | 1/cycle  |
+ *  |power9   |  ~80  | 1/cycle  |
+ *
+ *  @param val a _Decimal128 value.
+ *  @return the integer part of val as a signed __int128.
+ */
+static inline vi128_t
+vec_dfp128_ctsqz (_Decimal128 val)
+{
+  vi128_t result;
+  long long e;
+
+  e = __builtin_dxexq (val) - 6176;
+  if (e < 0)
+    val = vec_quantize0_Decimal128 (val);
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 10)
+  __asm__(
+      "dctfixqq %0,%1;\n"
+      : "=v" (result)
+      : "d" (val)
+      : );
+#else
+  vi128_t x_h, x_l;
+  x_h = vec_bcdctsq (vec_DFP2BCD (__builtin_dscriq (val, 31)));
+  x_l = vec_bcdctsq (vec_DFP2BCD (val));
+  result = (vi128_t) vec_mulluq ((vui128_t) x_h, vtipowof10[31]);
+  result = (vi128_t) vec_adduqm ((vui128_t) result, (vui128_t) x_l);
+  if (e > 0 && e <= 38)
+    result = (vi128_t) vec_mulluq ((vui128_t) result, vtipowof10[e]);
+#endif
+  return (result);
+}
+
+/** \brief Convert a _Decimal128 to unsigned __int128, truncating any
+ *  fraction digits.
+ *
+ *  As vec_dfp128_ctsqz() for the unsigned range.
+ *
+ *  \note The result is undefined for negative values, infinity, NaN
+ *  and values outside the unsigned __int128 range.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |  ~180 | 1/cycle  |
+ *  |power9   |  ~80  | 1/cycle  |
+ *
+ *  @param val a _Decimal128 value.
+ *  @return the integer part of val as an unsigned __int128.
+ */
+static inline vui128_t
+vec_dfp128_ctuqz (_Decimal128 val)
+{
+  vui128_t result, x_h, x_l;
+  vBCD_t b_h, b_l;
+  long long e;
+
+  e = __builtin_dxexq (val) - 6176;
+  if (e < 0)
+    val = vec_quantize0_Decimal128 (val);
+  // Convert the magnitudes, the sign nibble set to plus.
+  b_h = vec_bcdcpsgn (vec_DFP2BCD (__builtin_dscriq (val, 31)),
+		      _BCD_CONST_PLUS_ONE);
+  b_l = vec_bcdcpsgn (vec_DFP2BCD (val), _BCD_CONST_PLUS_ONE);
+  x_h = (vui128_t) vec_bcdctsq (b_h);
+  x_l = (vui128_t) vec_bcdctsq (b_l);
+  result = vec_mulluq (x_h, vtipowof10[31]);
+  result = vec_adduqm (result, x_l);
+  if (e > 0 && e <= 38)
+    result = vec_mulluq (result, vtipowof10[e]);
+  return (result);
+}
+
+/** \brief Quantize a _Decimal128 value to scale fraction digits,
+ *  with rounding mode.
+ *
+ *  Round val to the exponent -scale (for example scale 2 for cents)
+ *  as specified by rnd. VEC_ROUND_HALF_EVEN, VEC_ROUND_HALF_UP and
+ *  VEC_ROUND_TRUNC are the rounding mode controls of the DFP
+ *  Quantize instruction. The quantize instruction has no directed
+ *  rounding, so VEC_ROUND_UP, VEC_ROUND_FLOOR and VEC_ROUND_CEIL
+ *  truncate, then add or subtract 1 unit in the last place if the
+ *  truncation was inexact.
+ *
+ *  If the result needs more than 34 digits the result is NaN, or
+ *  has an exponent other than -scale. Infinity and NaN values are
+ *  returned unchanged.
+ *
+ *  \note Without _ARCH_PWR7 this uses quantized128(), which rounds
+ *  in the current DFP rounding mode.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 15-40 | 1/cycle  |
+ *  |power9   | 12-35 | 1/cycle  |
+ *
+ *  @param val a _Decimal128 value.
+ *  @param scale the number of fraction digits, 0-6176.
+ *  @param rnd the rounding mode.
+ *  @return the _Decimal128 value of val rounded to exponent -scale.
+ */
+static inline _Decimal128
+vec_dfp128_quantize (_Decimal128 val, unsigned int scale, vec_round_t rnd)
+{
+  _Decimal128 ref, t;
+
+  // Infinity and NaN have negative biased exponents.
+  if (__builtin_dxexq (val) < 0)
+    return val;
+
+  ref = __builtin_diexq (6176 - scale, 1DL);
+#ifdef _ARCH_PWR7
+  switch (rnd)
+    {
+    case VEC_ROUND_HALF_EVEN:
+      __asm__(
+	  "dquaq %0,%1,%2,0b00;\n"
+	  : "=d" (t)
+	  : "d" (ref), "d" (val)
+	  : );
+      break;
+    case VEC_ROUND_HALF_UP:
+      __asm__(
+	  "dquaq %0,%1,%2,0b10;\n"
+	  : "=d" (t)
+	  : "d" (ref), "d" (val)
+	  : );
+      break;
+    default:
+      __asm__(
+	  "dquaq %0,%1,%2,0b01;\n"
+	  : "=d" (t)
+	  : "d" (ref), "d" (val)
+	  : );
+      break;
+    }
+#else
+  t = quantized128 (val, ref);
+#endif
+  // Adjust the truncated value by 1 ulp (ref) if it was inexact.
+  if ((rnd >= VEC_ROUND_UP) && (__builtin_dxexq (t) >= 0) && (t != val))
+    {
+      if (val < 0DL)
+	{
+	  if (rnd != VEC_ROUND_CEIL)
+	    t = t - ref;
+	}
+      else if (rnd != VEC_ROUND_FLOOR)
+	t = t + ref;
+    }
+  return (t);
+}
+
 /** \brief Pack a FPR pair (_Decimal128) to a doubleword vector
  *  (vector double).
  *
@@ -5058,5 +5920,823 @@ vec_zndctuq (vui8_t zone00, vui8_t zone16)
   d10e = vec_rdxct10E16d (d100m);
   return vec_rdxct10e32q (d10e);
 }
+
+/** \name Dynamic call ABI for the heavier operations
+ *
+ *  The BCD multiply, divide and quadword conversions are also
+ *  available out of line. The conversions use the BCD and quadword
+ *  integer instructions where available (POWER9/10) and the DFP unit
+ *  before.
+ *
+ *  The multiplies use the binary (_rdx) implementations on POWER8
+ *  and later, where the quadword multiply and radix conversions
+ *  pipeline and the DFP multiply does not. POWER7 has no doubleword
+ *  multiply and keeps vec_bcdmul()/vec_bcdmulh().
+ *  The divides use vec_bcddiv_rdx()/vec_bcddive_rdx() only on
+ *  POWER10 (Vector Divide Quadword) and the DFP divide before.
+ *
+ *  libpvec.so exports FNAME_dyn selected by IFUNC and
+ *  libpvecstatic.a the platform suffixed implementations, as
+ *  described for the int128 divide chains in vec_int128_ppc.h.
+ */
+///@{
+/** \brief Out-of-line vec_bcdmul().  */
+extern vBCD_t
+vec_bcdmul_dyn (vBCD_t a, vBCD_t b);
+
+/** \brief Out-of-line vec_bcddiv().  */
+extern vBCD_t
+vec_bcddiv_dyn (vBCD_t a, vBCD_t b);
+
+/** \brief Out-of-line vec_bcdmulh().  */
+extern vBCD_t
+vec_bcdmulh_dyn (vBCD_t a, vBCD_t b);
+
+/** \brief Out-of-line vec_bcddive().  */
+extern vBCD_t
+vec_bcddive_dyn (vBCD_t a, vBCD_t b);
+
+/** \brief Out-of-line vec_bcdcfsq().  */
+extern vBCD_t
+vec_bcdcfsq_dyn (vi128_t vrb);
+
+/** \brief Out-of-line vec_bcdcfuq().  */
+extern vBCD_t
+vec_bcdcfuq_dyn (vui128_t vra);
+
+/** \brief Out-of-line vec_bcdctsq().  */
+extern vi128_t
+vec_bcdctsq_dyn (vBCD_t vra);
+
+/** \brief Out-of-line vec_bcdctuq().  */
+extern vui128_t
+vec_bcdctuq_dyn (vBCD_t vra);
+
+///@}
+
+///@cond INTERNAL
+/* Doxygen can not handle macros or attributes */
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcdmul) (vBCD_t a, vBCD_t b);
+
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcddiv) (vBCD_t a, vBCD_t b);
+
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcdmulh) (vBCD_t a, vBCD_t b);
+
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcddive) (vBCD_t a, vBCD_t b);
+
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcdcfsq) (vi128_t vrb);
+
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcdcfuq) (vui128_t vra);
+
+extern vi128_t
+__VEC_PWR_IMP (vec_bcdctsq) (vBCD_t vra);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_bcdctuq) (vBCD_t vra);
+///@endcond
+
+/** \name Multiple quadword signed BCD operations
+ *
+ *  Arithmetic over arrays of N signed 31 digit BCD quadwords,
+ *  high order digits first. See \ref bcd128_extended_0_2_4.
+ *
+ *  The result array may be the same as an input array except for
+ *  vec_bcdmul_byMN(), where the product must not overlap the
+ *  multiplicands.
+ */
+///@{
+/** \brief Add N quadword signed BCD values.
+ *
+ *  @param r pointer to the N quadword sum (a + b).
+ *  @param a pointer to the N quadword addend.
+ *  @param b pointer to the N quadword addend.
+ *  @param N number of quadwords in a, b and r.
+ *  @return the carry out of the high order digit, as a signed BCD
+ *  -1, 0 or +1.
+ */
+extern vBCD_t
+vec_bcdadd_byN (vBCD_t *r, vBCD_t *a, vBCD_t *b, unsigned long N);
+
+/** \brief Subtract N quadword signed BCD values.
+ *
+ *  @param r pointer to the N quadword difference (a - b).
+ *  @param a pointer to the N quadword minuend.
+ *  @param b pointer to the N quadword subtrahend.
+ *  @param N number of quadwords in a, b and r.
+ *  @return the carry out of the high order digit, as a signed BCD
+ *  -1, 0 or +1.
+ */
+extern vBCD_t
+vec_bcdsub_byN (vBCD_t *r, vBCD_t *a, vBCD_t *b, unsigned long N);
+
+/** \brief Compare N quadword signed BCD values.
+ *
+ *  Minus zero compares equal to plus zero.
+ *
+ *  @param a pointer to the N quadword value a.
+ *  @param b pointer to the N quadword value b.
+ *  @param N number of quadwords in a and b.
+ *  @return -1 if a < b, 0 if a == b, +1 if a > b.
+ */
+extern int
+vec_bcdcmp_byN (vBCD_t *a, vBCD_t *b, unsigned long N);
+
+/** \brief Multiply M by N quadword signed BCD values.
+ *
+ *  @param p pointer to the M+N quadword product (m1 * m2).
+ *  @param m1 pointer to the M quadword multiplicand.
+ *  @param m2 pointer to the N quadword multiplier.
+ *  @param M number of quadwords in m1.
+ *  @param N number of quadwords in m2.
+ */
+extern void
+vec_bcdmul_byMN (vBCD_t *p, vBCD_t *m1, vBCD_t *m2,
+		 unsigned long M, unsigned long N);
+
+/** \brief Shift left N quadword signed BCD value.
+ *
+ *  Digits shifted out of the high order quadword are lost.
+ *
+ *  @param r pointer to the N quadword result.
+ *  @param a pointer to the N quadword value to shift.
+ *  @param k number of digits to shift left.
+ *  @param N number of quadwords in a and r.
+ */
+extern void
+vec_bcdsl_byN (vBCD_t *r, vBCD_t *a, unsigned int k, unsigned long N);
+
+/** \brief Shift right N quadword signed BCD value.
+ *
+ *  Digits shifted out of the low order quadword are truncated.
+ *
+ *  @param r pointer to the N quadword result.
+ *  @param a pointer to the N quadword value to shift.
+ *  @param k number of digits to shift right.
+ *  @param N number of quadwords in a and r.
+ */
+extern void
+vec_bcdsr_byN (vBCD_t *r, vBCD_t *a, unsigned int k, unsigned long N);
+
+/** \brief Shift right and round N quadword signed BCD value.
+ *
+ *  If the last digit shifted out is 5 or more, increment the
+ *  magnitude of the result.
+ *
+ *  @param r pointer to the N quadword result.
+ *  @param a pointer to the N quadword value to shift.
+ *  @param k number of digits to shift right.
+ *  @param N number of quadwords in a and r.
+ */
+extern void
+vec_bcdsrr_byN (vBCD_t *r, vBCD_t *a, unsigned int k, unsigned long N);
+///@}
+
+///@cond INTERNAL
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcdadd_byN) (vBCD_t *r, vBCD_t *a, vBCD_t *b,
+				unsigned long N);
+
+extern vBCD_t
+__VEC_PWR_IMP (vec_bcdsub_byN) (vBCD_t *r, vBCD_t *a, vBCD_t *b,
+				unsigned long N);
+
+extern int
+__VEC_PWR_IMP (vec_bcdcmp_byN) (vBCD_t *a, vBCD_t *b, unsigned long N);
+
+extern void
+__VEC_PWR_IMP (vec_bcdmul_byMN) (vBCD_t *p, vBCD_t *m1, vBCD_t *m2,
+				 unsigned long M, unsigned long N);
+
+extern void
+__VEC_PWR_IMP (vec_bcdsl_byN) (vBCD_t *r, vBCD_t *a, unsigned int k,
+			       unsigned long N);
+
+extern void
+__VEC_PWR_IMP (vec_bcdsr_byN) (vBCD_t *r, vBCD_t *a, unsigned int k,
+			       unsigned long N);
+
+extern void
+__VEC_PWR_IMP (vec_bcdsrr_byN) (vBCD_t *r, vBCD_t *a, unsigned int k,
+				unsigned long N);
+///@endcond
+
+/** \name Packed and zoned decimal records
+ *
+ *  Convert the decimal fields of fixed layout records (mainframe
+ *  extracts with COMP-3 packed and zoned decimal fields) to columns
+ *  of binary or _Decimal128 values and back.
+ *  See \ref bcd128_records_0_2_5.
+ */
+///@{
+/** \brief Field formats for vec_bcdrec_decode()/vec_bcdrec_encode().  */
+typedef enum
+{
+  /*! \brief Packed decimal (COMP-3), 1-16 bytes. Two digits per byte
+   *  and the sign code in the low nibble of the last byte.  */
+  VEC_BCDREC_PACKED,
+  /*! \brief EBCDIC zoned decimal, 1-31 bytes. One digit per byte
+   *  (zone 0xF) and the sign in the zone of the last byte
+   *  (0xD or 0xB minus, else plus). Encoded with 0xC/0xD.  */
+  VEC_BCDREC_ZONED,
+  /*! \brief ASCII zoned decimal, 1-31 bytes. Zone 0x3 and the sign in
+   *  the zone of the last byte as vec_bcdcfz(). Encoded with
+   *  0x3/0x7.  */
+  VEC_BCDREC_ZONED_ASCII
+} vec_bcdrec_fmt_t;
+
+/** \brief Column types for vec_bcdrec_decode()/vec_bcdrec_encode().  */
+typedef enum
+{
+  /*! \brief Column of long long.  */
+  VEC_BCDREC_INT64,
+  /*! \brief Column of vi128_t.  */
+  VEC_BCDREC_INT128,
+  /*! \brief Column of _Decimal128 with scale fraction digits.  */
+  VEC_BCDREC_DEC128
+} vec_bcdrec_type_t;
+
+/** \brief Description of one decimal field of the record and the
+ *  column it converts to/from.  */
+typedef struct vec_bcdrec_field
+{
+  /*! \brief Byte offset of the field in the record.  */
+  unsigned long offset;
+  /*! \brief Field length in bytes.  */
+  unsigned int length;
+  /*! \brief Field format.  */
+  vec_bcdrec_fmt_t format;
+  /*! \brief Column element type.  */
+  vec_bcdrec_type_t type;
+  /*! \brief Implied fraction digits (0-31) of a VEC_BCDREC_DEC128
+   *  column. The binary columns hold the unscaled integer.  */
+  unsigned int scale;
+  /*! \brief Column array, one element per record.  */
+  void *column;
+} vec_bcdrec_field_t;
+
+/** \brief Decode the decimal fields of nrec records to columns.
+ *
+ *  Element i of each column is the value of the field in record i.
+ *  A field value that does not fit a VEC_BCDREC_INT64 column is
+ *  truncated to the low 64 bits and counted.
+ *
+ *  @param rec pointer to the first record.
+ *  @param reclen length of each record in bytes.
+ *  @param nrec number of records.
+ *  @param schema array of field descriptions.
+ *  @param nfields number of fields in schema.
+ *  @return the number of values that did not fit the column, or -1
+ *  if a field description is not valid (no records converted).
+ */
+extern long
+vec_bcdrec_decode (const unsigned char *rec, unsigned long reclen,
+		   unsigned long nrec, const vec_bcdrec_field_t *schema,
+		   unsigned long nfields);
+
+/** \brief Encode columns to the decimal fields of nrec records.
+ *
+ *  Only the bytes of the described fields are written. Values with
+ *  more digits than the field holds are truncated to the low order
+ *  digits and counted. _Decimal128 values are truncated (round
+ *  toward zero) to scale fraction digits.
+ *
+ *  @param rec pointer to the first record.
+ *  @param reclen length of each record in bytes.
+ *  @param nrec number of records.
+ *  @param schema array of field descriptions.
+ *  @param nfields number of fields in schema.
+ *  @return the number of values that did not fit the field, or -1
+ *  if a field description is not valid (no records converted).
+ */
+extern long
+vec_bcdrec_encode (unsigned char *rec, unsigned long reclen,
+		   unsigned long nrec, const vec_bcdrec_field_t *schema,
+		   unsigned long nfields);
+///@}
+
+///@cond INTERNAL
+extern long
+__VEC_PWR_IMP (vec_bcdrec_decode) (const unsigned char *rec,
+				   unsigned long reclen, unsigned long nrec,
+				   const vec_bcdrec_field_t *schema,
+				   unsigned long nfields);
+
+extern long
+__VEC_PWR_IMP (vec_bcdrec_encode) (unsigned char *rec,
+				   unsigned long reclen, unsigned long nrec,
+				   const vec_bcdrec_field_t *schema,
+				   unsigned long nfields);
+///@endcond
+
+/** \name Binary floating point to/from _Decimal128
+ *
+ *  Correctly rounded conversions between double or __binary128 and
+ *  _Decimal128, and the array forms of these and the quadword
+ *  integer conversions. See \ref bcd128_dfpconv_0_2_6.
+ */
+///@{
+/** \brief Convert a double to _Decimal128.
+ *
+ *  Every double has an exact decimal value. The result is that value
+ *  rounded once to 34 digits in the current DFP rounding mode.
+ *  Infinity and NaN convert to infinity and (quiet) NaN.
+ *
+ *  @param f64 a double value.
+ *  @return the _Decimal128 value of f64.
+ */
+extern _Decimal128
+vec_dfp128_cff64 (double f64);
+
+/** \brief Convert a _Decimal128 to double, rounded to nearest even.
+ *
+ *  Values too large for double convert to infinity, values too small
+ *  round to a subnormal or zero. The result does not depend on the
+ *  FPSCR rounding mode.
+ *
+ *  @param d128 a _Decimal128 value.
+ *  @return the double nearest to d128.
+ */
+extern double
+vec_dfp128_ctf64 (_Decimal128 d128);
+
+/** \brief Convert a __binary128 to _Decimal128.
+ *
+ *  As vec_dfp128_cff64() for the 113-bit significand and wider
+ *  exponent range of __binary128.
+ *
+ *  @param f128 a __binary128 value.
+ *  @return the _Decimal128 value of f128.
+ */
+extern _Decimal128
+vec_dfp128_cff128 (__binary128 f128);
+
+/** \brief Convert a _Decimal128 to __binary128, rounded to nearest
+ *  even.
+ *
+ *  @param d128 a _Decimal128 value.
+ *  @return the __binary128 nearest to d128.
+ */
+extern __binary128
+vec_dfp128_ctf128 (_Decimal128 d128);
+
+/** \brief Convert an array of signed __int128 to _Decimal128.
+ *
+ *  r[i] = vec_dfp128_cfsq (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the _Decimal128 results.
+ *  @param a pointer to the signed __int128 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_cfsq_array (_Decimal128 *r, vi128_t *a, unsigned long n);
+
+/** \brief Convert an array of unsigned __int128 to _Decimal128.
+ *
+ *  r[i] = vec_dfp128_cfuq (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the _Decimal128 results.
+ *  @param a pointer to the unsigned __int128 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_cfuq_array (_Decimal128 *r, vui128_t *a, unsigned long n);
+
+/** \brief Convert an array of double to _Decimal128.
+ *
+ *  r[i] = vec_dfp128_cff64 (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the _Decimal128 results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_cff64_array (_Decimal128 *r, double *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to _Decimal128.
+ *
+ *  r[i] = vec_dfp128_cff128 (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the _Decimal128 results.
+ *  @param a pointer to the __binary128 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_cff128_array (_Decimal128 *r, __binary128 *a, unsigned long n);
+
+/** \brief Convert an array of _Decimal128 to signed __int128.
+ *
+ *  r[i] = vec_dfp128_ctsqz (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the signed __int128 results.
+ *  @param a pointer to the _Decimal128 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_ctsqz_array (vi128_t *r, _Decimal128 *a, unsigned long n);
+
+/** \brief Convert an array of _Decimal128 to unsigned __int128.
+ *
+ *  r[i] = vec_dfp128_ctuqz (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the unsigned __int128 results.
+ *  @param a pointer to the _Decimal128 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_ctuqz_array (vui128_t *r, _Decimal128 *a, unsigned long n);
+
+/** \brief Convert an array of _Decimal128 to double.
+ *
+ *  r[i] = vec_dfp128_ctf64 (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the _Decimal128 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_ctf64_array (double *r, _Decimal128 *a, unsigned long n);
+
+/** \brief Convert an array of _Decimal128 to __binary128.
+ *
+ *  r[i] = vec_dfp128_ctf128 (a[i]) for i in 0 to n-1.
+ *
+ *  @param r pointer to the __binary128 results.
+ *  @param a pointer to the _Decimal128 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_ctf128_array (__binary128 *r, _Decimal128 *a, unsigned long n);
+///@}
+
+///@cond INTERNAL
+extern _Decimal128
+__VEC_PWR_IMP (vec_dfp128_cff64) (double f64);
+
+extern double
+__VEC_PWR_IMP (vec_dfp128_ctf64) (_Decimal128 d128);
+
+extern _Decimal128
+__VEC_PWR_IMP (vec_dfp128_cff128) (__binary128 f128);
+
+extern __binary128
+__VEC_PWR_IMP (vec_dfp128_ctf128) (_Decimal128 d128);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_cfsq_array) (_Decimal128 *r, vi128_t *a,
+				       unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_cfuq_array) (_Decimal128 *r, vui128_t *a,
+				       unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_cff64_array) (_Decimal128 *r, double *a,
+					unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_cff128_array) (_Decimal128 *r, __binary128 *a,
+					 unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_ctsqz_array) (vi128_t *r, _Decimal128 *a,
+					unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_ctuqz_array) (vui128_t *r, _Decimal128 *a,
+					unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_ctf64_array) (double *r, _Decimal128 *a,
+					unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_ctf128_array) (__binary128 *r, _Decimal128 *a,
+					 unsigned long n);
+///@endcond
+
+/** \name Decimal rescale with rounding mode
+ *
+ *  Change the decimal scale of a column of BCD or _Decimal128 values
+ *  and count the elements that overflow.
+ *  See \ref bcd128_rescale_0_2_7.
+ */
+///@{
+/** \brief Rescale an array of signed BCD values by 10**k.
+ *
+ *  For k > 0 r[i] is a[i] shifted left k digits. The element
+ *  overflows if any of the high k digits of a[i] is nonzero, and the
+ *  low 31 digits are stored. For k < 0 r[i] is
+ *  vec_bcdsr_rnd (a[i], -k, rnd), which can not overflow.
+ *
+ *  @param r pointer to the rescaled BCD values.
+ *  @param a pointer to the BCD values.
+ *  @param k the change of scale, in digits.
+ *  @param rnd the rounding mode for k < 0.
+ *  @param ovf NULL or pointer to n bytes, set to 1 for each element
+ *  that overflowed, otherwise 0.
+ *  @param n number of elements.
+ *  @return the number of elements that overflowed.
+ */
+extern long
+vec_bcdrescale_array (vBCD_t *r, vBCD_t *a, int k, vec_round_t rnd,
+		      unsigned char *ovf, unsigned long n);
+
+/** \brief Quantize an array of _Decimal128 values to scale fraction
+ *  digits.
+ *
+ *  r[i] = vec_dfp128_quantize (a[i], scale, rnd) for i in 0 to n-1.
+ *  An element overflows if a[i] is finite and the result does not
+ *  have the exponent -scale (it needs more than 34 digits).
+ *
+ *  @param r pointer to the quantized _Decimal128 values.
+ *  @param a pointer to the _Decimal128 values.
+ *  @param scale the number of fraction digits, 0-6176.
+ *  @param rnd the rounding mode.
+ *  @param ovf NULL or pointer to n bytes, set to 1 for each element
+ *  that overflowed, otherwise 0.
+ *  @param n number of elements.
+ *  @return the number of elements that overflowed.
+ */
+extern long
+vec_dfp128_rescale_array (_Decimal128 *r, _Decimal128 *a,
+			  unsigned int scale, vec_round_t rnd,
+			  unsigned char *ovf, unsigned long n);
+///@}
+
+///@cond INTERNAL
+extern long
+__VEC_PWR_IMP (vec_bcdrescale_array) (vBCD_t *r, vBCD_t *a, int k,
+				      vec_round_t rnd, unsigned char *ovf,
+				      unsigned long n);
+
+extern long
+__VEC_PWR_IMP (vec_dfp128_rescale_array) (_Decimal128 *r, _Decimal128 *a,
+					  unsigned int scale,
+					  vec_round_t rnd,
+					  unsigned char *ovf,
+					  unsigned long n);
+///@endcond
+
+/** \name Binary128 to/from decimal strings
+ *
+ *  Shortest round trip formatting and correctly rounded parsing of
+ *  __binary128. See \ref bcd128_f128str_0_2_8.
+ */
+///@{
+/** \brief The buffer size for vec_f128_ctstr(), including the
+ *  terminating null.  */
+#define VEC_F128_STR_MAX 48
+
+/** \brief Convert a __binary128 to the shortest decimal string that
+ *  converts back to the same value.
+ *
+ *  The format is "%.*e" with the precision of the shortest digit
+ *  string: an optional '-', one digit, '.' and the other digits if
+ *  there are any, then 'e', the sign and at least 2 exponent digits.
+ *  Zero is "0e+00", infinity "inf" and NaN "nan", with the '-' for
+ *  a negative sign.
+ *
+ *  @param buf pointer to at least VEC_F128_STR_MAX bytes.
+ *  @param f128 a __binary128 value.
+ *  @return the length of the string, not including the terminating
+ *  null.
+ */
+extern int
+vec_f128_ctstr (char *buf, __binary128 f128);
+
+/** \brief Convert a decimal string to __binary128, rounded to nearest
+ *  even.
+ *
+ *  Leading white space is skipped. Then an optional sign and either
+ *  "inf", "infinity", "nan", "nan(chars)" (ignoring case) or decimal
+ *  digits with an optional '.' and optional exponent. Values too
+ *  large for __binary128 convert to infinity, values too small round
+ *  to a subnormal or zero.
+ *
+ *  @param str pointer to the string.
+ *  @param endptr NULL or set to the character after the converted
+ *  string, or to str if no conversion was done.
+ *  @return the __binary128 value, 0 if no conversion was done.
+ */
+extern __binary128
+vec_f128_cfstr (const char *str, char **endptr);
+///@}
+
+///@cond INTERNAL
+extern int
+__VEC_PWR_IMP (vec_f128_ctstr) (char *buf, __binary128 f128);
+
+extern __binary128
+__VEC_PWR_IMP (vec_f128_cfstr) (const char *str, char **endptr);
+///@endcond
+
+/** \name Double and float to decimal strings
+ *
+ *  Shortest round trip formatting of double and float, single
+ *  values or arrays formatted two per vector. See
+ *  \ref bcd128_f128str_0_2_8.
+ */
+///@{
+/** \brief The buffer size for vec_f64_ctstr(), including the
+ *  terminating null.  */
+#define VEC_F64_STR_MAX 25
+/** \brief The buffer size for vec_f32_ctstr(), including the
+ *  terminating null.  */
+#define VEC_F32_STR_MAX 16
+
+/** \brief Convert a double to the shortest decimal string that
+ *  converts back to the same value.
+ *
+ *  The format is the same as vec_f128_ctstr(), for example
+ *  "1e-01", "-1.7976931348623157e+308", "-0e+00", "inf" or "nan".
+ *
+ *  @param buf pointer to at least VEC_F64_STR_MAX bytes.
+ *  @param f64 a double value.
+ *  @return the length of the string, not including the terminating
+ *  null.
+ */
+extern int
+vec_f64_ctstr (char *buf, double f64);
+
+/** \brief Convert a float to the shortest decimal string that
+ *  converts back to the same value.
+ *
+ *  The format is the same as vec_f128_ctstr(), for example
+ *  "1e-01" or "3.4028235e+38".
+ *
+ *  @param buf pointer to at least VEC_F32_STR_MAX bytes.
+ *  @param f32 a float value.
+ *  @return the length of the string, not including the terminating
+ *  null.
+ */
+extern int
+vec_f32_ctstr (char *buf, float f32);
+
+/** \brief Convert an array of doubles to shortest decimal strings
+ *  separated by sep.
+ *
+ *  Each value is formatted as vec_f64_ctstr(), two values per
+ *  pass. The strings are followed by a terminating null.
+ *
+ *  @param buf pointer to at least n * VEC_F64_STR_MAX bytes (1 if
+ *  n is 0).
+ *  @param f64 array of n doubles.
+ *  @param n number of values.
+ *  @param sep the character between the strings.
+ *  @return the length of the output, not including the terminating
+ *  null.
+ */
+extern long
+vec_f64_ctstr_array (char *buf, const double *f64, unsigned long n,
+		     char sep);
+
+/** \brief Convert an array of floats to shortest decimal strings
+ *  separated by sep.
+ *
+ *  As vec_f64_ctstr_array() with VEC_F32_STR_MAX bytes per value.
+ *
+ *  @param buf pointer to at least n * VEC_F32_STR_MAX bytes (1 if
+ *  n is 0).
+ *  @param f32 array of n floats.
+ *  @param n number of values.
+ *  @param sep the character between the strings.
+ *  @return the length of the output, not including the terminating
+ *  null.
+ */
+extern long
+vec_f32_ctstr_array (char *buf, const float *f32, unsigned long n,
+		     char sep);
+///@}
+
+///@cond INTERNAL
+extern int
+__VEC_PWR_IMP (vec_f64_ctstr) (char *buf, double f64);
+
+extern int
+__VEC_PWR_IMP (vec_f32_ctstr) (char *buf, float f32);
+
+extern long
+__VEC_PWR_IMP (vec_f64_ctstr_array) (char *buf, const double *f64,
+				     unsigned long n, char sep);
+
+extern long
+__VEC_PWR_IMP (vec_f32_ctstr_array) (char *buf, const float *f32,
+				     unsigned long n, char sep);
+///@endcond
+
+/** \name Decimal batch sum, dot product and scale
+ *
+ *  Aggregate columns of _Decimal128 or _Decimal64 values with one
+ *  rounding. See \ref bcd128_dfpbatch_0_2_9.
+ */
+///@{
+/** \brief Sum an array of _Decimal128 values.
+ *
+ *  The exact sum of a[0] to a[n-1] rounded once to _Decimal128 in
+ *  the current rounding mode. Infinity and NaN give the IEEE sum.
+ *
+ *  @param a pointer to the _Decimal128 values.
+ *  @param n number of elements.
+ *  @return the sum, 0 if n is 0.
+ */
+extern _Decimal128
+vec_dfp128_sum_array (_Decimal128 *a, unsigned long n);
+
+/** \brief Dot product of two arrays of _Decimal128 values.
+ *
+ *  The exact sum of a[i] * b[i] for i in 0 to n-1, rounded once as
+ *  vec_dfp128_sum_array().
+ *
+ *  @param a pointer to the first _Decimal128 values.
+ *  @param b pointer to the second _Decimal128 values.
+ *  @param n number of elements.
+ *  @return the dot product, 0 if n is 0.
+ */
+extern _Decimal128
+vec_dfp128_dot_array (_Decimal128 *a, _Decimal128 *b, unsigned long n);
+
+/** \brief Multiply an array of _Decimal128 values by a scalar.
+ *
+ *  r[i] = a[i] * s for i in 0 to n-1, the same result as the DFP
+ *  multiply.
+ *
+ *  @param r pointer to the _Decimal128 products.
+ *  @param a pointer to the _Decimal128 values.
+ *  @param s the scale factor.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp128_scale_array (_Decimal128 *r, _Decimal128 *a, _Decimal128 s,
+			unsigned long n);
+
+/** \brief Sum an array of _Decimal64 values to _Decimal128.
+ *
+ *  As vec_dfp128_sum_array(). The sum is exact if it fits 34 digits.
+ *
+ *  @param a pointer to the _Decimal64 values.
+ *  @param n number of elements.
+ *  @return the sum, 0 if n is 0.
+ */
+extern _Decimal128
+vec_dfp64_sum_array (_Decimal64 *a, unsigned long n);
+
+/** \brief Dot product of two arrays of _Decimal64 values to
+ *  _Decimal128.
+ *
+ *  As vec_dfp128_dot_array(). The products are exact.
+ *
+ *  @param a pointer to the first _Decimal64 values.
+ *  @param b pointer to the second _Decimal64 values.
+ *  @param n number of elements.
+ *  @return the dot product, 0 if n is 0.
+ */
+extern _Decimal128
+vec_dfp64_dot_array (_Decimal64 *a, _Decimal64 *b, unsigned long n);
+
+/** \brief Multiply an array of _Decimal64 values by a scalar.
+ *
+ *  r[i] = a[i] * s for i in 0 to n-1, the same result as the DFP
+ *  multiply.
+ *
+ *  @param r pointer to the _Decimal64 products.
+ *  @param a pointer to the _Decimal64 values.
+ *  @param s the scale factor.
+ *  @param n number of elements.
+ */
+extern void
+vec_dfp64_scale_array (_Decimal64 *r, _Decimal64 *a, _Decimal64 s,
+		       unsigned long n);
+///@}
+
+///@cond INTERNAL
+extern _Decimal128
+__VEC_PWR_IMP (vec_dfp128_sum_array) (_Decimal128 *a, unsigned long n);
+
+extern _Decimal128
+__VEC_PWR_IMP (vec_dfp128_dot_array) (_Decimal128 *a, _Decimal128 *b,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp128_scale_array) (_Decimal128 *r, _Decimal128 *a,
+					_Decimal128 s, unsigned long n);
+
+extern _Decimal128
+__VEC_PWR_IMP (vec_dfp64_sum_array) (_Decimal64 *a, unsigned long n);
+
+extern _Decimal128
+__VEC_PWR_IMP (vec_dfp64_dot_array) (_Decimal64 *a, _Decimal64 *b,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_dfp64_scale_array) (_Decimal64 *r, _Decimal64 *a,
+				       _Decimal64 s, unsigned long n);
+///@endcond
+
 #endif /* ndef PVECLIB_DISABLE_DFP */
 #endif /* VEC_BCD_PPC_H_ */
@@ -391,8 +391,35 @@ typedef union
 #define VEC_BYTE_HHW 1
 #endif
 
+/*! \brief Macro to add platform suffix for static calls.
+ *
+ *  The runtime libraries (libpvec.so and libpvecstatic.a) provide
+ *  out-of-line implementations compiled for each supported platform
+ *  and named with a _PWR7/_PWR8/_PWR9/_PWR10 suffix. Applications
+ *  linking libpvecstatic.a call the implementation matching their
+ *  own -mcpu= via __VEC_PWR_IMP(FNAME).  */
+#ifdef _ARCH_PWR10
+#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR10
+#else
+#ifdef _ARCH_PWR9
+#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR9
+#else
+#ifdef _ARCH_PWR8
+#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR8
+#else
+#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR7
+#endif
+#endif
+#endif
+
 /*! \brief table powers of 10 [0-38] in vector __int128 format.  */
 extern const vui128_t vtipowof10[];
+/*! \brief table of multipliers for n / 10**k [1-38] in vector
+ *  __int128 format. See vec_div10k_uq().  */
+extern const vui128_t vec128_recipof10[];
+/*! \brief table of the final right shift after the multiply by
+ *  vec128_recipof10[k], vec256_recipof10[k] or vec512_recipof10[k].  */
+extern const unsigned char vec_recipof10_sh[];
 /*! \brief table used to verify 128-bit frexp operations for powers of 10.  */
 extern const vui128_t vtifrexpof10[];
 
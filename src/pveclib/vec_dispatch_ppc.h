@@ -0,0 +1,414 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_dispatch_ppc.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_PVECLIB_VEC_DISPATCH_PPC_H_
+#define SRC_PVECLIB_VEC_DISPATCH_PPC_H_
+
+#include <pveclib/vec_int512_ppc.h>
+#include <pveclib/vec_f128_ppc.h>
+
+/*!
+ * \file  vec_dispatch_ppc.h
+ * \brief Cached function pointer table for the libpvec out-of-line
+ * operations.
+ *
+ * Each exported libpvec function (vec_mul128x128, ...,
+ * vec_bcdctuq_dyn) is an IFUNC symbol. The resolver runs once, but
+ * every call still goes through the PLT stub and a TOC save/restore.
+ * For short operations in a hot loop that overhead is a large part
+ * of the call.
+ *
+ * vec_dispatch_table() returns a table of pointers to the platform
+ * implementations selected for this process, using the same rules
+ * as the IFUNC resolvers (including the PVECLIB_CPU override).
+ * The table is constant for the life of the process, so fetch it
+ * once and hoist the load of the function pointer out of the loop.
+ * For example:
+ * \code
+ * const vec_dispatch_t *vd = vec_dispatch_table ();
+ * __VEC_U_256 (*mul) (vui128_t, vui128_t) = vd->vec_mul128x128;
+ *
+ * for (i = 0; i < n; i++)
+ *   p[i] = mul (a[i], b[i]);
+ * \endcode
+ *
+ * The members are named for the exported function, without the
+ * _dyn suffix. Operations disabled when PVECLIB was configured
+ * (PVECLIB_DISABLE_F128ARITH, PVECLIB_DISABLE_DFP) are NULL, so
+ * the layout of the table does not depend on the configuration.
+ *
+ * When the target platform is known at build time, linking one of
+ * the per-CPU archives (libpvec_pwr8.a, libpvec_pwr9.a, ...) avoids
+ * both the IFUNC and the table. See the <B>--enable-cpu-libs</B>
+ * configure option. These archives also provide
+ * vec_dispatch_table(), returning the table of their platform.
+ */
+
+// Record schema of vec_bcd_ppc.h, only the tag is needed here.
+struct vec_bcdrec_field;
+
+/*! \brief _Decimal128 in the vec_dispatch_t member types.
+ *
+ *  Without compiler DFP support (PVECLIB_DISABLE_DFP) the members
+ *  using it are NULL, and a stand-in type keeps their declarations,
+ *  so the member names do not depend on the configuration.  */
+#ifndef PVECLIB_DISABLE_DFP
+typedef _Decimal128 vec_d128_t;
+#else
+typedef struct { double d[2]; } vec_d128_t;
+#endif
+/*! \brief _Decimal64 in the vec_dispatch_t member types.  */
+#ifndef PVECLIB_DISABLE_DFP
+typedef _Decimal64 vec_d64_t;
+#else
+typedef double vec_d64_t;
+#endif
+
+/*! \brief Pointers to the platform implementations of the libpvec
+ *  exported functions.  */
+typedef struct
+{
+  /*! \brief Platform of the selected implementations (7, 8, 9 or 10). */
+  int platform;
+  /*! \brief vec_mul128x128().  */
+  __VEC_U_256 (*vec_mul128x128) (vui128_t, vui128_t);
+  /*! \brief vec_mul256x256().  */
+  __VEC_U_512 (*vec_mul256x256) (__VEC_U_256, __VEC_U_256);
+  /*! \brief vec_mul512x128().  */
+  __VEC_U_640 (*vec_mul512x128) (__VEC_U_512, vui128_t);
+  /*! \brief vec_madd512x128a512().  */
+  __VEC_U_640 (*vec_madd512x128a512) (__VEC_U_512, vui128_t, __VEC_U_512);
+  /*! \brief vec_mul512x512().  */
+  __VEC_U_1024 (*vec_mul512x512) (__VEC_U_512, __VEC_U_512);
+  /*! \brief vec_mul1024x1024().  */
+  void (*vec_mul1024x1024) (__VEC_U_2048 *, __VEC_U_1024 *, __VEC_U_1024 *);
+  /*! \brief vec_mul2048x2048().  */
+  void (*vec_mul2048x2048) (__VEC_U_4096 *, __VEC_U_2048 *, __VEC_U_2048 *);
+  /*! \brief vec_mul128_byMN().  */
+  void (*vec_mul128_byMN) (vui128_t *, vui128_t *, vui128_t *,
+			   unsigned long, unsigned long);
+  /*! \brief vec_mul512_byMN().  */
+  void (*vec_mul512_byMN) (__VEC_U_512 *, __VEC_U_512 *, __VEC_U_512 *,
+			   unsigned long, unsigned long);
+  /*! \brief vec_divuq_10e31_dyn().  */
+  vui128_t (*vec_divuq_10e31) (vui128_t);
+  /*! \brief vec_divuq_10e32_dyn().  */
+  vui128_t (*vec_divuq_10e32) (vui128_t);
+  /*! \brief vec_moduq_10e31_dyn().  */
+  vui128_t (*vec_moduq_10e31) (vui128_t, vui128_t);
+  /*! \brief vec_moduq_10e32_dyn().  */
+  vui128_t (*vec_moduq_10e32) (vui128_t, vui128_t);
+  /*! \brief vec_divudq_10e31_dyn().  */
+  vui128_t (*vec_divudq_10e31) (vui128_t *, vui128_t, vui128_t);
+  /*! \brief vec_divudq_10e32_dyn().  */
+  vui128_t (*vec_divudq_10e32) (vui128_t *, vui128_t, vui128_t);
+  /*! \brief vec_modudq_10e31_dyn().  */
+  vui128_t (*vec_modudq_10e31) (vui128_t, vui128_t, vui128_t *);
+  /*! \brief vec_modudq_10e32_dyn().  */
+  vui128_t (*vec_modudq_10e32) (vui128_t, vui128_t, vui128_t *);
+  /*! \brief vec_divsq_10e31_dyn().  */
+  vi128_t (*vec_divsq_10e31) (vi128_t);
+  /*! \brief vec_modsq_10e31_dyn().  */
+  vi128_t (*vec_modsq_10e31) (vi128_t, vi128_t);
+  /*! \brief vec_xsaddqpo_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_xsaddqpo) (__binary128, __binary128);
+  /*! \brief vec_xssubqpo_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_xssubqpo) (__binary128, __binary128);
+  /*! \brief vec_xsmulqpo_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_xsmulqpo) (__binary128, __binary128);
+  /*! \brief vec_xscvqpdpo_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  vf64_t (*vec_xscvqpdpo) (__binary128);
+  /*! \brief vec_xscvqpudz_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  vui64_t (*vec_xscvqpudz) (__binary128);
+  /*! \brief vec_xscvqpuqz_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  vui128_t (*vec_xscvqpuqz) (__binary128);
+  /* The BCD operations use vui32_t (the vBCD_t type of vec_bcd_ppc.h)
+     so this header does not depend on PVECLIB_DISABLE_DFP.  */
+  /*! \brief vec_bcdmul_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcdmul) (vui32_t, vui32_t);
+  /*! \brief vec_bcddiv_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcddiv) (vui32_t, vui32_t);
+  /*! \brief vec_bcdcfsq_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcdcfsq) (vi128_t);
+  /*! \brief vec_bcdcfuq_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcdcfuq) (vui128_t);
+  /*! \brief vec_bcdctsq_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vi128_t (*vec_bcdctsq) (vui32_t);
+  /*! \brief vec_bcdctuq_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui128_t (*vec_bcdctuq) (vui32_t);
+  /*! \brief vec_mul10k_byN().  */
+  vui128_t (*vec_mul10k_byN) (vui128_t *, vui128_t *, unsigned int,
+			      unsigned long);
+  /*! \brief vec_div10k_byN().  */
+  vui128_t (*vec_div10k_byN) (vui128_t *, vui128_t *, unsigned int,
+			      vec_round_t, unsigned long);
+  /*! \brief vec_bcdmulh_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcdmulh) (vui32_t, vui32_t);
+  /*! \brief vec_bcddive_dyn(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcddive) (vui32_t, vui32_t);
+  /*! \brief vec_bcdadd_byN(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcdadd_byN) (vui32_t *, vui32_t *, vui32_t *,
+			     unsigned long);
+  /*! \brief vec_bcdsub_byN(), NULL if PVECLIB_DISABLE_DFP.  */
+  vui32_t (*vec_bcdsub_byN) (vui32_t *, vui32_t *, vui32_t *,
+			     unsigned long);
+  /*! \brief vec_bcdcmp_byN(), NULL if PVECLIB_DISABLE_DFP.  */
+  int (*vec_bcdcmp_byN) (vui32_t *, vui32_t *, unsigned long);
+  /*! \brief vec_bcdmul_byMN(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_bcdmul_byMN) (vui32_t *, vui32_t *, vui32_t *,
+			   unsigned long, unsigned long);
+  /*! \brief vec_bcdsl_byN(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_bcdsl_byN) (vui32_t *, vui32_t *, unsigned int, unsigned long);
+  /*! \brief vec_bcdsr_byN(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_bcdsr_byN) (vui32_t *, vui32_t *, unsigned int, unsigned long);
+  /*! \brief vec_bcdsrr_byN(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_bcdsrr_byN) (vui32_t *, vui32_t *, unsigned int,
+			  unsigned long);
+  /*! \brief vec_bcdrec_decode(), NULL if PVECLIB_DISABLE_DFP.  */
+  long (*vec_bcdrec_decode) (const unsigned char *, unsigned long,
+			     unsigned long, const struct vec_bcdrec_field *,
+			     unsigned long);
+  /*! \brief vec_bcdrec_encode(), NULL if PVECLIB_DISABLE_DFP.  */
+  long (*vec_bcdrec_encode) (unsigned char *, unsigned long, unsigned long,
+			     const struct vec_bcdrec_field *, unsigned long);
+  /*! \brief vec_dfp128_cff64(), NULL if PVECLIB_DISABLE_DFP.  */
+  vec_d128_t (*vec_dfp128_cff64) (double);
+  /*! \brief vec_dfp128_ctf64(), NULL if PVECLIB_DISABLE_DFP.  */
+  double (*vec_dfp128_ctf64) (vec_d128_t);
+  /*! \brief vec_dfp128_cff128(), NULL if PVECLIB_DISABLE_DFP.  */
+  vec_d128_t (*vec_dfp128_cff128) (__binary128);
+  /*! \brief vec_dfp128_ctf128(), NULL if PVECLIB_DISABLE_DFP.  */
+  __binary128 (*vec_dfp128_ctf128) (vec_d128_t);
+  /*! \brief vec_dfp128_cfsq_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_cfsq_array) (vec_d128_t *, vi128_t *, unsigned long);
+  /*! \brief vec_dfp128_cfuq_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_cfuq_array) (vec_d128_t *, vui128_t *, unsigned long);
+  /*! \brief vec_dfp128_cff64_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_cff64_array) (vec_d128_t *, double *, unsigned long);
+  /*! \brief vec_dfp128_cff128_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_cff128_array) (vec_d128_t *, __binary128 *, unsigned long);
+  /*! \brief vec_dfp128_ctsqz_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_ctsqz_array) (vi128_t *, vec_d128_t *, unsigned long);
+  /*! \brief vec_dfp128_ctuqz_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_ctuqz_array) (vui128_t *, vec_d128_t *, unsigned long);
+  /*! \brief vec_dfp128_ctf64_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_ctf64_array) (double *, vec_d128_t *, unsigned long);
+  /*! \brief vec_dfp128_ctf128_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_ctf128_array) (__binary128 *, vec_d128_t *, unsigned long);
+  /*! \brief vec_rescalesq_array().  */
+  long (*vec_rescalesq_array) (vi128_t *, vi128_t *, int, vec_round_t,
+			       unsigned char *, unsigned long);
+  /*! \brief vec_bcdrescale_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  long (*vec_bcdrescale_array) (vui32_t *, vui32_t *, int, vec_round_t,
+				unsigned char *, unsigned long);
+  /*! \brief vec_dfp128_rescale_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  long (*vec_dfp128_rescale_array) (vec_d128_t *, vec_d128_t *, unsigned int,
+				    vec_round_t, unsigned char *,
+				    unsigned long);
+  /*! \brief vec_f128_ctstr(), NULL if PVECLIB_DISABLE_DFP.  */
+  int (*vec_f128_ctstr) (char *, __binary128);
+  /*! \brief vec_f128_cfstr(), NULL if PVECLIB_DISABLE_DFP.  */
+  __binary128 (*vec_f128_cfstr) (const char *, char **);
+  /*! \brief vec_f64_ctstr(), NULL if PVECLIB_DISABLE_DFP.  */
+  int (*vec_f64_ctstr) (char *, double);
+  /*! \brief vec_f32_ctstr(), NULL if PVECLIB_DISABLE_DFP.  */
+  int (*vec_f32_ctstr) (char *, float);
+  /*! \brief vec_f64_ctstr_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  long (*vec_f64_ctstr_array) (char *, const double *, unsigned long, char);
+  /*! \brief vec_f32_ctstr_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  long (*vec_f32_ctstr_array) (char *, const float *, unsigned long, char);
+  /*! \brief vec_dfp128_sum_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  vec_d128_t (*vec_dfp128_sum_array) (vec_d128_t *, unsigned long);
+  /*! \brief vec_dfp128_dot_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  vec_d128_t (*vec_dfp128_dot_array) (vec_d128_t *, vec_d128_t *,
+				      unsigned long);
+  /*! \brief vec_dfp128_scale_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp128_scale_array) (vec_d128_t *, vec_d128_t *, vec_d128_t,
+				  unsigned long);
+  /*! \brief vec_dfp64_sum_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  vec_d128_t (*vec_dfp64_sum_array) (vec_d64_t *, unsigned long);
+  /*! \brief vec_dfp64_dot_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  vec_d128_t (*vec_dfp64_dot_array) (vec_d64_t *, vec_d64_t *, unsigned long);
+  /*! \brief vec_dfp64_scale_array(), NULL if PVECLIB_DISABLE_DFP.  */
+  void (*vec_dfp64_scale_array) (vec_d64_t *, vec_d64_t *, vec_d64_t,
+				 unsigned long);
+  /*! \brief vec_dotf16_array().  */
+  float (*vec_dotf16_array) (const unsigned short *, const unsigned short *,
+			     unsigned long);
+  /*! \brief vec_dotf16f32_array().  */
+  float (*vec_dotf16f32_array) (const unsigned short *, const float *,
+				unsigned long);
+  /*! \brief vec_dotbf16_array().  */
+  float (*vec_dotbf16_array) (const unsigned short *, const unsigned short *,
+			      unsigned long);
+  /*! \brief vec_dotbf16f32_array().  */
+  float (*vec_dotbf16f32_array) (const unsigned short *, const float *,
+				 unsigned long);
+  /*! \brief vec_cvf16f32_array().  */
+  void (*vec_cvf16f32_array) (float *, const unsigned short *, unsigned long);
+  /*! \brief vec_cvf32f16_array().  */
+  void (*vec_cvf32f16_array) (unsigned short *, const float *, unsigned long);
+  /*! \brief vec_cvbf16f32_array().  */
+  void (*vec_cvbf16f32_array) (float *, const unsigned short *, unsigned long);
+  /*! \brief vec_cvf32bf16_array().  */
+  void (*vec_cvf32bf16_array) (unsigned short *, const float *, unsigned long);
+  /*! \brief vec_f128_cff64_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cff64_array) (__binary128 *, const double *, unsigned long);
+  /*! \brief vec_f128_ctf64_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctf64_array) (double *, const __binary128 *, vec_round_t,
+				unsigned long);
+  /*! \brief vec_f128_cff32_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cff32_array) (__binary128 *, const float *, unsigned long);
+  /*! \brief vec_f128_ctf32_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctf32_array) (float *, const __binary128 *, vec_round_t,
+				unsigned long);
+  /*! \brief vec_f128_cfsw_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cfsw_array) (__binary128 *, const int *, unsigned long);
+  /*! \brief vec_f128_ctswz_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctswz_array) (int *, const __binary128 *, unsigned long);
+  /*! \brief vec_f128_cfuw_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cfuw_array) (__binary128 *, const unsigned int *,
+			       unsigned long);
+  /*! \brief vec_f128_ctuwz_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctuwz_array) (unsigned int *, const __binary128 *,
+				unsigned long);
+  /*! \brief vec_f128_cfsd_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cfsd_array) (__binary128 *, const long long *,
+			       unsigned long);
+  /*! \brief vec_f128_ctsdz_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctsdz_array) (long long *, const __binary128 *,
+				unsigned long);
+  /*! \brief vec_f128_cfud_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cfud_array) (__binary128 *, const unsigned long long *,
+			       unsigned long);
+  /*! \brief vec_f128_ctudz_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctudz_array) (unsigned long long *, const __binary128 *,
+				unsigned long);
+  /*! \brief vec_f128_cfsq_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cfsq_array) (__binary128 *, const vi128_t *, unsigned long);
+  /*! \brief vec_f128_ctsqz_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctsqz_array) (vi128_t *, const __binary128 *, unsigned long);
+  /*! \brief vec_f128_cfuq_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cfuq_array) (__binary128 *, const vui128_t *, unsigned long);
+  /*! \brief vec_f128_ctuqz_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctuqz_array) (vui128_t *, const __binary128 *,
+				unsigned long);
+  /*! \brief vec_xsrqpi_rnd_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_xsrqpi_rnd) (__binary128, vec_round_t);
+  /*! \brief vec_fmodf128_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_fmodf128) (__binary128, __binary128);
+  /*! \brief vec_remainderf128_dyn(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_remainderf128) (__binary128, __binary128);
+  /*! \brief vec_f128_cfibm_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_cfibm_array) (__binary128 *, const __IBM128 *,
+				unsigned long);
+  /*! \brief vec_f128_ctibm_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_ctibm_array) (__IBM128 *, const __binary128 *,
+				unsigned long);
+  /*! \brief vec_cosf64_array().  */
+  void (*vec_cosf64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_erff64_array().  */
+  void (*vec_erff64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_exp2f64_array().  */
+  void (*vec_exp2f64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_expf64_array().  */
+  void (*vec_expf64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_log2f64_array().  */
+  void (*vec_log2f64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_logf64_array().  */
+  void (*vec_logf64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_sinf64_array().  */
+  void (*vec_sinf64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_tanhf64_array().  */
+  void (*vec_tanhf64_array) (double *, const double *, unsigned long);
+  /*! \brief vec_powf64_array().  */
+  void (*vec_powf64_array) (double *, const double *, const double *,
+			    unsigned long);
+  /*! \brief vec_cosf32_array().  */
+  void (*vec_cosf32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_erff32_array().  */
+  void (*vec_erff32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_exp2f32_array().  */
+  void (*vec_exp2f32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_expf32_array().  */
+  void (*vec_expf32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_log2f32_array().  */
+  void (*vec_log2f32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_logf32_array().  */
+  void (*vec_logf32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_sinf32_array().  */
+  void (*vec_sinf32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_tanhf32_array().  */
+  void (*vec_tanhf32_array) (float *, const float *, unsigned long);
+  /*! \brief vec_powf32_array().  */
+  void (*vec_powf32_array) (float *, const float *, const float *,
+			    unsigned long);
+  /*! \brief vec_f128_dot_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_f128_dot_array) (const __binary128 *, const __binary128 *,
+				     unsigned long);
+  /*! \brief vec_f128_dotf64_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  __binary128 (*vec_f128_dotf64_array) (const double *, const double *,
+					unsigned long);
+  /*! \brief vec_f128_gemv(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_gemv) (unsigned long, unsigned long, __binary128,
+			 const __binary128 *, unsigned long,
+			 const __binary128 *, __binary128, __binary128 *);
+  /*! \brief vec_f128_gemvf64(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_gemvf64) (unsigned long, unsigned long, __binary128,
+			    const double *, unsigned long, const double *,
+			    __binary128, __binary128 *);
+  /*! \brief vec_f128_gemm(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_gemm) (unsigned long, unsigned long, unsigned long,
+			 __binary128, const __binary128 *, unsigned long,
+			 const __binary128 *, unsigned long, __binary128,
+			 __binary128 *, unsigned long);
+  /*! \brief vec_f128_gemmf64(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_f128_gemmf64) (unsigned long, unsigned long, unsigned long,
+			    __binary128, const double *, unsigned long,
+			    const double *, unsigned long, __binary128,
+			    __binary128 *, unsigned long);
+  /*! \brief vec_polyf64_array().  */
+  void (*vec_polyf64_array) (double *, const double *, const double *,
+			     unsigned long, unsigned long);
+  /*! \brief vec_polyf64_dd_array().  */
+  void (*vec_polyf64_dd_array) (double *, const double *, const double *,
+				unsigned long, unsigned long);
+  /*! \brief vec_polyf128_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_polyf128_array) (__binary128 *, const __binary128 *,
+			      const __binary128 *, unsigned long,
+			      unsigned long);
+  /*! \brief vec_polyf128f64_array(), NULL if PVECLIB_DISABLE_F128ARITH.  */
+  void (*vec_polyf128f64_array) (double *, const double *,
+				 const __binary128 *, unsigned long,
+				 vec_round_t, unsigned long);
+} vec_dispatch_t;
+
+/*! \brief Return the function pointer table for the platform selected
+ *  for this process.
+ *
+ *  The first call selects the table (the same selection as the IFUNC
+ *  resolvers), later calls return the cached pointer. Safe to call
+ *  from multiple threads.  */
+extern const vec_dispatch_t *
+vec_dispatch_table (void);
+
+#endif /* SRC_PVECLIB_VEC_DISPATCH_PPC_H_ */
@@ -1854,10 +1854,66 @@ static inline vec_xscvsqqp (vi128_t int128)
  * \endcode
  *
  * \subsubsection f128_softfloat_0_0_2_x Convert Quad-Precision to Double-Precision
- * TBD
+ *
+ * The basic narrowing operation is vec_xscvqpdpo(), Convert with
+ * Round to Odd. For POWER9 this is the xscvqpdpo instruction. For
+ * POWER8 the significand is shifted into double format and any
+ * nonzero guard, round or sticky bits are ORed into the low order
+ * bit. Round to odd keeps enough information for a later rounding
+ * to any narrower format. So:
+ * - vec_xscvqpsp() rounds the round to odd double to float in the
+ * current rounding mode. Double has more than 24+2 significand bits,
+ * so this is correctly rounded. There is no quad-precision to
+ * single-precision instruction. vec_xscvqpsp_rnd() rounds to float
+ * in any of the vec_round_t modes, as vec_xscvqpdp_rnd() below.
+ * - vec_xscvqpdp_rnd() rounds to double in any of the vec_round_t
+ * modes, independent of <B>FPSCR<sub>RN</sub></B>. If the round to
+ * odd result converts back to the same quad-precision value it is
+ * exact. Otherwise the result is odd, and it and its neighbor (plus
+ * or minus one as an integer) bracket the quad-precision value. The
+ * directed modes pick one of the two. The nearest modes compare
+ * against their midpoint, which is exact in quad-precision.
+ *
+ * The conversions to integer truncate (round toward zero) and
+ * saturate, like the POWER9/10 instructions:
+ * vec_xscvqpswz(), vec_xscvqpuwz(), vec_xscvqpsdz(), vec_xscvqpudz(),
+ * vec_xscvqpsqz() and vec_xscvqpuqz(). The word results are returned
+ * extended to doubleword element 0, as the instructions do.
+ * vec_xscvqpsw_rnd() and vec_xscvqpuw_rnd() round to word integers
+ * in any of the vec_round_t modes (through vec_xsrqpi_rnd()).
+ * Conversions from float (vec_xscvspqp()), double and word or
+ * doubleword integers are exact.
+ *
+ * libpvec provides the array form of each of these, for example
+ * vec_f128_ctf64_array() and vec_f128_cfsq_array(). These convert
+ * 4 independent elements per iteration so the POWER8 emulation
+ * sequences overlap.
  *
  * \subsubsection f128_softfloat_0_0_2_y Round to Quad-Precision Integer
- * TBD
+ *
+ * POWER9 provides the <B>VSX Scalar Round to Quad-Precision Integer
+ * <I>(xsrqpi)</I></B> instruction with the rounding mode as
+ * immediate operands (R and RMC). For POWER8 the same result is
+ * computed on the binary representation. The unbiased exponent
+ * gives the number of fraction bits. Masking them off truncates
+ * the value and adding one unit in the last integral position
+ * (as a quadword integer) rounds the magnitude up. A carry into the
+ * exponent field is the correct result for a significand of all
+ * ones. The remaining question is which of the two to return,
+ * which depends only on the rounding mode, the sign and the
+ * fraction bits. See vec_xsrqpi_rnd().
+ *
+ * The C library equivalents are built on this:
+ * vec_floorf128(), vec_ceilf128(), vec_truncf128(),
+ * vec_roundf128() (ties away from zero) and vec_rintf128()
+ * (<B>FPSCR<sub>RN</sub></B>). vec_modff128() subtracts the
+ * truncated value, which is exact.
+ *
+ * The remainder operations vec_fmodf128() and vec_remainderf128()
+ * are also exact. There is no instruction for these, even for
+ * POWER9. The normalized significands are treated as quadword
+ * integers and reduced with shift and conditional subtract over
+ * the exponent difference.
  *
  * \subsection f128_softfloat_0_0_3 Quad-Precision Arithmetic
  *
@@ -3009,6 +3065,74 @@ test_vec_subqpo_V1 (__binary128 src1, __binary128 src2)
  * - Otherwise if <B>src1</B> is finite and <B>src2</B> is infinity then
  * return negative <B>src2</B>.
  *
+ * \subsubsection f128_softfloat_0_0_3_4 Multiply-Add Quad-Precision with Round-to-Odd.
+ *
+ * For POWER9 vec_xsmaddqpo() uses the xsmaddqpo instruction
+ * (fused, one rounding). For POWER8 it is vec_xsmulqpo() followed
+ * by vec_xsaddqpo(), which rounds twice. This is the same as the
+ * fused result when the product is exact, for example the product
+ * of two values converted from double (at most 106 significant
+ * bits). vec_xsmaddqpn(), vec_xsaddqpn() and vec_xsmulqpn() are the
+ * round to nearest (ties to even) forms.
+ *
+ * libpvec builds binary128 linear algebra kernels on this:
+ * vec_f128_dot_array(), vec_f128_gemv() and vec_f128_gemm(), and
+ * the mixed precision forms vec_f128_dotf64_array(),
+ * vec_f128_gemvf64() and vec_f128_gemmf64(), which take double
+ * matrices and vectors and accumulate in binary128. The intended
+ * use is the residual (r = b - A x) of an iterative refinement
+ * solver, where double accumulation would cancel most of the
+ * significant bits.
+ *
+ * The multiply-add latency (about 130 cycles for the POWER8
+ * emulation, 24 for POWER9) is the limit for a single sum. So the
+ * kernels keep several independent accumulators in flight; 4 for
+ * the dot products, 4 rows for vec_f128_gemv() and a 2x4 block of
+ * C for vec_f128_gemm(). The partial sums are added at the end.
+ * The matrices are row-major with a leading dimension (the stride
+ * between rows, in elements) and need not be quadword aligned.
+ *
+ * The partial sums are rounded to odd. The last multiply-add of
+ * each sum (vec_xsmaddqpn()) and the alpha and beta scaling round
+ * to nearest, so the returned or stored binary128 results (for
+ * example a residual) are not biased toward odd.
+ * A fused multiply-add (POWER9) adds at most 1 ULP (binary128) of
+ * its result. The POWER8 multiply-add rounds the product and then
+ * the sum, so adds up to 2 ULP, unless the product is exact as for
+ * the f64 forms. So the error bound is the usual n (POWER9 and the
+ * f64 forms) or 2n (POWER8) ULP for a sum of n products, but with
+ * 2<sup>-112</sup> in place of 2<sup>-52</sup>.
+ *
+ * \subsubsection f128_softfloat_0_0_3_5 Polynomial evaluation with Round-to-Odd.
+ *
+ * vec_polyf128o() evaluates a polynomial from an array of binary128
+ * coefficients with vec_xsmaddqpo(), by Horner's rule below degree 7
+ * and blocks of 8 coefficients by Estrin's scheme above (as
+ * vec_polyf64(), see vec_f64_ppc.h). Each intermediate result, and
+ * the result, is rounded to odd. This is not the round to odd of the
+ * exact value. Each step rounds, so the result has up to 1 ULP
+ * (binary128) of error per multiply-add (2 for the POWER8
+ * vec_xsmaddqpo()). But a conversion of the result to double (or
+ * float) with vec_xscvqpdp_rnd() rounds it only once. With 60 more
+ * bits than double the double result is the correctly rounded value
+ * of the polynomial, unless the exact value is within those few
+ * binary128 ULPs of a double rounding boundary (a midpoint for
+ * round to nearest).
+ *
+ * vec_polyf128() is the same evaluation for a binary128 result. It
+ * evaluates c[1..deg] with vec_polyf128o() and the final
+ * c[0] + x * p with vec_xsmaddqpn(), so the result is rounded to
+ * nearest (ties to even), and is not biased toward odd.
+ *
+ * For example the Taylor series for exp in the timed_expxsuba
+ * kernels of vec_perf_f128.c (1/n! coefficients) is
+ * vec_polyf128 (x, inv_fact, 8).
+ *
+ * libpvec provides vec_polyf128_array() and the mixed precision
+ * vec_polyf128f64_array(), which takes double arguments (converted
+ * exactly) and returns the double results with a single final
+ * rounding, in the rounding mode given.
+ *
  * \subsection f128_softfloat_0_0_4 Constants and Masks for Quad-Precision Soft-float
  * The implementation examples above require a number of __binary128,
  * vector __int128, and vector long long constants. These are used as
@@ -3721,6 +3845,17 @@ static inline __binary128 vec_xsiexpqp (vui128_t sig, vui64_t exp);
 static inline vui64_t vec_xsxexpqp (__binary128 f128);
 static inline vui128_t vec_xsxsigqp (__binary128 f128);
 static inline vui64_t vec_xxxexpqpp (__binary128 vfa, __binary128 vfb);
+static inline __binary128 vec_xsaddqpn (__binary128 vfa, __binary128 vfb);
+static inline __binary128 vec_xsaddqpo (__binary128 vfa, __binary128 vfb);
+static inline __binary128 vec_xsmaddqpn (__binary128 vfa, __binary128 vfb,
+					 __binary128 vfc);
+static inline __binary128 vec_xsmaddqpo (__binary128 vfa, __binary128 vfb,
+					 __binary128 vfc);
+static inline __binary128 vec_xsmulqpn (__binary128 vfa, __binary128 vfb);
+static inline __binary128 vec_xsmulqpo (__binary128 vfa, __binary128 vfb);
+static inline __binary128 vec_xssubqpo (__binary128 vfa, __binary128 vfb);
+static inline __binary128 vec_xsrqpi_rnd (__binary128 f128, vec_round_t rnd);
+static inline __binary128 vec_truncf128 (__binary128 f128);
 ///@endcond
 
 /** \brief Generate doubleword splat constant 128.
@@ -4922,6 +5057,25 @@ vec_all_iszerof128 (__binary128 f128)
 #endif
 }
 
+/** \brief Round quad-precision to integral toward +Infinity.
+ *
+ *  Equivalent to ceilf128() but inline and without the library
+ *  call. See vec_xsrqpi_rnd().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 20-40 | 1/cycle  |
+ *  |power9   |  12   | 1/cycle  |
+ *
+ *  @param f128 a __binary128 value.
+ *  @return the smallest integral value not less than f128.
+ */
+static inline __binary128
+vec_ceilf128 (__binary128 f128)
+{
+  return vec_xsrqpi_rnd (f128, VEC_ROUND_CEIL);
+}
+
 /** \brief Copy the sign bit from f128x and merge with the magnitude
  *  from f128y. The merged result is returned as a __float128 value.
  *
@@ -7506,6 +7660,138 @@ vec_cmpqp_exp_unordered (__binary128 vfa, __binary128 vfb)
 #endif
 }
 
+/** \brief Round quad-precision to integral toward -Infinity.
+ *
+ *  Equivalent to floorf128() but inline and without the library
+ *  call. See vec_xsrqpi_rnd().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 20-40 | 1/cycle  |
+ *  |power9   |  12   | 1/cycle  |
+ *
+ *  @param f128 a __binary128 value.
+ *  @return the largest integral value not greater than f128.
+ */
+static inline __binary128
+vec_floorf128 (__binary128 f128)
+{
+  return vec_xsrqpi_rnd (f128, VEC_ROUND_FLOOR);
+}
+
+/** \brief Quad-precision floating point remainder, rounded toward
+ *  zero quotient.
+ *
+ *  Equivalent to fmodf128(). The result is f128x - n * f128y where
+ *  n is the quotient f128x / f128y truncated to an integer. The
+ *  result has the sign of f128x and a magnitude less than f128y.
+ *  The result is always exact.
+ *
+ *  If either operand is a NaN the result is a quiet NaN. If f128x is
+ *  infinite or f128y is zero the result is the default NaN. If f128y
+ *  is infinite (and f128x finite) or f128x is zero the result is
+ *  f128x.
+ *
+ *  There is no quad-precision instruction for this. Both
+ *  significands are normalized (bit 112 set) as unsigned quadword
+ *  integers and the remainder is computed by shift and conditional
+ *  subtract, one bit for each unit of the exponent difference. The
+ *  remainder is then normalized and the exponent of f128y inserted.
+ *  So the latency is proportional to the exponent difference.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |60+8/bit| 1/cycle |
+ *  |power9   |40+6/bit| 1/cycle |
+ *
+ *  @param f128x the dividend.
+ *  @param f128y the divisor.
+ *  @return the remainder of f128x / f128y.
+ */
+static inline __binary128
+vec_fmodf128 (__binary128 f128x, __binary128 f128y)
+{
+  __binary128 result;
+  vui128_t x_sig, y_sig, r_sig;
+  vui32_t q_sign;
+  long x_exp, y_exp, k, lz;
+  const vui128_t q_zero = { 0 };
+  const vui32_t signmask = vec_mask128_f128sign ();
+  const vui32_t sigmask = vec_mask128_f128sig ();
+
+  if (__builtin_expect (vec_all_isnanf128 (f128x)
+			|| vec_all_isnanf128 (f128y), 0))
+    // Return the quieted NaN operand.
+    return vec_xsaddqpo (f128x, f128y);
+  if (__builtin_expect (vec_all_isinff128 (f128x)
+			|| vec_all_iszerof128 (f128y), 0))
+    return vec_const_nanf128 ();
+  if (__builtin_expect (vec_all_isinff128 (f128y)
+			|| vec_all_iszerof128 (f128x), 0))
+    return f128x;
+
+  q_sign = vec_and_bin128_2_vui32t (f128x, signmask);
+  x_exp = vec_xsxexpqp (f128x)[VEC_DW_H];
+  y_exp = vec_xsxexpqp (f128y)[VEC_DW_H];
+  x_sig = vec_xsxsigqp (f128x);
+  y_sig = vec_xsxsigqp (f128y);
+  // Denormals have an effective exponent of 1, then normalize so
+  // both significands have bit 112 set.
+  if (x_exp == 0)
+    {
+      x_exp = 1;
+      lz = ((vui64_t) vec_clzq (x_sig))[VEC_DW_L] - 15;
+      x_sig = vec_slq (x_sig, (vui128_t) vec_splats ((unsigned long long) lz));
+      x_exp -= lz;
+    }
+  if (y_exp == 0)
+    {
+      y_exp = 1;
+      lz = ((vui64_t) vec_clzq (y_sig))[VEC_DW_L] - 15;
+      y_sig = vec_slq (y_sig, (vui128_t) vec_splats ((unsigned long long) lz));
+      y_exp -= lz;
+    }
+  // |f128x| < |f128y|
+  if (x_exp < y_exp)
+    return f128x;
+
+  // The remainder stays less than 2 * y_sig < 2**114.
+  r_sig = x_sig;
+  for (k = x_exp - y_exp; k > 0; k--)
+    {
+      r_sig = vec_seluq (r_sig, vec_subuqm (r_sig, y_sig),
+			 vec_cmpgeuq (r_sig, y_sig));
+      r_sig = vec_slqi (r_sig, 1);
+    }
+  r_sig = vec_seluq (r_sig, vec_subuqm (r_sig, y_sig),
+		     vec_cmpgeuq (r_sig, y_sig));
+
+  if (vec_cmpuq_all_eq (r_sig, q_zero))
+    return vec_xfer_vui32t_2_bin128 (q_sign);
+
+  lz = ((vui64_t) vec_clzq (r_sig))[VEC_DW_L] - 15;
+  if ((y_exp - lz) >= 1)
+    {
+      r_sig = vec_slq (r_sig, (vui128_t) vec_splats ((unsigned long long) lz));
+      y_exp -= lz;
+    }
+  else
+    { // Denormal result, the bits shifted out (if any) are zero.
+      if (y_exp >= 1)
+	r_sig = vec_slq (r_sig,
+			 (vui128_t) vec_splats ((unsigned long long) (y_exp - 1)));
+      else
+	r_sig = vec_srq (r_sig,
+			 (vui128_t) vec_splats ((unsigned long long) (1 - y_exp)));
+      y_exp = 0;
+    }
+  r_sig = (vui128_t) vec_and ((vui32_t) r_sig, sigmask);
+  r_sig = (vui128_t) vec_or ((vui32_t) r_sig, q_sign);
+  result = vec_xsiexpqp (r_sig,
+			 vec_splats ((unsigned long long) y_exp));
+  return result;
+}
+
 /** \brief Return 128-bit vector boolean true if the __float128 value
  *  is Finite (Not NaN nor Inf).
  *
@@ -7836,6 +8122,37 @@ vec_iszerof128 (__binary128 f128)
 #endif
 }
 
+/** \brief Split quad-precision into integral and fractional parts.
+ *
+ *  Equivalent to modff128(). The integral part
+ *  (vec_truncf128()) is stored to *iptr and the fraction
+ *  returned. Both have the sign of f128, infinities return a zero
+ *  fraction. The subtraction is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 60-90 | 1/cycle  |
+ *  |power9   |  24   | 1/cycle  |
+ *
+ *  @param f128 a __binary128 value.
+ *  @param iptr pointer to store the integral part.
+ *  @return the fractional part of f128.
+ */
+static inline __binary128
+vec_modff128 (__binary128 f128, __binary128 *iptr)
+{
+  __binary128 f_int, result;
+  const vui32_t q_zero = CONST_VINT128_W (0, 0, 0, 0);
+
+  f_int = vec_truncf128 (f128);
+  *iptr = f_int;
+  if (__builtin_expect (vec_all_isinff128 (f128), 0))
+    result = vec_xfer_vui32t_2_bin128 (q_zero);
+  else
+    result = vec_xssubqpo (f128, f_int);
+  return vec_copysignf128 (f128, result);
+}
+
 /** \brief Negative Absolute value Quad-Precision
  *
  *  Unconditionally set sign bit of the __float128 input
@@ -7908,6 +8225,281 @@ vec_negf128 (__binary128 f128)
   return (result);
 }
 
+///@cond INTERNAL
+/** \brief Horner's rule for the coefficients c[0..deg], rounded to
+ *  odd.  */
+static inline __binary128
+vec_polyf128_horner (__binary128 x, const __binary128 *c,
+		     unsigned long deg)
+{
+  __binary128 result;
+  unsigned long i;
+
+  result = c[deg];
+  for (i = deg; i > 0; i--)
+    result = vec_xsmaddqpo (result, x, c[i - 1]);
+  return result;
+}
+
+/** \brief Estrin's scheme for the 8 coefficients c[0..7], given x,
+ *  x**2 and x**4, rounded to odd.  */
+static inline __binary128
+vec_polyf128_estrin8 (__binary128 x, __binary128 x2, __binary128 x4,
+		      const __binary128 *c)
+{
+  __binary128 p0, p1, p2, p3;
+
+  p0 = vec_xsmaddqpo (c[1], x, c[0]);
+  p1 = vec_xsmaddqpo (c[3], x, c[2]);
+  p2 = vec_xsmaddqpo (c[5], x, c[4]);
+  p3 = vec_xsmaddqpo (c[7], x, c[6]);
+  p0 = vec_xsmaddqpo (p1, x2, p0);
+  p2 = vec_xsmaddqpo (p3, x2, p2);
+  return vec_xsmaddqpo (p2, x4, p0);
+}
+
+/** \brief Blocks of 8 coefficients by Estrin's scheme, combined by
+ *  Horner's rule in x**8, rounded to odd. The top (deg+1)%8
+ *  coefficients are a Horner's rule block.  */
+static inline __binary128
+vec_polyf128_estrin (__binary128 x, const __binary128 *c,
+		     unsigned long deg)
+{
+  __binary128 x2, x4, x8, result;
+  unsigned long nb, top;
+
+  x2 = vec_xsmulqpo (x, x);
+  x4 = vec_xsmulqpo (x2, x2);
+  x8 = vec_xsmulqpo (x4, x4);
+  nb = (deg + 1) / 8;
+  top = (deg + 1) % 8;
+  if (top)
+    result = vec_polyf128_horner (x, &c[8 * nb], top - 1);
+  else
+    {
+      nb = nb - 1;
+      result = vec_polyf128_estrin8 (x, x2, x4, &c[8 * nb]);
+    }
+  for (; nb > 0; nb--)
+    result = vec_xsmaddqpo (result, x8,
+			    vec_polyf128_estrin8 (x, x2, x4,
+						  &c[8 * (nb - 1)]));
+  return result;
+}
+///@endcond
+
+/** \brief Quad-precision polynomial evaluation with round to odd.
+ *
+ *  Computes c[0] + c[1]*x + ... + c[deg]*x**deg with
+ *  vec_xsmaddqpo(), so every intermediate result is rounded to odd.
+ *  Below degree 7 this is Horner's rule. From degree 7 the
+ *  coefficients are split into blocks of 8, each evaluated with
+ *  Estrin's scheme, and the blocks combined with Horner's rule in
+ *  x**8. The blocks are independent, which lets the POWER8
+ *  emulation sequences (and the POWER9 multiply-add latency)
+ *  overlap. See \ref f128_softfloat_0_0_3_5.
+ *
+ *  The result is rounded to odd. Convert it with
+ *  vec_xscvqpdp_rnd() (or vec_xscvqpdpo()) for a double result with
+ *  a single final rounding. For a binary128 result use
+ *  vec_polyf128().
+ *
+ *  The table is for degree 15.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |700-800| 1/cycle  |
+ *  |power9   |130-150|1/216 cycle|
+ *
+ *  @param x a __binary128 value.
+ *  @param c pointer to the deg+1 __binary128 coefficients, constant
+ *  term first.
+ *  @param deg degree of the polynomial.
+ *  @return a __binary128 value of the polynomial at x.
+ */
+static inline __binary128
+vec_polyf128o (__binary128 x, const __binary128 *c, unsigned long deg)
+{
+  __binary128 result;
+
+  if (deg < 7)
+    result = vec_polyf128_horner (x, c, deg);
+  else
+    result = vec_polyf128_estrin (x, c, deg);
+  return result;
+}
+
+/** \brief Quad-precision polynomial evaluation.
+ *
+ *  Computes c[0] + c[1]*x + ... + c[deg]*x**deg. The coefficients
+ *  c[1..deg] are evaluated as vec_polyf128o(), with round to odd,
+ *  then c[0] is added to x times that with vec_xsmaddqpn(). So the
+ *  result is rounded to nearest (ties to even). Below degree 8 this
+ *  is Horner's rule.
+ *  See \ref f128_softfloat_0_0_3_5.
+ *
+ *  The table is for degree 15.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |830-960| 1/cycle  |
+ *  |power9   |150-175|1/240 cycle|
+ *
+ *  @param x a __binary128 value.
+ *  @param c pointer to the deg+1 __binary128 coefficients, constant
+ *  term first.
+ *  @param deg degree of the polynomial.
+ *  @return a __binary128 value of the polynomial at x.
+ */
+static inline __binary128
+vec_polyf128 (__binary128 x, const __binary128 *c, unsigned long deg)
+{
+  __binary128 result;
+
+  if (deg == 0)
+    result = c[0];
+  else
+    result = vec_xsmaddqpn (vec_polyf128o (x, &c[1], deg - 1), x, c[0]);
+  return result;
+}
+
+/** \brief Quad-precision IEEE remainder.
+ *
+ *  Equivalent to remainderf128(). The result is f128x - n * f128y
+ *  where n is the quotient f128x / f128y rounded to the nearest
+ *  integer (ties to even). The magnitude is at most half of f128y.
+ *  A zero result has the sign of f128x. The result is always exact.
+ *  The special cases are as for vec_fmodf128().
+ *
+ *  This is computed as vec_fmodf128() with divisor 2 * f128y,
+ *  leaving a magnitude less than 2 * f128y. Then at most two exact
+ *  subtractions of f128y give the round to nearest even quotient.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |150+8/bit| 1/cycle|
+ *  |power9   |60+6/bit| 1/cycle |
+ *
+ *  @param f128x the dividend.
+ *  @param f128y the divisor.
+ *  @return the remainder of f128x / f128y.
+ */
+static inline __binary128
+vec_remainderf128 (__binary128 f128x, __binary128 f128y)
+{
+  __binary128 x_abs, y_abs, y_half;
+  vui32_t q_sign, t_bits;
+  long y_exp;
+  const vui32_t signmask = vec_mask128_f128sign ();
+  const vui64_t q_half = CONST_VINT64_DW (0x3ffe000000000000, 0);
+
+  if (__builtin_expect (vec_all_isnanf128 (f128x)
+			|| vec_all_isnanf128 (f128y), 0))
+    return vec_xsaddqpo (f128x, f128y);
+  if (__builtin_expect (vec_all_isinff128 (f128x)
+			|| vec_all_iszerof128 (f128y), 0))
+    return vec_const_nanf128 ();
+  if (__builtin_expect (vec_all_isinff128 (f128y), 0))
+    return f128x;
+
+  q_sign = vec_and_bin128_2_vui32t (f128x, signmask);
+  y_abs = vec_absf128 (f128y);
+  y_exp = vec_xsxexpqp (f128y)[VEC_DW_H];
+  // Reduce to less than 2 * |f128y|, unless that overflows.
+  if (y_exp < 0x7ffe)
+    x_abs = vec_absf128 (vec_fmodf128 (f128x, vec_xsaddqpo (y_abs, y_abs)));
+  else
+    x_abs = vec_absf128 (f128x);
+
+  if (y_exp < 2)
+    { // |f128y| / 2 may not be exact, compare 2 * x_abs instead.
+      if (vec_cmpqp_all_gt (vec_xsaddqpo (x_abs, x_abs), y_abs))
+	{
+	  x_abs = vec_xssubqpo (x_abs, y_abs);
+	  if (vec_cmpqp_all_ge (vec_xsaddqpo (x_abs, x_abs), y_abs))
+	    x_abs = vec_xssubqpo (x_abs, y_abs);
+	}
+    }
+  else
+    {
+      y_half = vec_xsmulqpo (y_abs, vec_xfer_vui64t_2_bin128 (q_half));
+      if (vec_cmpqp_all_gt (x_abs, y_half))
+	{
+	  x_abs = vec_xssubqpo (x_abs, y_abs);
+	  if (vec_cmpqp_all_ge (x_abs, y_half))
+	    x_abs = vec_xssubqpo (x_abs, y_abs);
+	}
+    }
+  // Apply the sign of f128x, which may negate a negative result.
+  t_bits = vec_xor (vec_xfer_bin128_2_vui32t (x_abs), q_sign);
+  return vec_xfer_vui32t_2_bin128 (t_bits);
+}
+
+/** \brief Round quad-precision to integral in the current rounding
+ *  mode.
+ *
+ *  Equivalent to rintf128() (but does not set the inexact
+ *  exception). The rounding mode is <B>FPSCR<sub>RN</sub></B>.
+ *
+ *  For POWER9 use the xsrqpi instruction with R=0 and RMC=0b11.
+ *  For POWER8 and earlier read the rounding mode from the FPSCR and
+ *  call vec_xsrqpi_rnd().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 26-46 | 1/cycle  |
+ *  |power9   |  12   | 1/cycle  |
+ *
+ *  @param f128 a __binary128 value.
+ *  @return f128 rounded to an integral value.
+ */
+static inline __binary128
+vec_rintf128 (__binary128 f128)
+{
+  __binary128 result;
+#if defined (_ARCH_PWR9) && defined (__FLOAT128__) && (__GNUC__ > 7)
+  __asm__(
+      "xsrqpi 0,%0,%1,3"
+      : "=v" (result)
+      : "v" (f128)
+      : );
+#else
+  // FPSCR[RN] 0b00 Nearest, 0b01 Toward Zero, 0b10 +Inf, 0b11 -Inf
+  const vec_round_t fpscr_rn[4] = { VEC_ROUND_HALF_EVEN, VEC_ROUND_TRUNC,
+				    VEC_ROUND_CEIL, VEC_ROUND_FLOOR };
+  double fpscr;
+  unsigned long long rn;
+
+  __asm__ __volatile__(
+      "mffs %0"
+      : "=f" (fpscr)
+      : : );
+  rn = ((vui64_t) vec_splats (fpscr))[VEC_DW_H] & 3;
+  result = vec_xsrqpi_rnd (f128, fpscr_rn[rn]);
+#endif
+  return result;
+}
+
+/** \brief Round quad-precision to the nearest integral, ties away
+ *  from zero.
+ *
+ *  Equivalent to roundf128() but inline and without the library
+ *  call. See vec_xsrqpi_rnd().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 20-40 | 1/cycle  |
+ *  |power9   |  12   | 1/cycle  |
+ *
+ *  @param f128 a __binary128 value.
+ *  @return f128 rounded to the nearest integral value.
+ */
+static inline __binary128
+vec_roundf128 (__binary128 f128)
+{
+  return vec_xsrqpi_rnd (f128, VEC_ROUND_HALF_UP);
+}
+
 /** \brief Select and Transfer from one of two __binary128 scalars
  * under a 128-bit mask. The result is a __binary128 of the selected
  * value.
@@ -8006,6 +8598,25 @@ vec_signbitf128 (__binary128 f128)
 #endif
 }
 
+/** \brief Round quad-precision to integral toward zero.
+ *
+ *  Equivalent to truncf128() but inline and without the library
+ *  call. See vec_xsrqpi_rnd().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 20-40 | 1/cycle  |
+ *  |power9   |  12   | 1/cycle  |
+ *
+ *  @param f128 a __binary128 value.
+ *  @return the integral part of f128.
+ */
+static inline __binary128
+vec_truncf128 (__binary128 f128)
+{
+  return vec_xsrqpi_rnd (f128, VEC_ROUND_TRUNC);
+}
+
 /** \brief VSX Scalar Add Quad-Precision using round to Odd.
  *
  *  The quad-precision element of vectors vfa and vfb are added
@@ -8274,49 +8885,53 @@ vec_xsaddqpo (__binary128 vfa, __binary128 vfb)
   return result;
 }
 
-/** \brief VSX Scalar Subtract Quad-Precision using round to Odd.
+/** \brief VSX Scalar Add Quad-Precision using round to Nearest.
  *
- *  The quad-precision element of vector vfb is subtracted from vfa
+ *  The quad-precision element of vectors vfa and vfb are added
  *  to produce the quad-precision result.
- *  The rounding mode is round to odd.
- *
- *  For POWER9 use the xssubqpo instruction.
- *  For POWER8 use this soft-float implementation using
- *  vector instruction generated by PVECLIB operations.
+ *  The rounding mode is round to nearest, ties to even.
+ *
+ *  For POWER9 use the xsaddqp instruction, which rounds as
+ *  <B>FPSCR<sub>RN</sub></B> (round to nearest unless the program
+ *  changed it).
+ *  For POWER8 use the soft-float implementation of vec_xsaddqpo()
+ *  with a round to nearest even step in place of round to odd.
+ *  The truncated result is incremented (as an unsigned quadword)
+ *  if the GRX-bits are more than half, or exactly half and the
+ *  least significant bit is 1. A carry propagates into the
+ *  exponent, up to Infinity on overflow.
  *  For POWER7 and earlier us the compilers soft-float implementation.
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xsmulqpo instruction,
- *  the implementation may use that.
  *
  *  |processor|Latency|Throughput|
  *  |--------:|:-----:|:---------|
- *  |power8   | 51-70 | 1/cycle  |
+ *  |power8   | 58-76 | 1/cycle  |
  *  |power9   |   12  |1/12 cycle|
  *
  *  @param vfa 128-bit vector treated as a scalar __binary128.
  *  @param vfb 128-bit vector treated as a scalar __binary128.
- *  @return a vector unsigned __int128 value.
+ *  @return a __binary128 value of vfa + vfb.
  */
 static inline __binary128
-vec_xssubqpo (__binary128 vfa, __binary128 vfb)
+vec_xsaddqpn (__binary128 vfa, __binary128 vfb)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
 #if defined (__FLOAT128__) && (__GNUC__ > 8)
-  // earlier GCC versions generate extra data moves for this.
-  result = __builtin_subf128_round_to_odd (vfa, vfb);
+  // Let the compilers generate and optimize code.
+  result = vfa + vfb;
 #else
   // No extra data moves here.
   __asm__(
-      "xssubqpo %0,%1,%2"
+      "xsaddqp %0,%1,%2"
       : "=v" (result)
       : "v" (vfa), "v" (vfb)
       : );
 #endif
   return result;
-#else //  defined (_ARCH_PWR7)
+#else // defined (_ARCH_PWR7)
   vui64_t q_exp, a_exp, b_exp, x_exp;
   vui128_t q_sig, a_sig, b_sig, p_tmp, p_odd;
   vui128_t a_mag, b_mag;
@@ -8339,13 +8954,12 @@ vec_xssubqpo (__binary128 vfa, __binary128 vfb)
     {
       const vui128_t xbitmask = vec_splat_u128 (1);
       const vui128_t grx_mask = vec_splat_u128 (7);
+      const vui128_t rnd_bias = vec_splat_u128 (3);
       const vui64_t exp_min = vec_splat_u64 (1);
       const vui8_t t_sig_L = vec_splat_u8 (7);
       const vui8_t t_sig_C = vec_splat_u8 (15);
       const vui64_t exp_one = exp_min;
       const vui64_t exp_dnrm = (vui64_t) q_zero;
-      // signmask is the complement of the magmask
-      const vui32_t signmask = vec_nor(magmask, magmask);
       vui128_t add_sig, sub_sig;
       vui128_t s_sig, x_bits;
       vui32_t diff_sign;
@@ -8371,8 +8985,6 @@ vec_xssubqpo (__binary128 vfa, __binary128 vfb)
       // will force 0 exponents for zero/denormal results later
       //exp_mask = vec_cmpequd (x_exp, exp_dnrm);
       x_exp = vec_selud ( exp_min, x_exp, (vb64_t) x_norm);
-      // Negate sign for subtract, then use add logic
-      b_sign = vec_xor (signmask, b_sign);
       // Generation sign difference for signed 0.0
       q_sign = vec_xor (a_sign, b_sign);
       // Precondition the significands before add so the GRX bits
@@ -8481,22 +9093,28 @@ vec_xssubqpo (__binary128 vfa, __binary128 vfb)
 	    s_sig = vec_seluq (s_sig, c_sig, (vb128_t) nrm_mask);
 	  }
 	}
-      // Round to odd from low order GRX-bits
-      p_tmp = (vui128_t) vec_and ((vui32_t) s_sig, (vui32_t) grx_mask);
-      p_odd = vec_addcuq (p_tmp, (vui128_t) q_ones);
-      q_sig = vec_srqi (s_sig, 3);
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
-      // Check for exponent overflow -> __FLT128_MAX__
+      // Check for exponent overflow -> Infinity
       if (__builtin_expect ((vec_cmpud_all_ge ( q_exp, exp_naninf)), 0))
 	{
-	  // return maximum finite exponent and significand
-	  const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
-	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
-	  return vec_xfer_vui32t_2_bin128 (f128_smax);
+	  // return signed infinity
+	  vui32_t f128_sinf = vec_or (vec_mask128_f128exp (), q_sign);
+	  return vec_xfer_vui32t_2_bin128 (f128_sinf);
 	}
-      // Merge sign, significand, and exponent into final result
+      // Round to nearest even from low order GRX-bits. Round up if
+      // (GRX + L + 3) carries into bit 3, that is GRX > 4, or
+      // GRX == 4 and L == 1.
+      q_sig = vec_srqi (s_sig, 3);
+      p_tmp = (vui128_t) vec_and ((vui32_t) s_sig, (vui32_t) grx_mask);
+      p_odd = (vui128_t) vec_and ((vui32_t) q_sig, (vui32_t) xbitmask);
+      p_tmp = vec_adduqm (p_tmp, vec_adduqm (p_odd, rnd_bias));
+      p_tmp = vec_srqi (p_tmp, 3);
+      // Merge the exponent and significand, then add the round bit.
+      // A carry out of the significand increments the exponent.
+      q_sig = vec_xfer_bin128_2_vui128t (vec_xsiexpqp (q_sig, q_exp));
+      q_sig = vec_adduqm (q_sig, p_tmp);
+      // Merge sign into final result
       q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
-      result = vec_xsiexpqp (q_sig, q_exp);
+      result = vec_xfer_vui128t_2_bin128 (q_sig);
       return result;
     }
   else // One or both operands are NaN or Infinity
@@ -8521,9 +9139,9 @@ vec_xssubqpo (__binary128 vfa, __binary128 vfb)
 	  a_exp = vec_splatd (x_exp, VEC_DW_H);
 	  // b_exp = vec_splatd (x_exp, VEC_DW_L);
 	  if (vec_cmpud_all_eq (x_exp, exp_naninf)
-	      && vec_cmpud_all_eq ((vui64_t) a_sign, (vui64_t) b_sign))
+	      && vec_cmpud_any_ne ((vui64_t) a_sign, (vui64_t) b_sign))
 	    { // Both operands infinity and opposite sign
-	      // Inifinty - Infinity (same sign) is Default Quiet NaN
+	      // Inifinty + Infinity (opposite sign) is Default Quiet NaN
 	      return vec_const_nanf128 ();
 	    }
 	  else
@@ -8537,7 +9155,7 @@ vec_xssubqpo (__binary128 vfa, __binary128 vfb)
 	      else
 		{
 		  // return infinity
-		  return vec_negf128(vfb);
+		  return vfb;
 		}
 	    }
 	}
@@ -8546,92 +9164,364 @@ vec_xssubqpo (__binary128 vfa, __binary128 vfb)
   return result;
 }
 
-/** \brief VSX Scalar Convert Double-Precision to Quad-Precision format.
+/** \brief VSX Scalar Subtract Quad-Precision using round to Odd.
  *
- *  The left most double-precision element of vector f64 is converted
- *  to quad-precision format.
+ *  The quad-precision element of vector vfb is subtracted from vfa
+ *  to produce the quad-precision result.
+ *  The rounding mode is round to odd.
  *
- *  For POWER9 use the xscvdpqp instruction.
- *  For POWER8 and earlier use vector instruction generated by PVECLIB
- *  operations.
+ *  For POWER9 use the xssubqpo instruction.
+ *  For POWER8 use this soft-float implementation using
+ *  vector instruction generated by PVECLIB operations.
+ *  For POWER7 and earlier us the compilers soft-float implementation.
  *
  *  \note This operation <I>may not</I> follow the PowerISA
- *  relative to Signaling NaN and setting the FPSCR.
- *  However if the hardware target includes the xscvdpqp instruction,
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xsmulqpo instruction,
  *  the implementation may use that.
  *
  *  |processor|Latency|Throughput|
  *  |--------:|:-----:|:---------|
- *  |power8   |   ?   | 2/cycle  |
- *  |power9   |   3   | 2/cycle  |
+ *  |power8   | 51-70 | 1/cycle  |
+ *  |power9   |   12  |1/12 cycle|
  *
- *  @param f64 a vector double. The left most element is converted.
- *  @return a __binary128 value.
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @return a vector unsigned __int128 value.
  */
-__binary128
-static inline vec_xscvdpqp (vf64_t f64)
+static inline __binary128
+vec_xssubqpo (__binary128 vfa, __binary128 vfb)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
-#if defined (__FLOAT128__) && (__GNUC__ > 9)
+#if defined (__FLOAT128__) && (__GNUC__ > 8)
   // earlier GCC versions generate extra data moves for this.
-  result = f64[VEC_DW_H];
+  result = __builtin_subf128_round_to_odd (vfa, vfb);
 #else
   // No extra data moves here.
   __asm__(
-      "xscvdpqp %0,%1"
+      "xssubqpo %0,%1,%2"
       : "=v" (result)
-      : "v" (f64)
+      : "v" (vfa), "v" (vfb)
       : );
 #endif
-#elif  defined (_ARCH_PWR8)
-  vui64_t d_exp, d_sig, q_exp;
-  vui128_t q_sig;
-  vui32_t q_sign;
-  const vui64_t exp_delta = (vui64_t) CONST_VINT64_DW ( (0x3fff - 0x3ff), 0 );
-  const vui64_t d_naninf = (vui64_t) CONST_VINT64_DW ( 0x7ff, 0 );
-  const vui64_t d_denorm = (vui64_t) CONST_VINT64_DW ( 0, 0 );
-  const vui32_t signmask = CONST_VINT128_W (0x80000000, 0, 0, 0);
+  return result;
+#else //  defined (_ARCH_PWR7)
+  vui64_t q_exp, a_exp, b_exp, x_exp;
+  vui128_t q_sig, a_sig, b_sig, p_tmp, p_odd;
+  vui128_t a_mag, b_mag;
+  vui32_t q_sign,  a_sign,  b_sign;
+  vb128_t a_lt_b;
+  const vui32_t q_zero = CONST_VINT128_W (0, 0, 0, 0);
+  const vui32_t q_ones = CONST_VINT128_W (-1, -1, -1, -1);
+  const vui32_t magmask = vec_mask128_f128mag();
+  const vui64_t exp_naninf = vec_mask64_f128exp();
+  // Vector extract the exponents from vfa, vfb
+  x_exp = vec_xxxexpqpp (vfa, vfb);
+  // Mask off sign bits so can use integers for magnitude compare.
+  a_mag = (vui128_t) vec_and_bin128_2_vui32t (vfa, magmask);
+  b_mag = (vui128_t) vec_and_bin128_2_vui32t (vfb, magmask);
+  a_sign = vec_andc_bin128_2_vui32t (vfa, magmask);
+  b_sign = vec_andc_bin128_2_vui32t (vfb, magmask);
+//  if (vec_all_isfinitef128 (vfa) && vec_all_isfinitef128 (vfb))
+//  The above can be optimized to the following
+  if (__builtin_expect (vec_cmpud_all_lt (x_exp, exp_naninf), 1))
+    {
+      const vui128_t xbitmask = vec_splat_u128 (1);
+      const vui128_t grx_mask = vec_splat_u128 (7);
+      const vui64_t exp_min = vec_splat_u64 (1);
+      const vui8_t t_sig_L = vec_splat_u8 (7);
+      const vui8_t t_sig_C = vec_splat_u8 (15);
+      const vui64_t exp_one = exp_min;
+      const vui64_t exp_dnrm = (vui64_t) q_zero;
+      // signmask is the complement of the magmask
+      const vui32_t signmask = vec_nor(magmask, magmask);
+      vui128_t add_sig, sub_sig;
+      vui128_t s_sig, x_bits;
+      vui32_t diff_sign;
+      vui32_t sigmask = vec_mask128_f128sig();
+      vui32_t hidden = vec_mask128_f128Lbit();
+      vui32_t a_norm, b_norm, x_norm;
+      vui32_t a_s32, b_s32;
+
+      // Extract the significand
+      // Assume that the sign-bit is already masked off
+      // Mask off the significands
+      a_s32 = vec_and ((vui32_t) a_mag, sigmask);
+      b_s32 = vec_and ((vui32_t) b_mag, sigmask);
+      // Assume that exponents are already extracted and merged
+      // Compare exponents for denormal, assume finite
+      x_norm = (vui32_t) vec_cmpgt ((vui32_t) x_exp, q_zero);
+      a_norm = vec_splat (x_norm, VEC_WE_1);
+      b_norm = vec_splat (x_norm, VEC_WE_3);
+      // For Normal QP insert (hidden) L-bit into significand
+      a_sig =  (vui128_t) vec_sel (a_s32, a_norm, hidden);
+      b_sig =  (vui128_t) vec_sel (b_s32, b_norm, hidden);
+      // Correct exponent for zeros or denormals to E_min
+      // will force 0 exponents for zero/denormal results later
+      //exp_mask = vec_cmpequd (x_exp, exp_dnrm);
+      x_exp = vec_selud ( exp_min, x_exp, (vb64_t) x_norm);
+      // Negate sign for subtract, then use add logic
+      b_sign = vec_xor (signmask, b_sign);
+      // Generation sign difference for signed 0.0
+      q_sign = vec_xor (a_sign, b_sign);
+      // Precondition the significands before add so the GRX bits
+      // are in the least significant 3 bit.
+      a_sig = vec_slqi (a_sig, 3);
+      b_sig = vec_slqi (b_sig, 3);
+
+      // If sign(vfa) != sign(vfb) will need to:
+      // 1) Subtract instead of add significands
+      // 2) Generate signed zeros
+      diff_sign = (vui32_t) vec_setb_sq ((vi128_t) q_sign);
+      // If magnitude(b) >  magnitude(a) will need to swap a/b, later
+      a_lt_b = vec_cmpltuq (a_mag, b_mag);
 
+      // Now swap operands a/b if necessary so a has greater magnitude.
+      {
+	vui128_t a_tmp = a_sig;
+	vui128_t b_tmp = b_sig;
+	vui64_t x_tmp = vec_swapd (x_exp);
 
-  f64[VEC_DW_L] = 0.0; // clear the right most element to zero.
-  // Extract the exponent, significand, and sign bit.
-  d_exp = vec_xvxexpdp (f64);
-  d_sig = vec_xvxsigdp (f64);
-  q_sign = vec_and ((vui32_t) f64, signmask);
-  // The extract sig operation has already tested for finite/subnormal.
-  // So avoid testing isfinite/issubnormal again by simply testing
-  // the extracted exponent.
-  if (__builtin_expect (!vec_cmpud_all_eq (d_exp, d_naninf), 1))
+	q_sign = vec_sel (a_sign, b_sign, (vui32_t) a_lt_b);
+
+	x_exp = vec_selud (x_exp, x_tmp, (vb64_t) a_lt_b);
+	a_exp = vec_splatd (x_exp, VEC_DW_H);
+	b_exp = vec_splatd (x_exp, VEC_DW_L);
+	q_exp = a_exp;
+
+	a_sig = vec_seluq (a_tmp, b_tmp, (vb128_t) a_lt_b);
+	b_sig = vec_seluq (b_tmp, a_tmp, (vb128_t) a_lt_b);
+      }
+      // At this point we can assume that:
+      // The magnitude (vfa) >= magnitude (vfb)
+      // 1) Exponents (a_exp, b_exp) in the range E_min -> E_max
+      // 2) a_exp >= b_exp
+      // 2a) If a_exp == b_exp then a_sig >= b_sig
+      // 2b) If a_exp > b_exp then
+      //     shift (b_sig) right by (a_exp - b_exp)
+      //     any bits shifted out of b_sig are ORed into the X-bit
+      if (vec_cmpud_all_lt (b_exp, a_exp))
+	{
+	  vui64_t d_exp, l_exp;
+	  vui128_t t_sig;
+	  vb128_t exp_mask;
+	  const vui64_t exp_128 = vec_const64_f128_128();
+
+	  d_exp = vec_subudm (a_exp, b_exp);
+	  exp_mask = (vb128_t) vec_cmpltud (d_exp, exp_128);
+	  l_exp = vec_subudm (exp_128, d_exp);
+	  t_sig = vec_srq (b_sig, (vui128_t) d_exp);
+	  x_bits = vec_slq (b_sig, (vui128_t) l_exp);
+	  t_sig = vec_seluq ((vui128_t) q_zero, t_sig, exp_mask);
+	  x_bits = vec_seluq (b_sig, x_bits, exp_mask);
+	  p_odd = vec_addcuq (x_bits, (vui128_t) q_ones);
+	  b_sig = (vui128_t) vec_or ((vui32_t) t_sig, (vui32_t) p_odd);
+	}
+
+      // If operands have the same sign then s_sig = a_sig + b_sig
+      // Otherwise s_sig = a_sig - b_sig
+      add_sig = vec_adduqm (a_sig, b_sig);
+      sub_sig = vec_subuqm (a_sig, b_sig);
+      s_sig = vec_seluq (add_sig, sub_sig, (vb128_t) diff_sign);
+
+      if (__builtin_expect (vec_cmpuq_all_eq (s_sig, (vui128_t) q_zero), 0))
+	{ // Special case of both zero with different sign
+	  q_sign = vec_sel (a_sign, (vui32_t) q_zero, diff_sign);
+	  return vec_xfer_vui32t_2_bin128 (q_sign);
+	}
+
+      // Issolate CL bits from significand too simplify the compare
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      vui8_t t_sig = vec_splat ((vui8_t) s_sig, 14);
+#else
+      vui8_t t_sig = vec_splat ((vui8_t) s_sig, 1);
+#endif
+//      if (vec_cmpuq_all_gt (s_sig, (vui128_t) sigov))
+	if (vec_all_gt (t_sig, t_sig_C))
+	{ // Check for carry and adjust
+	  p_odd = (vui128_t) vec_and ((vui32_t) s_sig, (vui32_t) xbitmask);
+	  s_sig = vec_srqi (s_sig, 1);
+	  s_sig = (vui128_t) vec_or ((vui32_t) s_sig, (vui32_t) p_odd);
+	  q_exp = vec_addudm (q_exp, exp_one);
+	}
+      else // if (vec_cmpuq_all_le (s_sig, (vui128_t) sigovt))
+	  if (vec_all_le (t_sig, t_sig_L))
+	{
+	  // Or the significand is below normal range.
+	  // This can happen with subtraction.
+	  vui64_t c_exp, d_exp;
+	  vui128_t c_sig;
+	  const vui64_t exp_12 = vec_splat_u64 (12);
+
+	  c_sig = vec_clzq (s_sig);
+	  c_exp = vec_splatd ((vui64_t) c_sig, VEC_DW_L);
+	  // The IR has 12 leading zeros that should not effect the shift count.
+	  c_exp = vec_subudm (c_exp, exp_12);
+	  d_exp = vec_subudm (q_exp, (vui64_t) exp_min);
+	  d_exp = vec_minud (c_exp, d_exp);
+	  {
+	    vb64_t nrm_mask = vec_cmpgtsd ((vi64_t) q_exp, (vi64_t) exp_min);
+	    vb64_t exp_mask = vec_cmpgtud (q_exp, c_exp);
+
+	    c_sig = vec_slq (s_sig, (vui128_t) d_exp);
+	    q_exp = vec_subudm (q_exp, d_exp);
+	    exp_mask = (vb64_t) vec_and ((vui32_t) exp_mask, (vui32_t) nrm_mask);
+	    q_exp = vec_selud (exp_dnrm,  q_exp, exp_mask);
+	    s_sig = vec_seluq (s_sig, c_sig, (vb128_t) nrm_mask);
+	  }
+	}
+      // Round to odd from low order GRX-bits
+      p_tmp = (vui128_t) vec_and ((vui32_t) s_sig, (vui32_t) grx_mask);
+      p_odd = vec_addcuq (p_tmp, (vui128_t) q_ones);
+      q_sig = vec_srqi (s_sig, 3);
+      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
+      // Check for exponent overflow -> __FLT128_MAX__
+      if (__builtin_expect ((vec_cmpud_all_ge ( q_exp, exp_naninf)), 0))
+	{
+	  // return maximum finite exponent and significand
+	  const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
+	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
+	  return vec_xfer_vui32t_2_bin128 (f128_smax);
+	}
+      // Merge sign, significand, and exponent into final result
+      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
+      result = vec_xsiexpqp (q_sig, q_exp);
+      return result;
+    }
+  else // One or both operands are NaN or Infinity
     {
-      if (__builtin_expect (!vec_cmpud_all_eq (d_exp, d_denorm), 1))
+      //const vui32_t q_nan = CONST_VINT128_W(0x00008000, 0, 0, 0);
+      vui32_t q_nan = vec_mask128_f128Qbit ();
+      // One or both operands are NaN
+      if (vec_all_isnanf128 (vfa))
 	{
-	  q_sig = vec_srqi ((vui128_t) d_sig, 4);
-	  q_exp = vec_addudm (d_exp, exp_delta);
+	  // vfa is NaN, Convert vfa to QNaN and return
+	  vui32_t vf128 = vec_or_bin128_2_vui32t (vfa, q_nan);
+	  return vec_xfer_vui32t_2_bin128 (vf128);
 	}
-      else
+      else if (vec_all_isnanf128 (vfb))
 	{
-	  if (vec_cmpud_all_eq (d_sig, d_denorm))
-	    {
-	      q_sig = (vui128_t) d_sig;
-	      q_exp = (vui64_t) d_exp;
+	  // vfb is NaN, Convert vfb to QNaN and return
+	  vui32_t vf128 = vec_or_bin128_2_vui32t (vfb, q_nan);
+	  return vec_xfer_vui32t_2_bin128 (vf128);
+	}
+      else  // Or one or both operands are Infinity
+	{
+	  a_exp = vec_splatd (x_exp, VEC_DW_H);
+	  // b_exp = vec_splatd (x_exp, VEC_DW_L);
+	  if (vec_cmpud_all_eq (x_exp, exp_naninf)
+	      && vec_cmpud_all_eq ((vui64_t) a_sign, (vui64_t) b_sign))
+	    { // Both operands infinity and opposite sign
+	      // Inifinty - Infinity (same sign) is Default Quiet NaN
+	      return vec_const_nanf128 ();
 	    }
 	  else
-	    { // Must be subnormal but we need to produce a normal QP.
-	      // So need to adjust the quad exponent by the f64 denormal
-	      // exponent (-1023) and any leading '0's in the f64 sig.
-	      // There will be at least 12.
-	      vui64_t q_denorm = (vui64_t) CONST_VINT64_DW ( (0x3fff - (1023 - 12)), 0 );
-	      vui64_t f64_clz;
-	      f64_clz = vec_clzd (d_sig);
-	      d_sig = vec_vsld (d_sig, f64_clz);
-	      q_exp = vec_subudm (q_denorm, f64_clz);
-	      q_sig = vec_srqi ((vui128_t) d_sig, 15);
+	    { // Either both operands infinity and same sign
+	      // Or one infinity and one finite
+	      if (vec_cmpud_any_eq (a_exp, exp_naninf))
+		{
+		  // return infinity
+		  return vfa;
+		}
+	      else
+		{
+		  // return infinity
+		  return vec_negf128(vfb);
+		}
 	    }
 	}
     }
-  else
-    { // isinf or isnan.
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Convert Double-Precision to Quad-Precision format.
+ *
+ *  The left most double-precision element of vector f64 is converted
+ *  to quad-precision format.
+ *
+ *  For POWER9 use the xscvdpqp instruction.
+ *  For POWER8 and earlier use vector instruction generated by PVECLIB
+ *  operations.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to Signaling NaN and setting the FPSCR.
+ *  However if the hardware target includes the xscvdpqp instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |   ?   | 2/cycle  |
+ *  |power9   |   3   | 2/cycle  |
+ *
+ *  @param f64 a vector double. The left most element is converted.
+ *  @return a __binary128 value.
+ */
+__binary128
+static inline vec_xscvdpqp (vf64_t f64)
+{
+  __binary128 result;
+#if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+#if defined (__FLOAT128__) && (__GNUC__ > 9)
+  // earlier GCC versions generate extra data moves for this.
+  result = f64[VEC_DW_H];
+#else
+  // No extra data moves here.
+  __asm__(
+      "xscvdpqp %0,%1"
+      : "=v" (result)
+      : "v" (f64)
+      : );
+#endif
+#elif  defined (_ARCH_PWR8)
+  vui64_t d_exp, d_sig, q_exp;
+  vui128_t q_sig;
+  vui32_t q_sign;
+  const vui64_t exp_delta = (vui64_t) CONST_VINT64_DW ( (0x3fff - 0x3ff), 0 );
+  const vui64_t d_naninf = (vui64_t) CONST_VINT64_DW ( 0x7ff, 0 );
+  const vui64_t d_denorm = (vui64_t) CONST_VINT64_DW ( 0, 0 );
+  const vui32_t signmask = CONST_VINT128_W (0x80000000, 0, 0, 0);
+
+
+  f64[VEC_DW_L] = 0.0; // clear the right most element to zero.
+  // Extract the exponent, significand, and sign bit.
+  d_exp = vec_xvxexpdp (f64);
+  d_sig = vec_xvxsigdp (f64);
+  q_sign = vec_and ((vui32_t) f64, signmask);
+  // The extract sig operation has already tested for finite/subnormal.
+  // So avoid testing isfinite/issubnormal again by simply testing
+  // the extracted exponent.
+  if (__builtin_expect (!vec_cmpud_all_eq (d_exp, d_naninf), 1))
+    {
+      if (__builtin_expect (!vec_cmpud_all_eq (d_exp, d_denorm), 1))
+	{
+	  q_sig = vec_srqi ((vui128_t) d_sig, 4);
+	  q_exp = vec_addudm (d_exp, exp_delta);
+	}
+      else
+	{
+	  if (vec_cmpud_all_eq (d_sig, d_denorm))
+	    {
+	      q_sig = (vui128_t) d_sig;
+	      q_exp = (vui64_t) d_exp;
+	    }
+	  else
+	    { // Must be subnormal but we need to produce a normal QP.
+	      // So need to adjust the quad exponent by the f64 denormal
+	      // exponent (-1023) and any leading '0's in the f64 sig.
+	      // There will be at least 12.
+	      vui64_t q_denorm = (vui64_t) CONST_VINT64_DW ( (0x3fff - (1023 - 12)), 0 );
+	      vui64_t f64_clz;
+	      f64_clz = vec_clzd (d_sig);
+	      d_sig = vec_vsld (d_sig, f64_clz);
+	      q_exp = vec_subudm (q_denorm, f64_clz);
+	      q_sig = vec_srqi ((vui128_t) d_sig, 15);
+	    }
+	}
+    }
+  else
+    { // isinf or isnan.
       q_sig = vec_srqi ((vui128_t) d_sig, 4);
       q_exp = (vui64_t) CONST_VINT64_DW (0x7fff, 0);
     }
@@ -8645,6 +9535,142 @@ static inline vec_xscvdpqp (vf64_t f64)
   return result;
 }
 
+/** \brief VSX Scalar Convert IBM long double to Quad-Precision
+ *  format.
+ *
+ *  The IBM long double (double-double) value is the sum of the
+ *  high doubleword (element 0 in big endian order) and the low
+ *  doubleword of vector lval, as returned by
+ *  vec_unpack_longdouble(). The sum is rounded to quad-precision
+ *  (round to nearest even). For the usual double-double values (the
+ *  exponents of the high and low parts differ by at most 60) the sum
+ *  is exact. If the high part is infinite or NaN it is returned
+ *  and the low part ignored.
+ *
+ *  The result does not depend on the current rounding mode
+ *  (<B>FPSCR<sub>RN</sub></B>), so POWER9 does not use xsaddqp.
+ *  Add the magnitude of the larger part and the (signed) smaller
+ *  part with vec_xsaddqpo() (xsaddqpo for POWER9). If the difference
+ *  between the round to odd sum and the larger part is the smaller
+ *  part, the sum is exact. Otherwise the round to odd sum and its
+ *  neighbor bracket the exact sum. Compare the smaller part to the
+ *  offset of their midpoint from the larger part (both exact) to
+ *  select the nearest.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |100-250| 1/cycle  |
+ *  |power9   | 30-80 | 1/cycle  |
+ *
+ *  @param lval vector double values containing the IBM long double.
+ *  @return a __binary128 value.
+ */
+static inline __binary128
+vec_xscvibmqp (vf64_t lval)
+{
+  __binary128 result, q_hi, q_lo;
+  __binary128 q_a, q_b, q_d, q_tz, q_az, q_half, q_mid;
+  vui128_t r_bits;
+  vui32_t q_sign;
+  vf64_t d_hi, d_lo;
+  const vui128_t q_one = (vui128_t) CONST_VINT128_DW (0, 1);
+  const vui128_t q_zero = (vui128_t) CONST_VINT128_DW (0, 0);
+  const vui32_t signmask = vec_mask128_f128sign ();
+  const vui32_t q_pzero = CONST_VINT128_W (0, 0, 0, 0);
+
+  d_hi = vec_splat (lval, VEC_DW_H);
+  d_lo = vec_splat (lval, VEC_DW_L);
+  q_hi = vec_xscvdpqp (d_hi);
+  if (__builtin_expect ((d_lo[VEC_DW_H] == 0.0)
+			|| vec_all_isinff128 (q_hi)
+			|| vec_all_isnanf128 (q_hi), 0))
+    return q_hi;
+  q_lo = vec_xscvdpqp (d_lo);
+
+  // Order by magnitude, so q_a >= |q_b| and the sum is positive.
+  if (vec_cmpqp_all_gt (vec_absf128 (q_lo), vec_absf128 (q_hi)))
+    {
+      q_a = q_hi;
+      q_hi = q_lo;
+      q_lo = q_a;
+    }
+  q_sign = vec_and_bin128_2_vui32t (q_hi, signmask);
+  q_a = vec_absf128 (q_hi);
+  q_b = vec_xfer_vui32t_2_bin128 (
+      vec_xor (vec_xfer_bin128_2_vui32t (q_lo), q_sign));
+
+  result = vec_xsaddqpo (q_a, q_b);
+  // Exact, as result and q_a are close.
+  q_d = vec_xssubqpo (result, q_a);
+  if (!vec_cmpqp_all_eq (q_d, q_b))
+    {
+      // Inexact, so result is odd. Find the other candidate.
+      r_bits = vec_xfer_bin128_2_vui128t (result);
+      if (vec_cmpqp_all_gt (q_d, q_b))
+	{
+	  q_az = result;
+	  q_tz = vec_xfer_vui128t_2_bin128 (vec_subuqm (r_bits, q_one));
+	}
+      else
+	{
+	  q_tz = result;
+	  q_az = vec_xfer_vui128t_2_bin128 (vec_adduqm (r_bits, q_one));
+	}
+      // Half unit in the last place of q_tz.
+      q_half = vec_xsiexpqp (q_zero,
+			     vec_subudm (vec_xsxexpqp (q_tz),
+					 vec_splats ((unsigned long long) 113)));
+      // The midpoint less q_a, exact.
+      q_mid = vec_xsaddqpo (vec_xssubqpo (q_tz, q_a), q_half);
+      if (vec_cmpqp_all_gt (q_b, q_mid))
+	result = q_az;
+      else if (vec_cmpqp_all_lt (q_b, q_mid))
+	result = q_tz;
+      else
+	{ // Tie, select the even candidate.
+	  r_bits = vec_xfer_bin128_2_vui128t (q_tz);
+	  if (vec_cmpuq_all_eq ((vui128_t) vec_and ((vui32_t) r_bits,
+						    (vui32_t) q_one), q_zero))
+	    result = q_tz;
+	  else
+	    result = q_az;
+	}
+    }
+  if (vec_all_iszerof128 (result))
+    result = vec_xfer_vui32t_2_bin128 (q_pzero);
+  else
+    result = vec_xfer_vui32t_2_bin128 (
+	vec_or (vec_xfer_bin128_2_vui32t (result), q_sign));
+  return result;
+}
+
+/** \brief VSX Scalar Convert Single-Precision to Quad-Precision format.
+ *
+ *  The left most single-precision element (word element 0 in big
+ *  endian order) of vector f32 is converted to quad-precision
+ *  format. The conversion is exact.
+ *
+ *  There is no single-precision to quad-precision instruction.
+ *  The float is converted to double (exact) and then converted by
+ *  vec_xscvdpqp().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 15-24 | 2/cycle  |
+ *  |power9   |   6   | 2/cycle  |
+ *
+ *  @param f32 a vector float. The left most element is converted.
+ *  @return a __binary128 value.
+ */
+static inline __binary128
+vec_xscvspqp (vf32_t f32)
+{
+  vf64_t f64 = { 0.0, 0.0 };
+
+  f64[VEC_DW_H] = f32[VEC_W_H];
+  return vec_xscvdpqp (f64);
+}
+
 /** \brief VSX Scalar Convert with round Quad-Precision to Double-Precision
  *  (using round to odd).
  *
@@ -8779,132 +9805,655 @@ vec_xscvqpdpo (__binary128 f128)
   return result;
 }
 
-/** \brief VSX Scalar Convert with round to zero Quad-Precision to Unsigned doubleword.
+/** \brief VSX Scalar Convert Quad-Precision to Double-Precision with
+ *  explicit rounding mode.
+ *
+ *  The quad-precision element of vector f128 is converted to
+ *  double-precision and rounded as specified by rnd. The result is
+ *  placed in doubleword element 0 while element 1 is set to zero.
+ *  VEC_ROUND_TRUNC, VEC_ROUND_FLOOR, VEC_ROUND_CEIL and
+ *  VEC_ROUND_HALF_EVEN are the IEEE rounding directions,
+ *  VEC_ROUND_HALF_UP rounds ties away from zero and VEC_ROUND_UP
+ *  rounds away from zero. The result does not depend on
+ *  <B>FPSCR<sub>RN</sub></B>.
+ *
+ *  The conversion starts with vec_xscvqpdpo(). If that result
+ *  converts back to f128 exactly it is returned. Otherwise the round
+ *  to odd result is one of the two doubles that bracket f128 and
+ *  the other one is the next double toward or away from zero (plus
+ *  or minus one as an integer). The directed modes just select one
+ *  of them. The nearest modes compare f128 to the midpoint between
+ *  them, which is exact in quad-precision.
+ *
+ *  Overflow returns infinity or the largest finite double,
+ *  depending on the direction. NaNs are returned quiet.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |200-350| 1/cycle  |
+ *  |power9   | 12-90 |1/13cycles|
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @param rnd the rounding mode.
+ *  @return a vector double value.
+ */
+static inline vf64_t
+vec_xscvqpdp_rnd (__binary128 f128, vec_round_t rnd)
+{
+  vf64_t result;
+  __binary128 f_abs, f_tz, f_az, f_mid;
+  vui64_t d_bits, t_bits;
+  unsigned long long d_mag, d_sign, d_tz, d_az;
+  const vui64_t q_half = CONST_VINT64_DW (0x3ffe000000000000, 0);
+  // Midpoint of DBL_MAX and 2**1024.
+  const vui64_t q_maxmid = CONST_VINT64_DW (0x43feffffffffffff,
+					    0xf800000000000000);
+
+  result = vec_xscvqpdpo (f128);
+  d_bits = (vui64_t) result;
+  d_sign = d_bits[VEC_DW_H] & 0x8000000000000000UL;
+  d_mag = d_bits[VEC_DW_H] & 0x7fffffffffffffffUL;
+  // Infinity and NaN need no rounding.
+  if (__builtin_expect ((d_mag < 0x7ff0000000000000UL), 1))
+    {
+      t_bits = (vui64_t) CONST_VINT64_DW (0, 0);
+      t_bits[VEC_DW_H] = d_mag;
+      f_tz = vec_xscvdpqp ((vf64_t) t_bits);
+      f_abs = vec_absf128 (f128);
+      if (!vec_cmpqp_all_eq (f_abs, f_tz))
+	{
+	  // Inexact so d_mag is odd and f128 is between d_tz and d_az.
+	  if (vec_cmpqp_all_gt (f_abs, f_tz))
+	    {
+	      d_tz = d_mag;
+	      d_az = d_mag + 1;
+	    }
+	  else
+	    {
+	      d_tz = d_mag - 1;
+	      d_az = d_mag;
+	    }
+	  switch (rnd)
+	    {
+	    case VEC_ROUND_TRUNC:
+	      d_mag = d_tz;
+	      break;
+	    case VEC_ROUND_UP:
+	      d_mag = d_az;
+	      break;
+	    case VEC_ROUND_FLOOR:
+	      d_mag = d_sign ? d_az : d_tz;
+	      break;
+	    case VEC_ROUND_CEIL:
+	      d_mag = d_sign ? d_tz : d_az;
+	      break;
+	    default:
+	      if (d_az == 0x7ff0000000000000UL)
+		f_mid = vec_xfer_vui64t_2_bin128 (q_maxmid);
+	      else
+		{
+		  t_bits[VEC_DW_H] = d_tz;
+		  f_tz = vec_xscvdpqp ((vf64_t) t_bits);
+		  t_bits[VEC_DW_H] = d_az;
+		  f_az = vec_xscvdpqp ((vf64_t) t_bits);
+		  f_mid = vec_xsaddqpo (f_tz, f_az);
+		  f_mid = vec_xsmulqpo (f_mid, vec_xfer_vui64t_2_bin128 (q_half));
+		}
+	      if (vec_cmpqp_all_gt (f_abs, f_mid))
+		d_mag = d_az;
+	      else if (vec_cmpqp_all_lt (f_abs, f_mid))
+		d_mag = d_tz;
+	      else if (rnd == VEC_ROUND_HALF_EVEN)
+		d_mag = (d_tz & 1) ? d_az : d_tz;
+	      else
+		d_mag = d_az;
+	      break;
+	    }
+	  d_bits[VEC_DW_H] = d_mag | d_sign;
+	  result = (vf64_t) d_bits;
+	}
+    }
+  return result;
+}
+
+/** \brief VSX Scalar Convert Quad-Precision to IBM long double
+ *  format.
+ *
+ *  The quad-precision value f128 is split into the canonical IBM
+ *  long double (double-double) pair. The high doubleword is f128
+ *  rounded to double (round to nearest even). The low doubleword is
+ *  the remainder (f128 minus the high part, which is exact) rounded
+ *  to double. The result (high doubleword in element 0 in big
+ *  endian order) can be passed to vec_pack_longdouble().
+ *
+ *  If the high part is infinite or NaN the low part is 0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |450-750| 1/cycle  |
+ *  |power9   | 40-200|1/13cycles|
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @return vector double values containing the IBM long double.
+ */
+static inline vf64_t
+vec_xscvqpibm (__binary128 f128)
+{
+  vf64_t result, d_hi, d_lo;
+  __binary128 q_rem;
+
+  d_hi = vec_xscvqpdp_rnd (f128, VEC_ROUND_HALF_EVEN);
+  result = d_hi;
+  if (__builtin_expect (!vec_all_isinff64 (vec_splat (d_hi, VEC_DW_H))
+			&& !vec_all_isnanf64 (vec_splat (d_hi, VEC_DW_H)), 1))
+    {
+      q_rem = vec_xssubqpo (f128, vec_xscvdpqp (d_hi));
+      d_lo = vec_xscvqpdp_rnd (q_rem, VEC_ROUND_HALF_EVEN);
+      result[VEC_DW_L] = d_lo[VEC_DW_H];
+    }
+  return result;
+}
+
+/** \brief VSX Scalar Convert with round to zero Quad-Precision to
+ *  Signed doubleword.
  *
  *  The quad-precision element of vector f128 is converted
- *  to an unsigned doubleword integer.
+ *  to a signed doubleword integer.
  *  The Floating point value is rounded toward zero before conversion.
  *  The result is placed in element 0 while element 1 is set to zero.
+ *  Values out of range return the most positive or most negative
+ *  doubleword, NaNs return the most negative.
  *
- *  For POWER9 use the xscvqpudz instruction.
+ *  For POWER9 use the xscvqpsdz instruction.
  *  For POWER8 and earlier use vector instructions generated by PVECLIB
  *  operations.
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xscvqpudz instruction,
+ *  However if the hardware target includes the xscvqpsdz instruction,
  *  the implementation may use that.
  *
  *  |processor|Latency|Throughput|
  *  |--------:|:-----:|:---------|
- *  |power8   |   ?   | 2/cycle  |
- *  |power9   |   ?   | 2/cycle  |
+ *  |power8   | 30-45 | 2/cycle  |
+ *  |power9   |   12  | 1/cycle  |
  *
  *  @param f128 128-bit vector treated as a scalar __binary128.
- *  @return a vector unsigned long long value.
+ *  @return a vector signed long long value.
  */
-static inline vui64_t
-vec_xscvqpudz (__binary128 f128)
+static inline vi64_t
+vec_xscvqpsdz (__binary128 f128)
 {
-  vui64_t result;
+  vi64_t result;
 #if defined (_ARCH_PWR9) && defined (__FLOAT128__) && (__GNUC__ > 7)
   __asm__(
-      "xscvqpudz %0,%1"
+      "xscvqpsdz %0,%1"
       : "=v" (result)
       : "v" (f128)
       : );
 #else
-  vui64_t q_exp, q_delta, x_exp;
+  vui64_t q_exp, q_delta, x_exp, d_mag;
   vui128_t q_sig;
   vb128_t b_sign;
   const vui64_t q_zero = { 0, 0 };
-  const vui64_t q_ones = { -1, -1 };
+  const vui64_t d_max = CONST_VINT64_DW (0x7fffffffffffffff,
+					 0x7fffffffffffffff);
+  const vui64_t d_min = CONST_VINT64_DW (0x8000000000000000,
+					 0x8000000000000000);
   const vui64_t exp_low = (vui64_t) CONST_VINT64_DW ( 0x3fff, 0x3fff );
-  const vui64_t exp_high = (vui64_t) CONST_VINT64_DW ( (0x3fff+64), (0x3fff+64) );
+  const vui64_t exp_high = (vui64_t) CONST_VINT64_DW ( (0x3fff+63), (0x3fff+63) );
   const vui64_t exp_63 = (vui64_t) CONST_VINT64_DW ( (0x3fff+63), (0x3fff+63) );
   const vui64_t q_naninf = (vui64_t) CONST_VINT64_DW ( 0x7fff, 0x7fff );
 
-  result = q_zero;
   q_exp = vec_xsxexpqp (f128);
   q_sig = vec_xsxsigqp (f128);
   x_exp = vec_splatd (q_exp, VEC_DW_H);
   b_sign = vec_setb_qp (f128);
   if (__builtin_expect (!vec_cmpud_all_eq (x_exp, q_naninf), 1))
     {
-      if (vec_cmpud_all_ge (x_exp, exp_low)
-       && vec_cmpud_all_eq ((vui64_t)b_sign, (vui64_t)q_zero))
-	{ // Greater than or equal to 1.0
+      if (vec_cmpud_all_ge (x_exp, exp_low))
+	{ // Magnitude greater than or equal to 1.0
 	  if (vec_cmpud_all_lt (x_exp, exp_high))
-	    { // Less than 2**64-1
+	    { // Magnitude less than 2**63
 	      q_sig = vec_slqi (q_sig, 15);
 	      q_delta = vec_subudm (exp_63, x_exp);
-	      result = vec_vsrd ((vui64_t) q_sig, q_delta);
+	      d_mag = vec_vsrd ((vui64_t) q_sig, q_delta);
+	      result = (vi64_t) vec_selud (d_mag, vec_subudm (q_zero, d_mag),
+					   (vb64_t) b_sign);
 	    }
 	  else
-	    { // set result to 2**64-1
-	      result = q_ones;
+	    { // Saturate, this includes -2**63 exactly.
+	      result = (vi64_t) vec_selud (d_max, d_min, (vb64_t) b_sign);
 	    }
 	}
       else
-	{ // less than 1.0 or negative
-	  result = q_zero;
+	{ // less than 1.0
+	  result = (vi64_t) q_zero;
 	}
     }
   else
     { // isinf or isnan.
       vb128_t is_inf;
-      // Positive Inf returns all ones
-      // else NaN or -Infinity returns zero
+      // Positive Inf returns the max, NaN or -Infinity returns the min.
       is_inf = vec_cmpequq (q_sig, (vui128_t) q_zero);
-      // result = ~NaN | (pos & Inf) -> Inf & (pos & Inf) -> pos & Inf
-      result = (vui64_t) vec_andc ((vui32_t) is_inf, (vui32_t) b_sign);
+      is_inf = (vb128_t) vec_andc ((vui32_t) is_inf, (vui32_t) b_sign);
+      result = (vi64_t) vec_selud (d_min, d_max, (vb64_t) is_inf);
     }
-  result = vec_mrgahd ((vui128_t) result, (vui128_t) q_zero);
+  result = (vi64_t) vec_mrgahd ((vui128_t) result, (vui128_t) q_zero);
 #endif
   return result;
 }
 
-/** \brief VSX Scalar Convert with round to zero Quad-Precision to Unsigned Quadword.
+/** \brief VSX Scalar Convert Quad-Precision to Single-Precision.
+ *
+ *  The quad-precision element of vector f128 is converted to
+ *  single-precision, rounded in the current rounding mode
+ *  (<B>FPSCR<sub>RN</sub></B>). The result is splatted to all 4
+ *  elements.
+ *
+ *  There is no quad-precision to single-precision instruction.
+ *  The value is first converted to double with round to odd
+ *  (vec_xscvqpdpo()), then rounded to single-precision. Double has
+ *  more than 24+2 significand bits, so the second rounding is
+ *  correct for any rounding mode (no double rounding error).
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 40-60 | 1/cycle  |
+ *  |power9   |   21  | 1/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @return a vector float value.
+ */
+static inline vf32_t
+vec_xscvqpsp (__binary128 f128)
+{
+  vf64_t d_odd;
+  float f32;
+
+  d_odd = vec_xscvqpdpo (f128);
+  f32 = d_odd[VEC_DW_H];
+  return vec_splats (f32);
+}
+
+/** \brief VSX Scalar Convert Quad-Precision to Single-Precision with
+ *  explicit rounding mode.
+ *
+ *  The quad-precision element of vector f128 is converted to
+ *  single-precision and rounded as specified by rnd (see
+ *  vec_xscvqpdp_rnd()). The result is splatted to all 4 elements
+ *  and does not depend on <B>FPSCR<sub>RN</sub></B>.
+ *
+ *  Convert to double with round to odd (vec_xscvqpdpo()), which
+ *  keeps enough bits to round to float in any mode. Then convert to
+ *  float in the current mode. If that converts back to the same
+ *  double it is exact. Otherwise it and its neighbor (plus or minus
+ *  one as an integer) bracket the double. The directed modes pick
+ *  one of the two. The nearest modes compare against their
+ *  midpoint, which is exact in double. The round to odd double is
+ *  never equal to that midpoint unless f128 is.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 60-90 | 1/cycle  |
+ *  |power9   | 30-50 | 1/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @param rnd the rounding mode.
+ *  @return a vector float value.
+ */
+static inline vf32_t
+vec_xscvqpsp_rnd (__binary128 f128, vec_round_t rnd)
+{
+  vf64_t d_odd;
+  vui32_t f_bits;
+  double d_abs, d_mid;
+  float f32;
+  unsigned int f_mag, f_sign, f_tz, f_az;
+  // Midpoint of FLT_MAX and 2**128.
+  const double d_maxmid = 0x1.ffffffp127;
+
+  d_odd = vec_xscvqpdpo (f128);
+  f32 = d_odd[VEC_DW_H];
+  d_abs = __builtin_fabs (d_odd[VEC_DW_H]);
+  // Infinity and NaN need no rounding, nor do exact results.
+  if (__builtin_expect ((d_abs <= __DBL_MAX__)
+			&& ((double) __builtin_fabsf (f32) != d_abs), 1))
+    {
+      f_bits = (vui32_t) vec_splats (f32);
+      f_sign = f_bits[0] & 0x80000000U;
+      f_mag = f_bits[0] & 0x7fffffffU;
+      if ((double) __builtin_fabsf (f32) < d_abs)
+	{
+	  f_tz = f_mag;
+	  f_az = f_mag + 1;
+	}
+      else
+	{
+	  f_tz = f_mag - 1;
+	  f_az = f_mag;
+	}
+      switch (rnd)
+	{
+	case VEC_ROUND_TRUNC:
+	  f_mag = f_tz;
+	  break;
+	case VEC_ROUND_UP:
+	  f_mag = f_az;
+	  break;
+	case VEC_ROUND_FLOOR:
+	  f_mag = f_sign ? f_az : f_tz;
+	  break;
+	case VEC_ROUND_CEIL:
+	  f_mag = f_sign ? f_tz : f_az;
+	  break;
+	default:
+	  if (f_az == 0x7f800000U)
+	    d_mid = d_maxmid;
+	  else
+	    {
+	      // Adjacent floats, so the sum and half are exact.
+	      f_bits = (vui32_t) { f_tz, f_az, 0, 0 };
+	      d_mid = ((double) ((vf32_t) f_bits)[0]
+		       + (double) ((vf32_t) f_bits)[1]) * 0.5;
+	    }
+	  if (d_abs > d_mid)
+	    f_mag = f_az;
+	  else if (d_abs < d_mid)
+	    f_mag = f_tz;
+	  else if (rnd == VEC_ROUND_HALF_EVEN)
+	    f_mag = (f_tz & 1) ? f_az : f_tz;
+	  else
+	    f_mag = f_az;
+	  break;
+	}
+      return (vf32_t) vec_splats (f_mag | f_sign);
+    }
+  return vec_splats (f32);
+}
+
+/** \brief VSX Scalar Convert with round to zero Quad-Precision to
+ *  Signed Quadword.
  *
  *  The quad-precision element of vector f128 is converted
- *  to an unsigned quadword integer.
+ *  to a signed quadword integer.
  *  The Floating point value is rounded toward zero before conversion.
+ *  Values out of range return the most positive or most negative
+ *  quadword, NaNs return the most negative.
  *
- *  For POWER10 use the xscvqpuqz instruction.
+ *  For POWER10 use the xscvqpsqz instruction.
  *  For POWER9 and earlier use vector instruction generated by PVECLIB
  *  operations.
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xscvqpuqz instruction,
+ *  However if the hardware target includes the xscvqpsqz instruction,
  *  the implementation may use that.
  *
  *  |processor|Latency|Throughput|
  *  |--------:|:-----:|:---------|
- *  |power8   |   ?   | 2/cycle  |
- *  |power9   |   ?   | 2/cycle  |
+ *  |power8   | 40-55 | 2/cycle  |
+ *  |power9   | 25-35 | 2/cycle  |
+ *  |power10  |   12  | 1/cycle  |
  *
  *  @param f128 128-bit vector treated as a scalar __binary128.
- *  @return a vector unsigned __int128 value.
+ *  @return a vector signed __int128 value.
  */
-static inline vui128_t
-vec_xscvqpuqz (__binary128 f128)
+static inline vi128_t
+vec_xscvqpsqz (__binary128 f128)
 {
-  vui128_t result;
+  vi128_t result;
 #if defined (_ARCH_PWR10) && (__GNUC__ >= 10)
   __asm__(
-      "xscvqpuqz %0,%1"
+      "xscvqpsqz %0,%1"
       : "=v" (result)
       : "v" (f128)
       : );
 #else
   vui64_t q_exp, q_delta, x_exp;
-  vui128_t q_sig;
+  vui128_t q_sig, q_mag;
   vb128_t b_sign;
   const vui128_t q_zero = { 0 };
-  const vui128_t q_ones = (vui128_t) vec_splat_s32 (-1);
+  const vui128_t q_max = (vui128_t) CONST_VINT128_DW (0x7fffffffffffffff,
+						      0xffffffffffffffff);
+  const vui128_t q_min = (vui128_t) CONST_VINT128_DW (0x8000000000000000, 0);
   const vui64_t exp_low = (vui64_t) CONST_VINT64_DW ( 0x3fff, 0x3fff );
-  const vui64_t exp_high = (vui64_t) CONST_VINT64_DW ( (0x3fff+128), (0x3fff+128) );
+  const vui64_t exp_high = (vui64_t) CONST_VINT64_DW ( (0x3fff+127), (0x3fff+127) );
+  const vui64_t exp_127 = (vui64_t) CONST_VINT64_DW ( (0x3fff+127), (0x3fff+127) );
+  const vui64_t q_naninf = (vui64_t) CONST_VINT64_DW ( 0x7fff, 0x7fff );
+
+  q_exp = vec_xsxexpqp (f128);
+  q_sig = vec_xsxsigqp (f128);
+  x_exp = vec_splatd (q_exp, VEC_DW_H);
+  b_sign = vec_setb_qp (f128);
+  if (__builtin_expect (!vec_cmpud_all_eq (x_exp, q_naninf), 1))
+    {
+      if (vec_cmpud_all_ge (x_exp, exp_low))
+	{ // Magnitude greater than or equal to 1.0
+	  if (vec_cmpud_all_lt (x_exp, exp_high))
+	    { // Magnitude less than 2**127
+	      q_sig = vec_slqi (q_sig, 15);
+	      q_delta = vec_subudm (exp_127, x_exp);
+	      q_mag = vec_srq (q_sig, (vui128_t) q_delta);
+	      result = (vi128_t) vec_seluq (q_mag,
+					    (vui128_t) vec_negsq ((vi128_t) q_mag),
+					    b_sign);
+	    }
+	  else
+	    { // Saturate, this includes -2**127 exactly.
+	      result = (vi128_t) vec_seluq (q_max, q_min, b_sign);
+	    }
+	}
+      else
+	{ // less than 1.0
+	  result = (vi128_t) q_zero;
+	}
+    }
+  else
+    { // isinf or isnan.
+      vb128_t is_inf;
+      // Positive Inf returns the max, NaN or -Infinity returns the min.
+      is_inf = vec_cmpequq (q_sig, (vui128_t) q_zero);
+      is_inf = (vb128_t) vec_andc ((vui32_t) is_inf, (vui32_t) b_sign);
+      result = (vi128_t) vec_seluq (q_min, q_max, is_inf);
+    }
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Convert with round to zero Quad-Precision to
+ *  Signed word.
+ *
+ *  The quad-precision element of vector f128 is converted
+ *  to a signed word integer.
+ *  The Floating point value is rounded toward zero before conversion.
+ *  The result is sign extended into doubleword element 0 while
+ *  element 1 is set to zero.
+ *  Values out of range return the most positive or most negative
+ *  word, NaNs return the most negative.
+ *
+ *  For POWER9 use the xscvqpswz instruction.
+ *  For POWER8 and earlier convert to doubleword (vec_xscvqpsdz())
+ *  and saturate.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 34-49 | 2/cycle  |
+ *  |power9   |   12  | 1/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @return a vector signed long long value.
+ */
+static inline vi64_t
+vec_xscvqpswz (__binary128 f128)
+{
+  vi64_t result;
+#if defined (_ARCH_PWR9) && defined (__FLOAT128__) && (__GNUC__ > 7)
+  __asm__(
+      "xscvqpswz %0,%1"
+      : "=v" (result)
+      : "v" (f128)
+      : );
+#else
+  const vi64_t w_max = (vi64_t) CONST_VINT64_DW (0x7fffffff, 0);
+  const vi64_t w_min = (vi64_t) CONST_VINT64_DW (-0x80000000L, 0);
+
+  result = vec_xscvqpsdz (f128);
+  result = vec_maxsd (vec_minsd (result, w_max), w_min);
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Convert Quad-Precision to Signed word with
+ *  explicit rounding mode.
+ *
+ *  The quad-precision element of vector f128 is rounded to an
+ *  integral value as specified by rnd (vec_xsrqpi_rnd()), then
+ *  converted to a signed word integer as vec_xscvqpswz() does
+ *  (saturated, sign extended into doubleword element 0). The
+ *  result does not depend on <B>FPSCR<sub>RN</sub></B>.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 55-90 | 1/cycle  |
+ *  |power9   |   24  | 1/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @param rnd the rounding mode.
+ *  @return a vector signed long long value.
+ */
+static inline vi64_t
+vec_xscvqpsw_rnd (__binary128 f128, vec_round_t rnd)
+{
+  return vec_xscvqpswz (vec_xsrqpi_rnd (f128, rnd));
+}
+
+/** \brief VSX Scalar Convert with round to zero Quad-Precision to Unsigned doubleword.
+ *
+ *  The quad-precision element of vector f128 is converted
+ *  to an unsigned doubleword integer.
+ *  The Floating point value is rounded toward zero before conversion.
+ *  The result is placed in element 0 while element 1 is set to zero.
+ *
+ *  For POWER9 use the xscvqpudz instruction.
+ *  For POWER8 and earlier use vector instructions generated by PVECLIB
+ *  operations.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xscvqpudz instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |   ?   | 2/cycle  |
+ *  |power9   |   ?   | 2/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @return a vector unsigned long long value.
+ */
+static inline vui64_t
+vec_xscvqpudz (__binary128 f128)
+{
+  vui64_t result;
+#if defined (_ARCH_PWR9) && defined (__FLOAT128__) && (__GNUC__ > 7)
+  __asm__(
+      "xscvqpudz %0,%1"
+      : "=v" (result)
+      : "v" (f128)
+      : );
+#else
+  vui64_t q_exp, q_delta, x_exp;
+  vui128_t q_sig;
+  vb128_t b_sign;
+  const vui64_t q_zero = { 0, 0 };
+  const vui64_t q_ones = { -1, -1 };
+  const vui64_t exp_low = (vui64_t) CONST_VINT64_DW ( 0x3fff, 0x3fff );
+  const vui64_t exp_high = (vui64_t) CONST_VINT64_DW ( (0x3fff+64), (0x3fff+64) );
+  const vui64_t exp_63 = (vui64_t) CONST_VINT64_DW ( (0x3fff+63), (0x3fff+63) );
+  const vui64_t q_naninf = (vui64_t) CONST_VINT64_DW ( 0x7fff, 0x7fff );
+
+  result = q_zero;
+  q_exp = vec_xsxexpqp (f128);
+  q_sig = vec_xsxsigqp (f128);
+  x_exp = vec_splatd (q_exp, VEC_DW_H);
+  b_sign = vec_setb_qp (f128);
+  if (__builtin_expect (!vec_cmpud_all_eq (x_exp, q_naninf), 1))
+    {
+      if (vec_cmpud_all_ge (x_exp, exp_low)
+       && vec_cmpud_all_eq ((vui64_t)b_sign, (vui64_t)q_zero))
+	{ // Greater than or equal to 1.0
+	  if (vec_cmpud_all_lt (x_exp, exp_high))
+	    { // Less than 2**64-1
+	      q_sig = vec_slqi (q_sig, 15);
+	      q_delta = vec_subudm (exp_63, x_exp);
+	      result = vec_vsrd ((vui64_t) q_sig, q_delta);
+	    }
+	  else
+	    { // set result to 2**64-1
+	      result = q_ones;
+	    }
+	}
+      else
+	{ // less than 1.0 or negative
+	  result = q_zero;
+	}
+    }
+  else
+    { // isinf or isnan.
+      vb128_t is_inf;
+      // Positive Inf returns all ones
+      // else NaN or -Infinity returns zero
+      is_inf = vec_cmpequq (q_sig, (vui128_t) q_zero);
+      // result = ~NaN | (pos & Inf) -> Inf & (pos & Inf) -> pos & Inf
+      result = (vui64_t) vec_andc ((vui32_t) is_inf, (vui32_t) b_sign);
+    }
+  result = vec_mrgahd ((vui128_t) result, (vui128_t) q_zero);
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Convert with round to zero Quad-Precision to Unsigned Quadword.
+ *
+ *  The quad-precision element of vector f128 is converted
+ *  to an unsigned quadword integer.
+ *  The Floating point value is rounded toward zero before conversion.
+ *
+ *  For POWER10 use the xscvqpuqz instruction.
+ *  For POWER9 and earlier use vector instruction generated by PVECLIB
+ *  operations.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xscvqpuqz instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |   ?   | 2/cycle  |
+ *  |power9   |   ?   | 2/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @return a vector unsigned __int128 value.
+ */
+static inline vui128_t
+vec_xscvqpuqz (__binary128 f128)
+{
+  vui128_t result;
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 10)
+  __asm__(
+      "xscvqpuqz %0,%1"
+      : "=v" (result)
+      : "v" (f128)
+      : );
+#else
+  vui64_t q_exp, q_delta, x_exp;
+  vui128_t q_sig;
+  vb128_t b_sign;
+  const vui128_t q_zero = { 0 };
+  const vui128_t q_ones = (vui128_t) vec_splat_s32 (-1);
+  const vui64_t exp_low = (vui64_t) CONST_VINT64_DW ( 0x3fff, 0x3fff );
+  const vui64_t exp_high = (vui64_t) CONST_VINT64_DW ( (0x3fff+128), (0x3fff+128) );
   const vui64_t exp_127 = (vui64_t) CONST_VINT64_DW ( (0x3fff+127), (0x3fff+127) );
   const vui64_t q_naninf = (vui64_t) CONST_VINT64_DW ( 0x7fff, 0x7fff );
 
@@ -8947,6 +10496,71 @@ vec_xscvqpuqz (__binary128 f128)
   return result;
 }
 
+/** \brief VSX Scalar Convert with round to zero Quad-Precision to
+ *  Unsigned word.
+ *
+ *  The quad-precision element of vector f128 is converted
+ *  to an unsigned word integer.
+ *  The Floating point value is rounded toward zero before conversion.
+ *  The result is zero extended into doubleword element 0 while
+ *  element 1 is set to zero.
+ *  Values greater than the range return 0xffffffff, negative values
+ *  and NaNs return 0.
+ *
+ *  For POWER9 use the xscvqpuwz instruction.
+ *  For POWER8 and earlier convert to doubleword (vec_xscvqpudz())
+ *  and saturate.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 32-47 | 2/cycle  |
+ *  |power9   |   12  | 1/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @return a vector unsigned long long value.
+ */
+static inline vui64_t
+vec_xscvqpuwz (__binary128 f128)
+{
+  vui64_t result;
+#if defined (_ARCH_PWR9) && defined (__FLOAT128__) && (__GNUC__ > 7)
+  __asm__(
+      "xscvqpuwz %0,%1"
+      : "=v" (result)
+      : "v" (f128)
+      : );
+#else
+  const vui64_t w_max = (vui64_t) CONST_VINT64_DW (0xffffffff, 0);
+
+  result = vec_minud (vec_xscvqpudz (f128), w_max);
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Convert Quad-Precision to Unsigned word with
+ *  explicit rounding mode.
+ *
+ *  The quad-precision element of vector f128 is rounded to an
+ *  integral value as specified by rnd (vec_xsrqpi_rnd()), then
+ *  converted to an unsigned word integer as vec_xscvqpuwz() does
+ *  (saturated, zero extended into doubleword element 0). The
+ *  result does not depend on <B>FPSCR<sub>RN</sub></B>.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 55-90 | 1/cycle  |
+ *  |power9   |   24  | 1/cycle  |
+ *
+ *  @param f128 128-bit vector treated as a scalar __binary128.
+ *  @param rnd the rounding mode.
+ *  @return a vector unsigned long long value.
+ */
+static inline vui64_t
+vec_xscvqpuw_rnd (__binary128 f128, vec_round_t rnd)
+{
+  return vec_xscvqpuwz (vec_xsrqpi_rnd (f128, rnd));
+}
+
 /** \brief VSX Scalar Convert Signed-Doubleword to Quad-Precision format.
  *
  *  The left most signed doubleword element of vector int64 is converted
@@ -9297,97 +10911,431 @@ static inline vec_xscvuqqp (vui128_t int128)
       result = vec_xfer_vui128t_2_bin128 (q_zero);
     }
   else
-    { // We need to produce a normal QP, so we treat the integer like a
-      // denormal, then normalize it.
-      // Start with the quad exponent bias + 127 then subtract the count of
-      // leading '0's. The 128-bit sig can have 0-127 leading '0's.
-      vui64_t q_expm = (vui64_t) CONST_VINT64_DW (0, (0x3fff + 127));
-      vui64_t i64_clz = (vui64_t) vec_clzq (q_sig);
-      q_sig = vec_slq (q_sig, (vui128_t) i64_clz);
-      q_exp = vec_subudm (q_expm, i64_clz);
-      // This is the part that might require rounding.
-      // The Significand (including the L-bit) is right justified in
-      // in the high-order 113-bits of q_sig.
-      // The guard, round, and sticky (GRX) bits are in the low-order
-      // 15 bits.
-      // The sticky-bits are the last 13 bits and are logically ORed
-      // (or added to 0x1fff) to produce the X-bit.
-      //
-      // For "Round to Nearest Even".
-      // GRX = 0b001 - 0b011; truncate
-      // GRX = 0b100 and bit-112 is odd; round up, otherwise truncate
-      // GRX = 0b100 - 0b111; round up
-      // We can simplify by copying bit-112 and OR it with bit-X
-      // Then add 0x3fff to q_sig will generate a carry into bit-112
-      // if and only if GRX > 0b100 or (GRX == 0b100) && (bit-112 == 1)
-      const vui32_t RXmask = CONST_VINT128_W ( 0, 0, 0, 0x3fff);
-      vui128_t q_carry, q_sigc;
-      vb128_t qcmask;
-      vui32_t q_odd;
-      // Isolate bit-112 and OR into GRX bits if q_sig is odd
-      q_odd = (vui32_t) vec_srhi ((vui16_t)q_sig, 15);
-      q_odd = vec_and (q_odd, lowmask);
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_odd);
-      // We add 0x3fff to GRX-bits which may carry into low order sig-bit
-      // This may result in a carry out of bit L into bit-C.
-      q_carry = vec_addcuq (q_sig, (vui128_t) RXmask);
-      q_sig = vec_adduqm (q_sig, (vui128_t) RXmask);
-      // Generate a bool mask from the carry to use in the vsel
-      qcmask = vec_setb_cyq (q_carry);
-      // Two cases; 1) We did carry so shift (double) left 112 bits
-      q_sigc = vec_sldqi (q_carry, q_sig, 112);
-      // 2) no carry so shift left 15 bits
-      q_sig = vec_srqi ((vui128_t) q_sig, 15);
-      // Select which based on carry
-      q_sig = (vui128_t) vec_sel ((vui32_t) q_sig, (vui32_t) q_sigc, (vui32_t) qcmask);
-      // Increment the exponent based on the carry
-      q_exp = vec_addudm (q_exp, (vui64_t) q_carry);
-      q_exp = vec_swapd (q_exp);
-      result = vec_xsiexpqp (q_sig, q_exp);
+    { // We need to produce a normal QP, so we treat the integer like a
+      // denormal, then normalize it.
+      // Start with the quad exponent bias + 127 then subtract the count of
+      // leading '0's. The 128-bit sig can have 0-127 leading '0's.
+      vui64_t q_expm = (vui64_t) CONST_VINT64_DW (0, (0x3fff + 127));
+      vui64_t i64_clz = (vui64_t) vec_clzq (q_sig);
+      q_sig = vec_slq (q_sig, (vui128_t) i64_clz);
+      q_exp = vec_subudm (q_expm, i64_clz);
+      // This is the part that might require rounding.
+      // The Significand (including the L-bit) is right justified in
+      // in the high-order 113-bits of q_sig.
+      // The guard, round, and sticky (GRX) bits are in the low-order
+      // 15 bits.
+      // The sticky-bits are the last 13 bits and are logically ORed
+      // (or added to 0x1fff) to produce the X-bit.
+      //
+      // For "Round to Nearest Even".
+      // GRX = 0b001 - 0b011; truncate
+      // GRX = 0b100 and bit-112 is odd; round up, otherwise truncate
+      // GRX = 0b100 - 0b111; round up
+      // We can simplify by copying bit-112 and OR it with bit-X
+      // Then add 0x3fff to q_sig will generate a carry into bit-112
+      // if and only if GRX > 0b100 or (GRX == 0b100) && (bit-112 == 1)
+      const vui32_t RXmask = CONST_VINT128_W ( 0, 0, 0, 0x3fff);
+      vui128_t q_carry, q_sigc;
+      vb128_t qcmask;
+      vui32_t q_odd;
+      // Isolate bit-112 and OR into GRX bits if q_sig is odd
+      q_odd = (vui32_t) vec_srhi ((vui16_t)q_sig, 15);
+      q_odd = vec_and (q_odd, lowmask);
+      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_odd);
+      // We add 0x3fff to GRX-bits which may carry into low order sig-bit
+      // This may result in a carry out of bit L into bit-C.
+      q_carry = vec_addcuq (q_sig, (vui128_t) RXmask);
+      q_sig = vec_adduqm (q_sig, (vui128_t) RXmask);
+      // Generate a bool mask from the carry to use in the vsel
+      qcmask = vec_setb_cyq (q_carry);
+      // Two cases; 1) We did carry so shift (double) left 112 bits
+      q_sigc = vec_sldqi (q_carry, q_sig, 112);
+      // 2) no carry so shift left 15 bits
+      q_sig = vec_srqi ((vui128_t) q_sig, 15);
+      // Select which based on carry
+      q_sig = (vui128_t) vec_sel ((vui32_t) q_sig, (vui32_t) q_sigc, (vui32_t) qcmask);
+      // Increment the exponent based on the carry
+      q_exp = vec_addudm (q_exp, (vui64_t) q_carry);
+      q_exp = vec_swapd (q_exp);
+      result = vec_xsiexpqp (q_sig, q_exp);
+    }
+#else
+  result = int128[0];
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Multiply Quad-Precision using round to Odd.
+ *
+ *  The quad-precision element of vectors vfa and vfb are multiplied
+ *  to produce the quad-precision result.
+ *  The rounding mode is round to odd.
+ *
+ *  For POWER9 use the xsmulqpo instruction.
+ *  For POWER8 use this soft-float implementation using
+ *  vector instruction generated by PVECLIB operations.
+ *  For POWER7 and earlier is the compilers soft-float implementation.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xsmulqpo instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 78-84 | 1/cycle  |
+ *  |power9   |   24  |1/12 cycle|
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @return a vector unsigned __int128 value.
+ */
+static inline __binary128
+vec_xsmulqpo (__binary128 vfa, __binary128 vfb)
+{
+  __binary128 result;
+#if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+#if defined (__FLOAT128__) && (__GNUC__ > 8)
+  // earlier GCC versions generate extra data moves for this.
+  result = __builtin_mulf128_round_to_odd (vfa, vfb);
+#else
+  // No extra data moves here.
+  __asm__(
+      "xsmulqpo %0,%1,%2"
+      : "=v" (result)
+      : "v" (vfa), "v" (vfb)
+      : );
+#endif
+  return result;
+#else  //_ARCH_PWR8 or _ARCH_PWR7
+  vui64_t q_exp, a_exp, b_exp, x_exp;
+  vui128_t q_sig, a_sig, b_sig, p_sig_h, p_sig_l, p_odd;
+  vui32_t q_sign, a_sign, b_sign;
+  vui128_t a_mag, b_mag;
+  const vui32_t q_zero = CONST_VINT128_W(0, 0, 0, 0);
+  const vui32_t q_ones = CONST_VINT128_W(-1, -1, -1, -1);
+  //const vui64_t exp_naninf = (vui64_t) { 0x7fff, 0x7fff };
+  const vui64_t exp_naninf = vec_mask64_f128exp ();
+  const vui32_t magmask = vec_mask128_f128mag ();
+
+  // Vector extract the exponents from vfa, vfb
+  x_exp = vec_xxxexpqpp (vfa, vfb);
+  // Mask off sign bits so can use integers for magnitude compare.
+  a_mag = (vui128_t) vec_and_bin128_2_vui32t (vfa, magmask);
+  b_mag = (vui128_t) vec_and_bin128_2_vui32t (vfb, magmask);
+  a_sign = vec_andc_bin128_2_vui32t (vfa, magmask);
+  b_sign = vec_andc_bin128_2_vui32t (vfb, magmask);
+  q_sign = vec_xor (a_sign, b_sign);
+
+//  if (vec_all_isfinitef128 (vfa) && vec_all_isfinitef128 (vfb))
+  if (__builtin_expect (vec_cmpud_all_lt (x_exp, exp_naninf), 1))
+    {
+      const vui64_t exp_dnrm = (vui64_t) q_zero;
+      vui64_t exp_min, exp_one, exp_bias;
+      vui128_t p_tmp;
+      // const vui64_t exp_min, exp_one = { 1, 1 };
+      // exp_min = exp_one = vec_splat_u64 (1);
+	{ // Extract the significands and insert the Hidden bit
+	  //const vui32_t q_zero = CONST_VINT128_W(0, 0, 0, 0);
+	  const vui32_t sigmask = vec_mask128_f128sig ();
+	  vui32_t a_s32, b_s32;
+	  vui16_t a_e16, b_e16, x_hidden;
+	  vb16_t a_norm, b_norm;
+
+	  //const vui32_t hidden = vec_mask128_f128Lbit();
+	  x_hidden = vec_splat_u16(1);
+	  // Assume that the operands are finite magnitudes
+	  // Mask off the significands
+	  // Applying sigmask to orignal inputs can save 2 cycles here
+	  a_s32 = vec_and_bin128_2_vui32t (vfa, sigmask);
+	  b_s32 = vec_and_bin128_2_vui32t (vfb, sigmask);
+	  // But still need a/b_mag for exp extract to clear sign-bit
+	  // Mask off the exponents in high halfword
+	  a_e16 = (vui16_t) vec_andc ((vui32_t) a_mag, sigmask);
+	  b_e16 = (vui16_t) vec_andc ((vui32_t) b_mag, sigmask);
+	  // Compare exponents for finite i.e. > denomal (q_zero)
+	  a_norm = vec_cmpgt (a_e16, (vui16_t) q_zero);
+	  b_norm = vec_cmpgt (b_e16, (vui16_t) q_zero);
+	  // For Normal QP insert (hidden) L-bit into significand
+	  a_sig = (vui128_t) vec_sel ((vui16_t) a_s32, x_hidden, a_norm);
+	  b_sig = (vui128_t) vec_sel ((vui16_t) b_s32, x_hidden, b_norm);
+	}
+
+      // Precondition the significands before multiply so that the
+      // high-order 114-bits (C,L,FRACTION) of the product are right
+      // adjusted in p_sig_h. And the Low-order 112-bits are left
+      // justified in p_sig_l.
+      // Logically this (multiply) step could be moved after the zero
+      // test. But this uses a lot of registers and the compiler may
+      // see this as register pressure and decide to spill and reload
+      // unrelated data around this block.
+      // The zero multiply is rare so on average performance is better
+      // if we get this started now.
+      a_sig = vec_slqi (a_sig, 8);
+      b_sig = vec_slqi (b_sig, 8);
+      p_sig_l = vec_muludq (&p_sig_h, a_sig, b_sig);
+
+      // check for zero significands in multiply
+      if (__builtin_expect (
+	  (vec_all_eq((vui32_t ) a_sig, (vui32_t ) q_zero)
+	      || vec_all_eq((vui32_t ) b_sig, (vui32_t ) q_zero)),
+	  0))
+	{ // Multiply by zero, return QP signed zero
+	  result = vec_xfer_vui32t_2_bin128 (q_sign);
+	  return result;
+	}
+
+      // const vui64_t exp_min, exp_one = { 1, 1 };
+      exp_min = exp_one = vec_splat_u64 (1);
+      //const vui64_t exp_bias = (vui64_t) { 0x3fff, 0x3fff };
+      exp_bias = (vui64_t) vec_srhi ((vui16_t) exp_naninf, 1);
+	{ // Compute product exponent q_exp
+	  // Operand exponents should >= Emin for computation
+	  vb64_t exp_mask;
+	  exp_mask = vec_cmpequd (x_exp, exp_dnrm);
+	  x_exp = vec_selud (x_exp, exp_min, (vb64_t) exp_mask);
+	  // sum exponents across x_exp
+	  q_exp = vec_addudm (x_exp, vec_swapd (x_exp));
+	  // Sum includes 2 x exp_bias, So subtract 1 x exp_bias
+	  q_exp = vec_subudm (q_exp, exp_bias);
+	}
+
+      // Check for carry; shift right 1 and adjust exp +1
+	{
+	  vb128_t carry_mask;
+	  vui128_t sig_h, sig_l;
+	  // Test Carry-bit (greater than L-bit)
+	  vui16_t sig_l_mask = vec_splat_u16(1);
+	  vui16_t t_sig = vec_splat ((vui16_t) p_sig_h, VEC_HW_H);
+	  carry_mask = (vb128_t) vec_cmpgt (t_sig, sig_l_mask);
+	  // Shift double quadword right 1 bit
+	  p_tmp = vec_sldqi (p_sig_h, p_sig_l, 120);
+	  sig_h = vec_srqi (p_sig_h, 1);
+	  sig_l = vec_slqi (p_tmp, 7);
+	  // Increment the exponent
+	  x_exp = vec_addudm (q_exp, exp_one);
+	  // Select original or normalized exp/sig
+	  p_sig_h = vec_seluq (p_sig_h, sig_h, carry_mask);
+	  p_sig_l = vec_seluq (p_sig_l, sig_l, carry_mask);
+	  q_exp = vec_selud (q_exp, x_exp, (vb64_t) carry_mask);
+	}
+
+      // There are two cases for denormal
+      // 1) The sum of unbiased exponents is less the E_min (tiny).
+      // 2) The significand is less then 1.0 (C and L-bits are zero).
+      //  2a) The exponent is > E_min
+      //  2b) The exponent is == E_min
+      //
+      q_sig = p_sig_h;
+      // Check for Tiny exponent
+      if (__builtin_expect (
+	  (vec_cmpsd_all_lt ((vi64_t) q_exp, (vi64_t) exp_min)), 0))
+	{
+	  //const vui64_t exp_128 = (vui64_t) { 128, 128 };
+	  const vui64_t exp_128 = vec_const64_f128_128 ();
+	  const vui64_t too_tiny = (vui64_t
+		)
+		  { 116, 116 };
+	  // const vui32_t xmask = CONST_VINT128_W(0x1fffffff, -1, -1, -1);
+	  vui32_t xmask = (vui32_t) vec_srqi ((vui128_t) q_ones, 3);
+	  vui32_t tmp;
+
+	  // Intermediate result is tiny, unbiased exponent < -16382
+	  //x_exp = vec_subudm ((vui64_t) exp_tiny, q_exp);
+	  x_exp = vec_subudm (exp_min, q_exp);
+
+	  if (vec_cmpud_all_gt ((vui64_t) x_exp, too_tiny))
+	    {
+	      // Intermediate result is too tiny, the shift will
+	      // zero the fraction and the GR-bit leaving only the
+	      // Sticky bit. The X-bit needs to include all bits
+	      // from p_sig_h and p_sig_l
+	      p_sig_l = vec_srqi (p_sig_l, 8);
+	      p_sig_l = (vui128_t) vec_or ((vui32_t) p_sig_l,
+					   (vui32_t) p_sig_h);
+	      // generate a carry into bit-2 for any nonzero bits 3-127
+	      p_sig_l = vec_adduqm (p_sig_l, (vui128_t) xmask);
+	      q_sig = (vui128_t) q_zero;
+	      p_sig_l = (vui128_t) vec_andc ((vui32_t) p_sig_l, xmask);
+	    }
+	  else
+	    { // Normal tiny, right shift may loose low order bits
+	      // from p_sig_l. So collect any 1-bits below GRX and
+	      // OR them into the X-bit, before the right shift.
+	      vui64_t l_exp;
+
+	      // Propagate low order bits into the sticky bit
+	      // GRX left adjusted in p_sig_l
+	      // Issolate bits below GDX (bits 3-128).
+	      tmp = vec_and ((vui32_t) p_sig_l, xmask);
+	      // generate a carry into bit-2 for any nonzero bits 3-127
+	      tmp = (vui32_t) vec_adduqm ((vui128_t) tmp, (vui128_t) xmask);
+	      // Or this with the X-bit to propagate any sticky bits into X
+	      p_sig_l = (vui128_t) vec_or ((vui32_t) p_sig_l, tmp);
+	      p_sig_l = (vui128_t) vec_andc ((vui32_t) p_sig_l, xmask);
+
+	      l_exp = vec_subudm (exp_128, x_exp);
+	      p_sig_l = vec_sldq (p_sig_h, p_sig_l, (vui128_t) l_exp);
+	      p_sig_h = vec_srq (p_sig_h, (vui128_t) x_exp);
+	      q_sig = p_sig_h;
+	    }
+	  // Set the exponent for denormal
+	  q_exp = exp_dnrm;
+	}
+      // Exponent is not tiny but significand may be denormal
+      // Isolate sig CL bits and compare
+      vui16_t t_sig = vec_splat ((vui16_t) p_sig_h, VEC_HW_H);
+      if (__builtin_expect ((vec_all_eq(t_sig, (vui16_t ) q_zero)), 0))
+	{
+	  // Is below normal range. This can happen when
+	  // multiplying a denormal by a normal.
+	  // So try to normalize the significand.
+	  //const vui64_t exp_15 = { 15, 15 };
+	  const vui64_t exp_15 = vec_splat_u64 (15);
+	  vui64_t c_exp, d_exp;
+	  vui128_t c_sig;
+	  vb64_t exp_mask;
+	  c_sig = vec_clzq (p_sig_h);
+	  c_exp = vec_splatd ((vui64_t) c_sig, VEC_DW_L);
+	  c_exp = vec_subudm (c_exp, exp_15);
+	  d_exp = vec_subudm (q_exp, exp_min);
+	  d_exp = vec_minud (c_exp, d_exp);
+	  exp_mask = vec_cmpgtud (q_exp, c_exp);
+
+	  // Intermediate result <= tiny, unbiased exponent <= -16382
+	  if (vec_cmpsd_all_gt ((vi64_t) q_exp, (vi64_t) exp_min))
+	    {
+	      // Try to normalize the significand.
+	      p_sig_h = vec_sldq (p_sig_h, p_sig_l, (vui128_t) d_exp);
+	      p_sig_l = vec_slq (p_sig_l, (vui128_t) d_exp);
+	      q_sig = p_sig_h;
+	      // Compare computed exp to shift count to normalize.
+	      //exp_mask = vec_cmpgtud (q_exp, c_exp);
+	      q_exp = vec_subudm (q_exp, d_exp);
+	      q_exp = vec_selud (exp_dnrm, q_exp, exp_mask);
+	    }
+	  else
+	    { // sig is denormal range (L-bit is 0). Set exp to zero.
+	      q_exp = exp_dnrm;
+	    }
+	}
+      // Merge sign early will not effect rounding for this mode
+      // q_ssig = vec_or ((vui32_t) q_sig, q_sign);
+      // Round to odd from lower product bits
+      p_odd = vec_addcuq (p_sig_l, (vui128_t) q_ones);
+      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
+
+      // Check for exponent overflow -> __FLT128_MAX__ (round to odd)
+      if (__builtin_expect ((vec_cmpud_all_ge (q_exp, exp_naninf)), 0))
+	{
+	  // Intermediate result is huge, unbiased exponent > 16383
+	  // so return __FLT128_MAX__ with the appropriate sign.
+	  const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
+	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
+	  return vec_xfer_vui32t_2_bin128 (f128_smax);
+	}
+      else // combine sign, exp, and significand for return
+	{
+	  // Merge sign, significand, and exponent into final result
+	  q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
+	  vui32_t tmp, t128;
+	  // convert DW exp_naninf to QW expmask
+	  vui32_t expmask = vec_sld ((vui32_t) exp_naninf, q_zero, 14);
+	  // convert q_exp from DW to QW for QP format
+	  tmp = vec_sld ((vui32_t) q_exp, q_zero, 14);
+	  t128 = vec_sel ((vui32_t) q_sig, tmp, expmask);
+	  result = vec_xfer_vui32t_2_bin128 (t128);
+	  return result;
+	}
+    }
+  else
+    { // One or both operands are NaN or Infinity
+      //const vui32_t q_nan = CONST_VINT128_W(0x00008000, 0, 0, 0);
+      vui32_t q_nan = vec_mask128_f128Qbit ();
+      vui32_t q_inf = vec_mask128_f128exp ();
+      // One or both operands are NaN
+      if (vec_all_isnanf128 (vfa))
+	{
+	  // vfa is NaN, Convert vfa to QNaN and return
+	  vui32_t vf128 = vec_or_bin128_2_vui32t (vfa, q_nan);
+	  return vec_xfer_vui32t_2_bin128 (vf128);
+	}
+      else if (vec_all_isnanf128 (vfb))
+	{
+	  // vfb is NaN, Convert vfb to QNaN and return
+	  vui32_t vf128 = vec_or_bin128_2_vui32t (vfb, q_nan);
+	  return vec_xfer_vui32t_2_bin128 (vf128);
+	}
+      else  // Or one or both operands are Infinity
+	{
+	  if (vec_cmpud_all_eq (x_exp, (vui64_t) exp_naninf))
+	    {
+	      // Infinity x Infinity == signed Infinity
+	      q_sig = (vui128_t) q_inf;
+	    }
+	  else
+	    {
+	      // One each Infinity/Finite value, check for 0.0
+	      if (vec_cmpuq_all_eq (a_mag, (vui128_t) q_zero)
+		  || vec_cmpuq_all_eq (b_mag, (vui128_t) q_zero))
+		{
+		  // Inifinty x Zero is Default Quiet NaN
+		  return vec_const_nanf128 ();
+		}
+	      else // an Infinity and a Nonzero finite number
+		{
+		  // Return Infinity with product sign.
+		  q_sig = (vui128_t) q_inf;
+		}
+	    }
+	  // Merge sign, exp/sig into final result
+	  q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
+	  return vec_xfer_vui128t_2_bin128 (q_sig);
+	}
     }
-#else
-  result = int128[0];
 #endif
   return result;
 }
 
-/** \brief VSX Scalar Multiply Quad-Precision using round to Odd.
+/** \brief VSX Scalar Multiply Quad-Precision using round to Nearest.
  *
  *  The quad-precision element of vectors vfa and vfb are multiplied
  *  to produce the quad-precision result.
- *  The rounding mode is round to odd.
- *
- *  For POWER9 use the xsmulqpo instruction.
- *  For POWER8 use this soft-float implementation using
- *  vector instruction generated by PVECLIB operations.
+ *  The rounding mode is round to nearest, ties to even.
+ *
+ *  For POWER9 use the xsmulqp instruction, which rounds as
+ *  <B>FPSCR<sub>RN</sub></B> (round to nearest unless the program
+ *  changed it).
+ *  For POWER8 use the soft-float implementation of vec_xsmulqpo()
+ *  with a round to nearest even step in place of round to odd.
+ *  The low order product bits (plus the least significant bit) are
+ *  added to one less than half, the carry is the round bit.
  *  For POWER7 and earlier is the compilers soft-float implementation.
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xsmulqpo instruction,
- *  the implementation may use that.
  *
  *  |processor|Latency|Throughput|
  *  |--------:|:-----:|:---------|
- *  |power8   | 78-84 | 1/cycle  |
+ *  |power8   | 82-88 | 1/cycle  |
  *  |power9   |   24  |1/12 cycle|
  *
  *  @param vfa 128-bit vector treated as a scalar __binary128.
  *  @param vfb 128-bit vector treated as a scalar __binary128.
- *  @return a vector unsigned __int128 value.
+ *  @return a __binary128 value of vfa * vfb.
  */
 static inline __binary128
-vec_xsmulqpo (__binary128 vfa, __binary128 vfb)
+vec_xsmulqpn (__binary128 vfa, __binary128 vfb)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
 #if defined (__FLOAT128__) && (__GNUC__ > 8)
-  // earlier GCC versions generate extra data moves for this.
-  result = __builtin_mulf128_round_to_odd (vfa, vfb);
+  // Let the compilers generate and optimize code.
+  result = vfa * vfb;
 #else
   // No extra data moves here.
   __asm__(
-      "xsmulqpo %0,%1,%2"
+      "xsmulqp %0,%1,%2"
       : "=v" (result)
       : "v" (vfa), "v" (vfb)
       : );
@@ -9605,20 +11553,22 @@ vec_xsmulqpo (__binary128 vfa, __binary128 vfb)
 	      q_exp = exp_dnrm;
 	    }
 	}
-      // Merge sign early will not effect rounding for this mode
-      // q_ssig = vec_or ((vui32_t) q_sig, q_sign);
-      // Round to odd from lower product bits
-      p_odd = vec_addcuq (p_sig_l, (vui128_t) q_ones);
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
+      // Round to nearest even from lower product bits. The GRX-bits
+      // are left justified in p_sig_l, so round up if
+      // p_sig_l + 0x7fff...ffff + L carries, that is more than half,
+      // or exactly half and L == 1.
+      {
+	const vui128_t half_m1 = vec_srqi ((vui128_t) q_ones, 1);
+	p_odd = vec_addecuq (p_sig_l, half_m1, q_sig);
+      }
 
-      // Check for exponent overflow -> __FLT128_MAX__ (round to odd)
+      // Check for exponent overflow -> Infinity (round to nearest)
       if (__builtin_expect ((vec_cmpud_all_ge (q_exp, exp_naninf)), 0))
 	{
 	  // Intermediate result is huge, unbiased exponent > 16383
-	  // so return __FLT128_MAX__ with the appropriate sign.
-	  const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
-	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
-	  return vec_xfer_vui32t_2_bin128 (f128_smax);
+	  // so return Infinity with the appropriate sign.
+	  vui32_t f128_sinf = vec_or (vec_mask128_f128exp (), q_sign);
+	  return vec_xfer_vui32t_2_bin128 (f128_sinf);
 	}
       else // combine sign, exp, and significand for return
 	{
@@ -9630,6 +11580,9 @@ vec_xsmulqpo (__binary128 vfa, __binary128 vfb)
 	  // convert q_exp from DW to QW for QP format
 	  tmp = vec_sld ((vui32_t) q_exp, q_zero, 14);
 	  t128 = vec_sel ((vui32_t) q_sig, tmp, expmask);
+	  // Add the round bit, a carry out of the significand
+	  // increments the exponent.
+	  t128 = (vui32_t) vec_adduqm ((vui128_t) t128, p_odd);
 	  result = vec_xfer_vui32t_2_bin128 (t128);
 	  return result;
 	}
@@ -9683,6 +11636,303 @@ vec_xsmulqpo (__binary128 vfa, __binary128 vfb)
   return result;
 }
 
+/** \brief VSX Scalar Multiply-Add Quad-Precision using round to Odd.
+ *
+ *  The quad-precision elements of vectors vfa and vfb are multiplied
+ *  and the quad-precision element of vfc is added to the product
+ *  to produce the quad-precision result.
+ *  The rounding mode is round to odd.
+ *
+ *  For POWER9 use the xsmaddqpo instruction. The product is not
+ *  rounded before the add.
+ *  For POWER8 and earlier use vec_xsmulqpo() followed by
+ *  vec_xsaddqpo(). This rounds the product (to odd) before the add,
+ *  unless the product is exact. For example the product of two
+ *  values converted from double is always exact. With the two
+ *  roundings the result may be 2 ULP from the exact value (not 1 as
+ *  for the fused operation).
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xsmaddqpo instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |132-155| 1/cycle  |
+ *  |power9   |   24  |1/12 cycle|
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param vfc 128-bit vector treated as a scalar __binary128.
+ *  @return a __binary128 value of vfa * vfb + vfc.
+ */
+static inline __binary128
+vec_xsmaddqpo (__binary128 vfa, __binary128 vfb, __binary128 vfc)
+{
+  __binary128 result;
+#if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+#if defined (__FLOAT128__) && (__GNUC__ > 8)
+  // earlier GCC versions generate extra data moves for this.
+  result = __builtin_fmaf128_round_to_odd (vfa, vfb, vfc);
+#else
+  // No extra data moves here.
+  result = vfc;
+  __asm__(
+      "xsmaddqpo %0,%1,%2"
+      : "+v" (result)
+      : "v" (vfa), "v" (vfb)
+      : );
+#endif
+#else  //_ARCH_PWR8 or _ARCH_PWR7
+  result = vec_xsaddqpo (vec_xsmulqpo (vfa, vfb), vfc);
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Multiply-Add Quad-Precision using round to
+ *  Nearest.
+ *
+ *  The quad-precision elements of vectors vfa and vfb are multiplied
+ *  and the quad-precision element of vfc is added to the product
+ *  to produce the quad-precision result.
+ *  The rounding mode is round to nearest, ties to even.
+ *
+ *  For POWER9 use the xsmaddqp instruction (fused, one rounding as
+ *  <B>FPSCR<sub>RN</sub></B>, round to nearest unless the program
+ *  changed it).
+ *  For POWER8 and earlier use vec_xsmulqpo() followed by
+ *  vec_xsaddqpn(). If the product is exact (for example the product
+ *  of two values converted from double) this is the correctly
+ *  rounded result. Otherwise the product is rounded to odd first
+ *  and the result may differ from the fused result by 1 ULP.
+ *
+ *  Use this for the last step of a chain of vec_xsmaddqpo()
+ *  operations, where the result is kept in quad-precision.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |136-160| 1/cycle  |
+ *  |power9   |   24  |1/12 cycle|
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param vfc 128-bit vector treated as a scalar __binary128.
+ *  @return a __binary128 value of vfa * vfb + vfc.
+ */
+static inline __binary128
+vec_xsmaddqpn (__binary128 vfa, __binary128 vfb, __binary128 vfc)
+{
+  __binary128 result;
+#if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+#if defined (__FLOAT128__) && (__GNUC__ > 8)
+  // Let the compilers generate and optimize code.
+  result = __builtin_fmaf128 (vfa, vfb, vfc);
+#else
+  // No extra data moves here.
+  result = vfc;
+  __asm__(
+      "xsmaddqp %0,%1,%2"
+      : "+v" (result)
+      : "v" (vfa), "v" (vfb)
+      : );
+#endif
+#else  //_ARCH_PWR8 or _ARCH_PWR7
+  result = vec_xsaddqpn (vec_xsmulqpo (vfa, vfb), vfc);
+#endif
+  return result;
+}
+
+/** \brief VSX Scalar Round to Quad-Precision Integer with explicit
+ *  rounding mode.
+ *
+ *  The quad-precision value f128 is rounded to an integral value
+ *  using the rounding mode rnd. VEC_ROUND_HALF_UP rounds ties away
+ *  from zero and VEC_ROUND_UP rounds away from zero, the others are
+ *  the IEEE rounding directions. The result does not depend on
+ *  <B>FPSCR<sub>RN</sub></B>. Infinities, zeros and values with
+ *  no fraction bits are returned unchanged. NaNs are returned quiet.
+ *  The sign of f128 is preserved (-0.5 rounded toward zero is -0.0).
+ *
+ *  For POWER9 use the xsrqpi instruction. The R and RMC operands are
+ *  immediate so each mode is a separate instruction. There is no
+ *  encoding for VEC_ROUND_UP, so that rounds the magnitude toward
+ *  +Infinity and copies the sign.
+ *
+ *  For POWER8 and earlier work on the binary representation as an
+ *  unsigned quadword. If the unbiased exponent is less than 112
+ *  there are 112 - exponent fraction bits at the low end. Clear
+ *  them to truncate. Rounding away from zero adds one unit in the
+ *  last integral position. Any carry out of the significand
+ *  propagates into the exponent, which is the correct result. The
+ *  mode decides between the two using the fraction bits, the sign
+ *  and (for ties to even) the low order integral bit. Magnitudes
+ *  less than 1.0 round to 0.0 or 1.0 with the sign of f128.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 20-40 | 1/cycle  |
+ *  |power9   |  12   | 1/cycle  |
+ *
+ *  @param f128 a __binary128 value.
+ *  @param rnd the rounding mode.
+ *  @return f128 rounded to an integral value.
+ */
+static inline __binary128
+vec_xsrqpi_rnd (__binary128 f128, vec_round_t rnd)
+{
+  __binary128 result;
+#if defined (_ARCH_PWR9) && defined (__FLOAT128__) && (__GNUC__ > 7)
+  switch (rnd)
+    {
+    case VEC_ROUND_TRUNC:
+      __asm__(
+	  "xsrqpi 1,%0,%1,1"
+	  : "=v" (result)
+	  : "v" (f128)
+	  : );
+      break;
+    case VEC_ROUND_HALF_UP:
+      __asm__(
+	  "xsrqpi 0,%0,%1,0"
+	  : "=v" (result)
+	  : "v" (f128)
+	  : );
+      break;
+    case VEC_ROUND_HALF_EVEN:
+      __asm__(
+	  "xsrqpi 1,%0,%1,0"
+	  : "=v" (result)
+	  : "v" (f128)
+	  : );
+      break;
+    case VEC_ROUND_FLOOR:
+      __asm__(
+	  "xsrqpi 1,%0,%1,3"
+	  : "=v" (result)
+	  : "v" (f128)
+	  : );
+      break;
+    case VEC_ROUND_CEIL:
+      __asm__(
+	  "xsrqpi 1,%0,%1,2"
+	  : "=v" (result)
+	  : "v" (f128)
+	  : );
+      break;
+    default:
+      // VEC_ROUND_UP, round the magnitude toward +Inf.
+      __asm__(
+	  "xsrqpi 1,%0,%1,2"
+	  : "=v" (result)
+	  : "v" (vec_absf128 (f128))
+	  : );
+      result = vec_copysignf128 (f128, result);
+      break;
+    }
+#else
+  vui128_t q_bits, q_mask, q_frac, q_half, q_unit;
+  unsigned long long x_exp, x_sign;
+  int round_up;
+  const vui128_t q_zero = { 0 };
+  const vui128_t q_ones = (vui128_t) vec_splat_s32 (-1);
+  const vui128_t q_one = (vui128_t) CONST_VINT128_DW (0, 1);
+  const vui32_t magmask = vec_mask128_f128mag ();
+  const vui32_t q_quiet = vec_mask128_f128Qbit ();
+  // Exponent field of 0.5 and 1.0
+  const vui128_t q_exphalf = (vui128_t) CONST_VINT128_DW (0x3ffe000000000000, 0);
+  const vui128_t q_expone = (vui128_t) CONST_VINT128_DW (0x3fff000000000000, 0);
+
+  q_bits = vec_xfer_bin128_2_vui128t (f128);
+  x_exp = vec_xsxexpqp (f128)[VEC_DW_H];
+  x_sign = ((vui64_t) q_bits)[VEC_DW_H] >> 63;
+  if (x_exp >= (0x3fff + 112))
+    { // Already integral, infinity or NaN.
+      if (vec_all_isnanf128 (f128))
+	q_bits = (vui128_t) vec_or ((vui32_t) q_bits, q_quiet);
+    }
+  else if (x_exp < 0x3fff)
+    { // Magnitude less than 1.0 rounds to zero or one.
+      q_frac = (vui128_t) vec_and ((vui32_t) q_bits, magmask);
+      switch (rnd)
+	{
+	case VEC_ROUND_TRUNC:
+	  round_up = 0;
+	  break;
+	case VEC_ROUND_UP:
+	  round_up = !vec_cmpuq_all_eq (q_frac, q_zero);
+	  break;
+	case VEC_ROUND_FLOOR:
+	  round_up = x_sign && !vec_cmpuq_all_eq (q_frac, q_zero);
+	  break;
+	case VEC_ROUND_CEIL:
+	  round_up = !x_sign && !vec_cmpuq_all_eq (q_frac, q_zero);
+	  break;
+	case VEC_ROUND_HALF_UP:
+	  round_up = (x_exp == 0x3ffe);
+	  break;
+	default:
+	  // VEC_ROUND_HALF_EVEN, exactly 0.5 rounds to 0.
+	  round_up = (x_exp == 0x3ffe)
+	      && !vec_cmpuq_all_eq (q_frac, q_exphalf);
+	  break;
+	}
+      q_bits = (vui128_t) vec_andc ((vui32_t) q_bits, magmask);
+      if (round_up)
+	q_bits = (vui128_t) vec_or ((vui32_t) q_bits, (vui32_t) q_expone);
+    }
+  else
+    {
+      // 1-112 fraction bits at the low end
+      q_mask = vec_srq (q_ones, (vui128_t) vec_splats (
+	  (unsigned long long) (128 - ((0x3fff + 112) - x_exp))));
+      q_frac = (vui128_t) vec_and ((vui32_t) q_bits, (vui32_t) q_mask);
+      if (!vec_cmpuq_all_eq (q_frac, q_zero))
+	{
+	  q_half = vec_adduqm (vec_srqi (q_mask, 1), q_one);
+	  q_unit = vec_adduqm (q_mask, q_one);
+	  q_bits = (vui128_t) vec_andc ((vui32_t) q_bits, (vui32_t) q_mask);
+	  switch (rnd)
+	    {
+	    case VEC_ROUND_TRUNC:
+	      round_up = 0;
+	      break;
+	    case VEC_ROUND_UP:
+	      round_up = 1;
+	      break;
+	    case VEC_ROUND_FLOOR:
+	      round_up = x_sign;
+	      break;
+	    case VEC_ROUND_CEIL:
+	      round_up = !x_sign;
+	      break;
+	    case VEC_ROUND_HALF_UP:
+	      round_up = vec_cmpuq_all_ge (q_frac, q_half);
+	      break;
+	    default:
+	      // VEC_ROUND_HALF_EVEN, for ties test the low order
+	      // integral bit. For exponent 0 this is the low order bit
+	      // of the exponent field, which is 1 like the hidden bit.
+	      round_up = vec_cmpuq_all_gt (q_frac, q_half)
+		  || (vec_cmpuq_all_eq (q_frac, q_half)
+		      && !vec_cmpuq_all_eq ((vui128_t) vec_and ((vui32_t) q_bits,
+								(vui32_t) q_unit),
+					    q_zero));
+	      break;
+	    }
+	  // A carry from the significand increments the exponent.
+	  if (round_up)
+	    q_bits = vec_adduqm (q_bits, q_unit);
+	}
+    }
+  result = vec_xfer_vui128t_2_bin128 (q_bits);
+#endif
+  return result;
+}
+
 /** \brief Scalar Insert Exponent Quad-Precision
  *
  *  Merge the sign (bit 0) and significand (bits 16:127) from sig
@@ -9891,4 +12141,400 @@ vec_xxxexpqpp (__binary128 vfa, __binary128 vfb)
   return result;
 }
 
+#ifndef PVECLIB_DISABLE_F128ARITH
+/** \name Dynamic call ABI for the heavier operations
+ *
+ *  The binary128 arithmetic and conversions are also available
+ *  out of line. POWER7/8 implementations use the vector integer
+ *  emulation, POWER9/10 the quad-precision instructions.
+ *
+ *  As for the int128 divide chains (see vec_int128_ppc.h),
+ *  libpvec.so exports FNAME_dyn selected by IFUNC and
+ *  libpvecstatic.a the platform suffixed FNAME_PWR7 ... FNAME_PWR10.
+ */
+///@{
+/** \brief Out-of-line vec_xsaddqpo().  */
+extern __binary128
+vec_xsaddqpo_dyn (__binary128 vfa, __binary128 vfb);
+
+/** \brief Out-of-line vec_xssubqpo().  */
+extern __binary128
+vec_xssubqpo_dyn (__binary128 vfa, __binary128 vfb);
+
+/** \brief Out-of-line vec_xsmulqpo().  */
+extern __binary128
+vec_xsmulqpo_dyn (__binary128 vfa, __binary128 vfb);
+
+/** \brief Out-of-line vec_xscvqpdpo().  */
+extern vf64_t
+vec_xscvqpdpo_dyn (__binary128 f128);
+
+/** \brief Out-of-line vec_xscvqpudz().  */
+extern vui64_t
+vec_xscvqpudz_dyn (__binary128 f128);
+
+/** \brief Out-of-line vec_xscvqpuqz().  */
+extern vui128_t
+vec_xscvqpuqz_dyn (__binary128 f128);
+
+/** \brief Out-of-line vec_xsrqpi_rnd().  */
+extern __binary128
+vec_xsrqpi_rnd_dyn (__binary128 f128, vec_round_t rnd);
+
+/** \brief Out-of-line vec_fmodf128().  */
+extern __binary128
+vec_fmodf128_dyn (__binary128 f128x, __binary128 f128y);
+
+/** \brief Out-of-line vec_remainderf128().  */
+extern __binary128
+vec_remainderf128_dyn (__binary128 f128x, __binary128 f128y);
+
+///@}
+
+/** \name Array conversions
+ *
+ *  Convert arrays between __binary128 and double, float and the
+ *  signed and unsigned word, doubleword and quadword integers.
+ *  Each element is converted as the matching inline operation
+ *  (vec_xscvdpqp(), vec_xscvqpdp_rnd(), vec_xscvspqp(),
+ *  vec_xscvqpsp_rnd(), vec_xscvsdqp(), vec_xscvqpswz(), ...). The
+ *  implementations convert 4 independent elements per iteration,
+ *  which hides most of the latency of the POWER8 emulation.
+ *  libpvec exports these under their own names, selected by IFUNC.
+ */
+///@{
+/** \brief Convert an array of double to __binary128 (exact).  */
+extern void
+vec_f128_cff64_array (__binary128 *r, const double *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to double, rounded as
+ *  specified by rnd.  */
+extern void
+vec_f128_ctf64_array (double *r, const __binary128 *a, vec_round_t rnd,
+		      unsigned long n);
+
+/** \brief Convert an array of float to __binary128 (exact).  */
+extern void
+vec_f128_cff32_array (__binary128 *r, const float *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to float, rounded as
+ *  specified by rnd.  */
+extern void
+vec_f128_ctf32_array (float *r, const __binary128 *a, vec_round_t rnd,
+		      unsigned long n);
+
+/** \brief Convert an array of signed int to __binary128 (exact).  */
+extern void
+vec_f128_cfsw_array (__binary128 *r, const int *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to signed int, with
+ *  round toward zero and saturation.  */
+extern void
+vec_f128_ctswz_array (int *r, const __binary128 *a, unsigned long n);
+
+/** \brief Convert an array of unsigned int to __binary128 (exact).  */
+extern void
+vec_f128_cfuw_array (__binary128 *r, const unsigned int *a,
+		     unsigned long n);
+
+/** \brief Convert an array of __binary128 to unsigned int, with
+ *  round toward zero and saturation.  */
+extern void
+vec_f128_ctuwz_array (unsigned int *r, const __binary128 *a,
+		      unsigned long n);
+
+/** \brief Convert an array of signed long long to __binary128
+ *  (exact).  */
+extern void
+vec_f128_cfsd_array (__binary128 *r, const long long *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to signed long long, with
+ *  round toward zero and saturation.  */
+extern void
+vec_f128_ctsdz_array (long long *r, const __binary128 *a, unsigned long n);
+
+/** \brief Convert an array of unsigned long long to __binary128
+ *  (exact).  */
+extern void
+vec_f128_cfud_array (__binary128 *r, const unsigned long long *a,
+		     unsigned long n);
+
+/** \brief Convert an array of __binary128 to unsigned long long,
+ *  with round toward zero and saturation.  */
+extern void
+vec_f128_ctudz_array (unsigned long long *r, const __binary128 *a,
+		      unsigned long n);
+
+/** \brief Convert an array of signed __int128 to __binary128,
+ *  rounded as vec_xscvsqqp().  */
+extern void
+vec_f128_cfsq_array (__binary128 *r, const vi128_t *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to signed __int128, with
+ *  round toward zero and saturation.  */
+extern void
+vec_f128_ctsqz_array (vi128_t *r, const __binary128 *a, unsigned long n);
+
+/** \brief Convert an array of unsigned __int128 to __binary128,
+ *  rounded as vec_xscvuqqp().  */
+extern void
+vec_f128_cfuq_array (__binary128 *r, const vui128_t *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to unsigned __int128, with
+ *  round toward zero and saturation.  */
+extern void
+vec_f128_ctuqz_array (vui128_t *r, const __binary128 *a, unsigned long n);
+
+/** \brief Convert an array of IBM long double (double-double) to
+ *  __binary128, as vec_xscvibmqp().
+ *
+ *  Intended for bulk migration of stored long double data.
+ *  The arrays need not be quadword aligned and r may equal a
+ *  (convert in place, for example over a mmapped file). Otherwise
+ *  r and a must not overlap.  */
+extern void
+vec_f128_cfibm_array (__binary128 *r, const __IBM128 *a, unsigned long n);
+
+/** \brief Convert an array of __binary128 to IBM long double
+ *  (double-double), as vec_xscvqpibm().
+ *
+ *  The arrays need not be quadword aligned and r may equal a
+ *  (convert in place). Otherwise r and a must not overlap.  */
+extern void
+vec_f128_ctibm_array (__IBM128 *r, const __binary128 *a, unsigned long n);
+///@}
+
+/** \name Linear algebra kernels
+ *
+ *  Dot product, matrix-vector and matrix-matrix products in
+ *  binary128, built on vec_xsmaddqpo(). See
+ *  \ref f128_softfloat_0_0_3_4. The partial sums are rounded to
+ *  odd, the last multiply-add of each sum and the alpha and beta
+ *  scaling round to nearest. The matrices are row-major with the
+ *  leading dimension (lda, ldb, ldc) in elements. As for the BLAS,
+ *  if beta is zero y (or C) is not read, so it may be
+ *  uninitialized. The f64 forms take the double matrix and vector
+ *  operands and convert them (exactly) while accumulating in
+ *  binary128. libpvec exports these under their own names,
+ *  selected by IFUNC.
+ */
+///@{
+/** \brief Return the sum of a[i] * b[i] for 0 <= i < n.  */
+extern __binary128
+vec_f128_dot_array (const __binary128 *a, const __binary128 *b,
+		    unsigned long n);
+
+/** \brief Return the sum of a[i] * b[i] for 0 <= i < n, with the
+ *  products and the sum in binary128.  */
+extern __binary128
+vec_f128_dotf64_array (const double *a, const double *b, unsigned long n);
+
+/** \brief y = alpha * A x + beta * y, where A is m by n.  */
+extern void
+vec_f128_gemv (unsigned long m, unsigned long n, __binary128 alpha,
+	       const __binary128 *A, unsigned long lda,
+	       const __binary128 *x, __binary128 beta, __binary128 *y);
+
+/** \brief y = alpha * A x + beta * y, where A is m by n, and A and
+ *  x are double.
+ *
+ *  For example the residual r = b - A x in binary128 is this with
+ *  alpha -1.0, beta 1.0 and y initialized to b.  */
+extern void
+vec_f128_gemvf64 (unsigned long m, unsigned long n, __binary128 alpha,
+		  const double *A, unsigned long lda, const double *x,
+		  __binary128 beta, __binary128 *y);
+
+/** \brief C = alpha * A B + beta * C, where A is m by k, B is k by n
+ *  and C is m by n.  */
+extern void
+vec_f128_gemm (unsigned long m, unsigned long n, unsigned long k,
+	       __binary128 alpha, const __binary128 *A, unsigned long lda,
+	       const __binary128 *B, unsigned long ldb, __binary128 beta,
+	       __binary128 *C, unsigned long ldc);
+
+/** \brief C = alpha * A B + beta * C, where A is m by k, B is k by n
+ *  and C is m by n, and A and B are double.  */
+extern void
+vec_f128_gemmf64 (unsigned long m, unsigned long n, unsigned long k,
+		  __binary128 alpha, const double *A, unsigned long lda,
+		  const double *B, unsigned long ldb, __binary128 beta,
+		  __binary128 *C, unsigned long ldc);
+///@}
+
+/** \name Polynomial arrays
+ *
+ *  Evaluate one polynomial over an array of arguments, as
+ *  vec_polyf128(). See \ref f128_softfloat_0_0_3_5. The arrays
+ *  need not be quadword aligned. libpvec exports these under their
+ *  own names, selected by IFUNC.
+ */
+///@{
+/** \brief Compute r[i] = c[0] + c[1]*x[i] + ... + c[deg]*x[i]**deg,
+ *  rounded to nearest, as vec_polyf128(). r may equal x.  */
+extern void
+vec_polyf128_array (__binary128 *r, const __binary128 *x,
+		    const __binary128 *c, unsigned long deg,
+		    unsigned long n);
+
+/** \brief Compute r[i] = c[0] + c[1]*x[i] + ... + c[deg]*x[i]**deg
+ *  for double x[i], evaluated in binary128 with round to odd (as
+ *  vec_polyf128o()) and rounded once to double as specified by
+ *  rnd.  */
+extern void
+vec_polyf128f64_array (double *r, const double *x, const __binary128 *c,
+		       unsigned long deg, vec_round_t rnd, unsigned long n);
+///@}
+
+///@cond INTERNAL
+/* Doxygen can not handle macros or attributes */
+extern __binary128
+__VEC_PWR_IMP (vec_xsaddqpo) (__binary128 vfa, __binary128 vfb);
+
+extern __binary128
+__VEC_PWR_IMP (vec_xssubqpo) (__binary128 vfa, __binary128 vfb);
+
+extern __binary128
+__VEC_PWR_IMP (vec_xsmulqpo) (__binary128 vfa, __binary128 vfb);
+
+extern vf64_t
+__VEC_PWR_IMP (vec_xscvqpdpo) (__binary128 f128);
+
+extern vui64_t
+__VEC_PWR_IMP (vec_xscvqpudz) (__binary128 f128);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_xscvqpuqz) (__binary128 f128);
+
+extern __binary128
+__VEC_PWR_IMP (vec_xsrqpi_rnd) (__binary128 f128, vec_round_t rnd);
+
+extern __binary128
+__VEC_PWR_IMP (vec_fmodf128) (__binary128 f128x, __binary128 f128y);
+
+extern __binary128
+__VEC_PWR_IMP (vec_remainderf128) (__binary128 f128x, __binary128 f128y);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cff64_array) (__binary128 *r, const double *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctf64_array) (double *r, const __binary128 *a,
+				      vec_round_t rnd, unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cff32_array) (__binary128 *r, const float *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctf32_array) (float *r, const __binary128 *a,
+				      vec_round_t rnd, unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cfsw_array) (__binary128 *r, const int *a,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctswz_array) (int *r, const __binary128 *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cfuw_array) (__binary128 *r, const unsigned int *a,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctuwz_array) (unsigned int *r, const __binary128 *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cfsd_array) (__binary128 *r, const long long *a,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctsdz_array) (long long *r, const __binary128 *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cfud_array) (__binary128 *r,
+				     const unsigned long long *a,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctudz_array) (unsigned long long *r,
+				      const __binary128 *a, unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cfsq_array) (__binary128 *r, const vi128_t *a,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctsqz_array) (vi128_t *r, const __binary128 *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cfuq_array) (__binary128 *r, const vui128_t *a,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctuqz_array) (vui128_t *r, const __binary128 *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_cfibm_array) (__binary128 *r, const __IBM128 *a,
+				      unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_ctibm_array) (__IBM128 *r, const __binary128 *a,
+				      unsigned long n);
+
+extern __binary128
+__VEC_PWR_IMP (vec_f128_dot_array) (const __binary128 *a,
+				    const __binary128 *b, unsigned long n);
+
+extern __binary128
+__VEC_PWR_IMP (vec_f128_dotf64_array) (const double *a, const double *b,
+				       unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_f128_gemv) (unsigned long m, unsigned long n,
+			       __binary128 alpha, const __binary128 *A,
+			       unsigned long lda, const __binary128 *x,
+			       __binary128 beta, __binary128 *y);
+
+extern void
+__VEC_PWR_IMP (vec_f128_gemvf64) (unsigned long m, unsigned long n,
+				  __binary128 alpha, const double *A,
+				  unsigned long lda, const double *x,
+				  __binary128 beta, __binary128 *y);
+
+extern void
+__VEC_PWR_IMP (vec_f128_gemm) (unsigned long m, unsigned long n,
+			       unsigned long k, __binary128 alpha,
+			       const __binary128 *A, unsigned long lda,
+			       const __binary128 *B, unsigned long ldb,
+			       __binary128 beta, __binary128 *C,
+			       unsigned long ldc);
+
+extern void
+__VEC_PWR_IMP (vec_f128_gemmf64) (unsigned long m, unsigned long n,
+				  unsigned long k, __binary128 alpha,
+				  const double *A, unsigned long lda,
+				  const double *B, unsigned long ldb,
+				  __binary128 beta, __binary128 *C,
+				  unsigned long ldc);
+
+extern void
+__VEC_PWR_IMP (vec_polyf128_array) (__binary128 *r, const __binary128 *x,
+				    const __binary128 *c, unsigned long deg,
+				    unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_polyf128f64_array) (double *r, const double *x,
+				       const __binary128 *c,
+				       unsigned long deg, vec_round_t rnd,
+				       unsigned long n);
+///@endcond
+#endif /* PVECLIB_DISABLE_F128ARITH */
+
 #endif /* VEC_F128_PPC_H_ */
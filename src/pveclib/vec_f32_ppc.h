@@ -192,6 +192,51 @@ test_vec_cosf32 (vf32_t value)
  * Neither example raises floating point exceptions or sets
  * <B>errno</B>, as appropriate for a vector math library.
  *
+ * \section f32_f16_0_0 Half-precision and bfloat16
+ *
+ * Embeddings and sensor data are often stored as IEEE binary16
+ * (half-precision) or bfloat16 (the high 16 bits of a float) to halve
+ * the memory footprint and bandwidth. The arithmetic is still done in
+ * single-precision.
+ *
+ * vec_xvcvhpsp() and vec_xvcvsphp() convert between binary16 and
+ * float, one value per word. POWER9 has the instructions. For older
+ * processors these are built from the exponent and significand
+ * fields with vec_xvxexpsp() and vec_xviexpsp(), rounding to nearest
+ * even. vec_xvcvbf16spn() and vec_xvcvspbf16() do the same for
+ * bfloat16, using the POWER10 instructions where available.
+ * bfloat16 to float is just a shift, float to bfloat16 rounds to
+ * nearest even and keeps NaNs quiet.
+ *
+ * vec_unpackh_f16(), vec_unpackl_f16() and vec_pack_f16() (and the
+ * _bf16 forms) convert between a vector of 8 halfwords in storage
+ * order and two vectors of float.
+ *
+ * For arrays libpvec provides vec_cvf16f32_array(),
+ * vec_cvf32f16_array(), vec_cvbf16f32_array() and
+ * vec_cvf32bf16_array(), and the dot products vec_dotf16_array(),
+ * vec_dotf16f32_array(), vec_dotbf16_array() and
+ * vec_dotbf16f32_array(). The dot products convert each vector of
+ * halfwords as it is loaded and accumulate with vec_madd() in four
+ * float accumulators, so the narrow data is never widened in memory.
+ * These are selected for the platform at load time (IFUNC) like the
+ * other libpvec exports.
+ *
+ * \section f32_math_0_0 Elementary functions
+ *
+ * vec_expf32(), vec_exp2f32(), vec_logf32(), vec_log2f32(),
+ * vec_powf32(), vec_sinf32(), vec_cosf32(), vec_tanhf32() and
+ * vec_erff32() convert each half of the vector to double with
+ * vec_unpackh_f32() and vec_unpackl_f32(), call the double versions
+ * from vec_f64_ppc.h and round the results back with vec_pack_f32().
+ * The double results are within 0.85 ULP (double), so the single
+ * rounding to float gives less than 0.501 ULP (float). This costs
+ * two double evaluations per vector float, but avoids a second set of
+ * tables and polynomials and the float overflow and underflow cases
+ * fall out of the final rounding.
+ *
+ * The array forms vec_expf32_array() and so on are in libpvec.
+ *
  * \section f32_perf_0_0 Performance data.
  * High level performance estimates are provided as an aid to function
  * selection when evaluating algorithms. For background on how
@@ -201,6 +246,7 @@ test_vec_cosf32 (vf32_t value)
 
 #include <pveclib/vec_common_ppc.h>
 #include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_f64_ppc.h>
 
 ///@cond INTERNAL
 static inline vf64_t
@@ -213,6 +259,18 @@ vec_vsstfsso (vf64_t xs, float *array,
 	      const long long offset0, const long long offset1);
 static inline void
 vec_vstxsspx (vf64_t xs, const signed long long ra, float *rb);
+static inline vf32_t
+vec_xvcvbf16spn (vui32_t vrb);
+static inline vf32_t
+vec_xvcvhpsp (vui32_t vrb);
+static inline vui32_t
+vec_xvcvspbf16 (vf32_t vrb);
+static inline vui32_t
+vec_xvcvsphp (vf32_t vrb);
+static inline vf32_t
+vec_xviexpsp (vui32_t sig, vui32_t exp);
+static inline vui32_t
+vec_xvxexpsp (vf32_t vrb);
  ///@endcond
 
 /*! \brief typedef __vbinary32 to vector of 4 xfloat elements. */
@@ -838,6 +896,98 @@ vec_copysignf32 (vf32_t vf32x, vf32_t vf32y)
 #endif
 }
 
+/** \brief Vector float cosine.
+ *
+ *  Computes cos(x) for each element. The elements are converted to
+ *  double, computed with vec_cosf64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_cosf64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |130-150| 1/2 cycles|
+ *  |power9   |110-130| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of cos(x).
+ */
+static inline vf32_t
+vec_cosf32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_cosf64 (vec_unpackh_f32 (x)),
+		       vec_cosf64 (vec_unpackl_f32 (x)));
+}
+
+/** \brief Vector float error function.
+ *
+ *  Computes erf(x) for each element. The elements are converted to
+ *  double, computed with vec_erff64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_erff64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |110-130| 1/2 cycles|
+ *  |power9   |100-120| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of erf(x).
+ */
+static inline vf32_t
+vec_erff32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_erff64 (vec_unpackh_f32 (x)),
+		       vec_erff64 (vec_unpackl_f32 (x)));
+}
+
+/** \brief Vector float base 2 exponential.
+ *
+ *  Computes 2**x for each element. The elements are converted to
+ *  double, computed with vec_exp2f64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_exp2f64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |130-150| 1/2 cycles|
+ *  |power9   |120-140| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of 2**x.
+ */
+static inline vf32_t
+vec_exp2f32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_exp2f64 (vec_unpackh_f32 (x)),
+		       vec_exp2f64 (vec_unpackl_f32 (x)));
+}
+
+/** \brief Vector float exponential.
+ *
+ *  Computes exp(x) for each element. The elements are converted to
+ *  double, computed with vec_expf64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_expf64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |130-150| 1/2 cycles|
+ *  |power9   |120-140| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of exp(x).
+ */
+static inline vf32_t
+vec_expf32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_expf64 (vec_unpackh_f32 (x)),
+		       vec_expf64 (vec_unpackl_f32 (x)));
+}
+
 /** \brief Return 4x32-bit vector boolean true values for each float
  *  element that is Finite (Not NaN nor Inf).
  *
@@ -1111,6 +1261,147 @@ vec_iszerof32 (vf32_t vf32)
   return (result);
 }
 
+/** \brief Vector float base 2 logarithm.
+ *
+ *  Computes log2(x) for each element. The elements are converted to
+ *  double, computed with vec_log2f64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_log2f64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |140-160| 1/2 cycles|
+ *  |power9   |120-140| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of log2(x).
+ */
+static inline vf32_t
+vec_log2f32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_log2f64 (vec_unpackh_f32 (x)),
+		       vec_log2f64 (vec_unpackl_f32 (x)));
+}
+
+/** \brief Vector float natural logarithm.
+ *
+ *  Computes log(x) for each element. The elements are converted to
+ *  double, computed with vec_logf64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_logf64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |130-150| 1/2 cycles|
+ *  |power9   |110-130| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of log(x).
+ */
+static inline vf32_t
+vec_logf32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_logf64 (vec_unpackh_f32 (x)),
+		       vec_logf64 (vec_unpackl_f32 (x)));
+}
+
+/** \brief Vector Pack 2 vector float to 8 bfloat16.
+ *
+ *  Convert the 4 floats of vra and the 4 floats of vrb to bfloat16
+ *  (see vec_xvcvspbf16()) and pack them into halfword elements 0-3
+ *  and 4-7 of the result.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 12-16 | 1/cycle  |
+ *  |power10  | 6     | 2/cycle  |
+ *
+ *  @param vra vector float values for halfwords 0-3.
+ *  @param vrb vector float values for halfwords 4-7.
+ *  @return vector of 8 bfloat16 values.
+ */
+static inline vui16_t
+vec_pack_bf16 (vf32_t vra, vf32_t vrb)
+{
+  return vec_pack (vec_xvcvspbf16 (vra), vec_xvcvspbf16 (vrb));
+}
+
+/** \brief Vector Pack 2 vector float to 8 binary16.
+ *
+ *  Convert the 4 floats of vra and the 4 floats of vrb to binary16
+ *  (see vec_xvcvsphp()) and pack them into halfword elements 0-3
+ *  and 4-7 of the result.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 20-30 | 1/cycle  |
+ *  |power9   | 9     | 2/cycle  |
+ *
+ *  @param vra vector float values for halfwords 0-3.
+ *  @param vrb vector float values for halfwords 4-7.
+ *  @return vector of 8 binary16 values.
+ */
+static inline vui16_t
+vec_pack_f16 (vf32_t vra, vf32_t vrb)
+{
+  return vec_pack (vec_xvcvsphp (vra), vec_xvcvsphp (vrb));
+}
+
+/** \brief Vector Pack 2 vector double to 4 float.
+ *
+ *  Round the 2 doubles of vra and the 2 doubles of vrb to float
+ *  (current rounding mode) and pack them into word elements 0-1 and
+ *  2-3 of the result.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 10-12 | 1/cycle  |
+ *  |power9   | 9-11  | 1/cycle  |
+ *
+ *  @param vra vector double values for words 0-1.
+ *  @param vrb vector double values for words 2-3.
+ *  @return vector of 4 float values.
+ */
+static inline vf32_t
+vec_pack_f32 (vf64_t vra, vf64_t vrb)
+{
+#if defined (__VSX__) && (__GNUC__ > 7)
+  return vec_float2 (vra, vrb);
+#else
+  vf32_t result = { (float) vra[0], (float) vra[1],
+		     (float) vrb[0], (float) vrb[1] };
+  return result;
+#endif
+}
+
+/** \brief Vector float power.
+ *
+ *  Computes x**y for each element. The elements are converted to
+ *  double, computed with vec_powf64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_powf64(), results outside the float range overflow to +-Inf
+ *  or underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |240-280| 1/4 cycles|
+ *  |power9   |210-250| 1/4 cycles|
+ *
+ *  @param x vector float bases.
+ *  @param y vector float exponents.
+ *  @return vector float values of x**y.
+ */
+static inline vf32_t
+vec_powf32 (vf32_t x, vf32_t y)
+{
+  return vec_pack_f32 (vec_powf64 (vec_unpackh_f32 (x),
+				   vec_unpackh_f32 (y)),
+		       vec_powf64 (vec_unpackl_f32 (x),
+				   vec_unpackl_f32 (y)));
+}
+
 /*! \brief Vector Set Bool from Sign, Single Precision.
  *
  *  For each float, propagate the sign bit to all 32-bits of that
@@ -1139,6 +1430,198 @@ vec_setb_sp (vf32_t vra)
   return vec_setb_sw ((vi32_t) vra);
 }
 
+/** \brief Vector float sine.
+ *
+ *  Computes sin(x) for each element. The elements are converted to
+ *  double, computed with vec_sinf64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_sinf64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |130-150| 1/2 cycles|
+ *  |power9   |110-130| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of sin(x).
+ */
+static inline vf32_t
+vec_sinf32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_sinf64 (vec_unpackh_f32 (x)),
+		       vec_sinf64 (vec_unpackl_f32 (x)));
+}
+
+/** \brief Vector float hyperbolic tangent.
+ *
+ *  Computes tanh(x) for each element. The elements are converted to
+ *  double, computed with vec_tanhf64() and rounded once to float, so
+ *  the error is less than 0.501 ULP. Special values are as for
+ *  vec_tanhf64(), results outside the float range overflow to +-Inf or
+ *  underflow to +-0.0.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |160-180| 1/2 cycles|
+ *  |power9   |140-160| 1/2 cycles|
+ *
+ *  @param x vector float values.
+ *  @return vector float values of tanh(x).
+ */
+static inline vf32_t
+vec_tanhf32 (vf32_t x)
+{
+  return vec_pack_f32 (vec_tanhf64 (vec_unpackh_f32 (x)),
+		       vec_tanhf64 (vec_unpackl_f32 (x)));
+}
+
+/** \brief Vector Unpack High 4 bfloat16 to vector float.
+ *
+ *  Convert halfword elements 0-3 of vra from bfloat16 to float. The
+ *  conversion is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 2     | 2/cycle  |
+ *  |power9   | 3     | 2/cycle  |
+ *
+ *  @param vra vector of 8 bfloat16 values.
+ *  @return vector float values of halfwords 0-3.
+ */
+static inline vf32_t
+vec_unpackh_bf16 (vui16_t vra)
+{
+  const vui16_t zero = vec_splat_u16 (0);
+  // bfloat16 is the high halfword of the float.
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  return (vf32_t) vec_mergeh (zero, vra);
+#else
+  return (vf32_t) vec_mergeh (vra, zero);
+#endif
+}
+
+/** \brief Vector Unpack High 4 binary16 to vector float.
+ *
+ *  Convert halfword elements 0-3 of vra from binary16 to float (see
+ *  vec_xvcvhpsp()). The conversion is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 16-25 | 1/cycle  |
+ *  |power9   | 5     | 2/cycle  |
+ *
+ *  @param vra vector of 8 binary16 values.
+ *  @return vector float values of halfwords 0-3.
+ */
+static inline vf32_t
+vec_unpackh_f16 (vui16_t vra)
+{
+  const vui16_t zero = vec_splat_u16 (0);
+  // Each binary16 to the low halfword of a word.
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  return vec_xvcvhpsp ((vui32_t) vec_mergeh (vra, zero));
+#else
+  return vec_xvcvhpsp ((vui32_t) vec_mergeh (zero, vra));
+#endif
+}
+
+/** \brief Vector Unpack High 2 float to vector double.
+ *
+ *  Convert word elements 0-1 of vra from float to double. The
+ *  conversion is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 7-9   | 1/cycle  |
+ *  |power9   | 5-7   | 2/cycle  |
+ *
+ *  @param vra vector of 4 float values.
+ *  @return vector double values of words 0-1.
+ */
+static inline vf64_t
+vec_unpackh_f32 (vf32_t vra)
+{
+#if defined (__VSX__) && (__GNUC__ > 7)
+  return vec_doubleh (vra);
+#else
+  vf64_t result = { (double) vra[0], (double) vra[1] };
+  return result;
+#endif
+}
+
+/** \brief Vector Unpack Low 4 bfloat16 to vector float.
+ *
+ *  Convert halfword elements 4-7 of vra from bfloat16 to float. The
+ *  conversion is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 2     | 2/cycle  |
+ *  |power9   | 3     | 2/cycle  |
+ *
+ *  @param vra vector of 8 bfloat16 values.
+ *  @return vector float values of halfwords 4-7.
+ */
+static inline vf32_t
+vec_unpackl_bf16 (vui16_t vra)
+{
+  const vui16_t zero = vec_splat_u16 (0);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  return (vf32_t) vec_mergel (zero, vra);
+#else
+  return (vf32_t) vec_mergel (vra, zero);
+#endif
+}
+
+/** \brief Vector Unpack Low 4 binary16 to vector float.
+ *
+ *  Convert halfword elements 4-7 of vra from binary16 to float (see
+ *  vec_xvcvhpsp()). The conversion is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 16-25 | 1/cycle  |
+ *  |power9   | 5     | 2/cycle  |
+ *
+ *  @param vra vector of 8 binary16 values.
+ *  @return vector float values of halfwords 4-7.
+ */
+static inline vf32_t
+vec_unpackl_f16 (vui16_t vra)
+{
+  const vui16_t zero = vec_splat_u16 (0);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  return vec_xvcvhpsp ((vui32_t) vec_mergel (vra, zero));
+#else
+  return vec_xvcvhpsp ((vui32_t) vec_mergel (zero, vra));
+#endif
+}
+
+/** \brief Vector Unpack Low 2 float to vector double.
+ *
+ *  Convert word elements 2-3 of vra from float to double. The
+ *  conversion is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 7-9   | 1/cycle  |
+ *  |power9   | 5-7   | 2/cycle  |
+ *
+ *  @param vra vector of 4 float values.
+ *  @return vector double values of words 2-3.
+ */
+static inline vf64_t
+vec_unpackl_f32 (vf32_t vra)
+{
+#if defined (__VSX__) && (__GNUC__ > 7)
+  return vec_doublel (vra);
+#else
+  vf64_t result = { (double) vra[2], (double) vra[3] };
+  return result;
+#endif
+}
+
 /** \brief Vector Gather-Load 4 Words from scalar Offsets.
  *
  *  For each scalar offset[0,1,2,3], load the word
@@ -2036,6 +2519,218 @@ vec_vstxsspx (vf64_t xs, const signed long long ra, float *rb)
 #endif
 }
 
+/** \brief Vector Convert bfloat16 to Single-Precision format.
+ *
+ *  The bfloat16 value in the low order halfword (bits 16:31) of each
+ *  word element of vrb is converted to single-precision. The
+ *  conversion is exact, signaling NaNs are not quieted.
+ *
+ *  \note This is the POWER10 xvcvbf16spn instruction. For older
+ *  processors it is a shift left 16 bits.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 2     | 2/cycle  |
+ *  |power10  | 4     | 2/cycle  |
+ *
+ *  @param vrb vector of bfloat16 values in the low halfword of each
+ *  word.
+ *  @return vector float values of vrb.
+ */
+static inline vf32_t
+vec_xvcvbf16spn (vui32_t vrb)
+{
+  vf32_t result;
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 10)
+  __asm__(
+      "xvcvbf16spn %x0,%x1"
+      : "=wa" (result)
+      : "wa" (vrb)
+      : );
+#else
+  result = (vf32_t) vec_slwi (vrb, 16);
+#endif
+  return result;
+}
+
+/** \brief Vector Convert Half-Precision to Single-Precision format.
+ *
+ *  The binary16 value in the low order halfword (bits 16:31) of each
+ *  word element of vrb is converted to single-precision. The
+ *  conversion is exact. Signaling NaNs are returned quiet.
+ *
+ *  \note This operation is equivalent to the POWER9 xvcvhpsp
+ *  instruction. For older processors the binary16 exponent is
+ *  rebiased and merged with the significand by vec_xviexpsp().
+ *  The subnormal values are converted from integer and scaled by
+ *  2**-24, which is exact.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 14-23 | 1/cycle  |
+ *  |power9   | 3     | 2/cycle  |
+ *
+ *  @param vrb vector of binary16 values in the low halfword of each
+ *  word.
+ *  @return vector float values of vrb.
+ */
+static inline vf32_t
+vec_xvcvhpsp (vui32_t vrb)
+{
+  vf32_t result;
+#if defined (_ARCH_PWR9) && defined (__VSX__) && (__GNUC__ > 7)
+  __asm__(
+      "xvcvhpsp %x0,%x1"
+      : "=wa" (result)
+      : "wa" (vrb)
+      : );
+#else
+  const vui32_t zero = CONST_VINT128_W(0, 0, 0, 0);
+  const vui32_t signmask = CONST_VINT128_W(0x8000, 0x8000, 0x8000,
+					   0x8000);
+  const vui32_t sigmask = CONST_VINT128_W(0x3ff, 0x3ff, 0x3ff, 0x3ff);
+  const vui32_t exp31 = CONST_VINT128_W(31, 31, 31, 31);
+  const vui32_t exp255 = CONST_VINT128_W(255, 255, 255, 255);
+  const vui32_t bias = CONST_VINT128_W(112, 112, 112, 112);
+  const vui32_t quiet = CONST_VINT128_W(0x00400000, 0x00400000,
+					0x00400000, 0x00400000);
+  vui32_t sign, exp, sig, tmp;
+  vb32_t expz, expmax, nan;
+
+  sign = vec_slwi (vec_and (vrb, signmask), 16);
+  exp = vec_and (vec_srwi (vrb, 10), exp31);
+  sig = vec_and (vrb, sigmask);
+  expz = vec_cmpeq (exp, zero);
+  expmax = vec_cmpeq (exp, exp31);
+  nan = vec_andc (expmax, vec_cmpeq (sig, zero));
+  // Normal, infinity and NaN. The bias changes from 15 to 127 and
+  // the maximum exponent from 31 to 255.
+  tmp = vec_sel (vec_add (exp, bias), exp255, expmax);
+  tmp = (vui32_t) vec_xviexpsp (vec_slwi (sig, 13), tmp);
+  tmp = vec_sel (tmp, vec_or (tmp, quiet), nan);
+  // Zero and subnormal.
+  result = vec_sel ((vf32_t) tmp, vec_ctf (sig, 24), expz);
+  result = (vf32_t) vec_or ((vui32_t) result, sign);
+#endif
+  return result;
+}
+
+/** \brief Vector Convert Single-Precision to bfloat16 format.
+ *
+ *  Each float of vrb is rounded to nearest even to bfloat16 and
+ *  returned in the low order halfword (bits 16:31) of the word, the
+ *  high halfword is 0. NaNs are returned quiet.
+ *
+ *  \note This is the POWER10 xvcvspbf16 instruction. For older
+ *  processors the rounding is an integer add of 0x7fff plus the low
+ *  retained bit, which carries into the exponent as needed.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 10-14 | 1/cycle  |
+ *  |power10  | 4     | 2/cycle  |
+ *
+ *  @param vrb vector float values.
+ *  @return vector of bfloat16 values in the low halfword of each
+ *  word.
+ */
+static inline vui32_t
+vec_xvcvspbf16 (vf32_t vrb)
+{
+  vui32_t result;
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 10)
+  __asm__(
+      "xvcvspbf16 %x0,%x1"
+      : "=wa" (result)
+      : "wa" (vrb)
+      : );
+#else
+  const vui32_t one = CONST_VINT128_W(1, 1, 1, 1);
+  const vui32_t rnd = CONST_VINT128_W(0x7fff, 0x7fff, 0x7fff, 0x7fff);
+  const vui32_t quiet = CONST_VINT128_W(0x40, 0x40, 0x40, 0x40);
+  vui32_t x, tmp;
+
+  x = (vui32_t) vrb;
+  tmp = vec_and (vec_srwi (x, 16), one);
+  result = vec_srwi (vec_add (vec_add (x, rnd), tmp), 16);
+  // Truncate NaNs, so the payload can not round to infinity.
+  tmp = vec_or (vec_srwi (x, 16), quiet);
+  result = vec_sel (result, tmp, vec_isnanf32 (vrb));
+#endif
+  return result;
+}
+
+/** \brief Vector Convert Single-Precision to Half-Precision format.
+ *
+ *  Each float of vrb is rounded to binary16 and returned in the low
+ *  order halfword (bits 16:31) of the word, the high halfword is 0.
+ *  Values too large for binary16 convert to infinity, values too
+ *  small round to a subnormal or zero. NaNs are returned quiet,
+ *  keeping the high 10 bits of the significand.
+ *
+ *  \note This operation is equivalent to the POWER9 xvcvsphp
+ *  instruction, which rounds in the current rounding mode. For
+ *  older processors the float exponent (vec_xvxexpsp()) selects
+ *  between an integer rebias and round to nearest even for normal
+ *  binary16 results, and a float add of 0.5 that aligns and rounds
+ *  the subnormal results.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 18-27 | 1/cycle  |
+ *  |power9   | 3     | 2/cycle  |
+ *
+ *  @param vrb vector float values.
+ *  @return vector of binary16 values in the low halfword of each
+ *  word.
+ */
+static inline vui32_t
+vec_xvcvsphp (vf32_t vrb)
+{
+  vui32_t result;
+#if defined (_ARCH_PWR9) && defined (__VSX__) && (__GNUC__ > 7)
+  __asm__(
+      "xvcvsphp %x0,%x1"
+      : "=wa" (result)
+      : "wa" (vrb)
+      : );
+#else
+  const vui32_t one = CONST_VINT128_W(1, 1, 1, 1);
+  const vui32_t signmask = CONST_VINT128_W(0x80000000, 0x80000000,
+					   0x80000000, 0x80000000);
+  const vui32_t expmask = CONST_VINT128_W(0x7f800000, 0x7f800000,
+					  0x7f800000, 0x7f800000);
+  const vui32_t sigmask = CONST_VINT128_W(0x3ff, 0x3ff, 0x3ff, 0x3ff);
+  // (15 - 127) << 23 plus 0xfff, half the dropped bits less one.
+  const vui32_t rbias = CONST_VINT128_W(0xc8000fff, 0xc8000fff,
+					0xc8000fff, 0xc8000fff);
+  // 0.5, the ulp is the binary16 subnormal 2**-24.
+  const vui32_t half = CONST_VINT128_W(0x3f000000, 0x3f000000,
+				       0x3f000000, 0x3f000000);
+  const vui32_t e113 = CONST_VINT128_W(113, 113, 113, 113);
+  const vui32_t e142 = CONST_VINT128_W(142, 142, 142, 142);
+  const vui32_t inf16 = CONST_VINT128_W(0x7c00, 0x7c00, 0x7c00, 0x7c00);
+  const vui32_t nan16 = CONST_VINT128_W(0x7e00, 0x7e00, 0x7e00, 0x7e00);
+  vui32_t ax, sign, exp, tmp, sub;
+
+  ax = vec_andc ((vui32_t) vrb, signmask);
+  sign = vec_srwi (vec_and ((vui32_t) vrb, signmask), 16);
+  exp = vec_xvxexpsp (vrb);
+  // Normal binary16, rounded to nearest even.
+  tmp = vec_and (vec_srwi (ax, 13), one);
+  result = vec_srwi (vec_add (vec_add (ax, rbias), tmp), 13);
+  // Subnormal binary16 (exponent < -14).
+  sub = vec_sub ((vui32_t) vec_add ((vf32_t) ax, (vf32_t) half), half);
+  result = vec_sel (result, sub, vec_cmplt (exp, e113));
+  // Overflow (exponent > 15) and infinity, then NaN.
+  result = vec_sel (result, inf16, vec_cmpgt (exp, e142));
+  tmp = vec_or (nan16, vec_and (vec_srwi (ax, 13), sigmask));
+  result = vec_sel (result, tmp, vec_cmpgt (ax, expmask));
+  result = vec_or (result, sign);
+#endif
+  return result;
+}
+
 /** \brief Vector Insert Exponent Single-Precision
  *
  *  For each word of <B>sig</B> and <B>exp</B>,
@@ -2199,4 +2894,287 @@ vec_xvxsigsp (vf32_t vrb)
   return result;
 }
 
+/** \name Half-precision and bfloat16 arrays
+ *
+ *  Convert arrays between float and binary16 or bfloat16, and dot
+ *  products that consume the 16-bit data directly. See
+ *  \ref f32_f16_0_0.
+ */
+///@{
+/** \brief Convert an array of binary16 values to float.
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the binary16 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_cvf16f32_array (float *r, const unsigned short *a, unsigned long n);
+
+/** \brief Convert an array of float values to binary16.
+ *
+ *  Rounded as vec_xvcvsphp().
+ *
+ *  @param r pointer to the binary16 results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_cvf32f16_array (unsigned short *r, const float *a, unsigned long n);
+
+/** \brief Convert an array of bfloat16 values to float.
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the bfloat16 values.
+ *  @param n number of elements.
+ */
+extern void
+vec_cvbf16f32_array (float *r, const unsigned short *a, unsigned long n);
+
+/** \brief Convert an array of float values to bfloat16.
+ *
+ *  Rounded as vec_xvcvspbf16().
+ *
+ *  @param r pointer to the bfloat16 results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_cvf32bf16_array (unsigned short *r, const float *a, unsigned long n);
+
+/** \brief Dot product of two arrays of binary16 values.
+ *
+ *  The sum of a[i] * b[i] for i in 0 to n-1, converted to float as
+ *  loaded and accumulated in float with fused multiply-add. The
+ *  order of the additions is not sequential.
+ *
+ *  @param a pointer to the first binary16 values.
+ *  @param b pointer to the second binary16 values.
+ *  @param n number of elements.
+ *  @return the dot product, 0.0 if n is 0.
+ */
+extern float
+vec_dotf16_array (const unsigned short *a, const unsigned short *b,
+		  unsigned long n);
+
+/** \brief Dot product of an array of binary16 values and an array
+ *  of float values.
+ *
+ *  As vec_dotf16_array().
+ *
+ *  @param a pointer to the binary16 values.
+ *  @param b pointer to the float values.
+ *  @param n number of elements.
+ *  @return the dot product, 0.0 if n is 0.
+ */
+extern float
+vec_dotf16f32_array (const unsigned short *a, const float *b,
+		     unsigned long n);
+
+/** \brief Dot product of two arrays of bfloat16 values.
+ *
+ *  As vec_dotf16_array().
+ *
+ *  @param a pointer to the first bfloat16 values.
+ *  @param b pointer to the second bfloat16 values.
+ *  @param n number of elements.
+ *  @return the dot product, 0.0 if n is 0.
+ */
+extern float
+vec_dotbf16_array (const unsigned short *a, const unsigned short *b,
+		   unsigned long n);
+
+/** \brief Dot product of an array of bfloat16 values and an array
+ *  of float values.
+ *
+ *  As vec_dotf16_array().
+ *
+ *  @param a pointer to the bfloat16 values.
+ *  @param b pointer to the float values.
+ *  @param n number of elements.
+ *  @return the dot product, 0.0 if n is 0.
+ */
+extern float
+vec_dotbf16f32_array (const unsigned short *a, const float *b,
+		      unsigned long n);
+///@}
+
+/** \name Elementary function arrays
+ *
+ *  Apply the elementary functions to arrays of floats. The arrays
+ *  have no alignment requirement and r may equal a. See
+ *  \ref f32_math_0_0.
+ */
+///@{
+/** \brief Compute r[i] = cos(a[i]) for an array of floats.
+ *
+ *  As vec_cosf32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_cosf32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = erf(a[i]) for an array of floats.
+ *
+ *  As vec_erff32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_erff32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = 2**a[i] for an array of floats.
+ *
+ *  As vec_exp2f32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_exp2f32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = exp(a[i]) for an array of floats.
+ *
+ *  As vec_expf32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_expf32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = log2(a[i]) for an array of floats.
+ *
+ *  As vec_log2f32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_log2f32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = log(a[i]) for an array of floats.
+ *
+ *  As vec_logf32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_logf32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = sin(a[i]) for an array of floats.
+ *
+ *  As vec_sinf32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_sinf32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = tanh(a[i]) for an array of floats.
+ *
+ *  As vec_tanhf32().
+ *
+ *  @param r pointer to the float results.
+ *  @param a pointer to the float values.
+ *  @param n number of elements.
+ */
+extern void
+vec_tanhf32_array (float *r, const float *a, unsigned long n);
+
+/** \brief Compute r[i] = x[i]**y[i] for arrays of floats.
+ *
+ *  As vec_powf32().
+ *
+ *  @param r pointer to the float results.
+ *  @param x pointer to the float bases.
+ *  @param y pointer to the float exponents.
+ *  @param n number of elements.
+ */
+extern void
+vec_powf32_array (float *r, const float *x, const float *y,
+		  unsigned long n);
+///@}
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_cvf16f32_array) (float *r, const unsigned short *a,
+				    unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_cvf32f16_array) (unsigned short *r, const float *a,
+				    unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_cvbf16f32_array) (float *r, const unsigned short *a,
+				     unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_cvf32bf16_array) (unsigned short *r, const float *a,
+				     unsigned long n);
+
+extern float
+__VEC_PWR_IMP (vec_dotf16_array) (const unsigned short *a,
+				  const unsigned short *b, unsigned long n);
+
+extern float
+__VEC_PWR_IMP (vec_dotf16f32_array) (const unsigned short *a,
+				     const float *b, unsigned long n);
+
+extern float
+__VEC_PWR_IMP (vec_dotbf16_array) (const unsigned short *a,
+				   const unsigned short *b, unsigned long n);
+
+extern float
+__VEC_PWR_IMP (vec_dotbf16f32_array) (const unsigned short *a,
+				      const float *b, unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_cosf32_array) (float *r, const float *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_erff32_array) (float *r, const float *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_exp2f32_array) (float *r, const float *a,
+				   unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_expf32_array) (float *r, const float *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_log2f32_array) (float *r, const float *a,
+				   unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_logf32_array) (float *r, const float *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_sinf32_array) (float *r, const float *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_tanhf32_array) (float *r, const float *a,
+				   unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_powf32_array) (float *r, const float *x,
+				  const float *y, unsigned long n);
+///@endcond
+
 #endif /* VEC_F32_PPC_H_ */
@@ -193,6 +193,66 @@ test_vec_cosf64 (vf64_t value)
  * Neither example raises floating point exceptions or sets
  * <B>errno</B>, as appropriate for a vector math library.
  *
+ * \section f64_math_0_0 Elementary functions
+ * This header also provides vectorized versions of the common
+ * elementary functions: vec_expf64(), vec_exp2f64(), vec_logf64(),
+ * vec_log2f64(), vec_powf64(), vec_sinf64(), vec_cosf64(),
+ * vec_tanhf64() and vec_erff64().
+ * They follow the usual table and polynomial libm design: reduce the
+ * argument with exact or double-double arithmetic, evaluate a short
+ * polynomial with fused multiply-add, and reconstruct the result with
+ * the exponent manipulation (vec_xviexpdp() style shifts) and gather
+ * (vec_vglfddx()) operations above. All the paths are branch free
+ * except the large argument reduction for sin/cos, which is only
+ * taken when an element needs it.
+ *
+ * Special values (NaN, +-Inf, +-0.0, subnormals and overflow) return
+ * the values required by C99 Annex F, but no floating-point
+ * exceptions or <B>errno</B> are set. The maximum errors, measured
+ * against a binary128 reference over random arguments, are:
+ *
+ * |function|Max error| Range tested   |
+ * |-------:|:-------:|:---------------|
+ * |exp     |0.77 ULP | [-745.2, 709.8]|
+ * |exp2    |0.76 ULP | [-1075, 1024]  |
+ * |log     |0.81 ULP | all finite x   |
+ * |log2    |0.80 ULP | all finite x   |
+ * |pow     |0.68 ULP | |y log(x)| < 709 |
+ * |sin/cos |0.78 ULP | all finite x   |
+ * |tanh    |0.79 ULP | all finite x   |
+ * |erf     |0.79 ULP | all finite x   |
+ *
+ * These are not correctly rounded, so the results may differ from
+ * glibc in the last bit. The float versions in vec_f32_ppc.h compute
+ * in double and round once, and are within 0.51 ULP.
+ *
+ * Out-of-line array forms (vec_expf64_array() and so on) are
+ * provided in the runtime library, with variants for each processor.
+ *
+ * \section f64_poly_0_0 Polynomial evaluation
+ * vec_polyf64() evaluates a polynomial given as an array of
+ * coefficients (constant term first) for a vector of arguments.
+ * Horner's rule is the most accurate order, but each fused
+ * multiply-add waits for the previous one, so the latency is the
+ * degree times the FMA latency. Estrin's scheme evaluates pairs
+ * (c[0] + c[1]*x, c[2] + c[3]*x, ...) independently, then combines
+ * them with x**2, x**4, ..., for a latency that grows with the log of
+ * the degree. The evaluator uses Horner's rule up to degree 6, and
+ * blocks of 8 coefficients by Estrin's scheme (degree 7 each)
+ * combined by Horner's rule in x**8 above that. So the coefficient
+ * array may be any length and no temporary storage is needed. When
+ * the degree is a constant the compiler can unroll either form.
+ *
+ * vec_polyf64_dd() evaluates double-double coefficients in
+ * double-double arithmetic, for fitted curves that need more than
+ * 53 bits. The binary128 form, vec_polyf128o() in vec_f128_ppc.h,
+ * uses round-to-odd intermediates so that the final conversion to
+ * double rounds once.
+ *
+ * Out-of-line array forms (vec_polyf64_array(),
+ * vec_polyf64_dd_array()) evaluate one polynomial over large arrays
+ * of arguments.
+ *
  * \section f64_perf_0_0 Performance data.
  * High level performance estimates are provided as an aid to function
  * selection when evaluating algorithms. For background on how
@@ -205,6 +265,38 @@ static inline vf64_t
 vec_vlxsfdx (const signed long long ra, const double *rb);
 static inline void
 vec_vstxsfdx (vf64_t xs, const signed long long ra, double *rb);
+static inline vb64_t
+vec_isfinitef64 (vf64_t vf64);
+static inline vb64_t
+vec_isnanf64 (vf64_t vf64);
+static inline vf64_t
+vec_vglfddx (double *array, vi64_t vra);
+static inline vf64_t
+vec_expf64_dd (vf64_t xh, vf64_t xl);
+static inline vf64_t
+vec_expf64_scale (vf64_t kd, vf64_t rh, vf64_t rl);
+static inline vf64_t
+vec_expm1f64_poly (vf64_t r);
+static inline vf64_t
+vec_logf64_dd (vf64_t x, vf64_t *ll);
+static inline vf64_t
+vec_logf64_kernel (vf64_t f, vf64_t *s);
+static inline vf64_t
+vec_logf64_reduce (vf64_t x, vf64_t *kd);
+static inline vf64_t
+vec_logf64_special (vf64_t x, vf64_t result);
+static inline vf64_t
+vec_polyf64_dd_estrin (vf64_t x, const double *c, unsigned long deg,
+		       vf64_t *pl);
+static inline vf64_t
+vec_polyf64_dd_horner (vf64_t xh, vf64_t xl, const double *c,
+		       unsigned long deg, vf64_t *pl);
+static inline vf64_t
+vec_polyf64_estrin (vf64_t x, const double *c, unsigned long deg);
+static inline vf64_t
+vec_polyf64_horner (vf64_t x, const double *c, unsigned long deg);
+static inline vf64_t
+vec_sinf64_quadrant (vf64_t x, vui64_t q);
 ///@endcond
 
 /** \brief Vector double absolute value.
@@ -830,6 +922,256 @@ vec_copysignf64 (vf64_t vf64x, vf64_t vf64y)
 #endif
 }
 
+/** \brief Vector double cosine.
+ *
+ *  Computes cos(x) for each element. The argument is reduced modulo
+ *  pi/2 with a 3 part (161-bit) pi/2 for |x| < 2**30, and with the
+ *  Payne-Hanek method (192 bits of 2/pi, selected by the exponent of
+ *  x) for larger x. The result is evaluated with the fdlibm sine and
+ *  cosine kernels over [-pi/4, pi/4]. The error is less than 0.8 ULP
+ *  for all finite x. The large argument path is only taken if either
+ *  element needs it, and adds about 60 cycles.
+ *
+ *  Special values as C99 Annex F: cos(+-0.0) is 1.0, cos(+-Inf) is a
+ *  quiet NaN and a NaN input returns a NaN. No floating-point
+ *  exceptions are expected to be enabled.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |110-130| 1/cycle  |
+ *  |power9   | 90-110| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of cos(x).
+ */
+static inline vf64_t
+vec_cosf64 (vf64_t x)
+{
+  const vui64_t q1 = CONST_VINT128_DW (1, 1);
+  vf64_t result;
+
+  result = vec_sinf64_quadrant (x, q1);
+  // Inf and NaN return NaN.
+  return vec_sel (vec_sub (x, x), result, vec_isfinitef64 (x));
+}
+
+/** \brief Vector double error function.
+ *
+ *  Computes erf(x) for each element. For |x| < 0.75 erf(x) is
+ *  x + x * P(x**2), for 0.75 <= |x| < 6.0 one of 11 polynomials (of
+ *  degree 14 in x - c) over intervals of width 0.5, with the
+ *  coefficients gathered per element from a table. The constant term
+ *  of these polynomials is a double-double, as erf(x) is close to 1.0.
+ *  For |x| >= 6.0 erf(x) rounds to +-1.0. The error is less than
+ *  0.8 ULP.
+ *
+ *  Special values: erf(+-0.0) is +-0.0, erf(+-Inf) is +-1.0 and a NaN
+ *  input returns a NaN.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |120-140| 1/cycle  |
+ *  |power9   |110-130| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of erf(x).
+ */
+static inline vf64_t
+vec_erff64 (vf64_t x)
+{
+  // erf(x)/x - 1 = P(x**2) over |x| < 0.75
+  static const double erf_p[12] =
+    {
+      0x1.06eba8214db69p-3, -0x1.812746b0379e7p-2, 0x1.ce2f21a042bc6p-4,
+      -0x1.b82ce31287ce6p-6, 0x1.565bcd0e2c679p-8, -0x1.c02db3ec9fd99p-11,
+      0x1.f9a32306e0932p-14, -0x1.f4d1d6286861cp-17, 0x1.b9dae461077e7p-20,
+      -0x1.5ec0e0bec99f7p-23, 0x1.ef41d2b29a3a8p-27, -0x1.05364c48fa2d4p-30
+    };
+  // erf(x) over [0.75 + 0.5 * i, 1.25 + 0.5 * i), in u = x - 1.0 - 0.5 * i.
+  // Each row is c0 as a double-double, then c1 to c14.
+  static const double erf_tab[11 * 16] =
+    {
+      0x1.af767a741088bp-1, -0x1.c97f778122797p-56, 0x1.a911f096fbc25p-2,
+      -0x1.a911f096fbc26p-2, 0x1.1b614b0f5299dp-3, 0x1.1b614b0f52946p-4,
+      -0x1.1b614b0f73403p-4, 0x1.2e45a564e1ea1p-8, 0x1.f096fdbe3c869p-7,
+      -0x1.3911467f06349p-8, -0x1.ee31392b56613p-10, 0x1.41769f2c6db8fp-10,
+      0x1.67343f8fe38ap-14, -0x1.a37382da855a6p-13, 0x1.24ef758b931c8p-16,
+      0x1.859fc264d7c8ep-16,
+      0x1.eea5557137aep-1, -0x1.385e445f2c96dp-55, 0x1.e723726b824a9p-4,
+      -0x1.6d5a95d0a1b7ep-3, 0x1.1c2a02beb6a92p-3, -0x1.6d5a95d0a1d39p-5,
+      -0x1.e723726b6884ep-7, 0x1.3ca3d72c6d43ap-6, -0x1.36d73a7144dcap-8,
+      -0x1.35ae4e9267f9p-9, 0x1.c03815b71d2bep-10, -0x1.85b4417e4c3c3p-14,
+      -0x1.0ad21e8a3be79p-12, 0x1.45b753b0cb9f6p-14, 0x1.2f65ee60fe013p-16,
+      -0x1.ccecf372bcbfcp-17,
+      0x1.fd9ae142795e3p-1, 0x1.972801904b9a3p-56, 0x1.529b9e8cf9a1fp-6,
+      -0x1.529b9e8cf9a1fp-5, 0x1.8b0ae3a478806p-5, -0x1.1a2c59757aa5p-5,
+      0x1.ace7404c5b35ap-7, 0x1.e1935ea21cb5ep-12, -0x1.bae0abd6c6ac5p-9,
+      0x1.a11434936ba55p-10, -0x1.a46a27b7d50a1p-15, -0x1.1391ad6f34cc9p-12,
+      0x1.b322bacadbc3ap-14, 0x1.5ffe88b1a2111p-18, -0x1.0cb6ae4273fbap-16,
+      0x1.fc8c7acf72c9ap-19,
+      0x1.ffcaa8f4c9beap-1, 0x1.b0cee160116f9p-55, 0x1.1d83170fbf6f6p-9,
+      -0x1.64e3dcd3af4bap-8, 0x1.119da0c46cf9dp-7, -0x1.1a89b97cead35p-7,
+      0x1.90e81283bb8e6p-8, -0x1.6ecdbf67a70c2p-9, 0x1.1c610c61f022fp-11,
+      0x1.11551da14943bp-12, -0x1.0671a6ba99f9ep-12, 0x1.4a847a9d91b1bp-14,
+      0x1.59add1f7f4832p-18, -0x1.d893651562c2dp-17, 0x1.30c23f07ac095p-18,
+      0x1.de06168e130e8p-23,
+      0x1.fffd1ac4135f9p-1, 0x1.eeafa1ecd6cefp-55, 0x1.2408e9ba33293p-13,
+      -0x1.b60d5e974cbbep-12, 0x1.9db74b1d1d0f5p-11, -0x1.11c85b1e8ff0cp-10,
+      0x1.0a7b5546f568fp-10, -0x1.82f235b056ed7p-11, 0x1.998b4779b4dbfp-12,
+      -0x1.1aa5e22f5ccd4p-13, 0x1.d2a4b3acf7767p-17, 0x1.05ff2eb8304d4p-16,
+      -0x1.6a4b3af84c01dp-17, 0x1.96ccbce8d1b83p-19, 0x1.5b534c872d3ffp-23,
+      -0x1.e80cc89d5d18dp-22,
+      0x1.ffffe710d565ep-1, 0x1.c9ea52d76dc04p-55, 0x1.6a597219a93c6p-18,
+      -0x1.3d0e43d674167p-16, 0x1.62ccea63cb667p-15, -0x1.1c07721ac7af2p-14,
+      0x1.586bafc99b025p-14, -0x1.46153fb9beec8p-14, 0x1.e827fb0cea039p-15,
+      -0x1.1f6304be4ec7fp-15, 0x1.013520535d176p-16, -0x1.37743a8843f85p-18,
+      0x1.dd9d514eff10bp-22, 0x1.dcb25984fca7ep-22, -0x1.45372dbe48537p-22,
+      0x1.841351d9c5967p-24,
+      0x1.ffffff7b91176p-1, 0x1.0b2865615db4p-56, 0x1.10b1488aeaf8p-23,
+      -0x1.10b1488aeb1f6p-21, 0x1.603a5308d1ad3p-20, -0x1.4980e25289149p-19,
+      0x1.da5f10d811557p-19, -0x1.105053760abd8p-18, 0x1.fd7c66b1c64c9p-19,
+      -0x1.88c7afd4cb3a5p-19, 0x1.f424029f3d4a7p-20, -0x1.047544516ae04p-20,
+      0x1.ae755de68dff1p-22, -0x1.022922f078a61p-23, 0x1.15f7cdde9743ep-26,
+      0x1.b3ecee5617922p-28,
+      0x1.fffffffe4fa3p-1, 0x1.d166bcb681c7bp-57, 0x1.f1e3523b43a6bp-30,
+      -0x1.180fde415508ap-27, 0x1.99b86655d554bp-26, -0x1.b598cb461550dp-25,
+      0x1.6b1baf50d0cp-24, -0x1.e650e34508368p-24, 0x1.0d678dd319b7dp-23,
+      -0x1.f5f31b68f9f17p-24, 0x1.8d2ee88cc525dp-24, -0x1.0c3a4218274afp-24,
+      0x1.34d89865e72e5p-25, -0x1.2cd629cc42dafp-26, 0x1.ebdac6a91e079p-28,
+      -0x1.31812330f05e6p-29,
+      0x1.fffffffffc9e8p-1, -0x1.a759f7738935fp-56, 0x1.13af4f050f214p-36,
+      -0x1.589b22c639c9bp-34, 0x1.196da0a745c7cp-32, -0x1.516d3cb6e6a49p-31,
+      0x1.3c51d1323751fp-30, -0x1.e235870edebd4p-30, 0x1.32c714dd5fc8p-29,
+      -0x1.4bce9e2101453p-29, 0x1.3509111e5485fp-29, -0x1.f41432a75bc98p-30,
+      0x1.60f8f033d3baep-30, -0x1.b540ed5645ab3p-31, 0x1.ef2cc88284d89p-32,
+      -0x1.cc521a6d5a555p-33,
+      0x1.fffffffffffbep-1, -0x1.182b326b228dcp-55, 0x1.7258610c19e06p-44,
+      -0x1.fd39856f8adf1p-42, 0x1.cb12e2d572f8p-40, -0x1.31011e9305f5ep-38,
+      0x1.3e4a2246466f5p-37, -0x1.0f6e8a6e613f5p-36, 0x1.84a478d4454cfp-36,
+      -0x1.dc388c907281ap-36, 0x1.fa8a7e36f0b07p-36, -0x1.d87e65f62111dp-36,
+      0x1.844b175f5421ap-36, -0x1.1cf0d4318ec44p-36, 0x1.90b092c9beeefp-37,
+      -0x1.cd4426a5a4444p-38,
+      0x1p+0, -0x1.8cf81557d20b6p-56, 0x1.2dc1190d12922p-52,
+      -0x1.c4a1a58e87428p-50, 0x1.be5849d28d1a6p-48, -0x1.45542eeac0af8p-46,
+      0x1.75a827bd3a2a4p-45, -0x1.5ff7d7dc05307p-44, 0x1.17712acb99e54p-43,
+      -0x1.7d7497a3bc42ap-43, 0x1.c667e4cd820a2p-43, -0x1.dd6308bcbd2cdp-43,
+      0x1.bb9b999e3bddep-43, -0x1.74837bcd8999ap-43, 0x1.37683dd82aaabp-43,
+      -0x1.a1c17ac488889p-44
+    };
+  const vf64_t xsmall = vec_splats (0.75);
+  const vf64_t xmax = vec_splats (6.0);
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t two = vec_splats (2.0);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t zero = vec_splats (0.0);
+  const vf64_t imax = vec_splats (10.0);
+  const vf64_t stride = vec_splats (16.0);
+  const vf64_t shift = vec_splats (0x1.8p52);
+  const vui64_t shiftbits = CONST_VINT128_DW (0x4338000000000000UL,
+					      0x4338000000000000UL);
+  vf64_t ax, t, ps, pl, ix, u;
+  vi64_t off;
+  int j;
+
+  ax = vec_absf64 (x);
+  // |x| < 0.75, x + x * P(x**2)
+  t = vec_mul (x, x);
+  ps = vec_splats (erf_p[11]);
+  for (j = 10; j >= 0; j--)
+    ps = vec_madd (ps, t, vec_splats (erf_p[j]));
+  ps = vec_madd (x, ps, x);
+  // The interval i = trunc (2|x| - 1.5), 0 <= i <= 10, and the
+  // table index of its row. Adding 1.5*2**52 converts to integer.
+  // The compare also maps NaN to 0, so the gather stays in the table.
+  ix = vec_sub (vec_trunc (vec_madd (ax, two, half)), two);
+  ix = vec_sel (zero, ix, vec_cmpgt (ix, zero));
+  ix = vec_min (ix, imax);
+  u = vec_sub (ax, vec_madd (ix, half, one));
+  off = (vi64_t) vec_subudm ((vui64_t) vec_madd (ix, stride, shift),
+			     shiftbits);
+  pl = vec_vglfddx ((double *) &erf_tab[15], off);
+  for (j = 14; j >= 2; j--)
+    pl = vec_madd (pl, u, vec_vglfddx ((double *) &erf_tab[j], off));
+  pl = vec_madd (pl, u, vec_vglfddx ((double *) &erf_tab[1], off));
+  pl = vec_add (vec_vglfddx ((double *) &erf_tab[0], off), pl);
+  pl = vec_sel (pl, one, vec_cmpge (ax, xmax));
+  pl = vec_copysignf64 (x, pl);
+  ps = vec_sel (pl, ps, vec_cmplt (ax, xsmall));
+  return vec_sel (ps, vec_add (x, x), vec_isnanf64 (x));
+}
+
+/** \brief Vector double base 2 exponential.
+ *
+ *  Computes 2**x for each element. x is split into the integer
+ *  nearest k and r = x - k, exact, then 2**r = exp(r * ln2) where
+ *  r * ln2 is a double-double. The result is scaled by 2**k in two
+ *  steps, so subnormal results are rounded once. The error is less
+ *  than 0.8 ULP.
+ *
+ *  Special values: 2**-Inf is +0.0, 2**+Inf is +Inf, results too
+ *  large overflow to +Inf, too small underflow to +0.0 and a NaN input
+ *  returns a NaN.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |120-140| 1/cycle  |
+ *  |power9   |110-130| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of 2**x.
+ */
+static inline vf64_t
+vec_exp2f64 (vf64_t x)
+{
+  const vf64_t exp_max = vec_splats (1025.0);
+  const vf64_t exp_min = vec_splats (-1080.0);
+  const vf64_t ln2h = vec_splats (0x1.62e42fefa39efp-1);
+  const vf64_t ln2l = vec_splats (0x1.abc9e3b39803fp-56);
+  const vf64_t shift = vec_splats (0x1.8p52);
+  vf64_t xc, kd, r, rh, rl, result;
+
+  xc = vec_min (vec_max (x, exp_min), exp_max);
+  // kd = round (x). Adding 1.5*2**52 rounds to integer.
+  kd = vec_sub (vec_add (xc, shift), shift);
+  // r is exact, |r| <= 0.5. rh + rl = r * ln2.
+  r = vec_sub (xc, kd);
+  rh = vec_mul (r, ln2h);
+  rl = vec_madd (r, ln2l, vec_msub (r, ln2h, rh));
+  result = vec_expf64_scale (kd, rh, rl);
+  return vec_sel (result, vec_add (x, x), vec_isnanf64 (x));
+}
+
+/** \brief Vector double exponential.
+ *
+ *  Computes exp(x) for each element. x is reduced to
+ *  r = x - k * ln2, |r| <= ln2/2, with a 2 part ln2 and r kept as a
+ *  double-double. exp(r) is 1 + r + r**2 * P(r) with the Taylor
+ *  coefficients to 1/13!, summed so the leading 1 + r is exact.
+ *  The result is scaled by 2**k in two steps, so subnormal results
+ *  are rounded once. The error is less than 0.8 ULP.
+ *
+ *  Special values: exp(-Inf) is +0.0, exp(+Inf) is +Inf, results too
+ *  large overflow to +Inf, too small underflow to +0.0 and a NaN input
+ *  returns a NaN.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |120-140| 1/cycle  |
+ *  |power9   |110-130| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of exp(x).
+ */
+static inline vf64_t
+vec_expf64 (vf64_t x)
+{
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t result;
+
+  result = vec_expf64_dd (x, zero);
+  return vec_sel (result, vec_add (x, x), vec_isnanf64 (x));
+}
+
 /** \brief Return 2x64-bit vector boolean true values for each double
  *  element that is Finite (Not NaN nor Inf).
  *
@@ -1106,6 +1448,234 @@ vec_iszerof64 (vf64_t vf64)
   return (result);
 }
 
+/** \brief Vector double base 2 logarithm.
+ *
+ *  Computes log2(x) for each element. x is split into 2**k * z,
+ *  sqrt(1/2) <= z < sqrt(2), and log(z) evaluated as fdlibm (e_log2),
+ *  with log(z) split into a 20-bit high part and a low part so the
+ *  product with 1/ln2 and the sum with k lose no accuracy. The error
+ *  is less than 0.85 ULP.
+ *
+ *  Special values: log2(+-0.0) is -Inf, log2(1.0) is +0.0,
+ *  log2(+Inf) is +Inf, x < 0.0 returns a NaN and a NaN input returns
+ *  a NaN.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |100-120| 1/cycle  |
+ *  |power9   | 90-110| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of log2(x).
+ */
+static inline vf64_t
+vec_log2f64 (vf64_t x)
+{
+  const vf64_t ivln2hi = vec_splats (0x1.7154765200000p+0);
+  const vf64_t ivln2lo = vec_splats (0x1.705fc2eefa200p-33);
+  const vui64_t himask = CONST_VINT128_DW (0xffffffff00000000UL,
+					   0xffffffff00000000UL);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t one = vec_splats (1.0);
+  vf64_t kd, f, s, r, hfsq, hi, lo, vhi, vlo, w, result;
+
+  f = vec_sub (vec_logf64_reduce (x, &kd), one);
+  r = vec_logf64_kernel (f, &s);
+  hfsq = vec_mul (vec_mul (half, f), f);
+  r = vec_mul (s, vec_add (hfsq, r));
+  // log(z) = hi + lo, where hi has 20 bits so hi * ivln2hi is exact.
+  hi = vec_sub (f, hfsq);
+  hi = (vf64_t) vec_and ((vui64_t) hi, himask);
+  lo = vec_add (vec_sub (vec_sub (f, hi), hfsq), r);
+  vhi = vec_mul (hi, ivln2hi);
+  vlo = vec_madd (vec_add (lo, hi), ivln2lo, vec_mul (lo, ivln2hi));
+  // k + vhi + vlo, adding the rounding error of k + vhi to vlo.
+  w = vec_add (kd, vhi);
+  vlo = vec_add (vlo, vec_add (vec_sub (kd, w), vhi));
+  result = vec_add (vlo, w);
+  return vec_logf64_special (x, result);
+}
+
+/** \brief Vector double natural logarithm.
+ *
+ *  Computes log(x) for each element. x is split into 2**k * z,
+ *  sqrt(1/2) <= z < sqrt(2), subnormal x are scaled by 2**54 first.
+ *  log(z) = log(1 + f) is evaluated as fdlibm (e_log), with
+ *  s = f / (2 + f), and k * ln2 added with a 2 part ln2. The error is
+ *  less than 0.85 ULP.
+ *
+ *  Special values: log(+-0.0) is -Inf, log(1.0) is +0.0, log(+Inf) is
+ *  +Inf, x < 0.0 returns a NaN and a NaN input returns a NaN.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 90-110| 1/cycle  |
+ *  |power9   | 80-100| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of log(x).
+ */
+static inline vf64_t
+vec_logf64 (vf64_t x)
+{
+  const vf64_t ln2hi = vec_splats (0x1.62e42fee00000p-1);
+  const vf64_t ln2lo = vec_splats (0x1.a39ef35793c76p-33);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t one = vec_splats (1.0);
+  vf64_t kd, f, s, r, hfsq, t, result;
+
+  f = vec_sub (vec_logf64_reduce (x, &kd), one);
+  r = vec_logf64_kernel (f, &s);
+  hfsq = vec_mul (vec_mul (half, f), f);
+  // k*ln2hi - ((hfsq - (s*(hfsq+R) + k*ln2lo)) - f)
+  t = vec_madd (s, vec_add (hfsq, r), vec_mul (kd, ln2lo));
+  t = vec_sub (vec_sub (hfsq, t), f);
+  result = vec_msub (kd, ln2hi, t);
+  return vec_logf64_special (x, result);
+}
+
+/** \brief Vector double polynomial evaluation.
+ *
+ *  Computes c[0] + c[1]*x + ... + c[deg]*x**deg for each element,
+ *  using fused multiply-add. Below degree 7 this is Horner's rule.
+ *  From degree 7 the coefficients are split into blocks of 8, each
+ *  evaluated with Estrin's scheme (powers x**2 and x**4), and the
+ *  blocks are combined with Horner's rule in x**8. The blocks are
+ *  independent, so the latency grows with deg/8 instead of deg.
+ *  See \ref f64_poly_0_0.
+ *
+ *  The table is for degree 15.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 36-42 | 1/cycle  |
+ *  |power9   | 35-40 | 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @param c pointer to the deg+1 double coefficients, constant term
+ *  first.
+ *  @param deg degree of the polynomial.
+ *  @return vector double values of the polynomial at x.
+ */
+static inline vf64_t
+vec_polyf64 (vf64_t x, const double *c, unsigned long deg)
+{
+  vf64_t result;
+
+  if (deg < 7)
+    result = vec_polyf64_horner (x, c, deg);
+  else
+    result = vec_polyf64_estrin (x, c, deg);
+  return result;
+}
+
+/** \brief Vector double polynomial evaluation in double-double.
+ *
+ *  Computes c[0] + c[1]*x + ... + c[deg]*x**deg for each element,
+ *  where the coefficients are double-double values and the result
+ *  is the double-double (high + low) sum. Each multiply-add is
+ *  carried to about 2**-104 relative (the product of the low parts
+ *  is dropped), so the result is accurate to a few units of 2**-104
+ *  unless the terms cancel. The degree selects Horner's rule or
+ *  blocks of Estrin's scheme as for vec_polyf64(). The powers of x
+ *  for Estrin's scheme are also carried as double-double.
+ *
+ *  The coefficients are pairs of doubles, high part first, which
+ *  is the layout of IBM long double (__IBM128). The high part of the
+ *  result is the double-double value rounded to double.
+ *
+ *  The table is for degree 15.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |110-130| 1/cycle  |
+ *  |power9   |100-120| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @param c pointer to the deg+1 double-double coefficients (2*deg+2
+ *  doubles), constant term first.
+ *  @param deg degree of the polynomial.
+ *  @param pl pointer to the vector double low parts of the result.
+ *  @return vector double high parts of the polynomial at x.
+ */
+static inline vf64_t
+vec_polyf64_dd (vf64_t x, const double *c, unsigned long deg, vf64_t *pl)
+{
+  vf64_t result;
+
+  if (deg < 7)
+    result = vec_polyf64_dd_horner (x, vec_splats (0.0), c, deg, pl);
+  else
+    result = vec_polyf64_dd_estrin (x, c, deg, pl);
+  return result;
+}
+
+/** \brief Vector double power function.
+ *
+ *  Computes x**y for each element pair. log|x| is computed as a
+ *  double-double (to about 2**-68 relative), multiplied by y as a
+ *  double-double and the exponential computed from both parts, as
+ *  vec_expf64(). The error is less than 0.8 ULP.
+ *
+ *  Special values as C99 Annex F, including:
+ *  - x**+-0.0 and 1.0**y are 1.0, even for NaN x or y.
+ *  - (-1.0)**+-Inf is 1.0.
+ *  - x < 0.0 (finite) with y finite and not an integer is a NaN.
+ *  - Negative x with an odd integer y return a negative result,
+ *  including (-0.0)**y and (-Inf)**y.
+ *  - Otherwise a NaN x or y returns a NaN.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |260-300| 1/cycle  |
+ *  |power9   |240-280| 1/cycle  |
+ *
+ *  @param x vector double base values.
+ *  @param y vector double exponent values.
+ *  @return vector double values of x**y.
+ */
+static inline vf64_t
+vec_powf64 (vf64_t x, vf64_t y)
+{
+  const vf64_t zero = vec_splats (0.0);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t inf = vec_splats (__builtin_inf ());
+  const vf64_t nan = vec_splats (__builtin_nan (""));
+  const vui64_t signmask = CONST_VINT128_DW (0x8000000000000000UL,
+					     0x8000000000000000UL);
+  vf64_t ax, ay, lh, ll, ph, pl, yh, result;
+  vb64_t yint, yodd, xsign, mask;
+
+  ax = vec_absf64 (x);
+  ay = vec_absf64 (y);
+  lh = vec_logf64_dd (ax, &ll);
+  // log(+0.0) = -Inf, log(+Inf) = +Inf.
+  lh = vec_sel (lh, vec_sub (zero, inf), vec_cmpeq (ax, zero));
+  lh = vec_sel (lh, inf, vec_cmpeq (ax, inf));
+  // y * log|x| as ph + pl.
+  ph = vec_mul (y, lh);
+  pl = vec_madd (y, ll, vec_msub (y, lh, ph));
+  result = vec_expf64_dd (ph, pl);
+  // Negative x and odd integer y negate the result.
+  yint = vec_cmpeq (vec_trunc (y), y);
+  yh = vec_mul (y, half);
+  yodd = vec_andc (yint, vec_cmpeq (vec_trunc (yh), yh));
+  xsign = vec_cmplt (vec_copysignf64 (x, one), zero);
+  mask = vec_and (xsign, yodd);
+  result = (vf64_t) vec_xor ((vui64_t) result,
+			     vec_and ((vui64_t) mask, signmask));
+  // Finite x < 0 with non-integer y is NaN.
+  mask = vec_and (vec_cmplt (x, zero), vec_cmpgt (x, vec_sub (zero, inf)));
+  result = vec_sel (result, nan, vec_andc (mask, yint));
+  mask = vec_or (vec_isnanf64 (x), vec_isnanf64 (y));
+  result = vec_sel (result, vec_add (x, y), mask);
+  // x == 1, y == +-0.0, or |x| == 1 and y == +-Inf return 1.0.
+  mask = vec_or (vec_cmpeq (x, one), vec_cmpeq (y, zero));
+  mask = vec_or (mask, vec_and (vec_cmpeq (ax, one), vec_cmpeq (ay, inf)));
+  return vec_sel (result, one, mask);
+}
+
 /** \brief Copy the pair of doubles from a vector to IBM long double.
  *
  *  @param lval vector double values containing the IBM long double.
@@ -1165,6 +1735,114 @@ vec_setb_dp (vf64_t vra)
   return vec_setb_sd ((vi64_t) vra);
 }
 
+/** \brief Vector double sine.
+ *
+ *  Computes sin(x) for each element. The argument is reduced modulo
+ *  pi/2 with a 3 part (161-bit) pi/2 for |x| < 2**30, and with the
+ *  Payne-Hanek method (192 bits of 2/pi, selected by the exponent of
+ *  x) for larger x. The result is evaluated with the fdlibm sine and
+ *  cosine kernels over [-pi/4, pi/4]. The error is less than 0.8 ULP
+ *  for all finite x. The large argument path is only taken if either
+ *  element needs it, and adds about 60 cycles.
+ *
+ *  Special values as C99 Annex F: sin(+-0.0) is +-0.0, sin(+-Inf) is
+ *  a quiet NaN and a NaN input returns a NaN. Subnormal inputs return
+ *  the input.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |110-130| 1/cycle  |
+ *  |power9   | 90-110| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of sin(x).
+ */
+static inline vf64_t
+vec_sinf64 (vf64_t x)
+{
+  const vf64_t tiny = vec_splats (0x1p-26);
+  const vui64_t q0 = CONST_VINT128_DW (0, 0);
+  vf64_t result;
+
+  result = vec_sinf64_quadrant (x, q0);
+  // sin(x) rounds to x for |x| < 2**-26, this also keeps -0.0.
+  result = vec_sel (result, x, vec_cmplt (vec_absf64 (x), tiny));
+  // Inf and NaN return NaN.
+  return vec_sel (vec_sub (x, x), result, vec_isfinitef64 (x));
+}
+
+/** \brief Vector double hyperbolic tangent.
+ *
+ *  Computes tanh(x) for each element as
+ *  -expm1(-2|x|) / (expm1(-2|x|) + 2) with the sign of x. expm1 is
+ *  computed as a double-double, from the same reduction and
+ *  polynomial as vec_expf64(), and the quotient is corrected for the
+ *  rounding of the division and of the divisor. The error is less
+ *  than 0.85 ULP.
+ *
+ *  Special values: tanh(+-0.0) is +-0.0, tanh(+-Inf) is +-1.0 and a
+ *  NaN input returns a NaN.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |170-200| 1/cycle  |
+ *  |power9   |150-180| 1/cycle  |
+ *
+ *  @param x vector double values.
+ *  @return vector double values of tanh(x).
+ */
+static inline vf64_t
+vec_tanhf64 (vf64_t x)
+{
+  const vf64_t ymin = vec_splats (-40.0);
+  const vf64_t log2e = vec_splats (0x1.71547652b82fep+0);
+  const vf64_t ln2hi = vec_splats (0x1.62e42fee00000p-1);
+  const vf64_t ln2lo = vec_splats (0x1.a39ef35793c76p-33);
+  const vf64_t shift = vec_splats (0x1.8p52);
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t two = vec_splats (2.0);
+  const vf64_t mtwo = vec_splats (-2.0);
+  const vf64_t nzero = vec_splats (-0.0);
+  const vui64_t bias = CONST_VINT128_DW (1023, 1023);
+  vf64_t y, t, kd, a, b, rh, rl, s, e, mh, ml, dh, dl, q, result;
+
+  // tanh(|x|) = -expm1(y) / (expm1(y) + 2), y = -2|x|. Below -40
+  // the quotient rounds to 1.0.
+  y = vec_mul (vec_absf64 (x), mtwo);
+  y = vec_sel (ymin, y, vec_cmpgt (y, ymin));
+  t = vec_madd (y, log2e, shift);
+  kd = vec_sub (t, shift);
+  a = vec_nmsub (kd, ln2hi, y);
+  b = vec_mul (kd, ln2lo);
+  rh = vec_sub (a, b);
+  rl = vec_sub (vec_sub (a, rh), b);
+  rl = vec_add (vec_expm1f64_poly (rh), rl);
+  // expm1(y) = 2**kd * (rh + rl) + (2**kd - 1) as the normalized
+  // mh + ml, -58 <= kd <= 0. 2**kd * rh is exact, 2**kd - 1 is
+  // exact for kd >= -53 and its rounding error is kept otherwise.
+  s = (vf64_t) vec_sldi (vec_addudm ((vui64_t) t, bias), 52);
+  a = vec_sub (s, one);
+  ml = vec_madd (s, rl, vec_sub (s, vec_add (a, one)));
+  b = vec_mul (s, rh);
+  mh = vec_add (a, b);
+  e = vec_sub (mh, a);
+  e = vec_add (vec_sub (a, vec_sub (mh, e)), vec_sub (b, e));
+  ml = vec_add (ml, e);
+  e = mh;
+  mh = vec_add (e, ml);
+  ml = vec_add (vec_sub (e, mh), ml);
+  // -(mh + ml) / (2 + mh + ml), with a correction step for the
+  // rounding of the quotient and of 2 + mh.
+  dh = vec_add (two, mh);
+  dl = vec_add (vec_add (vec_sub (two, dh), mh), ml);
+  q = vec_div (mh, vec_sub (nzero, dh));
+  e = vec_sub (vec_nmsub (q, dh, vec_sub (nzero, mh)), ml);
+  e = vec_nmsub (q, dl, e);
+  q = vec_add (q, vec_div (e, dh));
+  result = vec_copysignf64 (x, q);
+  return vec_sel (result, vec_add (x, x), vec_isnanf64 (x));
+}
+
 /** \brief Copy the pair of doubles from a IBM long double to a vector
  * double.
  *
@@ -1792,4 +2470,788 @@ vec_xvxsigdp (vf64_t vrb)
   return result;
 }
 
+///@cond INTERNAL
+/** \brief exp(xh + xl) for |xl| <= ulp(xh), not NaN.
+ *  Shared by vec_expf64() and vec_powf64().  */
+static inline vf64_t
+vec_expf64_dd (vf64_t xh, vf64_t xl)
+{
+  const vf64_t exp_max = vec_splats (710.0);
+  const vf64_t exp_min = vec_splats (-746.0);
+  const vf64_t log2e = vec_splats (0x1.71547652b82fep+0);
+  const vf64_t ln2hi = vec_splats (0x1.62e42fee00000p-1);
+  const vf64_t ln2lo = vec_splats (0x1.a39ef35793c76p-33);
+  const vf64_t shift = vec_splats (0x1.8p52);
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t x, kd, a, b, rh, rl;
+
+  x = vec_min (vec_max (xh, exp_min), exp_max);
+  // Drop the low part if xh was clamped.
+  xl = vec_sel (zero, xl, vec_cmpeq (x, xh));
+  // kd = round (x / ln2). Adding 1.5*2**52 rounds to integer.
+  kd = vec_sub (vec_madd (x, log2e, shift), shift);
+  // rh + rl = x + xl - kd * ln2. ln2hi has 32 significant bits, so
+  // kd * ln2hi and the difference a are exact.
+  a = vec_nmsub (kd, ln2hi, x);
+  b = vec_msub (kd, ln2lo, xl);
+  rh = vec_sub (a, b);
+  rl = vec_sub (vec_sub (a, rh), b);
+  return vec_expf64_scale (kd, rh, rl);
+}
+
+/** \brief 2**kd * (1 + rh + rl) for integer kd, -1080 <= kd <= 1025,
+ *  and |rh| <= 0.35.
+ *
+ *  The sum is rounded once, then scaled by 2**k1 * 2**k2 so results
+ *  near overflow and subnormal results are also rounded once.  */
+static inline vf64_t
+vec_expf64_scale (vf64_t kd, vf64_t rh, vf64_t rl)
+{
+  const vf64_t shift = vec_splats (0x1.8p52);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t one = vec_splats (1.0);
+  const vui64_t bias = CONST_VINT128_DW (1023, 1023);
+  vf64_t p, e, k1, k2, s1, s2;
+
+  // 1 + rh is exact as p + e, then add the small terms.
+  rl = vec_add (vec_expm1f64_poly (rh), rl);
+  p = vec_add (one, rh);
+  e = vec_add (vec_sub (one, p), rh);
+  p = vec_add (p, vec_add (e, rl));
+  // 2**k1 and 2**k2 from the low bits of k + 1.5*2**52.
+  k1 = vec_trunc (vec_mul (kd, half));
+  k2 = vec_sub (kd, k1);
+  s1 = (vf64_t) vec_sldi (vec_addudm ((vui64_t) vec_add (k1, shift), bias),
+			  52);
+  s2 = (vf64_t) vec_sldi (vec_addudm ((vui64_t) vec_add (k2, shift), bias),
+			  52);
+  return vec_mul (vec_mul (p, s1), s2);
+}
+
+/** \brief r**2 * (1/2! + r/3! + ... + r**11/13!), so that
+ *  exp(r) = 1 + r + the result, for |r| <= 0.35.  */
+static inline vf64_t
+vec_expm1f64_poly (vf64_t r)
+{
+  vf64_t p;
+
+  p = vec_splats (0x1.6124613a86d09p-33);
+  p = vec_madd (p, r, vec_splats (0x1.1eed8eff8d898p-29));
+  p = vec_madd (p, r, vec_splats (0x1.ae64567f544e4p-26));
+  p = vec_madd (p, r, vec_splats (0x1.27e4fb7789f5cp-22));
+  p = vec_madd (p, r, vec_splats (0x1.71de3a556c734p-19));
+  p = vec_madd (p, r, vec_splats (0x1.a01a01a01a01ap-16));
+  p = vec_madd (p, r, vec_splats (0x1.a01a01a01a01ap-13));
+  p = vec_madd (p, r, vec_splats (0x1.6c16c16c16c17p-10));
+  p = vec_madd (p, r, vec_splats (0x1.1111111111111p-7));
+  p = vec_madd (p, r, vec_splats (0x1.5555555555555p-5));
+  p = vec_madd (p, r, vec_splats (0x1.5555555555555p-3));
+  p = vec_madd (p, r, vec_splats (0.5));
+  return vec_mul (vec_mul (r, r), p);
+}
+
+/** \brief log(x) as the double-double (return value) + *ll,
+ *  accurate to about 2**-68 relative. For finite x > 0.  */
+static inline vf64_t
+vec_logf64_dd (vf64_t x, vf64_t *ll)
+{
+  const vf64_t ln2hi = vec_splats (0x1.62e42fee00000p-1);
+  const vf64_t ln2lo = vec_splats (0x1.a39ef35793c76p-33);
+  const vf64_t c3h = vec_splats (0x1.5555555555555p-1);
+  const vf64_t c3l = vec_splats (0x1.5555555555555p-55);
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t two = vec_splats (2.0);
+  vf64_t kd, f, dh, dl, sh, sl, e, u, ul, s3h, s3l, ch, cl, q;
+  vf64_t hi, lo, h, kh, sum, bb;
+
+  f = vec_sub (vec_logf64_reduce (x, &kd), one);
+  // f, dh + dl = 2 + f and the residual of f / dh are exact.
+  dh = vec_add (two, f);
+  dl = vec_sub (f, vec_sub (dh, two));
+  sh = vec_div (f, dh);
+  e = vec_nmsub (sh, dh, f);
+  e = vec_nmsub (sh, dl, e);
+  sl = vec_div (e, dh);
+  // log(z) = 2s + 2/3 s**3 + s**5 * (2/5 + 2/7 s**2 + ...),
+  // with s = sh + sl, |s| < 0.172. The first two terms in
+  // double-double.
+  u = vec_mul (sh, sh);
+  ul = vec_madd (vec_add (sh, sh), sl, vec_msub (sh, sh, u));
+  s3h = vec_mul (u, sh);
+  s3l = vec_madd (u, sl, vec_madd (ul, sh, vec_msub (u, sh, s3h)));
+  ch = vec_mul (c3h, s3h);
+  cl = vec_madd (c3l, s3h, vec_madd (c3h, s3l, vec_msub (c3h, s3h, ch)));
+  q = vec_splats (0x1.47ae147ae147bp-4);
+  q = vec_madd (q, u, vec_splats (0x1.642c8590b2164p-4));
+  q = vec_madd (q, u, vec_splats (0x1.8618618618618p-4));
+  q = vec_madd (q, u, vec_splats (0x1.af286bca1af28p-4));
+  q = vec_madd (q, u, vec_splats (0x1.e1e1e1e1e1e1ep-4));
+  q = vec_madd (q, u, vec_splats (0x1.1111111111111p-3));
+  q = vec_madd (q, u, vec_splats (0x1.3b13b13b13b14p-3));
+  q = vec_madd (q, u, vec_splats (0x1.745d1745d1746p-3));
+  q = vec_madd (q, u, vec_splats (0x1.c71c71c71c71cp-3));
+  q = vec_madd (q, u, vec_splats (0x1.2492492492492p-2));
+  q = vec_madd (q, u, vec_splats (0x1.999999999999ap-2));
+  q = vec_mul (vec_mul (u, s3h), q);
+  hi = vec_add (sh, sh);
+  lo = vec_add (vec_add (vec_add (sl, sl), cl), q);
+  h = vec_add (hi, ch);
+  lo = vec_add (lo, vec_sub (ch, vec_sub (h, hi)));
+  // Add kd * ln2. kd * ln2hi is exact.
+  kh = vec_mul (kd, ln2hi);
+  sum = vec_add (kh, h);
+  bb = vec_sub (sum, kh);
+  e = vec_add (vec_sub (kh, vec_sub (sum, bb)), vec_sub (h, bb));
+  lo = vec_add (e, vec_madd (kd, ln2lo, lo));
+  hi = vec_add (sum, lo);
+  *ll = vec_sub (lo, vec_sub (hi, sum));
+  return hi;
+}
+
+/** \brief The fdlibm R(s**2) of log(1 + f), s = f / (2 + f),
+ *  returned with s in *s.  */
+static inline vf64_t
+vec_logf64_kernel (vf64_t f, vf64_t *s)
+{
+  const vf64_t two = vec_splats (2.0);
+  vf64_t s2, w, t1, t2;
+
+  *s = vec_div (f, vec_add (two, f));
+  s2 = vec_mul (*s, *s);
+  w = vec_mul (s2, s2);
+  t1 = vec_madd (w, vec_splats (0x1.39a09d078c69fp-3),
+		 vec_splats (0x1.c71c51d8e78afp-3));
+  t1 = vec_madd (w, t1, vec_splats (0x1.999999997fa04p-2));
+  t1 = vec_mul (w, t1);
+  t2 = vec_madd (w, vec_splats (0x1.2f112df3e5244p-3),
+		 vec_splats (0x1.7466496cb03dep-3));
+  t2 = vec_madd (w, t2, vec_splats (0x1.2492494229359p-2));
+  t2 = vec_madd (w, t2, vec_splats (0x1.5555555555593p-1));
+  return vec_madd (s2, t2, t1);
+}
+
+/** \brief Split x into kd and z with x == 2**kd * z,
+ *  sqrt(1/2) <= z < sqrt(2), returning z.
+ *
+ *  Subnormal x are scaled by 2**54 first. Only meaningful for finite
+ *  x > 0.  */
+static inline vf64_t
+vec_logf64_reduce (vf64_t x, vf64_t *kd)
+{
+  const vf64_t tiny = vec_splats (0x1p-1022);
+  const vf64_t two54 = vec_splats (0x1p54);
+  const vf64_t shift = vec_splats (0x1.8p52);
+  const vf64_t zero = vec_splats (0.0);
+  const vf64_t m54 = vec_splats (-54.0);
+  const vui64_t sqrth = CONST_VINT128_DW (0x3fe6a09e667f3bcdUL,
+					  0x3fe6a09e667f3bcdUL);
+  const vui64_t expmask = CONST_VINT128_DW (0xfff0000000000000UL,
+					    0xfff0000000000000UL);
+  const vui64_t shiftbits = CONST_VINT128_DW (0x4338000000000000UL,
+					      0x4338000000000000UL);
+  vb64_t sub;
+  vui64_t ix, tmp;
+  vi64_t k;
+  vf64_t ka;
+
+  sub = vec_cmplt (x, tiny);
+  x = vec_sel (x, vec_mul (x, two54), sub);
+  ka = vec_sel (zero, m54, sub);
+  ix = (vui64_t) x;
+  // Offset so the exponent of tmp is k, and z in [sqrt(1/2), sqrt(2)).
+  tmp = vec_subudm (ix, sqrth);
+  k = vec_sradi ((vi64_t) tmp, 52);
+  ix = vec_subudm (ix, vec_and (tmp, expmask));
+  // Convert k to double (exact) with the 1.5*2**52 shifter.
+  *kd = vec_add (vec_sub ((vf64_t) vec_addudm ((vui64_t) k, shiftbits),
+			  shift), ka);
+  return (vf64_t) ix;
+}
+
+/** \brief Merge the C99 special values of log(x) into result.
+ *
+ *  +Inf and NaN return x, x < 0 (and -Inf) NaN, +-0.0 -Inf.  */
+static inline vf64_t
+vec_logf64_special (vf64_t x, vf64_t result)
+{
+  const vf64_t zero = vec_splats (0.0);
+  const vf64_t inf = vec_splats (__builtin_inf ());
+  const vf64_t nan = vec_splats (__builtin_nan (""));
+
+  result = vec_sel (result, vec_add (x, x), vec_isnanf64 (x));
+  result = vec_sel (result, x, vec_cmpeq (x, inf));
+  result = vec_sel (result, nan, vec_cmplt (x, zero));
+  result = vec_sel (result, vec_sub (zero, inf), vec_cmpeq (x, zero));
+  return result;
+}
+
+/** \brief Return the double-double a * b + c, setting *rl to the low
+ *  part. The product of the low parts is dropped.  */
+static inline vf64_t
+vec_polyf64_dd_madd (vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl,
+		     vf64_t ch, vf64_t cl, vf64_t *rl)
+{
+  vf64_t ph, pl, sh, v, e, rh;
+
+  ph = vec_mul (ah, bh);
+  pl = vec_msub (ah, bh, ph);
+  pl = vec_madd (ah, bl, pl);
+  pl = vec_madd (al, bh, pl);
+  // Two-sum of the high parts, then add the low parts.
+  sh = vec_add (ph, ch);
+  v = vec_sub (sh, ph);
+  e = vec_add (vec_sub (ph, vec_sub (sh, v)), vec_sub (ch, v));
+  e = vec_add (e, vec_add (pl, cl));
+  rh = vec_add (sh, e);
+  *rl = vec_sub (e, vec_sub (rh, sh));
+  return rh;
+}
+
+/** \brief Return the double-double a * b, setting *rl to the low
+ *  part. The product of the low parts is dropped.  */
+static inline vf64_t
+vec_polyf64_dd_mul (vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl,
+		    vf64_t *rl)
+{
+  vf64_t ph, pl, rh;
+
+  ph = vec_mul (ah, bh);
+  pl = vec_msub (ah, bh, ph);
+  pl = vec_madd (ah, bl, pl);
+  pl = vec_madd (al, bh, pl);
+  rh = vec_add (ph, pl);
+  *rl = vec_sub (pl, vec_sub (rh, ph));
+  return rh;
+}
+
+/** \brief Horner's rule in double-double for the double-double
+ *  xh + xl.  */
+static inline vf64_t
+vec_polyf64_dd_horner (vf64_t xh, vf64_t xl, const double *c,
+		       unsigned long deg, vf64_t *pl)
+{
+  vf64_t rh, rl;
+  unsigned long i;
+
+  rh = vec_splats (c[2 * deg]);
+  rl = vec_splats (c[2 * deg + 1]);
+  for (i = deg; i > 0; i--)
+    rh = vec_polyf64_dd_madd (rh, rl, xh, xl, vec_splats (c[2 * i - 2]),
+			      vec_splats (c[2 * i - 1]), &rl);
+  *pl = rl;
+  return rh;
+}
+
+/** \brief Estrin's scheme in double-double for the 8 coefficients
+ *  c[0..15], given x, x**2 and x**4.  */
+static inline vf64_t
+vec_polyf64_dd_estrin8 (vf64_t x, vf64_t x2h, vf64_t x2l, vf64_t x4h,
+			vf64_t x4l, const double *c, vf64_t *pl)
+{
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t p0h, p0l, p1h, p1l, p2h, p2l, p3h, p3l;
+
+  p0h = vec_polyf64_dd_madd (vec_splats (c[2]), vec_splats (c[3]), x, zero,
+			     vec_splats (c[0]), vec_splats (c[1]), &p0l);
+  p1h = vec_polyf64_dd_madd (vec_splats (c[6]), vec_splats (c[7]), x, zero,
+			     vec_splats (c[4]), vec_splats (c[5]), &p1l);
+  p2h = vec_polyf64_dd_madd (vec_splats (c[10]), vec_splats (c[11]), x,
+			     zero, vec_splats (c[8]), vec_splats (c[9]),
+			     &p2l);
+  p3h = vec_polyf64_dd_madd (vec_splats (c[14]), vec_splats (c[15]), x,
+			     zero, vec_splats (c[12]), vec_splats (c[13]),
+			     &p3l);
+  p0h = vec_polyf64_dd_madd (p1h, p1l, x2h, x2l, p0h, p0l, &p0l);
+  p2h = vec_polyf64_dd_madd (p3h, p3l, x2h, x2l, p2h, p2l, &p2l);
+  return vec_polyf64_dd_madd (p2h, p2l, x4h, x4l, p0h, p0l, pl);
+}
+
+/** \brief Blocks of 8 coefficients by Estrin's scheme, combined by
+ *  Horner's rule in x**8, all in double-double. The top (deg+1)%8
+ *  coefficients are a Horner's rule block.  */
+static inline vf64_t
+vec_polyf64_dd_estrin (vf64_t x, const double *c, unsigned long deg,
+		       vf64_t *pl)
+{
+  vf64_t x2h, x2l, x4h, x4l, x8h, x8l, rh, rl, eh, el;
+  unsigned long nb, top;
+
+  // x**2 is exact as a double-double.
+  x2h = vec_mul (x, x);
+  x2l = vec_msub (x, x, x2h);
+  x4h = vec_polyf64_dd_mul (x2h, x2l, x2h, x2l, &x4l);
+  x8h = vec_polyf64_dd_mul (x4h, x4l, x4h, x4l, &x8l);
+  nb = (deg + 1) / 8;
+  top = (deg + 1) % 8;
+  if (top)
+    rh = vec_polyf64_dd_horner (x, vec_splats (0.0), &c[16 * nb], top - 1,
+				&rl);
+  else
+    {
+      nb = nb - 1;
+      rh = vec_polyf64_dd_estrin8 (x, x2h, x2l, x4h, x4l, &c[16 * nb], &rl);
+    }
+  for (; nb > 0; nb--)
+    {
+      eh = vec_polyf64_dd_estrin8 (x, x2h, x2l, x4h, x4l,
+				   &c[16 * (nb - 1)], &el);
+      rh = vec_polyf64_dd_madd (rh, rl, x8h, x8l, eh, el, &rl);
+    }
+  *pl = rl;
+  return rh;
+}
+
+/** \brief Estrin's scheme for the 8 coefficients c[0..7], given x,
+ *  x**2 and x**4.  */
+static inline vf64_t
+vec_polyf64_estrin8 (vf64_t x, vf64_t x2, vf64_t x4, const double *c)
+{
+  vf64_t p0, p1, p2, p3;
+
+  p0 = vec_madd (vec_splats (c[1]), x, vec_splats (c[0]));
+  p1 = vec_madd (vec_splats (c[3]), x, vec_splats (c[2]));
+  p2 = vec_madd (vec_splats (c[5]), x, vec_splats (c[4]));
+  p3 = vec_madd (vec_splats (c[7]), x, vec_splats (c[6]));
+  p0 = vec_madd (p1, x2, p0);
+  p2 = vec_madd (p3, x2, p2);
+  return vec_madd (p2, x4, p0);
+}
+
+/** \brief Blocks of 8 coefficients by Estrin's scheme, combined by
+ *  Horner's rule in x**8. The top (deg+1)%8 coefficients are a
+ *  Horner's rule block.  */
+static inline vf64_t
+vec_polyf64_estrin (vf64_t x, const double *c, unsigned long deg)
+{
+  vf64_t x2, x4, x8, result;
+  unsigned long nb, top;
+
+  x2 = vec_mul (x, x);
+  x4 = vec_mul (x2, x2);
+  x8 = vec_mul (x4, x4);
+  nb = (deg + 1) / 8;
+  top = (deg + 1) % 8;
+  if (top)
+    result = vec_polyf64_horner (x, &c[8 * nb], top - 1);
+  else
+    {
+      nb = nb - 1;
+      result = vec_polyf64_estrin8 (x, x2, x4, &c[8 * nb]);
+    }
+  for (; nb > 0; nb--)
+    result = vec_madd (result, x8,
+		       vec_polyf64_estrin8 (x, x2, x4, &c[8 * (nb - 1)]));
+  return result;
+}
+
+/** \brief Horner's rule for the coefficients c[0..deg].  */
+static inline vf64_t
+vec_polyf64_horner (vf64_t x, const double *c, unsigned long deg)
+{
+  vf64_t result;
+  unsigned long i;
+
+  result = vec_splats (c[deg]);
+  for (i = deg; i > 0; i--)
+    result = vec_madd (result, x, vec_splats (c[i - 1]));
+  return result;
+}
+
+/** \brief Payne-Hanek reduction of finite |x| >= 2**30.
+ *
+ *  Returns the quadrant q + round(x * 2/pi) (mod 4) and sets *y0 + *y1
+ *  to x - round(x * 2/pi) * pi/2, |*y0| <= pi/4.  */
+static inline vui64_t
+vec_sinf64_reduce_large (vf64_t x, vui64_t q, vf64_t *y0, vf64_t *y1)
+{
+  // The bits of 2/pi as 24-bit chunks, 2/pi = sum c[i] * 2**(-24*(i+1)).
+  static const double pio2_tab[48] =
+    {
+      10680707.0, 7228996.0, 1387004.0, 2578385.0, 16069853.0, 12639074.0,
+      9804092.0, 4427841.0, 16666979.0, 11263675.0, 12935607.0, 2387514.0,
+      4345298.0, 14681673.0, 3074569.0, 13734428.0, 16653803.0, 1880361.0,
+      10960616.0, 8533493.0, 3062596.0, 8710556.0, 7349940.0, 6258241.0,
+      3772886.0, 3769171.0, 3798172.0, 8675211.0, 12450088.0, 3874808.0,
+      9961438.0, 366607.0, 15675153.0, 9132554.0, 7151469.0, 3571407.0,
+      2607881.0, 12013382.0, 4155038.0, 6285869.0, 7677882.0, 13102053.0,
+      15825725.0, 473591.0, 9065106.0, 15363067.0, 6271263.0, 9264392.0
+    };
+  const vf64_t shift = vec_splats (0x1.8p52);
+  const vf64_t big = vec_splats (0x1p30);
+  const vf64_t c24 = vec_splats (0x1p24);
+  const vf64_t c48 = vec_splats (0x1p-48);
+  const vf64_t c96 = vec_splats (0x1p-96);
+  const vf64_t c144 = vec_splats (0x1p-144);
+  const vf64_t c192 = vec_splats (0x1p-192);
+  const vf64_t m24 = vec_splats (-24.0);
+  const vf64_t r24 = vec_splats (1.0 / 24.0);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t quarter = vec_splats (0.25);
+  const vf64_t four = vec_splats (4.0);
+  const vf64_t zero = vec_splats (0.0);
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t pio2h = vec_splats (0x1.921fb54442d18p+0);
+  const vf64_t pio2l = vec_splats (0x1.1a62633145c07p-54);
+  const vui64_t expmask = CONST_VINT128_DW (0x7ff0000000000000UL,
+					    0x7ff0000000000000UL);
+  const vui64_t shiftbits = CONST_VINT128_DW (0x4338000000000000UL,
+					      0x4338000000000000UL);
+  const vui64_t e54 = CONST_VINT128_DW (1023 + 54, 1023 + 54);
+  const vui64_t bias = CONST_VINT128_DW (1023, 1023);
+  vui64_t ex;
+  vi64_t ix;
+  vf64_t ax, sg, jd, xs, d1, d2, d3, d4, t[7], sh, sl, s, e, k, kn;
+  int i;
+
+  // Only finite |x| >= 2**30 are reduced here, others use 2**30.
+  ax = vec_absf64 (x);
+  ax = vec_sel (big, ax, vec_and (vec_cmpge (ax, big), vec_isfinitef64 (x)));
+  // j = (e - 54) / 24 for the unbiased exponent e >= 54, else 0. The
+  // chunks before j only add multiples of 4 to x * 2/pi, so
+  // x * 2/pi == xs * (sum c[j+i] * 2**(-24*(i+1))) (mod 4), with
+  // xs = x * 2**(-24*j) < 2**78.
+  ex = vec_srdi (vec_and ((vui64_t) ax, expmask), 52);
+  ex = vec_sel (e54, ex, vec_cmpgtud (ex, e54));
+  jd = vec_sub ((vf64_t) vec_addudm (vec_subudm (ex, e54), shiftbits),
+		shift);
+  jd = vec_trunc (vec_mul (vec_add (jd, half), r24));
+  xs = (vf64_t) vec_sldi (vec_addudm ((vui64_t) vec_madd (jd, m24, shift),
+				      bias), 52);
+  xs = vec_mul (ax, xs);
+  ix = (vi64_t) vec_subudm ((vui64_t) vec_add (jd, shift), shiftbits);
+  // 4 48-bit pieces of 2/pi from 8 chunks starting at j.
+  d1 = vec_madd (vec_vglfddx ((double *) &pio2_tab[0], ix), c24,
+		 vec_vglfddx ((double *) &pio2_tab[1], ix));
+  d2 = vec_madd (vec_vglfddx ((double *) &pio2_tab[2], ix), c24,
+		 vec_vglfddx ((double *) &pio2_tab[3], ix));
+  d3 = vec_madd (vec_vglfddx ((double *) &pio2_tab[4], ix), c24,
+		 vec_vglfddx ((double *) &pio2_tab[5], ix));
+  d4 = vec_madd (vec_vglfddx ((double *) &pio2_tab[6], ix), c24,
+		 vec_vglfddx ((double *) &pio2_tab[7], ix));
+  d1 = vec_mul (d1, c48);
+  d2 = vec_mul (d2, c96);
+  d3 = vec_mul (d3, c144);
+  d4 = vec_mul (d4, c192);
+  // The exact products, in decreasing order of magnitude. The
+  // leading terms are reduced mod 4.
+  t[0] = vec_mul (xs, d1);
+  t[1] = vec_msub (xs, d1, t[0]);
+  t[2] = vec_mul (xs, d2);
+  t[3] = vec_msub (xs, d2, t[2]);
+  t[4] = vec_mul (xs, d3);
+  t[5] = vec_msub (xs, d3, t[4]);
+  t[6] = vec_mul (xs, d4);
+  for (i = 0; i < 3; i++)
+    t[i] = vec_nmsub (vec_trunc (vec_mul (t[i], quarter)), four, t[i]);
+  // Sum as the double-double sh + sl, removing the nearest integer
+  // (counted in kn) after each step. All terms up to t[4] lie on a
+  // common grid that spans less than 106 bits, so these sums are
+  // exact. The later terms are small enough for the double-double
+  // rounding.
+  sh = t[0];
+  sl = zero;
+  kn = zero;
+  for (i = 1; i < 7; i++)
+    {
+      s = vec_add (sh, t[i]);
+      e = vec_sub (s, sh);
+      e = vec_add (vec_sub (sh, vec_sub (s, e)), vec_sub (t[i], e));
+      e = vec_add (e, sl);
+      k = vec_sub (vec_add (s, shift), shift);
+      kn = vec_add (kn, k);
+      s = vec_sub (s, k);
+      sh = vec_add (s, e);
+      sl = vec_sub (e, vec_sub (sh, s));
+    }
+  k = vec_sub (vec_add (sh, shift), shift);
+  kn = vec_add (kn, k);
+  sh = vec_sub (sh, k);
+  s = vec_add (sh, sl);
+  sl = vec_sub (sl, vec_sub (s, sh));
+  sh = s;
+  // y0 + y1 = (sh + sl) * pi/2 and the quadrant, with the sign of x.
+  sg = vec_copysignf64 (x, one);
+  s = vec_mul (sh, pio2h);
+  e = vec_madd (sh, pio2l, vec_msub (sh, pio2h, s));
+  e = vec_madd (sl, pio2h, e);
+  sh = vec_add (s, e);
+  *y0 = vec_mul (sh, sg);
+  *y1 = vec_mul (vec_sub (e, vec_sub (sh, s)), sg);
+  kn = vec_mul (kn, sg);
+  return vec_addudm ((vui64_t) vec_add (kn, shift), q);
+}
+
+/** \brief sin(x + q * pi/2) for finite x.
+ *  Shared by vec_sinf64() and vec_cosf64().  */
+static inline vf64_t
+vec_sinf64_quadrant (vf64_t x, vui64_t q)
+{
+  const vf64_t twobypi = vec_splats (0x1.45f306dc9c883p-1);
+  const vf64_t pio2_1 = vec_splats (0x1.921fb54442d18p+0);
+  const vf64_t pio2_2 = vec_splats (0x1.1a62633145c07p-54);
+  const vf64_t pio2_3 = vec_splats (-0x1.f1976b7ed8fbcp-110);
+  const vf64_t shift = vec_splats (0x1.8p52);
+  const vf64_t big = vec_splats (0x1p30);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t one = vec_splats (1.0);
+  const vui64_t q1 = CONST_VINT128_DW (1, 1);
+  const vui64_t q2 = CONST_VINT128_DW (2, 2);
+  vf64_t t, kd, a, bh, bl, c, r, bb, e, y0, y1, z, v, p, ks, kc, hz, w;
+  vf64_t ly0, ly1;
+  vui64_t n, ln;
+  vb64_t odd, large;
+
+  // Nearest kd = x * 2/pi and the quadrant n = kd + q (mod 4).
+  t = vec_madd (x, twobypi, shift);
+  kd = vec_sub (t, shift);
+  n = vec_addudm ((vui64_t) t, q);
+  // y0 + y1 = x - kd * pi/2, with pi/2 in 3 parts. The first
+  // difference is exact, the second product is split exactly.
+  a = vec_nmsub (kd, pio2_1, x);
+  bh = vec_mul (kd, pio2_2);
+  bl = vec_msub (kd, pio2_2, bh);
+  c = vec_mul (kd, pio2_3);
+  r = vec_sub (a, bh);
+  bb = vec_sub (r, a);
+  e = vec_sub (vec_sub (a, vec_sub (r, bb)), vec_add (bh, bb));
+  e = vec_sub (e, vec_add (bl, c));
+  y0 = vec_add (r, e);
+  y1 = vec_sub (e, vec_sub (y0, r));
+  // Larger arguments need more bits of pi/2.
+  large = vec_cmpge (vec_absf64 (x), big);
+  if (vec_any_ge (vec_absf64 (x), big))
+    {
+      ln = vec_sinf64_reduce_large (x, q, &ly0, &ly1);
+      y0 = vec_sel (y0, ly0, large);
+      y1 = vec_sel (y1, ly1, large);
+      n = vec_sel (n, ln, large);
+    }
+  // The fdlibm __kernel_sin and __kernel_cos over |y0| <= pi/4.
+  z = vec_mul (y0, y0);
+  v = vec_mul (z, y0);
+  p = vec_madd (z, vec_splats (0x1.5d93a5acfd57cp-33),
+		vec_splats (-0x1.ae5e68a2b9cebp-26));
+  p = vec_madd (z, p, vec_splats (0x1.71de357b1fe7dp-19));
+  p = vec_madd (z, p, vec_splats (-0x1.a01a019c161d5p-13));
+  p = vec_madd (z, p, vec_splats (0x1.111111110f8a6p-7));
+  // y0 - ((z*(y1/2 - v*p) - y1) - v*S1)
+  ks = vec_msub (z, vec_nmsub (v, p, vec_mul (half, y1)), y1);
+  ks = vec_nmsub (v, vec_splats (-0x1.5555555555549p-3), ks);
+  ks = vec_sub (y0, ks);
+  p = vec_madd (z, vec_splats (-0x1.8fae9be8838d4p-37),
+		vec_splats (0x1.1ee9ebdb4b1c4p-29));
+  p = vec_madd (z, p, vec_splats (-0x1.27e4f809c52adp-22));
+  p = vec_madd (z, p, vec_splats (0x1.a01a019cb1590p-16));
+  p = vec_madd (z, p, vec_splats (-0x1.6c16c16c15177p-10));
+  p = vec_madd (z, p, vec_splats (0x1.555555555554cp-5));
+  p = vec_mul (z, p);
+  // w + (((1-w)-hz) + (z*p - y0*y1))
+  hz = vec_mul (half, z);
+  w = vec_sub (one, hz);
+  kc = vec_msub (z, p, vec_mul (y0, y1));
+  kc = vec_add (vec_sub (vec_sub (one, w), hz), kc);
+  kc = vec_add (w, kc);
+  // Odd quadrants use the cosine, quadrants 2 and 3 negate.
+  odd = vec_cmpequd (vec_and (n, q1), q1);
+  r = vec_sel (ks, kc, odd);
+  return (vf64_t) vec_xor ((vui64_t) r, vec_sldi (vec_and (n, q2), 62));
+}
+///@endcond
+
+/** \name Elementary function arrays
+ *
+ *  Apply the elementary functions to arrays of doubles. The arrays
+ *  have no alignment requirement and r may equal a. See
+ *  \ref f64_math_0_0.
+ */
+///@{
+/** \brief Compute r[i] = cos(a[i]) for an array of doubles.
+ *
+ *  As vec_cosf64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_cosf64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = erf(a[i]) for an array of doubles.
+ *
+ *  As vec_erff64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_erff64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = 2**a[i] for an array of doubles.
+ *
+ *  As vec_exp2f64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_exp2f64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = exp(a[i]) for an array of doubles.
+ *
+ *  As vec_expf64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_expf64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = log2(a[i]) for an array of doubles.
+ *
+ *  As vec_log2f64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_log2f64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = log(a[i]) for an array of doubles.
+ *
+ *  As vec_logf64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_logf64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = sin(a[i]) for an array of doubles.
+ *
+ *  As vec_sinf64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_sinf64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = tanh(a[i]) for an array of doubles.
+ *
+ *  As vec_tanhf64().
+ *
+ *  @param r pointer to the double results.
+ *  @param a pointer to the double values.
+ *  @param n number of elements.
+ */
+extern void
+vec_tanhf64_array (double *r, const double *a, unsigned long n);
+
+/** \brief Compute r[i] = x[i]**y[i] for arrays of doubles.
+ *
+ *  As vec_powf64().
+ *
+ *  @param r pointer to the double results.
+ *  @param x pointer to the double bases.
+ *  @param y pointer to the double exponents.
+ *  @param n number of elements.
+ */
+extern void
+vec_powf64_array (double *r, const double *x, const double *y,
+		  unsigned long n);
+///@}
+
+/** \name Polynomial arrays
+ *
+ *  Evaluate one polynomial over arrays of doubles. The arrays have
+ *  no alignment requirement. See \ref f64_poly_0_0.
+ */
+///@{
+/** \brief Compute r[i] = c[0] + c[1]*x[i] + ... + c[deg]*x[i]**deg
+ *  for an array of doubles.
+ *
+ *  As vec_polyf64(). r may equal x.
+ *
+ *  @param r pointer to the double results.
+ *  @param x pointer to the double values.
+ *  @param c pointer to the deg+1 double coefficients.
+ *  @param deg degree of the polynomial.
+ *  @param n number of elements.
+ */
+extern void
+vec_polyf64_array (double *r, const double *x, const double *c,
+		   unsigned long deg, unsigned long n);
+
+/** \brief Compute the double-double r[i] = c[0] + c[1]*x[i] + ... +
+ *  c[deg]*x[i]**deg for an array of doubles.
+ *
+ *  As vec_polyf64_dd(). The results are stored as pairs of doubles
+ *  (high part first, 2*n doubles), the layout of IBM long double.
+ *  r must not overlap x.
+ *
+ *  @param r pointer to the double-double results.
+ *  @param x pointer to the double values.
+ *  @param c pointer to the deg+1 double-double coefficients.
+ *  @param deg degree of the polynomial.
+ *  @param n number of elements.
+ */
+extern void
+vec_polyf64_dd_array (double *r, const double *x, const double *c,
+		      unsigned long deg, unsigned long n);
+///@}
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_cosf64_array) (double *r, const double *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_erff64_array) (double *r, const double *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_exp2f64_array) (double *r, const double *a,
+				   unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_expf64_array) (double *r, const double *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_log2f64_array) (double *r, const double *a,
+				   unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_logf64_array) (double *r, const double *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_sinf64_array) (double *r, const double *a,
+				  unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_tanhf64_array) (double *r, const double *a,
+				   unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_powf64_array) (double *r, const double *x,
+				  const double *y, unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_polyf64_array) (double *r, const double *x,
+				   const double *c, unsigned long deg,
+				   unsigned long n);
+
+extern void
+__VEC_PWR_IMP (vec_polyf64_dd_array) (double *r, const double *x,
+				      const double *c, unsigned long deg,
+				      unsigned long n);
+///@endcond
+
 #endif /* VEC_F64_PPC_H_ */
@@ -2426,6 +2426,32 @@ example_longdiv_10e31 (vui128_t *q, vui128_t *d, long int _N)
     (((unsigned __int128) __q0) * 10000000000000000UL) \
     + ((unsigned __int128) __q1) )
 
+/** \brief Rounding modes for the quotient of a division by a power
+ *  of ten.
+ *
+ *  Used by vec_div10k_rnd_uq(), vec_div10k_rnd_sq(), vec_div10k_byN()
+ *  and the rescale operations of vec_int512_ppc.h and
+ *  vec_bcd_ppc.h. For unsigned operands VEC_ROUND_FLOOR is
+ *  VEC_ROUND_TRUNC and VEC_ROUND_CEIL is VEC_ROUND_UP. The difference
+ *  matters for signed operands, where TRUNC and UP are toward/away
+ *  from zero.
+ */
+typedef enum
+{
+  /*! \brief Truncate (toward zero).  */
+  VEC_ROUND_TRUNC = 0,
+  /*! \brief Nearest, ties away from zero.  */
+  VEC_ROUND_HALF_UP = 1,
+  /*! \brief Nearest, ties to even.  */
+  VEC_ROUND_HALF_EVEN = 2,
+  /*! \brief Away from zero.  */
+  VEC_ROUND_UP = 3,
+  /*! \brief Toward negative infinity.  */
+  VEC_ROUND_FLOOR = 4,
+  /*! \brief Toward positive infinity.  */
+  VEC_ROUND_CEIL = 5
+} vec_round_t;
+
 ///@cond INTERNAL
 static inline vui128_t vec_addecuq (vui128_t a, vui128_t b, vui128_t ci);
 static inline vui128_t vec_addeuqm (vui128_t a, vui128_t b, vui128_t ci);
@@ -2435,10 +2461,15 @@ static inline vb128_t vec_cmpgtuq (vui128_t vra, vui128_t vrb);
 static inline vb128_t vec_cmpleuq (vui128_t vra, vui128_t vrb);
 static inline vb128_t vec_cmpltuq (vui128_t vra, vui128_t vrb);
 static inline vb128_t vec_cmpneuq (vui128_t vra, vui128_t vrb);
+static inline vui128_t vec_div10k_rnd_uq (vui128_t vra, unsigned int k,
+					  vec_round_t rnd);
+static inline vui128_t vec_div10k_uq (vui128_t vra, unsigned int k);
 static inline vui128_t vec_divuq_10e31 (vui128_t vra);
 static inline vui128_t vec_divuq_10e32 (vui128_t vra);
 static inline vui128_t vec_maxuq (vui128_t a, vui128_t b);
 static inline vui128_t vec_minuq (vui128_t a, vui128_t b);
+static inline vui128_t vec_mod10k_uq (vui128_t vra, vui128_t q,
+				      unsigned int k);
 static inline vui128_t vec_moduq_10e31 (vui128_t vra, vui128_t q);
 static inline vui128_t vec_moduq_10e32 (vui128_t vra, vui128_t q);
 static inline vui128_t vec_muleud (vui64_t a, vui64_t b);
@@ -2448,6 +2479,8 @@ static inline vui128_t vec_muloud (vui64_t a, vui64_t b);
 static inline vui128_t vec_muludq (vui128_t *mulu, vui128_t a, vui128_t b);
 static inline vi128_t vec_negsq (vi128_t int128);
 static inline vui128_t vec_popcntq (vui128_t vra);
+static inline int vec_rnd10k_uq (vui128_t q, vui128_t r, unsigned int k,
+				 vec_round_t rnd);
 static inline vb128_t vec_setb_cyq (vui128_t vcy);
 static inline vb128_t vec_setb_ncq (vui128_t vcy);
 static inline vb128_t vec_setb_sq (vi128_t vra);
@@ -2456,6 +2489,7 @@ static inline vui128_t vec_sldq (vui128_t vrw, vui128_t vrx,
 				 vui128_t vrb);
 static inline vui128_t vec_sldqi (vui128_t vrw, vui128_t vrx,
 				  const unsigned int shb);
+static inline vui128_t vec_srq (vui128_t vra, vui128_t vrb);
 static inline vui128_t vec_srqi (vui128_t vra, const unsigned int shb);
 static inline vui128_t vec_subcuq (vui128_t vra, vui128_t vrb);
 static inline vui128_t vec_subeuqm (vui128_t vra, vui128_t vrb, vui128_t vrc);
@@ -4171,6 +4205,155 @@ vec_cmul10cuq (vui128_t *cout, vui128_t a)
   return ((vui128_t) t);
 }
 
+/** \brief Vector combined Multiply by 10**k & write Carry Unsigned
+ *  Quadword.
+ *
+ *  Compute the 256-bit product of the 128-bit value vra * 10**k,
+ *  for k in the range 0-38. The low order 128 bits of the product
+ *  are returned and the high order 128 bits are stored to *cout.
+ *  The high 128 bits are less than 10**k.
+ *
+ *  One vec_muludq() by vtipowof10[k] replaces k steps of
+ *  vec_cmul10ecuq().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 54-60 | 1/cycle  |
+ *  |power9   | 26-32 | 1/cycle  |
+ *
+ *  @param *cout pointer to upper 128-bits of the product.
+ *  @param vra 128-bit vector treated as a unsigned __int128.
+ *  @param k the power of ten in the range 0-38.
+ *  @return vector __int128 (lower 128-bits of the 256-bit product)
+ *  vra * 10**k.
+ */
+static inline vui128_t
+vec_cmul10k_cuq (vui128_t *cout, vui128_t vra, unsigned int k)
+{
+  return vec_muludq (cout, vra, vtipowof10[k]);
+}
+
+/** \brief Vector Divide by 10**k and Round Signed Quadword.
+ *
+ *  Compute the quotient vra / 10**k rounded as specified by rnd,
+ *  for signed vra. This is the fixed-point rescale of a value
+ *  with an implied decimal scale, for example cents to dollars.
+ *
+ *  The magnitude is divided by vec_div10k_rnd_uq() and the sign
+ *  restored. VEC_ROUND_FLOOR and VEC_ROUND_CEIL are mapped to
+ *  VEC_ROUND_TRUNC or VEC_ROUND_UP by the sign of vra. The
+ *  magnitude of the most negative value (2**127) is correct as an
+ *  unsigned quadword, so there is no overflow for k > 0.
+ *
+ *  |processor|Latency |Throughput|
+ *  |--------:|:------:|:---------|
+ *  |power8   |130-150 | 1/cycle  |
+ *  |power9   | 80-95  | 1/cycle  |
+ *
+ *  @param vra the dividend as a vector treated as a signed __int128.
+ *  @param k the power of ten.
+ *  @param rnd the rounding mode.
+ *  @return the rounded quotient as vector signed __int128.
+ */
+static inline vi128_t
+vec_div10k_rnd_sq (vi128_t vra, unsigned int k, vec_round_t rnd)
+{
+  const vi128_t zero = (vi128_t) { (__int128) 0 };
+  vui128_t q;
+  int neg;
+
+  neg = vec_cmpsq_all_lt (vra, zero);
+  if (rnd == VEC_ROUND_FLOOR)
+    rnd = neg ? VEC_ROUND_UP : VEC_ROUND_TRUNC;
+  else if (rnd == VEC_ROUND_CEIL)
+    rnd = neg ? VEC_ROUND_TRUNC : VEC_ROUND_UP;
+
+  q = vec_div10k_rnd_uq ((vui128_t) vec_abssq (vra), k, rnd);
+  if (neg)
+    return vec_negsq ((vi128_t) q);
+  else
+    return (vi128_t) q;
+}
+
+/** \brief Vector Divide by 10**k and Round Unsigned Quadword.
+ *
+ *  Compute the quotient vra / 10**k rounded as specified by rnd.
+ *  For k greater than 38 the truncated quotient is 0 and the
+ *  remainder is vra.
+ *
+ *  The rounding increment is decided by vec_rnd10k_uq() from the
+ *  truncated quotient (vec_div10k_uq()) and remainder
+ *  (vec_mod10k_uq()). The rounded quotient can not overflow for
+ *  k > 0.
+ *
+ *  |processor|Latency |Throughput|
+ *  |--------:|:------:|:---------|
+ *  |power8   |120-140 | 1/cycle  |
+ *  |power9   | 70-85  | 1/cycle  |
+ *
+ *  @param vra the dividend as a vector treated as a unsigned __int128.
+ *  @param k the power of ten.
+ *  @param rnd the rounding mode.
+ *  @return the rounded quotient as vector unsigned __int128.
+ */
+static inline vui128_t
+vec_div10k_rnd_uq (vui128_t vra, unsigned int k, vec_round_t rnd)
+{
+  const vui128_t one = (vui128_t) CONST_VINT128_W (0, 0, 0, 1);
+  vui128_t q, r;
+
+  q = vec_div10k_uq (vra, k);
+  r = vec_mod10k_uq (vra, q, k);
+  if (vec_rnd10k_uq (q, r, k, rnd))
+    q = vec_adduqm (q, one);
+
+  return q;
+}
+
+/** \brief Vector Divide by 10**k Unsigned Quadword.
+ *
+ *  Compute the quotient of a 128 bit value vra / 10**k, truncated.
+ *  For k greater than 38 the quotient is 0.
+ *
+ *  This uses the multiplicative inverse of 10**k from the table
+ *  vec128_recipof10[] (libpvec, generated by gen_powof10_512.c).
+ *  The factor 2**k of 10**k is shifted out first, so a 128-bit
+ *  multiplier is exact for all vra:
+ *
+ *  vra / 10**k = ((vra >> k) * vec128_recipof10[k]) >> (128 + vec_recipof10_sh[k])
+ *
+ *  That is two shifts and one vec_mulhuq(), independent of k.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 66-74 | 1/cycle  |
+ *  |power9   | 47-53 | 1/cycle  |
+ *
+ *  @param vra the dividend as a vector treated as a unsigned __int128.
+ *  @param k the power of ten.
+ *  @return the quotient as vector unsigned __int128.
+ */
+static inline vui128_t
+vec_div10k_uq (vui128_t vra, unsigned int k)
+{
+  vui128_t result, t, vk, vsh;
+
+  if (k == 0)
+    result = vra;
+  else if (k <= 38)
+    {
+      vk = (vui128_t) vec_splats ((unsigned char) k);
+      vsh = (vui128_t) vec_splats ((unsigned char) vec_recipof10_sh[k]);
+      t = vec_srq (vra, vk);
+      t = vec_mulhuq (t, vec128_recipof10[k]);
+      result = vec_srq (t, vsh);
+    }
+  else
+    result = (vui128_t) { (__int128) 0 };
+
+  return result;
+}
+
 /** \brief Vector Divide by const 10e31 Signed Quadword.
  *
  *  Compute the quotient of a 128 bit values vra / 10e31.
@@ -4561,6 +4744,38 @@ vec_minuq(vui128_t vra, vui128_t vrb)
   return (vui128_t) vec_sel ((vui32_t) vrb, (vui32_t) vra, minmask);
 }
 
+/** \brief Vector Modulo by 10**k Unsigned Quadword.
+ *
+ *  Compute the remainder of a 128 bit value vra % 10**k, given the
+ *  quotient q from vec_div10k_uq(). For k greater than 38 the
+ *  remainder is vra.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 46-52 | 1/cycle  |
+ *  |power9   | 19-23 | 2/cycle  |
+ *
+ *  @param vra the dividend as a vector treated as a unsigned __int128.
+ *  @param q the quotient vra / 10**k from vec_div10k_uq().
+ *  @param k the power of ten.
+ *  @return the remainder as vector unsigned __int128.
+ */
+static inline vui128_t
+vec_mod10k_uq (vui128_t vra, vui128_t q, unsigned int k)
+{
+  vui128_t result, t;
+
+  if (k <= 38)
+    {
+      t = vec_mulluq (q, vtipowof10[k]);
+      result = vec_subuqm (vra, t);
+    }
+  else
+    result = vra;
+
+  return result;
+}
+
 /** \brief Vector Modulo by const 10e31 Signed Quadword.
  *
  *  Compute the remainder of a 128 bit values vra % 10e31.
@@ -4988,6 +5203,30 @@ vec_mul10uq (vui128_t a)
   return ((vui128_t) t);
 }
 
+/** \brief Vector Multiply by 10**k Unsigned Quadword.
+ *
+ *  Compute the product of a 128 bit value vra * 10**k, for k in
+ *  the range 0-38. Only the low order 128 bits of the product are
+ *  returned. See vec_cmul10k_cuq() for the high order bits.
+ *
+ *  One vec_mulluq() by vtipowof10[k] replaces k steps of
+ *  vec_mul10uq().
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 44-50 | 1/cycle  |
+ *  |power9   | 18-22 | 2/cycle  |
+ *
+ *  @param vra 128-bit vector treated as a unsigned __int128.
+ *  @param k the power of ten in the range 0-38.
+ *  @return __int128 (lower 128-bits of the 256-bit product) vra * 10**k.
+ */
+static inline vui128_t
+vec_mul10k_uq (vui128_t vra, unsigned int k)
+{
+  return vec_mulluq (vra, vtipowof10[k]);
+}
+
 /** \brief Vector combined Multiply by 100 & write Carry Unsigned Quadword.
  *
  *  compute the product of a 128 bit values a * 100.
@@ -6444,6 +6683,61 @@ vec_rlqi (vui128_t vra, const unsigned int shb)
   return ((vui128_t) result);
 }
 
+/** \brief Round the quotient of a division by 10**k, Unsigned
+ *  Quadword.
+ *
+ *  Given the truncated quotient q and remainder r of vra / 10**k
+ *  (vec_div10k_uq() and vec_mod10k_uq()), return 1 if q must be
+ *  incremented to round as specified by rnd, otherwise 0.
+ *
+ *  The half way test compares 2 * r with 10**k, so no half-ulp
+ *  constant is needed. For k > 38, 10**k exceeds 2 * r for any
+ *  128-bit r and only VEC_ROUND_UP/VEC_ROUND_CEIL can round.
+ *
+ *  @param q the truncated quotient.
+ *  @param r the remainder.
+ *  @param k the power of ten.
+ *  @param rnd the rounding mode.
+ *  @return 1 if the quotient rounds up, otherwise 0.
+ */
+static inline int
+vec_rnd10k_uq (vui128_t q, vui128_t r, unsigned int k, vec_round_t rnd)
+{
+  const vui128_t zero = (vui128_t) { (__int128) 0 };
+  const vui32_t one = CONST_VINT128_W (0, 0, 0, 1);
+  vui128_t r2;
+  int result = 0;
+
+  switch (rnd)
+    {
+    case VEC_ROUND_UP:
+    case VEC_ROUND_CEIL:
+      result = vec_cmpuq_all_ne (r, zero);
+      break;
+    case VEC_ROUND_HALF_UP:
+    case VEC_ROUND_HALF_EVEN:
+      if (k <= 38)
+	{
+	  r2 = vec_adduqm (r, r);
+	  if (vec_cmpuq_all_gt (r2, vtipowof10[k]))
+	    result = 1;
+	  else if (vec_cmpuq_all_eq (r2, vtipowof10[k]))
+	    {
+	      if (rnd == VEC_ROUND_HALF_UP)
+		result = 1;
+	      else /* Ties to even, round up if q is odd.  */
+		result = vec_cmpuq_all_ne (
+		    (vui128_t) vec_and ((vui32_t) q, one), zero);
+	    }
+	}
+      break;
+    default:
+      break;
+    }
+
+  return result;
+}
+
 /** \brief Vector Select Signed Quadword.
  *
  *  Return the value, (vra & ~vrc) | (vrb & vrc).
@@ -8168,4 +8462,99 @@ vec_vsrdbi (vui128_t vra, vui128_t vrb, const unsigned int shb)
 
   return ((vui128_t) result);
 }
+
+/** \name Dynamic call ABI for the heavier operations
+ *
+ *  The divide and modulo by 10**31 and 10**32 chains used for
+ *  decimal conversion are also available out of line.
+ *
+ *  libpvec.so exports an IFUNC symbol FNAME_dyn for each operation
+ *  below, resolved at load time to the implementation compiled for
+ *  the running platform (see vec_runtime_DYN.c). Programs built for
+ *  the distro baseline (-mcpu=power8) get the POWER9/POWER10
+ *  instructions on newer hardware without being rebuilt. The call
+ *  costs a few cycles more than the inline operation, so call the
+ *  inline operation when the program is built for the target
+ *  platform.
+ *
+ *  libpvecstatic.a provides the same implementations with a platform
+ *  suffix (_PWR7, _PWR8, _PWR9, _PWR10). Use __VEC_PWR_IMP(FNAME)
+ *  to call the one matching the -mcpu= of the caller.
+ */
+///@{
+/** \brief Out-of-line vec_divuq_10e31().  */
+extern vui128_t
+vec_divuq_10e31_dyn (vui128_t vra);
+
+/** \brief Out-of-line vec_divuq_10e32().  */
+extern vui128_t
+vec_divuq_10e32_dyn (vui128_t vra);
+
+/** \brief Out-of-line vec_moduq_10e31().  */
+extern vui128_t
+vec_moduq_10e31_dyn (vui128_t vra, vui128_t q);
+
+/** \brief Out-of-line vec_moduq_10e32().  */
+extern vui128_t
+vec_moduq_10e32_dyn (vui128_t vra, vui128_t q);
+
+/** \brief Out-of-line vec_divudq_10e31().  */
+extern vui128_t
+vec_divudq_10e31_dyn (vui128_t *qh, vui128_t vra, vui128_t vrb);
+
+/** \brief Out-of-line vec_divudq_10e32().  */
+extern vui128_t
+vec_divudq_10e32_dyn (vui128_t *qh, vui128_t vra, vui128_t vrb);
+
+/** \brief Out-of-line vec_modudq_10e31().  */
+extern vui128_t
+vec_modudq_10e31_dyn (vui128_t vra, vui128_t vrb, vui128_t *ql);
+
+/** \brief Out-of-line vec_modudq_10e32().  */
+extern vui128_t
+vec_modudq_10e32_dyn (vui128_t vra, vui128_t vrb, vui128_t *ql);
+
+/** \brief Out-of-line vec_divsq_10e31().  */
+extern vi128_t
+vec_divsq_10e31_dyn (vi128_t vra);
+
+/** \brief Out-of-line vec_modsq_10e31().  */
+extern vi128_t
+vec_modsq_10e31_dyn (vi128_t vra, vi128_t q);
+
+///@}
+
+///@cond INTERNAL
+/* Doxygen can not handle macros or attributes */
+extern vui128_t
+__VEC_PWR_IMP (vec_divuq_10e31) (vui128_t vra);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_divuq_10e32) (vui128_t vra);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_moduq_10e31) (vui128_t vra, vui128_t q);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_moduq_10e32) (vui128_t vra, vui128_t q);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_divudq_10e31) (vui128_t *qh, vui128_t vra, vui128_t vrb);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_divudq_10e32) (vui128_t *qh, vui128_t vra, vui128_t vrb);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_modudq_10e31) (vui128_t vra, vui128_t vrb, vui128_t *ql);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_modudq_10e32) (vui128_t vra, vui128_t vrb, vui128_t *ql);
+
+extern vi128_t
+__VEC_PWR_IMP (vec_divsq_10e31) (vi128_t vra);
+
+extern vi128_t
+__VEC_PWR_IMP (vec_modsq_10e31) (vi128_t vra, vi128_t q);
+///@endcond
+
 #endif /* VEC_INT128_PPC_H_ */
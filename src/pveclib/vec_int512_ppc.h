@@ -813,6 +813,19 @@ const __VEC_U_512  vec512_ten128th = CONST_VINT512_Q
 #define CONST_VINT512_Q(__q0, __q1, __q2, __q3) {__q0, __q1, __q2, __q3}
 #endif
 
+/** \brief Generate a 256-bit vector unsigned integer constant from
+ *  2 x quadword constants.
+ *
+ *  Combine 2 x quadwords constants into a 256-bit __VEC_U_256 constant.
+ *  The 2 parameters are quadword integer constant values in high to
+ *  low order, as for CONST_VINT512_Q.
+ */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define CONST_VINT256_Q(__q0, __q1) {__q1, __q0}
+#else
+#define CONST_VINT256_Q(__q0, __q1) {__q0, __q1}
+#endif
+
 
 /*! \brief A vector representation of a 256-bit unsigned integer.
  *
@@ -1344,20 +1357,72 @@ typedef union
 #define COMPILE_FENCE __asm (";":::)
 #endif
 
-/*! \brief Macro to add platform suffix for static calls. */
-#ifdef _ARCH_PWR10
-#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR10
-#else
-#ifdef _ARCH_PWR9
-#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR9
-#else
-#ifdef _ARCH_PWR8
-#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR8
-#else
-#define __VEC_PWR_IMP(FNAME) FNAME ## _PWR7
-#endif
-#endif
-#endif
+/** \name Power of ten and reciprocal tables
+ *
+ *  Extend vtipowof10[] (10**0-10**38 as vui128_t) to the largest
+ *  powers of ten that fit in 256 and 512 bits. The source
+ *  (powof10_512.c) is generated at build time by gen_powof10_512.c
+ *  and is part of both libpvec and libpvecstatic.
+ *
+ *  The reciprocal tables replace division by 10**k with a multiply.
+ *  For an unsigned 256-bit n and 1 <= k <= 77:
+ *
+ *  n / 10**k = ((n >> k) * vec256_recipof10[k]) >> (256 + vec_recipof10_sh[k])
+ *
+ *  The product is 512 bits (vec_mul256x256()) and only the high
+ *  256 bits are needed, shifted right by vec_recipof10_sh[k].
+ *  The 512-bit form is the same with vec512_recipof10[k],
+ *  1 <= k <= 154, and vec_mul512x512(). The result is exact (not
+ *  an estimate) for all n. vec_recipof10_sh[] and the 128-bit
+ *  vec128_recipof10[] (see vec_div10k_uq()) are declared in
+ *  vec_common_ppc.h.
+ *
+ *  The powers of 5 tables support the binary128 decimal conversions
+ *  (vec_f128_ctstr(), vec_f128_cfstr()), which need the leading 249
+ *  bits of 5**n and 2**j / 5**n for n = [0-5096]. Only every 56th
+ *  entry is stored. Entry n is vec128_powof5[n % 56] times the
+ *  nearest stored entry, shifted right, plus the 2-bit correction
+ *  for n (bits 2*(n%32) of word n/32).
+ *
+ *  The double and float conversions (vec_f64_ctstr(),
+ *  vec_f32_ctstr()) need only 125 bits and n <= 341, so
+ *  vec128_f64powof5[] and vec128_f64recipof5[] keep every entry.
+ *
+ *  vec_dpd2bin[] and vec_bin2dpd[] convert between the 10-bit
+ *  densely packed decimal declets of the _Decimal128 and _Decimal64
+ *  encodings and binary 0-999, for the batch decimal arithmetic
+ *  (vec_dfp128_sum_array() and friends).
+ */
+///@{
+/** \brief 10**k, k = [0-77], as 256-bit integers.  */
+extern const __VEC_U_256 vec256_powof10[];
+/** \brief 10**k, k = [0-154], as 512-bit integers.  */
+extern const __VEC_U_512 vec512_powof10[];
+/** \brief Multipliers for 256-bit n / 10**k, k = [1-77].  */
+extern const __VEC_U_256 vec256_recipof10[];
+/** \brief Multipliers for 512-bit n / 10**k, k = [1-154].  */
+extern const __VEC_U_512 vec512_recipof10[];
+/** \brief 5**k, k = [0-55], as 128-bit integers.  */
+extern const vui128_t vec128_powof5[];
+/** \brief The leading 249 bits of 5**(56*b), b = [0-91].  */
+extern const __VEC_U_256 vec256_powof5[];
+/** \brief floor(2**(pow5bits(n)+248) / 5**n), n = 56*b, b = [0-91].  */
+extern const __VEC_U_256 vec256_recipof5[];
+/** \brief 2-bit corrections for 5**n rebuilt from vec256_powof5[].  */
+extern const unsigned long long vec_powof5_err[];
+/** \brief 2-bit corrections for 5**-n rebuilt from vec256_recipof5[].  */
+extern const unsigned long long vec_recipof5_err[];
+/** \brief The leading 125 bits of 5**n, n = [0-325].  */
+extern const vui128_t vec128_f64powof5[];
+/** \brief floor(2**(pow5bits(n)+124) / 5**n) + 1, n = [0-341].  */
+extern const vui128_t vec128_f64recipof5[];
+/** \brief DPD declet to binary 0-999, all 1024 declets.  */
+extern const unsigned short vec_dpd2bin[];
+/** \brief Binary 0-999 to the canonical DPD declet.  */
+extern const unsigned short vec_bin2dpd[];
+///@}
+
+/* __VEC_PWR_IMP() is defined in vec_common_ppc.h.  */
 
 /** \brief Vector Add 512-bit Unsigned Integer & Write Carry.
  *
@@ -2171,6 +2236,106 @@ vec_mul512_byMN  (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
 
+/** \brief Vector Unsigned Integer Quadword N by 10**k Multiply.
+ *
+ *  Compute the product of the N quadword integer m and 10**k, for k
+ *  in the range 0-38. The low order N quadwords of the product are
+ *  stored to p and the carry out (the high order quadword, less
+ *  than 10**k) is returned. p and m may be the same array.
+ *
+ *  One vec_madduq() by vtipowof10[k] per quadword, instead of k
+ *  passes of vec_cmul10ecuq() over the array.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  For static calls the __VEC_PWR_IMP() macro
+ *  will add appropriate suffix based on the compile -mcpu= option.
+ *  \note The storage order for quadwords matches the system endian,
+ *  as for vec_mul128_byMN().
+ *
+ *  |processor|  Latency |Throughput|
+ *  |--------:|:--------:|:---------|
+ *  |power8   | ~60*N    | 1/cycle  |
+ *  |power9   | ~30*N    | 1/cycle  |
+ *
+ *  @param p pointer to the Nx128-bit product in storage.
+ *  @param m pointer to the Nx128-bit multiplicand in storage.
+ *  @param k the power of ten in the range 0-38.
+ *  @param N long int specifying the number of quadwords in p and m.
+ *  @return the carry out quadword of the product.
+ */
+extern vui128_t
+vec_mul10k_byN (vui128_t *p, vui128_t *m, unsigned int k,
+		unsigned long N);
+
+/** \brief Vector Unsigned Integer Quadword N by 10**k Divide.
+ *
+ *  Compute the quotient of the N quadword integer n and 10**k, for
+ *  k in the range 0-38, rounded as specified by rnd. The N quadword
+ *  quotient is stored to q and the remainder of the truncated
+ *  division is returned. q and n may be the same array.
+ *
+ *  This is a long division from the high order quadword. Each step
+ *  divides the 256-bit (remainder || n[i]) using the 256-bit
+ *  multiplicative inverse vec256_recipof10[k], so there is no
+ *  quadword divide and no loop over k.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  For static calls the __VEC_PWR_IMP() macro
+ *  will add appropriate suffix based on the compile -mcpu= option.
+ *  \note The storage order for quadwords matches the system endian,
+ *  as for vec_mul128_byMN().
+ *
+ *  |processor|  Latency |Throughput|
+ *  |--------:|:--------:|:---------|
+ *  |power8   | ~220*N   | 1/cycle  |
+ *  |power9   | ~110*N   | 1/cycle  |
+ *
+ *  @param q pointer to the Nx128-bit quotient in storage.
+ *  @param n pointer to the Nx128-bit dividend in storage.
+ *  @param k the power of ten in the range 0-38.
+ *  @param rnd the rounding mode for q.
+ *  @param N long int specifying the number of quadwords in q and n.
+ *  @return the remainder of the truncated division, less than 10**k.
+ */
+extern vui128_t
+vec_div10k_byN (vui128_t *q, vui128_t *n, unsigned int k,
+		vec_round_t rnd, unsigned long N);
+
+/** \brief Vector Signed Integer Quadword array Rescale by 10**k.
+ *
+ *  Change the implied decimal scale of n signed fixed-point values,
+ *  for example a column of currency amounts. For k > 0 each a[i] is
+ *  multiplied by 10**k. For k < 0 each a[i] is divided by 10**-k
+ *  and rounded as specified by rnd (vec_div10k_rnd_sq()). r and a
+ *  may be the same array.
+ *
+ *  The multiply overflows if the product is outside the range of
+ *  signed __int128. The result stored for an overflowed element is
+ *  the low order 128 bits of the product. The divide can not
+ *  overflow.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  For static calls the __VEC_PWR_IMP() macro
+ *  will add appropriate suffix based on the compile -mcpu= option.
+ *
+ *  |processor|  Latency |Throughput|
+ *  |--------:|:--------:|:---------|
+ *  |power8   | ~140*n   | 1/cycle  |
+ *  |power9   | ~85*n    | 1/cycle  |
+ *
+ *  @param r pointer to the n rescaled values in storage.
+ *  @param a pointer to the n values in storage.
+ *  @param k the change of scale, a power of ten.
+ *  @param rnd the rounding mode for k < 0.
+ *  @param ovf NULL or pointer to n bytes, set to 1 for each element
+ *  that overflowed, otherwise 0.
+ *  @param n long int specifying the number of elements in r and a.
+ *  @return the number of elements that overflowed.
+ */
+extern long
+vec_rescalesq_array (vi128_t *r, vi128_t *a, int k, vec_round_t rnd,
+		     unsigned char *ovf, unsigned long n);
+
 ///@cond INTERNAL
 /* Doxygen can not handle macros or attributes */
 extern __VEC_U_256
@@ -2218,6 +2383,19 @@ extern void
 __VEC_PWR_IMP (vec_mul512_byMN) (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_mul10k_byN) (vui128_t *p, vui128_t *m, unsigned int k,
+				unsigned long N);
+
+extern vui128_t
+__VEC_PWR_IMP (vec_div10k_byN) (vui128_t *q, vui128_t *n, unsigned int k,
+				vec_round_t rnd, unsigned long N);
+
+extern long
+__VEC_PWR_IMP (vec_rescalesq_array) (vi128_t *r, vi128_t *a, int k,
+				     vec_round_t rnd, unsigned char *ovf,
+				     unsigned long n);
 ///@endcond
 
 #endif /* SRC_PVECLIB_VEC_INT512_PPC_H_ */
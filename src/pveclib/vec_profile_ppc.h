@@ -0,0 +1,125 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_profile_ppc.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_PVECLIB_VEC_PROFILE_PPC_H_
+#define SRC_PVECLIB_VEC_PROFILE_PPC_H_
+
+#include <stdio.h>
+
+/*!
+ * \file  vec_profile_ppc.h
+ * \brief Interface to the optional libpvec call profiling.
+ *
+ * When PVECLIB is configured with <B>--enable-profile</B>
+ * (which defines PVECLIB_PROFILE) each IFUNC exported entry point of
+ * libpvec (vec_mul128x128, ..., vec_mul512_byMN, the FNAME_dyn
+ * operations and the array functions) is wrapped with per-thread
+ * counters. For each function we count calls and total timebase
+ * ticks spent in the selected platform implementation.
+ * For vec_mul128_byMN and vec_mul512_byMN we also collect a
+ * histogram of the M and N operand sizes.
+ *
+ * The counters live in per-thread blocks, so the wrappers do not
+ * need atomic operations or locks. vec_prof_snapshot() sums the
+ * blocks of all threads (including threads that have exited).
+ * Reading counters of running threads is not synchronized with
+ * their updates, so a snapshot taken while other threads call
+ * libpvec is approximate.
+ *
+ * If the environment variable PVECLIB_PROFILE_DUMP is set when the
+ * library is loaded, a report is written at exit to the named file
+ * (or stderr for "stderr" or an empty value).
+ *
+ * Without --enable-profile the exported functions are the IFUNC
+ * symbols themselves, as before, and there is no overhead.
+ * The functions below are still provided; vec_prof_enabled()
+ * returns 0 and all counts are zero.
+ *
+ * \note The libpvecstatic.a archive calls the platform
+ * implementations directly and is not profiled.
+ */
+
+/*! \brief Profiled functions, indexes into vec_prof_stats_t.func.
+ *
+ *  The int512 multiplies have fixed indexes. The indexes after
+ *  VEC_PROF_MUL512_BYMN are assigned to the remaining exported
+ *  functions of the library build, which depend on the configure
+ *  options. Use vec_prof_name() to identify them; it returns an
+ *  empty string for unused indexes. VEC_PROF_NFUNCS is the capacity
+ *  of the table.  */
+enum vec_prof_func
+{
+  VEC_PROF_MUL128X128 = 0,
+  VEC_PROF_MUL256X256,
+  VEC_PROF_MUL512X128,
+  VEC_PROF_MADD512X128A512,
+  VEC_PROF_MUL512X512,
+  VEC_PROF_MUL1024X1024,
+  VEC_PROF_MUL2048X2048,
+  VEC_PROF_MUL128_BYMN,
+  VEC_PROF_MUL512_BYMN,
+  VEC_PROF_NFUNCS = 192
+};
+
+/*! \brief Number of M/N size buckets for the byMN histograms.
+ *  Bucket 0 counts sizes 0 and 1, bucket b counts sizes in
+ *  (2^(b-1), 2^b], and the last bucket all larger sizes.  */
+#define VEC_PROF_HIST_BUCKETS 16
+
+/*! \brief Call and timebase tick counts for one function.  */
+typedef struct
+{
+  unsigned long long calls;
+  unsigned long long ticks;
+} vec_prof_count_t;
+
+/*! \brief Profile counts for all libpvec exported functions.  */
+typedef struct
+{
+  vec_prof_count_t func[VEC_PROF_NFUNCS];
+  /*! \brief vec_mul128_byMN calls by [M bucket][N bucket].  */
+  unsigned long long mul128_byMN[VEC_PROF_HIST_BUCKETS][VEC_PROF_HIST_BUCKETS];
+  /*! \brief vec_mul512_byMN calls by [M bucket][N bucket].  */
+  unsigned long long mul512_byMN[VEC_PROF_HIST_BUCKETS][VEC_PROF_HIST_BUCKETS];
+} vec_prof_stats_t;
+
+/*! \brief Return 1 if libpvec was built with PVECLIB_PROFILE.  */
+extern int
+vec_prof_enabled (void);
+
+/*! \brief Return the exported function name for a vec_prof_func.  */
+extern const char *
+vec_prof_name (int func);
+
+/*! \brief Sum the counters of all threads into stats.  */
+extern void
+vec_prof_snapshot (vec_prof_stats_t *stats);
+
+/*! \brief Clear the counters of all threads.  */
+extern void
+vec_prof_reset (void);
+
+/*! \brief Write a summary of vec_prof_snapshot() to f.  */
+extern void
+vec_prof_dump (FILE *f);
+
+#endif /* SRC_PVECLIB_VEC_PROFILE_PPC_H_ */
@@ -30,6 +30,8 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 //#define __DEBUG_PRINT__
 #include <pveclib/vec_common_ppc.h>
@@ -1280,6 +1282,1065 @@ test_bcd_addsub (void)
 
   return rc;
 }
+
+/* The out-of-line implementations in libpvecstatic.a, selected by
+   __VEC_PWR_IMP for this -mcpu, must match the inline operations.  */
+int
+test_bcd_muldiv_runtime (void)
+{
+  vBCD_t i, j, k;
+  vBCD_t e;
+  vi128_t ki;
+  int rc = 0;
+
+  printf ("\n%s Vector BCD runtime */\n", __FUNCTION__);
+
+  i = (vBCD_t) CONST_VINT128_W (0, 0, 0x99999999, 0x9999999c);
+  j = (vBCD_t) CONST_VINT128_W (0, 0x99999999, 0x99999999, 0x9999999c);
+  k = __VEC_PWR_IMP (vec_bcdmul) (i, j);
+
+#ifdef __DEBUG_PRINT__
+  print_vint128x_sum ("bcd (999999999999999*99999999999999999999999)", k, i, j);
+#endif
+  e = (vBCD_t) CONST_VINT128_W (0x99999998, 0x99999999,
+				0x00000000, 0x0000001c);
+  rc += check_vuint128x ("vec_bcdmul_PWRn:", (vui128_t) k, (vui128_t) e);
+
+  i = (vBCD_t) CONST_VINT128_W (0x09999999, 0x99999998,
+				0x00000000, 0x0000001c);
+  j = (vBCD_t) CONST_VINT128_W (0, 0, 0x99999999, 0x9999999c);
+  k = __VEC_PWR_IMP (vec_bcddiv) (i, j);
+
+#ifdef __DEBUG_PRINT__
+  print_vint128x_sum ("bcd (999999999999998000000000000001/999999999999999)", k, i, j);
+#endif
+  e = (vBCD_t) CONST_VINT128_W (0x00000000, 0x00000000,
+				0x99999999, 0x9999999c);
+  rc += check_vuint128x ("vec_bcddiv_PWRn:", (vui128_t) k, (vui128_t) e);
+
+  i = (vBCD_t) CONST_VINT128_W (0, 0, 0x99999999, 0x9999999c);
+  j = (vBCD_t) CONST_VINT128_W (0x99999999, 0x99999999, 0x99999999,
+				0x9999999d);
+  k = __VEC_PWR_IMP (vec_bcdmulh) (i, j);
+  e = vec_bcdmulh (i, j);
+  rc += check_vuint128x ("vec_bcdmulh_PWRn:", (vui128_t) k, (vui128_t) e);
+
+  // Almost PI
+  i = (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x628321c);
+  j = (vBCD_t) CONST_VINT128_W (0, 0, 0x2, 0x0000079c);
+  k = __VEC_PWR_IMP (vec_bcddive) (i, j);
+  e = (vBCD_t) CONST_VINT128_W (0x31415925, 0x90709266, 0x69839654,
+				0x1333661c);
+  rc += check_vuint128x ("vec_bcddive_PWRn:", (vui128_t) k, (vui128_t) e);
+
+  i = (vBCD_t) CONST_VINT128_W (0, 0, 0x12345678, 0x9012345d);
+  ki = __VEC_PWR_IMP (vec_bcdctsq) (i);
+  k = __VEC_PWR_IMP (vec_bcdcfsq) (ki);
+
+#ifdef __DEBUG_PRINT__
+  print_vint128x ("bcd -123456789012345 ", (vui128_t) k);
+#endif
+  e = vec_bcdcfsq (vec_bcdctsq (i));
+  rc += check_vuint128x ("vec_bcdct/cfsq_PWRn:", (vui128_t) k, (vui128_t) e);
+
+  return (rc);
+}
+#undef __DEBUG_PRINT__
+
+static int
+test_check_bcd_byN (char *prefix, vBCD_t *r, vBCD_t *e, unsigned long N)
+{
+  unsigned long i;
+  int rc = 0;
+
+  for (i = 0; i < N; i++)
+    rc += check_vuint128x (prefix, (vui128_t) r[i], (vui128_t) e[i]);
+
+  return (rc);
+}
+
+//#define __DEBUG_PRINT__ 1
+int
+test_bcd_byN (void)
+{
+  // 12345678901234567890123456789012345678901234567890
+  vBCD_t a[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00001234, 0x56789012,
+				0x3456789c),
+      (vBCD_t) CONST_VINT128_W (0x01234567, 0x89012345, 0x67890123,
+				0x4567890c)
+    };
+  // 98765432109876543210987654321098765432109876543210
+  vBCD_t b[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00009876, 0x54321098,
+				0x7654321c),
+      (vBCD_t) CONST_VINT128_W (0x09876543, 0x21098765, 0x43210987,
+				0x6543210c)
+    };
+  vBCD_t e_add[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00011111, 0x11110111,
+				0x1111110c),
+      (vBCD_t) CONST_VINT128_W (0x11111111, 0x10111111, 0x11101111,
+				0x1111100c)
+    };
+  vBCD_t e_sub[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00008641, 0x97532086,
+				0x4197532d),
+      (vBCD_t) CONST_VINT128_W (0x08641975, 0x32086419, 0x75320864,
+				0x1975320d)
+    };
+  // -(a * b)
+  vBCD_t e_mul[4] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00000000, 0x00000000,
+				0x1219326d),
+      (vBCD_t) CONST_VINT128_W (0x31137021, 0x79522618, 0x50327338,
+				0x6678859d),
+      (vBCD_t) CONST_VINT128_W (0x45115073, 0x91561194, 0x93974487,
+				0x1208653d),
+      (vBCD_t) CONST_VINT128_W (0x36229233, 0x32237463, 0x80111126,
+				0x3526900d)
+    };
+  // a << 5 digits, truncated to 62 digits
+  vBCD_t e_sl[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000001, 0x23456789, 0x01234567,
+				0x8901234c),
+      (vBCD_t) CONST_VINT128_W (0x56789012, 0x34567890, 0x12345678,
+				0x9000000c)
+    };
+  // -a >> 35 digits, truncated and rounded
+  vBCD_t e_sr[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00000000, 0x00000000,
+				0x0000000d),
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00000000, 0x12345678,
+				0x9012345d)
+    };
+  vBCD_t e_srr[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00000000, 0x00000000,
+				0x0000000d),
+      (vBCD_t) CONST_VINT128_W (0x00000000, 0x00000000, 0x12345678,
+				0x9012346d)
+    };
+  vBCD_t nines[2] = { _BCD_CONST_PLUS_NINES, _BCD_CONST_PLUS_NINES };
+  vBCD_t one[2] = { _BCD_CONST_ZERO, _BCD_CONST_PLUS_ONE };
+  vBCD_t ten31[2] = { _BCD_CONST_PLUS_ONE, _BCD_CONST_ZERO };
+  vBCD_t zeros[2] = { _BCD_CONST_ZERO, _BCD_CONST_ZERO };
+  vBCD_t mzeros[2] =
+    {
+      (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000000d),
+      (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000000d)
+    };
+  vBCD_t r[4], e[2], na[2], c;
+  int i, rc = 0;
+
+  printf ("\n%s Vector BCD N quadword */\n", __FUNCTION__);
+
+  c = __VEC_PWR_IMP (vec_bcdadd_byN) (r, a, b, 2);
+#ifdef __DEBUG_PRINT__
+  print_vint128x ("a+b ", (vui128_t) r[0]);
+  print_vint128x ("    ", (vui128_t) r[1]);
+#endif
+  rc += test_check_bcd_byN ("vec_bcdadd_byN:", r, e_add, 2);
+  rc += check_vuint128x ("vec_bcdadd_byN c:", (vui128_t) c,
+			 (vui128_t) _BCD_CONST_ZERO);
+
+  c = __VEC_PWR_IMP (vec_bcdsub_byN) (r, a, b, 2);
+  rc += test_check_bcd_byN ("vec_bcdsub_byN:", r, e_sub, 2);
+  rc += check_vuint128x ("vec_bcdsub_byN c:", (vui128_t) c,
+			 (vui128_t) _BCD_CONST_ZERO);
+
+  // (a - b) + b == a, with mixed signs and the larger magnitude second
+  __VEC_PWR_IMP (vec_bcdadd_byN) (r, r, b, 2);
+  rc += test_check_bcd_byN ("vec_bcdadd_byN mixed:", r, a, 2);
+
+  // -a - -b = b - a
+  for (i = 0; i < 2; i++)
+    {
+      na[i] = vec_bcdcpsgn (a[i], _BCD_CONST_MINUS_ONE);
+      e[i] = vec_bcdcpsgn (e_sub[i], _BCD_CONST_ZERO);
+    }
+  r[0] = vec_bcdcpsgn (b[0], _BCD_CONST_MINUS_ONE);
+  r[1] = vec_bcdcpsgn (b[1], _BCD_CONST_MINUS_ONE);
+  __VEC_PWR_IMP (vec_bcdsub_byN) (r, na, r, 2);
+  rc += test_check_bcd_byN ("vec_bcdsub_byN neg:", r, e, 2);
+
+  // Borrow across the quadwords, 10**31 - 1
+  c = __VEC_PWR_IMP (vec_bcdsub_byN) (r, ten31, one, 2);
+  e[0] = _BCD_CONST_ZERO;
+  e[1] = _BCD_CONST_PLUS_NINES;
+  rc += test_check_bcd_byN ("vec_bcdsub_byN borrow:", r, e, 2);
+  rc += check_vuint128x ("vec_bcdsub_byN borrow c:", (vui128_t) c,
+			 (vui128_t) _BCD_CONST_ZERO);
+
+  // Carry out of 10**62 - 1 + 1, and the negative carry
+  c = __VEC_PWR_IMP (vec_bcdadd_byN) (r, nines, one, 2);
+  rc += test_check_bcd_byN ("vec_bcdadd_byN carry:", r, zeros, 2);
+  rc += check_vuint128x ("vec_bcdadd_byN carry c:", (vui128_t) c,
+			 (vui128_t) _BCD_CONST_PLUS_ONE);
+  c = __VEC_PWR_IMP (vec_bcdsub_byN) (r, zeros, nines, 2);
+  c = __VEC_PWR_IMP (vec_bcdsub_byN) (r, r, one, 2);
+  rc += test_check_bcd_byN ("vec_bcdsub_byN carry:", r, zeros, 2);
+  rc += check_vuint128x ("vec_bcdsub_byN carry c:", (vui128_t) c,
+			 (vui128_t) _BCD_CONST_MINUS_ONE);
+
+  // x - x is +0
+  __VEC_PWR_IMP (vec_bcdsub_byN) (r, na, na, 2);
+  rc += test_check_bcd_byN ("vec_bcdsub_byN zero:", r, zeros, 2);
+
+  if (__VEC_PWR_IMP (vec_bcdcmp_byN) (a, b, 2) != -1)
+    rc += check_vuint128x ("vec_bcdcmp_byN a<b:", (vui128_t) a[0],
+			   (vui128_t) b[0]);
+  if (__VEC_PWR_IMP (vec_bcdcmp_byN) (a, na, 2) != 1)
+    rc += check_vuint128x ("vec_bcdcmp_byN a>-a:", (vui128_t) a[0],
+			   (vui128_t) na[0]);
+  if (__VEC_PWR_IMP (vec_bcdcmp_byN) (na, e_sub, 2) != 1)
+    rc += check_vuint128x ("vec_bcdcmp_byN -a>a-b:", (vui128_t) na[0],
+			   (vui128_t) e_sub[0]);
+  if (__VEC_PWR_IMP (vec_bcdcmp_byN) (mzeros, zeros, 2) != 0)
+    rc += check_vuint128x ("vec_bcdcmp_byN -0==0:", (vui128_t) mzeros[0],
+			   (vui128_t) zeros[0]);
+
+  __VEC_PWR_IMP (vec_bcdmul_byMN) (r, na, b, 2, 2);
+#ifdef __DEBUG_PRINT__
+  print_vint128x ("-a*b ", (vui128_t) r[0]);
+  print_vint128x ("     ", (vui128_t) r[1]);
+  print_vint128x ("     ", (vui128_t) r[2]);
+  print_vint128x ("     ", (vui128_t) r[3]);
+#endif
+  rc += test_check_bcd_byN ("vec_bcdmul_byMN:", r, e_mul, 4);
+
+  // (10**62 - 1)**2 = 10**124 - 2 * 10**62 + 1
+  __VEC_PWR_IMP (vec_bcdmul_byMN) (r, nines, nines, 2, 2);
+  e[0] = _BCD_CONST_PLUS_NINES;
+  e[1] = vec_bcdsub (_BCD_CONST_PLUS_NINES, _BCD_CONST_PLUS_ONE);
+  rc += test_check_bcd_byN ("vec_bcdmul_byMN max:", r, e, 2);
+  rc += test_check_bcd_byN ("vec_bcdmul_byMN max:", &r[2], one, 2);
+
+  __VEC_PWR_IMP (vec_bcdsl_byN) (r, a, 5, 2);
+  rc += test_check_bcd_byN ("vec_bcdsl_byN:", r, e_sl, 2);
+  __VEC_PWR_IMP (vec_bcdsl_byN) (r, one, 31, 2);
+  rc += test_check_bcd_byN ("vec_bcdsl_byN 31:", r, ten31, 2);
+
+  __VEC_PWR_IMP (vec_bcdsr_byN) (r, na, 35, 2);
+  rc += test_check_bcd_byN ("vec_bcdsr_byN:", r, e_sr, 2);
+  __VEC_PWR_IMP (vec_bcdsrr_byN) (r, na, 35, 2);
+  rc += test_check_bcd_byN ("vec_bcdsrr_byN:", r, e_srr, 2);
+  __VEC_PWR_IMP (vec_bcdsr_byN) (r, ten31, 31, 2);
+  rc += test_check_bcd_byN ("vec_bcdsr_byN 31:", r, one, 2);
+
+  // (10**32 - 1) >> 1 rounds up to 10**31, carry across quadwords
+  e[0] = (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000009c);
+  e[1] = _BCD_CONST_PLUS_NINES;
+  __VEC_PWR_IMP (vec_bcdsrr_byN) (r, e, 1, 2);
+  rc += test_check_bcd_byN ("vec_bcdsrr_byN carry:", r, ten31, 2);
+
+  // In place
+  r[0] = a[0];
+  r[1] = a[1];
+  __VEC_PWR_IMP (vec_bcdsl_byN) (r, r, 5, 2);
+  rc += test_check_bcd_byN ("vec_bcdsl_byN r=a:", r, e_sl, 2);
+
+  return (rc);
+}
+
+int
+test_bcdrec (void)
+{
+  // 0x40 filler, PIC S9(9) COMP-3, PIC S9(20), PIC S9(3)V99 COMP-3
+  unsigned char rec[3 * 29] =
+    {
+      0x40, 0x12, 0x34, 0x56, 0x78, 0x9c,
+      0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xf0,
+      0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xd0,
+      0x12, 0x34, 0x5c,
+
+      0x40, 0x00, 0x00, 0x00, 0x00, 0x1d,
+      0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+      0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xc0,
+      0x00, 0x00, 0x1d,
+
+      0x40, 0x00, 0x00, 0x00, 0x00, 0x0c,
+      0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9,
+      0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xc9,
+      0x99, 0x99, 0x9c
+    };
+  unsigned char out[3 * 29];
+  long long c0[3];
+  __int128 c1[3];
+  _Decimal128 c2[3];
+  vec_bcdrec_field_t schema[3] =
+    {
+      { 1, 5, VEC_BCDREC_PACKED, VEC_BCDREC_INT64, 0, c0 },
+      { 6, 20, VEC_BCDREC_ZONED, VEC_BCDREC_INT128, 0, c1 },
+      { 26, 3, VEC_BCDREC_PACKED, VEC_BCDREC_DEC128, 2, c2 }
+    };
+  vec_bcdrec_field_t bad = { 1, 17, VEC_BCDREC_PACKED, VEC_BCDREC_INT64,
+			     0, c0 };
+  __int128 e1, e2;
+  long n;
+  unsigned long i;
+  int rc = 0;
+
+  printf ("\n%s Vector BCD records */\n", __FUNCTION__);
+
+  e1 = (__int128) 12345678901234567890UL;
+  // 10**20 - 1
+  e2 = ((__int128) 9999999999UL * 10000000000UL) + 9999999999UL;
+
+  n = __VEC_PWR_IMP (vec_bcdrec_decode) (rec, 29, 3, schema, 3);
+  rc += check_int64 ("vec_bcdrec_decode n:", n, 0);
+  rc += check_int64 ("vec_bcdrec_decode c0[0]:", c0[0], 123456789);
+  rc += check_int64 ("vec_bcdrec_decode c0[1]:", c0[1], -1);
+  rc += check_int64 ("vec_bcdrec_decode c0[2]:", c0[2], 0);
+  rc += check_int128 ("vec_bcdrec_decode c1[0]:", c1[0], -e1);
+  rc += check_int128 ("vec_bcdrec_decode c1[1]:", c1[1], 0);
+  rc += check_int128 ("vec_bcdrec_decode c1[2]:", c1[2], e2);
+  rc += check_dfp128 ("vec_bcdrec_decode c2[0]:", c2[0], 123.45DL);
+  rc += check_dfp128 ("vec_bcdrec_decode c2[1]:", c2[1], -0.01DL);
+  rc += check_dfp128 ("vec_bcdrec_decode c2[2]:", c2[2], 999.99DL);
+
+  // Round trip, only the fields are written.
+  for (i = 0; i < sizeof (out); i++)
+    out[i] = (i % 29) == 0 ? 0x40 : 0xff;
+  n = __VEC_PWR_IMP (vec_bcdrec_encode) (out, 29, 3, schema, 3);
+  rc += check_int64 ("vec_bcdrec_encode n:", n, 0);
+  for (i = 0; i < sizeof (out); i++)
+    if (out[i] != rec[i])
+      {
+	rc += check_uint64 ("vec_bcdrec_encode byte:", out[i], rec[i]);
+	break;
+      }
+
+  // 10 digits into a 9 digit field, keeps the low digits.
+  c0[0] = 1000000000;
+  n = __VEC_PWR_IMP (vec_bcdrec_encode) (out, 29, 1, schema, 1);
+  rc += check_int64 ("vec_bcdrec_encode overflow:", n, 1);
+  rc += check_uint64 ("vec_bcdrec_encode overflow:", out[5], 0x0c);
+
+  n = __VEC_PWR_IMP (vec_bcdrec_decode) (rec, 29, 3, &bad, 1);
+  rc += check_int64 ("vec_bcdrec_decode bad:", n, -1);
+
+  return (rc);
+}
+
+int
+test_dfp128_conv (void)
+{
+  union
+  {
+    double d;
+    unsigned long u;
+  } f;
+  double fa[3];
+  _Decimal128 da[3], ea[3];
+  __int128 x;
+  vui128_t xu;
+  __binary128 b;
+  int rc = 0;
+
+  printf ("\n%s Vector _Decimal128 conversions */\n", __FUNCTION__);
+
+  // 38 digits round to 34, 2**128-1 has 39 digits.
+  x = ((__int128) 1234567890123456789UL * 10000000000000000000UL)
+      + 1234567890123456789UL;
+  rc += check_dfp128 ("vec_dfp128_cfsq:",
+		      vec_dfp128_cfsq ((vi128_t)
+			  vec_transfer_uint128_to_vui128t (-x)),
+		      -1.234567890123456789123456789012346E+37DL);
+  xu = (vui128_t) CONST_VINT128_DW128 (-1UL, -1UL);
+  rc += check_dfp128 ("vec_dfp128_cfuq:", vec_dfp128_cfuq (xu),
+		      3.402823669209384634633746074317682E+38DL);
+  xu = (vui128_t) vec_dfp128_ctsqz (-123.99DL);
+  rc += check_int128 ("vec_dfp128_ctsqz:",
+		      vec_transfer_vui128t_to_uint128 (xu), -123);
+  x = ((__int128) 3402823669209384UL * 1000000000000000000UL)
+      + 634633746074317682UL;
+  xu = vec_dfp128_ctuqz (3.402823669209384634633746074317682E+38DL);
+  rc += check_int128 ("vec_dfp128_ctuqz:",
+		      vec_transfer_vui128t_to_uint128 (xu), x * 100000);
+
+  rc += check_dfp128 ("vec_dfp128_cff64 0.1:",
+		      __VEC_PWR_IMP (vec_dfp128_cff64) (0.1),
+		      1.000000000000000055511151231257827E-1DL);
+  rc += check_dfp128 ("vec_dfp128_cff64 min:",
+		      __VEC_PWR_IMP (vec_dfp128_cff64) (__DBL_DENORM_MIN__),
+		      4.940656458412465441765687928682214E-324DL);
+  rc += check_dfp128 ("vec_dfp128_cff64 max:",
+		      __VEC_PWR_IMP (vec_dfp128_cff64) (-__DBL_MAX__),
+		      -1.797693134862315708145274237317044E+308DL);
+
+  b = vec_xfer_vui128t_2_bin128 ((vui128_t) CONST_VINT128_DW128 (
+      0x3ffb999999999999UL, 0x999999999999999aUL));
+  rc += check_dfp128 ("vec_dfp128_cff128 0.1:",
+		      __VEC_PWR_IMP (vec_dfp128_cff128) (b), 0.1DL);
+  b = vec_xfer_vui128t_2_bin128 ((vui128_t) CONST_VINT128_DW128 (
+      0x7ffeffffffffffffUL, 0xffffffffffffffffUL));
+  rc += check_dfp128 ("vec_dfp128_cff128 max:",
+		      __VEC_PWR_IMP (vec_dfp128_cff128) (b),
+		      1.189731495357231765085759326628007E+4932DL);
+  b = vec_xfer_vui128t_2_bin128 ((vui128_t) CONST_VINT128_DW128 (0, 1));
+  rc += check_dfp128 ("vec_dfp128_cff128 min:",
+		      __VEC_PWR_IMP (vec_dfp128_cff128) (b),
+		      6.475175119438025110924438958227647E-4966DL);
+
+  f.d = __VEC_PWR_IMP (vec_dfp128_ctf64)
+      (1.000000000000000055511151231257827E-1DL);
+  rc += check_uint64 ("vec_dfp128_ctf64 0.1:", f.u, 0x3fb999999999999aUL);
+  f.d = __VEC_PWR_IMP (vec_dfp128_ctf64)
+      (12345678901234.56789012345678901234DL);
+  rc += check_uint64 ("vec_dfp128_ctf64 34d:", f.u, 0x42a674e79c5fe523UL);
+  f.d = __VEC_PWR_IMP (vec_dfp128_ctf64)
+      (1.797693134862315708145274237317044E+308DL);
+  rc += check_uint64 ("vec_dfp128_ctf64 max:", f.u, 0x7fefffffffffffffUL);
+  f.d = __VEC_PWR_IMP (vec_dfp128_ctf64) (1E+309DL);
+  rc += check_uint64 ("vec_dfp128_ctf64 inf:", f.u, 0x7ff0000000000000UL);
+  f.d = __VEC_PWR_IMP (vec_dfp128_ctf64) (-1.5DL);
+  rc += check_uint64 ("vec_dfp128_ctf64 -1.5:", f.u, 0xbff8000000000000UL);
+  // Just above and below half of the smallest subnormal.
+  f.d = __VEC_PWR_IMP (vec_dfp128_ctf64)
+      (2.470328229206232720882843964341107E-324DL);
+  rc += check_uint64 ("vec_dfp128_ctf64 >half:", f.u, 1);
+  f.d = __VEC_PWR_IMP (vec_dfp128_ctf64)
+      (2.470328229206232720882843964341106E-324DL);
+  rc += check_uint64 ("vec_dfp128_ctf64 <half:", f.u, 0);
+
+  b = __VEC_PWR_IMP (vec_dfp128_ctf128) (0.1DL);
+  rc += check_vuint128x ("vec_dfp128_ctf128 0.1:",
+			 vec_xfer_bin128_2_vui128t (b),
+			 (vui128_t) CONST_VINT128_DW128 (0x3ffb999999999999UL,
+							 0x999999999999999aUL));
+  b = __VEC_PWR_IMP (vec_dfp128_ctf128) (12345678901234.56789012345678901234DL);
+  rc += check_vuint128x ("vec_dfp128_ctf128 34d:",
+			 vec_xfer_bin128_2_vui128t (b),
+			 (vui128_t) CONST_VINT128_DW128 (0x402a674e79c5fe52UL,
+							 0x2c27e87efc67ee7aUL));
+  b = __VEC_PWR_IMP (vec_dfp128_ctf128) (1E-4950DL);
+  rc += check_vuint128x ("vec_dfp128_ctf128 sub:",
+			 vec_xfer_bin128_2_vui128t (b),
+			 (vui128_t) CONST_VINT128_DW128 (0, 0x57c9647e1a018UL));
+  b = __VEC_PWR_IMP (vec_dfp128_ctf128) (-1E+4933DL);
+  rc += check_vuint128x ("vec_dfp128_ctf128 inf:",
+			 vec_xfer_bin128_2_vui128t (b),
+			 (vui128_t) CONST_VINT128_DW128 (0xffff000000000000UL,
+							 0));
+
+  fa[0] = 0.1;
+  fa[1] = -2.0;
+  fa[2] = __DBL_DENORM_MIN__;
+  __VEC_PWR_IMP (vec_dfp128_cff64_array) (da, fa, 3);
+  rc += check_dfp128 ("vec_dfp128_cff64_array:", da[1], -2.0DL);
+  __VEC_PWR_IMP (vec_dfp128_ctf64_array) (fa, da, 3);
+  f.d = fa[2];
+  rc += check_uint64 ("vec_dfp128_ctf64_array:", f.u, 1);
+  ea[0] = 1.5DL;
+  ea[1] = -7E+20DL;
+  ea[2] = 0.DL;
+  __VEC_PWR_IMP (vec_dfp128_ctsqz_array) ((vi128_t *) &x, ea + 1, 1);
+  rc += check_int128 ("vec_dfp128_ctsqz_array:", x,
+		      (__int128) -7 * 100000000000000000000UL);
+
+  return (rc);
+}
+
+int
+test_bcd_rescale (void)
+{
+  /* +12345, -12345, +12355, -12355, +15, -15, +0, +12341 / 10 for
+     each of the vec_round_t modes.  */
+  const unsigned long ba[8] =
+    { 0x12345c, 0x12345d, 0x12355c, 0x12355d, 0x15c, 0x15d, 0x0c,
+      0x12341c };
+  const unsigned long be[6][8] =
+    {
+      // TRUNC
+      { 0x1234c, 0x1234d, 0x1235c, 0x1235d, 0x1c, 0x1d, 0x0c, 0x1234c },
+      // HALF_UP
+      { 0x1235c, 0x1235d, 0x1236c, 0x1236d, 0x2c, 0x2d, 0x0c, 0x1234c },
+      // HALF_EVEN
+      { 0x1234c, 0x1234d, 0x1236c, 0x1236d, 0x2c, 0x2d, 0x0c, 0x1234c },
+      // UP
+      { 0x1235c, 0x1235d, 0x1236c, 0x1236d, 0x2c, 0x2d, 0x0c, 0x1235c },
+      // FLOOR
+      { 0x1234c, 0x1235d, 0x1235c, 0x1236d, 0x1c, 0x2d, 0x0c, 0x1234c },
+      // CEIL
+      { 0x1235c, 0x1234d, 0x1236c, 0x1235d, 0x2c, 0x1d, 0x0c, 0x1235c }
+    };
+  /* 1.2345, -1.2345, 1.2355, -1.2355, 1.2341 quantized to 3 digits,
+     then a 34 digit integer that overflows.  */
+  const _Decimal128 da[6] =
+    { 1.2345DL, -1.2345DL, 1.2355DL, -1.2355DL, 1.2341DL,
+      9999999999999999999999999999999999DL };
+  const _Decimal128 de[6][5] =
+    {
+      { 1.234DL, -1.234DL, 1.235DL, -1.235DL, 1.234DL },
+      { 1.235DL, -1.235DL, 1.236DL, -1.236DL, 1.234DL },
+      { 1.234DL, -1.234DL, 1.236DL, -1.236DL, 1.234DL },
+      { 1.235DL, -1.235DL, 1.236DL, -1.236DL, 1.235DL },
+      { 1.234DL, -1.235DL, 1.235DL, -1.236DL, 1.234DL },
+      { 1.235DL, -1.234DL, 1.236DL, -1.235DL, 1.235DL }
+    };
+  vBCD_t a[8], r[8], e;
+  _Decimal128 dr[6];
+  unsigned char ovf[8];
+  long novf;
+  int i, rnd, rc = 0;
+
+  printf ("\n%s Vector BCD and _Decimal128 rescale */\n", __FUNCTION__);
+
+  for (i = 0; i < 8; i++)
+    a[i] = (vBCD_t) CONST_VINT128_DW128 (0, ba[i]);
+
+  for (rnd = VEC_ROUND_TRUNC; rnd <= VEC_ROUND_CEIL; rnd++)
+    {
+      novf = __VEC_PWR_IMP (vec_bcdrescale_array) (r, a, -1, rnd, ovf, 8);
+      rc += check_int64 ("vec_bcdrescale_array novf:", novf, 0);
+      for (i = 0; i < 8; i++)
+	{
+	  e = (vBCD_t) CONST_VINT128_DW128 (0, be[rnd][i]);
+	  rc += check_vuint128x ("vec_bcdrescale_array:", (vui128_t) r[i],
+				 (vui128_t) e);
+	  rc += check_vuint128x ("vec_bcdsr_rnd:",
+				 (vui128_t) vec_bcdsr_rnd (a[i], 1, rnd),
+				 (vui128_t) e);
+	  rc += check_int64 ("vec_bcdrescale_array ovf:", ovf[i], 0);
+	}
+
+      novf = __VEC_PWR_IMP (vec_dfp128_rescale_array) (dr, (_Decimal128 *) da,
+							3, rnd, ovf, 6);
+      rc += check_int64 ("vec_dfp128_rescale_array novf:", novf, 1);
+      rc += check_int64 ("vec_dfp128_rescale_array ovf:", ovf[5], 1);
+      for (i = 0; i < 5; i++)
+	{
+	  rc += check_dfp128 ("vec_dfp128_rescale_array:", dr[i], de[rnd][i]);
+	  rc += check_int64 ("vec_dfp128_rescale_array exp:",
+			     __builtin_dxexq (dr[i]) - 6176, -3);
+	}
+    }
+
+  // Ties to even with a sticky digit, and exact ties.
+  e = (vBCD_t) CONST_VINT128_DW128 (0, 0x124c);
+  rc += check_vuint128x ("vec_bcdsr_rnd sticky:",
+			 (vui128_t) vec_bcdsr_rnd (
+			     (vBCD_t) CONST_VINT128_DW128 (0, 0x12251c), 2,
+			     VEC_ROUND_HALF_EVEN),
+			 (vui128_t) CONST_VINT128_DW128 (0, 0x123c));
+  rc += check_vuint128x ("vec_bcdsr_rnd odd:",
+			 (vui128_t) vec_bcdsr_rnd (
+			     (vBCD_t) CONST_VINT128_DW128 (0, 0x12350c), 2,
+			     VEC_ROUND_HALF_EVEN), (vui128_t) e);
+  rc += check_vuint128x ("vec_bcdsr_rnd even:",
+			 (vui128_t) vec_bcdsr_rnd (
+			     (vBCD_t) CONST_VINT128_DW128 (0, 0x12450c), 2,
+			     VEC_ROUND_HALF_EVEN), (vui128_t) e);
+  // All digits shifted out.
+  rc += check_vuint128x ("vec_bcdsr_rnd 32:",
+			 (vui128_t) vec_bcdsr_rnd (a[1], 32, VEC_ROUND_UP),
+			 (vui128_t) CONST_VINT128_DW128 (0, 0x1d));
+
+  // Scale up, 31 nines overflow and keep the low 29 digits.
+  a[0] = (vBCD_t) CONST_VINT128_DW128 (0x9999999999999999UL,
+				       0x999999999999999cUL);
+  novf = __VEC_PWR_IMP (vec_bcdrescale_array) (r, a, 2, VEC_ROUND_TRUNC,
+					       ovf, 2);
+  rc += check_int64 ("vec_bcdrescale_array novf up:", novf, 1);
+  rc += check_int64 ("vec_bcdrescale_array ovf up:", ovf[0], 1);
+  rc += check_vuint128x ("vec_bcdrescale_array up:", (vui128_t) r[0],
+			 (vui128_t) CONST_VINT128_DW128 (0x9999999999999999UL,
+							 0x999999999999900cUL));
+  rc += check_vuint128x ("vec_bcdrescale_array up:", (vui128_t) r[1],
+			 (vui128_t) CONST_VINT128_DW128 (0, 0x1234500d));
+
+  return (rc);
+}
+
+static int
+check_f128str (char *prefix, char *buf, int n, const char *shouldbe)
+{
+  int rc = 0;
+
+  if ((n != (int) strlen (shouldbe)) || strcmp (buf, shouldbe))
+    {
+      rc = 1;
+      printf ("%s \"%s\" should be \"%s\"\n", prefix, buf, shouldbe);
+    }
+
+  return (rc);
+}
+
+/* Return 1 if a decimal string with one digit less than the
+   vec_f128_ctstr() string s also converts to b, so s is not the
+   shortest. Only the truncation of s and its successor in the last
+   kept digit can be in the rounding interval of b.  */
+static int
+test_f128str_shorter (const char *s, __binary128 b)
+{
+  char dig[VEC_F128_STR_MAX], str[VEC_F128_STR_MAX + 8];
+  const char *p = s;
+  char *end;
+  vui128_t vb = vec_xfer_bin128_2_vui128t (b);
+  long exp;
+  int neg = 0, nd = 0, i, j, k, m;
+
+  if (*p == '-')
+    {
+      neg = 1;
+      p++;
+    }
+  for (; *p != '\0' && *p != 'e'; p++)
+    if (*p >= '0' && *p <= '9')
+      dig[nd++] = *p;
+  if (*p != 'e' || nd < 2)
+    return 0;
+  exp = strtol (p + 1, NULL, 10);
+
+  for (k = 0; k < 2; k++)
+    {
+      m = nd - 1;
+      if (k == 1)
+	{
+	  // Add 1 in the last kept digit, 9.99 becomes 1.0e+1.
+	  for (i = m - 1; i >= 0 && dig[i] == '9'; i--)
+	    dig[i] = '0';
+	  if (i < 0)
+	    {
+	      dig[0] = '1';
+	      m = 1;
+	      exp++;
+	    }
+	  else
+	    dig[i]++;
+	}
+      j = 0;
+      if (neg)
+	str[j++] = '-';
+      str[j++] = dig[0];
+      if (m > 1)
+	{
+	  str[j++] = '.';
+	  for (i = 1; i < m; i++)
+	    str[j++] = dig[i];
+	}
+      sprintf (&str[j], "e%ld", exp);
+      if (vec_all_eq ((vui32_t) vec_xfer_bin128_2_vui128t (
+			  __VEC_PWR_IMP (vec_f128_cfstr) (str, &end)),
+		      (vui32_t) vb))
+	{
+	  printf ("vec_f128_ctstr \"%s\" is not shortest, \"%s\"\n", s,
+		  str);
+	  return 1;
+	}
+    }
+  return 0;
+}
+
+int
+test_f128_str (void)
+{
+  const unsigned long ba[8][2] =
+    {
+      { 0x3ffb999999999999UL, 0x999999999999999aUL },
+      { 0x7ffeffffffffffffUL, 0xffffffffffffffffUL },
+      { 0x0001000000000000UL, 0 },
+      { 0, 1 },
+      { 0xc000400000000000UL, 0 },
+      { 0x8000000000000000UL, 0 },
+      { 0xffff000000000000UL, 0 },
+      { 0x7fff800000000000UL, 0 }
+    };
+  const char *be[8] =
+    { "1e-01", "1.189731495357231765085759326628007e+4932",
+      "3.3621031431120935062626778173217526e-4932", "6e-4966",
+      "-2.5e+00", "-0e+00", "-inf", "nan" };
+  char buf[VEC_F128_STR_MAX];
+  char *end;
+  __binary128 b;
+  vui128_t e;
+  unsigned long x, hi, lo;
+  int i, n, rc = 0;
+
+  printf ("\n%s Vector binary128 to/from decimal strings */\n",
+	  __FUNCTION__);
+
+  for (i = 0; i < 8; i++)
+    {
+      b = vec_xfer_vui128t_2_bin128 ((vui128_t) CONST_VINT128_DW128 (
+	  ba[i][0], ba[i][1]));
+      n = __VEC_PWR_IMP (vec_f128_ctstr) (buf, b);
+      rc += check_f128str ("vec_f128_ctstr:", buf, n, be[i]);
+      // Shortest digits must parse back to the same bits, NaN included.
+      b = __VEC_PWR_IMP (vec_f128_cfstr) (buf, &end);
+      e = (vui128_t) CONST_VINT128_DW128 (ba[i][0], ba[i][1]);
+      rc += check_vuint128x ("vec_f128_cfstr round trip:",
+			     vec_xfer_bin128_2_vui128t (b), e);
+      rc += check_int64 ("vec_f128_cfstr endptr:", end - buf, n);
+    }
+
+  // 36 digits, just below and just above the rounding boundary of max.
+  b = __VEC_PWR_IMP (vec_f128_cfstr) (
+      "1.18973149535723176508575932662800702e4932", &end);
+  e = (vui128_t) CONST_VINT128_DW128 (0x7ffeffffffffffffUL,
+				      0xffffffffffffffffUL);
+  rc += check_vuint128x ("vec_f128_cfstr max:",
+			 vec_xfer_bin128_2_vui128t (b), e);
+  b = __VEC_PWR_IMP (vec_f128_cfstr) (
+      "1.18973149535723176508575932662800713e4932", &end);
+  e = (vui128_t) CONST_VINT128_DW128 (0x7fff000000000000UL, 0);
+  rc += check_vuint128x ("vec_f128_cfstr max+:",
+			 vec_xfer_bin128_2_vui128t (b), e);
+  // Underflow to zero and a trailing suffix.
+  b = __VEC_PWR_IMP (vec_f128_cfstr) ("1e-5000xyz", &end);
+  e = (vui128_t) CONST_VINT128_DW128 (0, 0);
+  rc += check_vuint128x ("vec_f128_cfstr 1e-5000:",
+			 vec_xfer_bin128_2_vui128t (b), e);
+  rc += check_int64 ("vec_f128_cfstr 1e-5000 endptr:", *end, 'x');
+  // No conversion leaves endptr at the start of the string.
+  b = __VEC_PWR_IMP (vec_f128_cfstr) ("abc", &end);
+  rc += check_int64 ("vec_f128_cfstr abc endptr:", *end, 'a');
+
+  // Random finite values over the full exponent range, plus values
+  // with short decimal forms (integers times a power of 10). Each
+  // string must parse back to the same bits and be the shortest.
+  x = 0x9e3779b97f4a7c15UL;
+  for (i = 0; i < 20000 && rc < 10; i++)
+    {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      hi = x;
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      lo = x;
+      if (i & 1)
+	{
+	  // An integer of up to 57 bits scaled by 10**(-40..40).
+	  snprintf (buf, sizeof (buf), "%lue%d",
+		    hi % (1UL << (lo % 57 + 1)), (int) (lo % 81) - 40);
+	  b = __VEC_PWR_IMP (vec_f128_cfstr) (buf, &end);
+	}
+      else
+	{
+	  // Skip Inf and NaN exponents.
+	  if ((hi & 0x7fff000000000000UL) == 0x7fff000000000000UL)
+	    hi ^= 0x4000000000000000UL;
+	  b = vec_xfer_vui128t_2_bin128 ((vui128_t) CONST_VINT128_DW128 (
+	      hi, lo));
+	}
+      e = vec_xfer_bin128_2_vui128t (b);
+      n = __VEC_PWR_IMP (vec_f128_ctstr) (buf, b);
+      b = __VEC_PWR_IMP (vec_f128_cfstr) (buf, &end);
+      if (check_vuint128x ("vec_f128_cfstr random round trip:",
+			   vec_xfer_bin128_2_vui128t (b), e))
+	{
+	  printf ("  string \"%s\"\n", buf);
+	  rc++;
+	}
+      rc += check_int64 ("vec_f128_cfstr random endptr:", end - buf, n);
+      rc += test_f128str_shorter (buf, b);
+    }
+
+  return (rc);
+}
+
+/* As test_f128str_shorter for the vec_f64_ctstr() (f32 == 0) or
+   vec_f32_ctstr() (f32 != 0) string s of u, parsed with strtod or
+   strtof.  */
+static int
+test_f64str_shorter (const char *s, unsigned long u, int f32)
+{
+  char dig[VEC_F64_STR_MAX], str[VEC_F64_STR_MAX + 8];
+  const char *p = s;
+  union
+  {
+    double d;
+    float f;
+    unsigned long u;
+    unsigned int w;
+  } r;
+  long exp;
+  int neg = 0, nd = 0, i, j, k, m;
+
+  if (*p == '-')
+    {
+      neg = 1;
+      p++;
+    }
+  for (; *p != '\0' && *p != 'e'; p++)
+    if (*p >= '0' && *p <= '9')
+      dig[nd++] = *p;
+  if (*p != 'e' || nd < 2)
+    return 0;
+  exp = strtol (p + 1, NULL, 10);
+
+  for (k = 0; k < 2; k++)
+    {
+      m = nd - 1;
+      if (k == 1)
+	{
+	  // Add 1 in the last kept digit, 9.99 becomes 1.0e+1.
+	  for (i = m - 1; i >= 0 && dig[i] == '9'; i--)
+	    dig[i] = '0';
+	  if (i < 0)
+	    {
+	      dig[0] = '1';
+	      m = 1;
+	      exp++;
+	    }
+	  else
+	    dig[i]++;
+	}
+      j = 0;
+      if (neg)
+	str[j++] = '-';
+      str[j++] = dig[0];
+      if (m > 1)
+	{
+	  str[j++] = '.';
+	  for (i = 1; i < m; i++)
+	    str[j++] = dig[i];
+	}
+      sprintf (&str[j], "e%ld", exp);
+      r.u = 0;
+      if (f32)
+	r.f = strtof (str, NULL);
+      else
+	r.d = strtod (str, NULL);
+      if ((f32 ? r.w : r.u) == u)
+	{
+	  printf ("vec_f%d_ctstr \"%s\" is not shortest, \"%s\"\n",
+		  f32 ? 32 : 64, s, str);
+	  return 1;
+	}
+    }
+  return 0;
+}
+
+int
+test_f64_str (void)
+{
+  const unsigned long da[8] =
+    { 0x3fb999999999999aUL, 0x7fefffffffffffffUL, 0x0010000000000000UL,
+      0x0000000000000001UL, 0xc004000000000000UL, 0x8000000000000000UL,
+      0x44b52d02c7e14af6UL, 0x7ff8000000000000UL };
+  const char *de[8] =
+    { "1e-01", "1.7976931348623157e+308", "2.2250738585072014e-308",
+      "5e-324", "-2.5e+00", "-0e+00", "1e+23", "nan" };
+  const unsigned int fa[6] =
+    { 0x3dcccccd, 0x7f7fffff, 0x00800000, 0x00000001, 0xff800000,
+      0x3e99999a };
+  const char *fe[6] =
+    { "1e-01", "3.4028235e+38", "1.1754944e-38", "1e-45", "-inf",
+      "3e-01" };
+  union
+  {
+    double d[8];
+    unsigned long u[8];
+  } f64;
+  union
+  {
+    float f[6];
+    unsigned int u[6];
+  } f32;
+  char buf[8 * VEC_F64_STR_MAX];
+  unsigned long x, r;
+  long n;
+  int i, rc = 0;
+
+  printf ("\n%s Vector double and float to decimal strings */\n",
+	  __FUNCTION__);
+
+  for (i = 0; i < 8; i++)
+    {
+      f64.u[i] = da[i];
+      n = __VEC_PWR_IMP (vec_f64_ctstr) (buf, f64.d[i]);
+      rc += check_f128str ("vec_f64_ctstr:", buf, n, de[i]);
+    }
+  for (i = 0; i < 6; i++)
+    {
+      f32.u[i] = fa[i];
+      n = __VEC_PWR_IMP (vec_f32_ctstr) (buf, f32.f[i]);
+      rc += check_f128str ("vec_f32_ctstr:", buf, n, fe[i]);
+    }
+
+  // Pairs plus an odd last value.
+  n = __VEC_PWR_IMP (vec_f64_ctstr_array) (buf, f64.d, 5, ',');
+  rc += check_f128str ("vec_f64_ctstr_array:", buf, n,
+		       "1e-01,1.7976931348623157e+308,"
+		       "2.2250738585072014e-308,5e-324,-2.5e+00");
+  n = __VEC_PWR_IMP (vec_f32_ctstr_array) (buf, f32.f, 6, ' ');
+  rc += check_f128str ("vec_f32_ctstr_array:", buf, n,
+		       "1e-01 3.4028235e+38 1.1754944e-38 1e-45 -inf 3e-01");
+  n = __VEC_PWR_IMP (vec_f64_ctstr_array) (buf, f64.d, 0, ',');
+  rc += check_f128str ("vec_f64_ctstr_array 0:", buf, n, "");
+
+  // Random finite values; full range, subnormals, powers of 2 and
+  // integers times a power of 10 (short decimal forms, where the
+  // exact quotient has trailing zeros). Each string must parse back
+  // (strtod, strtof) to the same bits and be the shortest. Pairs go
+  // through vec_f64_ctstr_array, which formats 2 values at once, and
+  // must match the single value strings.
+  x = 0x9e3779b97f4a7c15UL;
+  for (i = 0; i < 20000 && rc < 10; i++)
+    {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      r = x;
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      switch (i & 3)
+	{
+	case 0:
+	  break;
+	case 1:
+	  // Subnormal
+	  r &= 0x800fffffffffffffUL;
+	  break;
+	case 2:
+	  // Power of 2
+	  r &= 0xfff0000000000000UL;
+	  break;
+	default:
+	  // An integer of up to 54 bits scaled by 10**(-30..30).
+	  snprintf (buf, sizeof (buf), "%lue%d",
+		    r % (1UL << (x % 54 + 1)), (int) ((x >> 8) % 61) - 30);
+	  f64.d[0] = strtod (buf, NULL);
+	  f32.f[0] = strtof (buf, NULL);
+	  r = f64.u[0];
+	  x = (x & ~0xffffffffUL) | f32.u[0];
+	  break;
+	}
+      // Skip Inf and NaN exponents.
+      if ((r & 0x7ff0000000000000UL) == 0x7ff0000000000000UL)
+	r ^= 0x4000000000000000UL;
+      if ((x & 0x7f800000UL) == 0x7f800000UL)
+	x ^= 0x40000000UL;
+      if ((i & 3) == 1)
+	x &= 0x807fffffUL;
+      else if ((i & 3) == 2)
+	x &= 0xff800000UL;
+
+      f64.u[i & 1] = r;
+      n = __VEC_PWR_IMP (vec_f64_ctstr) (buf, f64.d[i & 1]);
+      f64.d[2] = strtod (buf, NULL);
+      if (f64.u[2] != r)
+	{
+	  printf ("vec_f64_ctstr random round trip: \"%s\" is %016lx"
+		  " should be %016lx\n", buf, f64.u[2], r);
+	  rc++;
+	}
+      rc += test_f64str_shorter (buf, r, 0);
+      if (i & 1)
+	{
+	  char buf2[2 * VEC_F64_STR_MAX];
+	  n = __VEC_PWR_IMP (vec_f64_ctstr) (buf2, f64.d[0]);
+	  buf2[n] = ',';
+	  __VEC_PWR_IMP (vec_f64_ctstr) (&buf2[n + 1], f64.d[1]);
+	  n = __VEC_PWR_IMP (vec_f64_ctstr_array) (buf, f64.d, 2, ',');
+	  rc += check_f128str ("vec_f64_ctstr_array random:", buf, n, buf2);
+	}
+
+      f32.u[0] = (unsigned int) x;
+      n = __VEC_PWR_IMP (vec_f32_ctstr) (buf, f32.f[0]);
+      f32.f[1] = strtof (buf, NULL);
+      if (f32.u[1] != f32.u[0])
+	{
+	  printf ("vec_f32_ctstr random round trip: \"%s\" is %08x"
+		  " should be %08x\n", buf, f32.u[1], f32.u[0]);
+	  rc++;
+	}
+      rc += test_f64str_shorter (buf, f32.u[0], 1);
+    }
+
+  return (rc);
+}
+
+int
+test_dfp_batch (void)
+{
+  _Decimal128 sa[4] = { 1.10DL, 2.205DL, -0.3DL, 1E-3DL };
+  _Decimal128 ra[3] = { 1E34DL, 6DL, 6DL };
+  _Decimal128 za[2] = { 1.5DL, -1.5DL };
+  _Decimal128 na[2] = { -0.0DL, -0.00DL };
+  _Decimal128 ia[2] = { 1DL, __builtin_infd128 () };
+  _Decimal128 da[3] = { 1.5DL, 2.25DL, -3DL };
+  _Decimal128 db[3] = { 2DL, 4DL, 1.1DL };
+  _Decimal128 ca[4] =
+    { 1.25DL, -2.5DL, 1234567890123456789012345678901234DL,
+      9.999999999999999999999999999999999E6144DL };
+  _Decimal128 cr[4];
+  _Decimal64 ea[3] = { 0.1DD, 0.2DD, 0.3DD };
+  _Decimal64 eb[3] = { 1.5DD, 2DD, -4E-2DD };
+  _Decimal64 er[3];
+  _Decimal128 r;
+  vui64_t t;
+  int i, rc = 0;
+
+  printf ("\n%s Vector _Decimal128/_Decimal64 batch sum, dot, scale */\n",
+	  __FUNCTION__);
+
+  r = __VEC_PWR_IMP (vec_dfp128_sum_array) (sa, 4);
+  rc += check_dfp128 ("vec_dfp128_sum_array:", r, 3.006DL);
+  rc += check_int64 ("vec_dfp128_sum_array exp:",
+		     __builtin_dxexq (r) - 6176, -3);
+#ifdef _ARCH_PWR8
+  // The DFP loop rounds 1E34 + 6 up, twice. The exact sum rounds once.
+  r = __VEC_PWR_IMP (vec_dfp128_sum_array) (ra, 3);
+  rc += check_dfp128 ("vec_dfp128_sum_array exact:", r,
+		      1.000000000000000000000000000000001E34DL);
+#endif
+  r = __VEC_PWR_IMP (vec_dfp128_sum_array) (za, 2);
+  t = (vui64_t) vec_pack_Decimal128 (r);
+  rc += check_dfp128 ("vec_dfp128_sum_array 0:", r, 0DL);
+  rc += check_int64 ("vec_dfp128_sum_array 0 exp:",
+		     __builtin_dxexq (r) - 6176, -1);
+  rc += check_int64 ("vec_dfp128_sum_array 0 sign:", t[VEC_DW_H] >> 63, 0);
+  r = __VEC_PWR_IMP (vec_dfp128_sum_array) (na, 2);
+  t = (vui64_t) vec_pack_Decimal128 (r);
+  rc += check_int64 ("vec_dfp128_sum_array -0 sign:", t[VEC_DW_H] >> 63, 1);
+  r = __VEC_PWR_IMP (vec_dfp128_sum_array) (ia, 2);
+  rc += check_dfp128 ("vec_dfp128_sum_array inf:", r,
+		      __builtin_infd128 ());
+  r = __VEC_PWR_IMP (vec_dfp128_sum_array) (sa, 0);
+  rc += check_dfp128 ("vec_dfp128_sum_array n=0:", r, 0DL);
+
+  r = __VEC_PWR_IMP (vec_dfp128_dot_array) (da, db, 3);
+  rc += check_dfp128 ("vec_dfp128_dot_array:", r, 8.70DL);
+  rc += check_int64 ("vec_dfp128_dot_array exp:",
+		     __builtin_dxexq (r) - 6176, -2);
+
+  // The same results as the DFP multiply, including the rounded and
+  // overflowed products.
+  __VEC_PWR_IMP (vec_dfp128_scale_array) (cr, ca, 1.1DL, 4);
+  for (i = 0; i < 4; i++)
+    {
+      rc += check_dfp128 ("vec_dfp128_scale_array:", cr[i], ca[i] * 1.1DL);
+      if (i < 3)
+	rc += check_int64 ("vec_dfp128_scale_array exp:",
+			   __builtin_dxexq (cr[i]),
+			   __builtin_dxexq (ca[i] * 1.1DL));
+    }
+
+  r = __VEC_PWR_IMP (vec_dfp64_sum_array) (ea, 3);
+  rc += check_dfp128 ("vec_dfp64_sum_array:", r, 0.6DL);
+  r = __VEC_PWR_IMP (vec_dfp64_dot_array) (ea, eb, 3);
+  rc += check_dfp128 ("vec_dfp64_dot_array:", r, 0.538DL);
+  rc += check_int64 ("vec_dfp64_dot_array exp:",
+		     __builtin_dxexq (r) - 6176, -3);
+  __VEC_PWR_IMP (vec_dfp64_scale_array) (er, eb, 0.2DD, 3);
+  for (i = 0; i < 3; i++)
+    rc += check_dfp64 ("vec_dfp64_scale_array:", er[i], eb[i] * 0.2DD);
+
+  return (rc);
+}
 #undef __DEBUG_PRINT__
 
  //#define __DEBUG_PRINT__ 1
@@ -7645,6 +8706,116 @@ test_bcddive (void)
  return (rc);
 }
 
+/* The binary (_rdx) multiply and divide must match the DFP
+   implementations. The DFP divide can return -0 for a zero quotient
+   where the _rdx divide returns +0, so the expected quotient is
+   normalized with vec_bcdadd (e, +0).  */
+int
+test_bcd_muldiv_rdx (void)
+{
+  const vBCD_t ops[] =
+    {
+      (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000000c),
+      (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000001c),
+      (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000001d),
+      (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000007d),
+      (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x9999999c),
+      (vBCD_t) CONST_VINT128_W (0, 0, 0x12345678, 0x9012345d),
+      (vBCD_t) CONST_VINT128_W (0, 0x9, 0x99999999, 0x9999999c),
+      (vBCD_t) CONST_VINT128_W (0x00098765, 0x43210987, 0x65432109,
+				0x8765432d),
+      (vBCD_t) CONST_VINT128_W (0x12345678, 0x90123456, 0x78901234,
+				0x5678901c),
+      (vBCD_t) CONST_VINT128_W (0x99999999, 0x99999999, 0x99999999,
+				0x9999999c),
+      (vBCD_t) CONST_VINT128_W (0x99999999, 0x99999999, 0x99999999,
+				0x9999999d)
+    };
+  const int n = sizeof (ops) / sizeof (ops[0]);
+  vBCD_t i, j, k, e;
+  int ii, jj;
+  int rc = 0;
+
+  printf ("\n%s Vector BCD binary multiply/divide */\n", __FUNCTION__);
+
+  for (ii = 0; ii < n; ii++)
+    for (jj = 0; jj < n; jj++)
+      {
+	k = vec_bcdmul_rdx (ops[ii], ops[jj]);
+	e = vec_bcdmul (ops[ii], ops[jj]);
+#ifdef __DEBUG_PRINT__
+	print_vint128x_sum ("bcd (a * b)", k, ops[ii], ops[jj]);
+#endif
+	rc += check_vuint128x ("vec_bcdmul_rdx:", (vui128_t) k, (vui128_t) e);
+
+	k = vec_bcdmulh_rdx (ops[ii], ops[jj]);
+	e = vec_bcdmulh (ops[ii], ops[jj]);
+	rc += check_vuint128x ("vec_bcdmulh_rdx:", (vui128_t) k, (vui128_t) e);
+
+	if (ii == 0 || jj == 0)
+	  continue;
+	k = vec_bcddiv_rdx (ops[ii], ops[jj]);
+	e = vec_bcdadd (vec_bcddiv (ops[ii], ops[jj]), _BCD_CONST_ZERO);
+#ifdef __DEBUG_PRINT__
+	print_vint128x_sum ("bcd (a / b)", k, ops[ii], ops[jj]);
+#endif
+	rc += check_vuint128x ("vec_bcddiv_rdx:", (vui128_t) k, (vui128_t) e);
+      }
+
+  // The DFP quotient of a * 10**32 is rounded to 34 digits, so compare
+  // vec_bcddive_rdx to exact quotients (the low order 31 digits).
+  // 10**32 / 3
+  i = (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000001d);
+  j = (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000003c);
+  k = vec_bcddive_rdx (i, j);
+  e = (vBCD_t) CONST_VINT128_W (0x33333333, 0x33333333, 0x33333333,
+				0x3333333d);
+  rc += check_vuint128x ("vec_bcddive_rdx:", (vui128_t) k, (vui128_t) e);
+
+  i = (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000001c);
+  j = (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x0000007d);
+  k = vec_bcddive_rdx (i, j);
+  e = (vBCD_t) CONST_VINT128_W (0x42857142, 0x85714285, 0x71428571,
+				0x4285714d);
+  rc += check_vuint128x ("vec_bcddive_rdx:", (vui128_t) k, (vui128_t) e);
+
+  // Almost PI
+  i = (vBCD_t) CONST_VINT128_W (0, 0, 0, 0x628321c);
+  j = (vBCD_t) CONST_VINT128_W (0, 0, 0x2, 0x0000079c);
+  k = vec_bcddive_rdx (i, j);
+  e = (vBCD_t) CONST_VINT128_W (0x31415925, 0x90709266, 0x69839654,
+				0x1333661c);
+  rc += check_vuint128x ("vec_bcddive_rdx:", (vui128_t) k, (vui128_t) e);
+
+  i = (vBCD_t) CONST_VINT128_W (0x12345678, 0x90123456, 0x78901234,
+				0x5678901c);
+  j = (vBCD_t) CONST_VINT128_W (0x99999999, 0x99999999, 0x99999999,
+				0x9999999c);
+  k = vec_bcddive_rdx (i, j);
+  e = (vBCD_t) CONST_VINT128_W (0x23456789, 0x01234567, 0x89012345,
+				0x6789011c);
+  rc += check_vuint128x ("vec_bcddive_rdx:", (vui128_t) k, (vui128_t) e);
+
+  i = (vBCD_t) CONST_VINT128_W (0x99999999, 0x99999999, 0x99999999,
+				0x9999998d);
+  j = (vBCD_t) CONST_VINT128_W (0x99999999, 0x99999999, 0x99999999,
+				0x9999999d);
+  k = vec_bcddive_rdx (i, j);
+  e = (vBCD_t) CONST_VINT128_W (0x99999999, 0x99999999, 0x99999999,
+				0x9999989c);
+  rc += check_vuint128x ("vec_bcddive_rdx:", (vui128_t) k, (vui128_t) e);
+
+  // Conversions without the DFP unit
+  i = (vBCD_t) CONST_VINT128_W (0x98765432, 0x10987654, 0x32109876,
+				0x54321098);
+  k = vec_bcdcfuq_rdx (vec_bcdctuq_rdx (i));
+  rc += check_vuint128x ("vec_bcdcf/ctuq_rdx:", (vui128_t) k, (vui128_t) i);
+  e = vec_bcdcfuq (vec_bcdctuq (i));
+  rc += check_vuint128x ("vec_bcdcf/ctuq_rdx:", (vui128_t) k, (vui128_t) e);
+
+  return (rc);
+}
+
 //#define __DEBUG_PRINT__ 1
 int
 test_bcd_p2 (void)
@@ -8581,6 +9752,18 @@ test_vec_bcd (void)
 
   rc += test_bcd_muldiv ();
 
+  rc += test_bcd_muldiv_runtime ();
+
+  rc += test_bcd_byN ();
+
+  rc += test_bcdrec ();
+
+  rc += test_dfp128_conv ();
+  rc += test_bcd_rescale ();
+  rc += test_f128_str ();
+  rc += test_f64_str ();
+  rc += test_dfp_batch ();
+
   rc += test_cvtbcd2c100 ();
 
   rc += test_cvtbcd2c10k ();
@@ -8649,6 +9832,7 @@ test_vec_bcd (void)
   rc += test_vec_bcdcfsq ();
 
   rc += test_bcddive ();
+  rc += test_bcd_muldiv_rdx ();
 
   rc += test_bcd_p2 ();
   rc += test_bcd_p2B ();
@@ -13090,6 +13090,839 @@ test_convert_qpdpo (void)
   return (rc);
 }
 
+int
+test_convert_matrix (void)
+{
+  __binary128 x;
+  vi64_t td;
+  vui64_t tu, e, xui;
+  vi128_t tq;
+  vf64_t tf;
+  vf32_t ts;
+  int rc = 0;
+  printf ("\n%s\n", __FUNCTION__);
+
+  // -1.5 truncates to -1
+  xui = CONST_VINT128_DW ( 0xbfff800000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  td = vec_xscvqpsdz (x);
+  e = CONST_VINT128_DW ( 0xffffffffffffffff, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsdz", (vui128_t) td, (vui128_t) e);
+  td = vec_xscvqpswz (x);
+  rc += check_vuint128x ("check vec_xscvqpswz", (vui128_t) td, (vui128_t) e);
+  tu = vec_xscvqpuwz (x);
+  e = CONST_VINT128_DW ( 0, 0 );
+  rc += check_vuint128x ("check vec_xscvqpuwz", (vui128_t) tu, (vui128_t) e);
+  tq = vec_xscvqpsqz (x);
+  e = CONST_VINT128_DW ( 0xffffffffffffffff, 0xffffffffffffffff );
+  rc += check_vuint128x ("check vec_xscvqpsqz", (vui128_t) tq, (vui128_t) e);
+
+  // 2**70 saturates word and doubleword
+  xui = CONST_VINT128_DW ( 0x4045000000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  td = vec_xscvqpsdz (x);
+  e = CONST_VINT128_DW ( 0x7fffffffffffffff, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsdz", (vui128_t) td, (vui128_t) e);
+  td = vec_xscvqpswz (x);
+  e = CONST_VINT128_DW ( 0x7fffffff, 0 );
+  rc += check_vuint128x ("check vec_xscvqpswz", (vui128_t) td, (vui128_t) e);
+  tu = vec_xscvqpuwz (x);
+  e = CONST_VINT128_DW ( 0xffffffff, 0 );
+  rc += check_vuint128x ("check vec_xscvqpuwz", (vui128_t) tu, (vui128_t) e);
+  tq = vec_xscvqpsqz (x);
+  e = CONST_VINT128_DW ( 0x40, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsqz", (vui128_t) tq, (vui128_t) e);
+
+  // -2**100
+  xui = CONST_VINT128_DW ( 0xc063000000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  td = vec_xscvqpsdz (x);
+  e = CONST_VINT128_DW ( 0x8000000000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsdz", (vui128_t) td, (vui128_t) e);
+  tq = vec_xscvqpsqz (x);
+  e = CONST_VINT128_DW ( 0xfffffff000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsqz", (vui128_t) tq, (vui128_t) e);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_inf );
+  tq = vec_xscvqpsqz (x);
+  e = CONST_VINT128_DW ( 0x7fffffffffffffff, 0xffffffffffffffff );
+  rc += check_vuint128x ("check vec_xscvqpsqz", (vui128_t) tq, (vui128_t) e);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_ninf );
+  tq = vec_xscvqpsqz (x);
+  e = CONST_VINT128_DW ( 0x8000000000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsqz", (vui128_t) tq, (vui128_t) e);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_nan );
+  tq = vec_xscvqpsqz (x);
+  rc += check_vuint128x ("check vec_xscvqpsqz", (vui128_t) tq, (vui128_t) e);
+  td = vec_xscvqpsdz (x);
+  rc += check_vuint128x ("check vec_xscvqpsdz", (vui128_t) td, (vui128_t) e);
+  td = vec_xscvqpswz (x);
+  e = CONST_VINT128_DW ( 0xffffffff80000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpswz", (vui128_t) td, (vui128_t) e);
+
+  // 1 + 2**-53 is half way between 1.0 and the next double
+  xui = CONST_VINT128_DW ( 0x3fff000000000000, 0x0800000000000000 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = CONST_VINT128_DW ( 0x3ff0000000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd even", (vui128_t) tf, (vui128_t) e);
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_TRUNC);
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd trunc", (vui128_t) tf, (vui128_t) e);
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_FLOOR);
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd floor", (vui128_t) tf, (vui128_t) e);
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_HALF_UP);
+  e = CONST_VINT128_DW ( 0x3ff0000000000001, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd half up", (vui128_t) tf, (vui128_t) e);
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_UP);
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd up", (vui128_t) tf, (vui128_t) e);
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_CEIL);
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd ceil", (vui128_t) tf, (vui128_t) e);
+
+  // -(1 + 2**-53)
+  xui = CONST_VINT128_DW ( 0xbfff000000000000, 0x0800000000000000 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_FLOOR);
+  e = CONST_VINT128_DW ( 0xbff0000000000001, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd floor", (vui128_t) tf, (vui128_t) e);
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_CEIL);
+  e = CONST_VINT128_DW ( 0xbff0000000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd ceil", (vui128_t) tf, (vui128_t) e);
+
+  // 1 + 3*2**-53 ties to even upward
+  xui = CONST_VINT128_DW ( 0x3fff000000000000, 0x1800000000000000 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = CONST_VINT128_DW ( 0x3ff0000000000002, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd even", (vui128_t) tf, (vui128_t) e);
+
+  // 1 + 2**-53 + 2**-60 is above the half way point
+  xui = CONST_VINT128_DW ( 0x3fff000000000000, 0x0810000000000000 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = CONST_VINT128_DW ( 0x3ff0000000000001, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd even", (vui128_t) tf, (vui128_t) e);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_max );
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_TRUNC);
+  e = CONST_VINT128_DW ( 0x7fefffffffffffff, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd trunc", (vui128_t) tf, (vui128_t) e);
+  tf = vec_xscvqpdp_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = CONST_VINT128_DW ( 0x7ff0000000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpdp_rnd even", (vui128_t) tf, (vui128_t) e);
+
+  // 1 + 2**-24 ties to 1.0f, 1 + 2**-24 + 2**-80 rounds up
+  xui = CONST_VINT128_DW ( 0x3fff000001000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  ts = vec_xscvqpsp (x);
+  e = (vui64_t) CONST_VINT128_W ( 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000 );
+  rc += check_vuint128x ("check vec_xscvqpsp", (vui128_t) ts, (vui128_t) e);
+  xui = CONST_VINT128_DW ( 0x3fff000001000000, 0x0000000100000000 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  ts = vec_xscvqpsp (x);
+  e = (vui64_t) CONST_VINT128_W ( 0x3f800001, 0x3f800001, 0x3f800001, 0x3f800001 );
+  rc += check_vuint128x ("check vec_xscvqpsp", (vui128_t) ts, (vui128_t) e);
+
+  // 1 + 2**-24 ties, so the nearest modes differ
+  xui = CONST_VINT128_DW ( 0x3fff000001000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = (vui64_t) CONST_VINT128_W ( 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000 );
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd even", (vui128_t) ts, (vui128_t) e);
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_TRUNC);
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd trunc", (vui128_t) ts, (vui128_t) e);
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_HALF_UP);
+  e = (vui64_t) CONST_VINT128_W ( 0x3f800001, 0x3f800001, 0x3f800001, 0x3f800001 );
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd half up", (vui128_t) ts, (vui128_t) e);
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_CEIL);
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd ceil", (vui128_t) ts, (vui128_t) e);
+
+  // 1 + 3*2**-24 ties to even upward
+  xui = CONST_VINT128_DW ( 0x3fff000003000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = (vui64_t) CONST_VINT128_W ( 0x3f800002, 0x3f800002, 0x3f800002, 0x3f800002 );
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd even", (vui128_t) ts, (vui128_t) e);
+
+  // -(1 + 2**-24 + 2**-80)
+  xui = CONST_VINT128_DW ( 0xbfff000001000000, 0x0000000100000000 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_FLOOR);
+  e = (vui64_t) CONST_VINT128_W ( 0xbf800001, 0xbf800001, 0xbf800001, 0xbf800001 );
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd floor", (vui128_t) ts, (vui128_t) e);
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_CEIL);
+  e = (vui64_t) CONST_VINT128_W ( 0xbf800000, 0xbf800000, 0xbf800000, 0xbf800000 );
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd ceil", (vui128_t) ts, (vui128_t) e);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_max );
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_TRUNC);
+  e = (vui64_t) CONST_VINT128_W ( 0x7f7fffff, 0x7f7fffff, 0x7f7fffff, 0x7f7fffff );
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd trunc", (vui128_t) ts, (vui128_t) e);
+  ts = vec_xscvqpsp_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = (vui64_t) CONST_VINT128_W ( 0x7f800000, 0x7f800000, 0x7f800000, 0x7f800000 );
+  rc += check_vuint128x ("check vec_xscvqpsp_rnd even", (vui128_t) ts, (vui128_t) e);
+
+  // 2.5 and -2.5 to word integers
+  xui = CONST_VINT128_DW ( 0x4000400000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  td = vec_xscvqpsw_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = CONST_VINT128_DW ( 2, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsw_rnd even", (vui128_t) td, (vui128_t) e);
+  tu = vec_xscvqpuw_rnd (x, VEC_ROUND_TRUNC);
+  rc += check_vuint128x ("check vec_xscvqpuw_rnd trunc", (vui128_t) tu, (vui128_t) e);
+  td = vec_xscvqpsw_rnd (x, VEC_ROUND_HALF_UP);
+  e = CONST_VINT128_DW ( 3, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsw_rnd half up", (vui128_t) td, (vui128_t) e);
+  tu = vec_xscvqpuw_rnd (x, VEC_ROUND_UP);
+  rc += check_vuint128x ("check vec_xscvqpuw_rnd up", (vui128_t) tu, (vui128_t) e);
+  xui = CONST_VINT128_DW ( 0xc000400000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  td = vec_xscvqpsw_rnd (x, VEC_ROUND_FLOOR);
+  e = CONST_VINT128_DW ( 0xfffffffffffffffd, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsw_rnd floor", (vui128_t) td, (vui128_t) e);
+  td = vec_xscvqpsw_rnd (x, VEC_ROUND_HALF_EVEN);
+  e = CONST_VINT128_DW ( 0xfffffffffffffffe, 0 );
+  rc += check_vuint128x ("check vec_xscvqpsw_rnd even", (vui128_t) td, (vui128_t) e);
+  tu = vec_xscvqpuw_rnd (x, VEC_ROUND_CEIL);
+  e = CONST_VINT128_DW ( 0, 0 );
+  rc += check_vuint128x ("check vec_xscvqpuw_rnd ceil", (vui128_t) tu, (vui128_t) e);
+
+  ts = (vf32_t) CONST_VINT128_W ( 0x3fc00000, 0x3fc00000, 0x3fc00000, 0x3fc00000 );
+  x = vec_xscvspqp (ts);
+  e = CONST_VINT128_DW ( 0x3fff800000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvspqp",
+			 (vui128_t) vec_xfer_bin128_2_vui64t (x), (vui128_t) e);
+
+  {
+    __binary128 ra[5];
+    int wa[5] = { -3, 0, 7, 2147483647, -2147483647 - 1 };
+    int wr[5];
+    float fr[2];
+    vi128_t qa[3], qr[3];
+    long i;
+
+    __VEC_PWR_IMP (vec_f128_cfsw_array) (ra, wa, 5);
+    __VEC_PWR_IMP (vec_f128_ctswz_array) (wr, ra, 5);
+    for (i = 0; i < 5; i++)
+      if (wr[i] != wa[i])
+	{
+	  printf ("check vec_f128_cfsw/ctswz_array [%ld] is %d should be %d\n",
+		  i, wr[i], wa[i]);
+	  rc++;
+	}
+
+    qa[0] = (vi128_t) CONST_VINT128_DW ( 0xfffffff000000000, 0 );
+    qa[1] = (vi128_t) CONST_VINT128_DW ( 0, 12345 );
+    qa[2] = (vi128_t) CONST_VINT128_DW ( 0x7fffffffffffffff, 0xffffffffffffffff );
+    __VEC_PWR_IMP (vec_f128_cfsq_array) (ra, qa, 3);
+    __VEC_PWR_IMP (vec_f128_ctsqz_array) (qr, ra, 3);
+    rc += check_vuint128x ("check vec_f128_ctsqz_array",
+			   (vui128_t) qr[0], (vui128_t) qa[0]);
+    rc += check_vuint128x ("check vec_f128_ctsqz_array",
+			   (vui128_t) qr[1], (vui128_t) qa[1]);
+    // 2**127-1 rounds up to 2**127 in quad-precision and saturates
+    rc += check_vuint128x ("check vec_f128_ctsqz_array",
+			   (vui128_t) qr[2], (vui128_t) qa[2]);
+
+    // +-(1 + 2**-24) round away from 1.0f toward +Infinity only
+    ra[0] = vec_xfer_vui64t_2_bin128 (
+	(vui64_t) CONST_VINT128_DW ( 0x3fff000001000000, 0 ));
+    ra[1] = vec_xfer_vui64t_2_bin128 (
+	(vui64_t) CONST_VINT128_DW ( 0xbfff000001000000, 0 ));
+    __VEC_PWR_IMP (vec_f128_ctf32_array) (fr, ra, VEC_ROUND_CEIL, 2);
+    if (fr[0] != 0x1.000002p0f || fr[1] != -1.0f)
+      {
+	printf ("check vec_f128_ctf32_array is %a %a should be %a %a\n",
+		fr[0], fr[1], 0x1.000002p0f, -1.0f);
+	rc++;
+      }
+  }
+
+  return (rc);
+}
+
+int
+test_round_f128 (void)
+{
+  __binary128 x, y, t, e, ip;
+  vui64_t xui;
+  int rc = 0;
+  printf ("\n%s\n", __FUNCTION__);
+
+  // 2.5
+  xui = CONST_VINT128_DW ( 0x4000400000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_two );
+  t = vec_floorf128 (x);
+  rc += check_f128 ("check vec_floorf128", x, t, e);
+  t = vec_truncf128 (x);
+  rc += check_f128 ("check vec_truncf128", x, t, e);
+  t = vec_rintf128 (x);
+  rc += check_f128 ("check vec_rintf128", x, t, e);
+  t = vec_xsrqpi_rnd (x, VEC_ROUND_HALF_EVEN);
+  rc += check_f128 ("check vec_xsrqpi_rnd", x, t, e);
+  xui = CONST_VINT128_DW ( 0x4000800000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_ceilf128 (x);
+  rc += check_f128 ("check vec_ceilf128", x, t, e);
+  t = vec_roundf128 (x);
+  rc += check_f128 ("check vec_roundf128", x, t, e);
+  t = vec_xsrqpi_rnd (x, VEC_ROUND_UP);
+  rc += check_f128 ("check vec_xsrqpi_rnd", x, t, e);
+
+  // -2.5
+  xui = CONST_VINT128_DW ( 0xc000400000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_ntwo );
+  t = vec_ceilf128 (x);
+  rc += check_f128 ("check vec_ceilf128", x, t, e);
+  t = vec_truncf128 (x);
+  rc += check_f128 ("check vec_truncf128", x, t, e);
+  t = vec_rintf128 (x);
+  rc += check_f128 ("check vec_rintf128", x, t, e);
+  xui = CONST_VINT128_DW ( 0xc000800000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_floorf128 (x);
+  rc += check_f128 ("check vec_floorf128", x, t, e);
+  t = vec_roundf128 (x);
+  rc += check_f128 ("check vec_roundf128", x, t, e);
+  t = vec_xsrqpi_rnd (x, VEC_ROUND_UP);
+  rc += check_f128 ("check vec_xsrqpi_rnd", x, t, e);
+
+  // 0.5 rounds away to 1.0, to even 0.0
+  xui = CONST_VINT128_DW ( 0x3ffe000000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_one );
+  t = vec_roundf128 (x);
+  rc += check_f128 ("check vec_roundf128", x, t, e);
+  e = vec_xfer_vui64t_2_bin128 ( vf128_zero );
+  t = vec_rintf128 (x);
+  rc += check_f128 ("check vec_rintf128", x, t, e);
+
+  // -0.25 keeps the sign
+  xui = CONST_VINT128_DW ( 0xbffd000000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_nzero );
+  t = vec_ceilf128 (x);
+  rc += check_f128 ("check vec_ceilf128", x, t, e);
+  e = vec_xfer_vui64t_2_bin128 ( vf128_none );
+  t = vec_floorf128 (x);
+  rc += check_f128 ("check vec_floorf128", x, t, e);
+
+  // 1.5 rounds to even 2.0
+  xui = CONST_VINT128_DW ( 0x3fff800000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_two );
+  t = vec_rintf128 (x);
+  rc += check_f128 ("check vec_rintf128", x, t, e);
+
+  // Largest value less than 2.0, the carry increments the exponent
+  xui = CONST_VINT128_DW ( 0x3fffffffffffffff, 0xffffffffffffffff );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_ceilf128 (x);
+  rc += check_f128 ("check vec_ceilf128", x, t, e);
+
+  // 2**112 + 1 is integral
+  xui = CONST_VINT128_DW ( 0x406f000000000000, 1 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_floorf128 (x);
+  rc += check_f128 ("check vec_floorf128", x, t, x);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_ninf );
+  t = vec_roundf128 (x);
+  rc += check_f128 ("check vec_roundf128", x, t, x);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_snan );
+  xui = CONST_VINT128_DW ( 0x7fffc00000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_truncf128 (x);
+  rc += check_f128 ("check vec_truncf128", x, t, e);
+
+  // modf (-3.75) is -3.0 and -0.75
+  xui = CONST_VINT128_DW ( 0xc000e00000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_modff128 (x, &ip);
+  xui = CONST_VINT128_DW ( 0xbffe800000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  rc += check_f128 ("check vec_modff128", x, t, e);
+  xui = CONST_VINT128_DW ( 0xc000800000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  rc += check_f128 ("check vec_modff128 int", x, ip, e);
+
+  x = vec_xfer_vui64t_2_bin128 ( vf128_ninf );
+  t = vec_modff128 (x, &ip);
+  e = vec_xfer_vui64t_2_bin128 ( vf128_nzero );
+  rc += check_f128 ("check vec_modff128", x, t, e);
+  rc += check_f128 ("check vec_modff128 int", x, ip, x);
+
+  // fmod (5.5, 2.0) is 1.5, remainder (5.5, 2.0) is -0.5
+  xui = CONST_VINT128_DW ( 0x4001600000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  y = vec_xfer_vui64t_2_bin128 ( vf128_two );
+  t = vec_fmodf128 (x, y);
+  xui = CONST_VINT128_DW ( 0x3fff800000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  rc += check_f128 ("check vec_fmodf128", x, t, e);
+  t = vec_remainderf128 (x, y);
+  xui = CONST_VINT128_DW ( 0xbffe000000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  rc += check_f128 ("check vec_remainderf128", x, t, e);
+
+  // fmod (-5.5, 2.0) is -1.5
+  xui = CONST_VINT128_DW ( 0xc001600000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_fmodf128 (x, y);
+  xui = CONST_VINT128_DW ( 0xbfff800000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  rc += check_f128 ("check vec_fmodf128", x, t, e);
+
+  // remainder ties to even, (5.0, 2.0) is 1.0 and (7.0, 2.0) -1.0
+  xui = CONST_VINT128_DW ( 0x4001400000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_remainderf128 (x, y);
+  e = vec_xfer_vui64t_2_bin128 ( vf128_one );
+  rc += check_f128 ("check vec_remainderf128", x, t, e);
+  xui = CONST_VINT128_DW ( 0x4001c00000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_remainderf128 (x, y);
+  e = vec_xfer_vui64t_2_bin128 ( vf128_none );
+  rc += check_f128 ("check vec_remainderf128", x, t, e);
+
+  // 2**1000 mod 3 is 1
+  xui = CONST_VINT128_DW ( 0x43e7000000000000, 0 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  xui = CONST_VINT128_DW ( 0x4000800000000000, 0 );
+  y = vec_xfer_vui64t_2_bin128 ( xui );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_one );
+  t = vec_fmodf128 (x, y);
+  rc += check_f128 ("check vec_fmodf128", x, t, e);
+  t = vec_remainderf128 (x, y);
+  rc += check_f128 ("check vec_remainderf128", x, t, e);
+
+  // Denormal operands and result
+  xui = CONST_VINT128_DW ( 0, 3 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  xui = CONST_VINT128_DW ( 0, 2 );
+  y = vec_xfer_vui64t_2_bin128 ( xui );
+  xui = CONST_VINT128_DW ( 0, 1 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_fmodf128 (x, y);
+  rc += check_f128 ("check vec_fmodf128", x, t, e);
+
+  y = vec_xfer_vui64t_2_bin128 ( vf128_zero );
+  t = vec_fmodf128 (x, y);
+  if (!vec_all_isnanf128 (t))
+    {
+      printf ("check vec_fmodf128 (x, 0.0) is not NaN\n");
+      rc++;
+    }
+
+  return (rc);
+}
+
+int
+test_convert_ibm (void)
+{
+  __binary128 x, t, e;
+  vui64_t xui, eui;
+  vf64_t lv, tl;
+  int rc = 0;
+  printf ("\n%s\n", __FUNCTION__);
+
+  // 1.0 + 2**-60, exact
+  lv = (vf64_t) CONST_VINT128_DW ( 0x3ff0000000000000, 0x3c30000000000000 );
+  xui = CONST_VINT128_DW ( 0x3fff000000000000, 0x0010000000000000 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_xscvibmqp (lv);
+  rc += check_f128 ("check vec_xscvibmqp", e, t, e);
+  // 1.0 - 2**-60, exact
+  lv = (vf64_t) CONST_VINT128_DW ( 0x3ff0000000000000, 0xbc30000000000000 );
+  xui = CONST_VINT128_DW ( 0x3ffeffffffffffff, 0xffe0000000000000 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_xscvibmqp (lv);
+  rc += check_f128 ("check vec_xscvibmqp", e, t, e);
+  // -1.0 - 2**-113, a tie rounds to even -1.0
+  lv = (vf64_t) CONST_VINT128_DW ( 0xbff0000000000000, 0xb8e0000000000000 );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_none );
+  t = vec_xscvibmqp (lv);
+  rc += check_f128 ("check vec_xscvibmqp", e, t, e);
+  // 1.0 + 1.5 * 2**-113, rounds up to 1.0 + 2**-112
+  lv = (vf64_t) CONST_VINT128_DW ( 0x3ff0000000000000, 0x38e8000000000000 );
+  xui = CONST_VINT128_DW ( 0x3fff000000000000, 0x0000000000000001 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  t = vec_xscvibmqp (lv);
+  rc += check_f128 ("check vec_xscvibmqp", e, t, e);
+  // Inf, the low part is ignored
+  lv = (vf64_t) CONST_VINT128_DW ( 0x7ff0000000000000, 0 );
+  e = vec_xfer_vui64t_2_bin128 ( vf128_inf );
+  t = vec_xscvibmqp (lv);
+  rc += check_f128 ("check vec_xscvibmqp", e, t, e);
+
+  // -(1.0 + 2**-60 + 2**-112) splits exactly and converts back
+  xui = CONST_VINT128_DW ( 0xbfff000000000000, 0x0010000000000001 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  tl = vec_xscvqpibm (x);
+  eui = CONST_VINT128_DW ( 0xbff0000000000000, 0xbc30000000000001 );
+  rc += check_vuint128x ("check vec_xscvqpibm", (vui128_t) tl, (vui128_t) eui);
+  t = vec_xscvibmqp (tl);
+  rc += check_f128 ("check vec_xscvibmqp", x, t, x);
+  // 1.0 + 2**-112 rounds the low part to nearest
+  xui = CONST_VINT128_DW ( 0x3fff000000000000, 0x0000000000000001 );
+  x = vec_xfer_vui64t_2_bin128 ( xui );
+  tl = vec_xscvqpibm (x);
+  eui = CONST_VINT128_DW ( 0x3ff0000000000000, 0x38f0000000000000 );
+  rc += check_vuint128x ("check vec_xscvqpibm", (vui128_t) tl, (vui128_t) eui);
+  // -Inf
+  x = vec_xfer_vui64t_2_bin128 ( vf128_ninf );
+  tl = vec_xscvqpibm (x);
+  eui = CONST_VINT128_DW ( 0xfff0000000000000, 0 );
+  rc += check_vuint128x ("check vec_xscvqpibm", (vui128_t) tl, (vui128_t) eui);
+
+  {
+    // Convert in place, as over a mapped file.
+    union
+    {
+      __binary128 q[5];
+      unsigned long long d[10];
+    } buf;
+    unsigned long long da[10] =
+      { 0x3ff0000000000000, 0x3c30000000000000,
+	0x3ff0000000000000, 0xbc30000000000000,
+	0xbff0000000000000, 0xb8e0000000000000,
+	0x4000000000000000, 0,
+	0xbff0000000000000, 0xbc30000000000001 };
+    long i;
+
+    for (i = 0; i < 10; i++)
+      buf.d[i] = da[i];
+    __VEC_PWR_IMP (vec_f128_cfibm_array) (buf.q, (__IBM128 *) buf.d, 5);
+    xui = CONST_VINT128_DW ( 0x3fff000000000000, 0x0010000000000000 );
+    e = vec_xfer_vui64t_2_bin128 ( xui );
+    rc += check_f128 ("check vec_f128_cfibm_array", e, buf.q[0], e);
+    e = vec_xfer_vui64t_2_bin128 ( vf128_none );
+    rc += check_f128 ("check vec_f128_cfibm_array", e, buf.q[2], e);
+    e = vec_xfer_vui64t_2_bin128 ( vf128_two );
+    rc += check_f128 ("check vec_f128_cfibm_array", e, buf.q[3], e);
+    xui = CONST_VINT128_DW ( 0xbfff000000000000, 0x0010000000000001 );
+    e = vec_xfer_vui64t_2_bin128 ( xui );
+    rc += check_f128 ("check vec_f128_cfibm_array", e, buf.q[4], e);
+
+    __VEC_PWR_IMP (vec_f128_ctibm_array) ((__IBM128 *) buf.d, buf.q, 5);
+    // The tie (element 2) returns as the canonical -1.0, 0.0
+    da[5] = 0;
+    for (i = 0; i < 10; i++)
+      if (buf.d[i] != da[i])
+	{
+	  printf ("check vec_f128_ctibm_array [%ld] is %016llx should be %016llx\n",
+		  i, buf.d[i], da[i]);
+	  rc++;
+	}
+  }
+
+  return (rc);
+}
+
+int
+test_linalg_f128 (void)
+{
+  const __binary128 zero = vec_xfer_vui64t_2_bin128 ( vf128_zero );
+  const __binary128 one = vec_xfer_vui64t_2_bin128 ( vf128_one );
+  const __binary128 mone = vec_xfer_vui64t_2_bin128 ( vf128_none );
+  __binary128 qa[15], qb[15], qy[5], qc[15], t, e;
+  double da[15], db[15];
+  double ey[5], ec[15];
+  int i, j, p;
+  int rc = 0;
+  printf ("\n%s\n", __FUNCTION__);
+
+  // 3.0 * 5.0 + 1.0
+  t = vec_xsmaddqpo (vec_xscvdpqp (vec_splats (3.0)),
+		     vec_xscvdpqp (vec_splats (5.0)), one);
+  e = vec_xscvdpqp (vec_splats (16.0));
+  rc += check_f128 ("check vec_xsmaddqpo", e, t, e);
+  // -3.0 * 5.0 + -1.0
+  t = vec_xsmaddqpo (vec_xscvdpqp (vec_splats (-3.0)),
+		     vec_xscvdpqp (vec_splats (5.0)), mone);
+  e = vec_xscvdpqp (vec_splats (-16.0));
+  rc += check_f128 ("check vec_xsmaddqpo", e, t, e);
+
+  {
+    // Round to nearest, ties to even. 2**-113 is half an ULP of 1.0.
+    const __binary128 half_ulp = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x3f8e000000000000, 0 ));
+    const __binary128 one_ulp = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x3fff000000000000, 1 ));
+    const __binary128 f128_max = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x7ffeffffffffffff, 0xffffffffffffffff ));
+    __binary128 x, y;
+
+    // 1.0 + 2**-113 is a tie, rounds down to even.
+    t = vec_xsaddqpn (one, half_ulp);
+    rc += check_f128 ("check vec_xsaddqpn tie", one, t, one);
+    // (1.0 + 2**-112) + 2**-113 is a tie, rounds up to even.
+    t = vec_xsaddqpn (one_ulp, half_ulp);
+    e = vec_xfer_vui64t_2_bin128 (CONST_VINT128_DW ( 0x3fff000000000000, 2 ));
+    rc += check_f128 ("check vec_xsaddqpn tie", one_ulp, t, e);
+    // 1.0 + 1.5 * 2**-113 is more than half, rounds up.
+    x = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x3f8e800000000000, 0 ));
+    t = vec_xsaddqpn (one, x);
+    rc += check_f128 ("check vec_xsaddqpn", x, t, one_ulp);
+    // Overflow is Infinity.
+    t = vec_xsaddqpn (f128_max, f128_max);
+    e = vec_xfer_vui64t_2_bin128 ( vf128_inf );
+    rc += check_f128 ("check vec_xsaddqpn inf", f128_max, t, e);
+    t = vec_xsmaddqpn (one, one, half_ulp);
+    rc += check_f128 ("check vec_xsmaddqpn tie", one, t, one);
+
+    // (1.0 + 2**-112)**2 = 1.0 + 2**-111 + 2**-224, rounds down.
+    t = vec_xsmulqpn (one_ulp, one_ulp);
+    e = vec_xfer_vui64t_2_bin128 (CONST_VINT128_DW ( 0x3fff000000000000, 2 ));
+    rc += check_f128 ("check vec_xsmulqpn", one_ulp, t, e);
+    // (1.0 + 2**-57) * (1.0 + 2**-56) is a tie, rounds down to even.
+    x = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x3fff000000000000, 0x0080000000000000 ));
+    y = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x3fff000000000000, 0x0100000000000000 ));
+    t = vec_xsmulqpn (x, y);
+    e = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x3fff000000000000, 0x0180000000000000 ));
+    rc += check_f128 ("check vec_xsmulqpn tie", x, t, e);
+    t = vec_xsmulqpn (f128_max, f128_max);
+    e = vec_xfer_vui64t_2_bin128 ( vf128_inf );
+    rc += check_f128 ("check vec_xsmulqpn inf", f128_max, t, e);
+  }
+
+  for (i = 0; i < 15; i++)
+    {
+      da[i] = (double) (i + 1);
+      db[i] = (double) (i % 4) - 1.0;
+      qa[i] = vec_xscvdpqp (vec_splats (da[i]));
+      qb[i] = vec_xscvdpqp (vec_splats (db[i]));
+    }
+
+  // sum (i + 1) * (i % 4 - 1) for n = 9, with the remainder loop.
+  e = vec_xscvdpqp (vec_splats (19.0));
+  t = __VEC_PWR_IMP (vec_f128_dot_array) (qa, qb, 9);
+  rc += check_f128 ("check vec_f128_dot_array", e, t, e);
+  t = __VEC_PWR_IMP (vec_f128_dotf64_array) (da, db, 9);
+  rc += check_f128 ("check vec_f128_dotf64_array", e, t, e);
+  t = __VEC_PWR_IMP (vec_f128_dot_array) (qa, qb, 0);
+  rc += check_f128 ("check vec_f128_dot_array", zero, t, zero);
+
+  {
+    // 2**60 + 1.0 - 2**60 cancels to 0.0 in double
+    const double dc[3] = { 0x1p60, 1.0, -0x1p60 };
+    const double dd[3] = { 1.0, 1.0, 1.0 };
+    t = __VEC_PWR_IMP (vec_f128_dotf64_array) (dc, dd, 3);
+    rc += check_f128 ("check vec_f128_dotf64_array", one, t, one);
+  }
+  {
+    // 1.0 + 2**-113 is a tie, the sum rounds to nearest even (1.0),
+    // not to odd.
+    const double dc[2] = { 1.0, 0x1p-113 };
+    const double dd[2] = { 1.0, 1.0 };
+    t = __VEC_PWR_IMP (vec_f128_dotf64_array) (dc, dd, 2);
+    rc += check_f128 ("check vec_f128_dotf64_array tie", one, t, one);
+    __VEC_PWR_IMP (vec_f128_gemvf64) (1, 2, one, dc, 2, dd, zero, qy);
+    rc += check_f128 ("check vec_f128_gemvf64 tie", one, qy[0], one);
+  }
+
+  // Residual y = b - A x, A is 5 by 3 (lda 3), x = db[0..2],
+  // b = 1.0. Rows 0-3 are blocked, row 4 is the remainder.
+  for (i = 0; i < 5; i++)
+    {
+      ey[i] = 1.0;
+      for (p = 0; p < 3; p++)
+	ey[i] -= da[i * 3 + p] * db[p];
+      qy[i] = one;
+    }
+  __VEC_PWR_IMP (vec_f128_gemv) (5, 3, mone, qa, 3, qb, one, qy);
+  for (i = 0; i < 5; i++)
+    {
+      e = vec_xscvdpqp (vec_splats (ey[i]));
+      rc += check_f128 ("check vec_f128_gemv", e, qy[i], e);
+    }
+  for (i = 0; i < 5; i++)
+    qy[i] = one;
+  __VEC_PWR_IMP (vec_f128_gemvf64) (5, 3, mone, da, 3, db, one, qy);
+  for (i = 0; i < 5; i++)
+    {
+      e = vec_xscvdpqp (vec_splats (ey[i]));
+      rc += check_f128 ("check vec_f128_gemvf64", e, qy[i], e);
+    }
+
+  // C = A B, A is 3 by 2 (lda 2), B is 2 by 5 (ldb 5), beta is zero
+  // so C is not read. Covers the 2x4 block, the remainder column
+  // and the remainder row.
+  for (i = 0; i < 3; i++)
+    for (j = 0; j < 5; j++)
+      {
+	ec[i * 5 + j] = 0.0;
+	for (p = 0; p < 2; p++)
+	  ec[i * 5 + j] += da[i * 2 + p] * db[p * 5 + j];
+	qc[i * 5 + j] = vec_xfer_vui64t_2_bin128 ( vf128_nan );
+      }
+  __VEC_PWR_IMP (vec_f128_gemm) (3, 5, 2, one, qa, 2, qb, 5, zero, qc, 5);
+  for (i = 0; i < 15; i++)
+    {
+      e = vec_xscvdpqp (vec_splats (ec[i]));
+      rc += check_f128 ("check vec_f128_gemm", e, qc[i], e);
+    }
+  // C = A B + C, which doubles C.
+  __VEC_PWR_IMP (vec_f128_gemmf64) (3, 5, 2, one, da, 2, db, 5, one, qc, 5);
+  for (i = 0; i < 15; i++)
+    {
+      e = vec_xscvdpqp (vec_splats (ec[i] * 2.0));
+      rc += check_f128 ("check vec_f128_gemmf64", e, qc[i], e);
+    }
+
+  return (rc);
+}
+
+int
+test_poly_f128 (void)
+{
+  const __binary128 one = vec_xfer_vui64t_2_bin128 ( vf128_one );
+  const __binary128 two = vec_xfer_vui64t_2_bin128 ( vf128_two );
+  __binary128 qc[101], qx[5], qr[5], t, e;
+  double dx[5], dr[5];
+  vui64_t xui;
+  long i, deg;
+  int rc = 0;
+  printf ("\n%s\n", __FUNCTION__);
+
+  // All ones at 2.0 is 2**(deg+1) - 1, exact in binary128 up to
+  // degree 112. Degree 5 is Horner's rule, the others Estrin's scheme
+  // with 0 or more Horner coefficients on top.
+  for (i = 0; i < 101; i++)
+    qc[i] = one;
+  for (deg = 5; deg <= 17; deg += 3)
+    {
+      t = vec_polyf128 (two, qc, deg);
+      e = vec_xscvdpqp (vec_splats ((double) ((2L << deg) - 1)));
+      rc += check_f128 ("check vec_polyf128", two, t, e);
+    }
+  t = vec_polyf128 (two, qc, 100);
+  xui = CONST_VINT128_DW ( 0x4063ffffffffffff, 0xfffffffffffff000 );
+  e = vec_xfer_vui64t_2_bin128 ( xui );
+  rc += check_f128 ("check vec_polyf128 100", two, t, e);
+
+  {
+    // c[0] + 1.0 at x = 1.0, where c[0] = 2**-113 is half an ULP of
+    // 1.0. The tie rounds to nearest even (1.0), not to odd. Degree 1
+    // is Horner's rule and degree 8 Estrin's scheme for c[1..8].
+    __binary128 pc[9];
+    pc[0] = vec_xfer_vui64t_2_bin128 (
+	CONST_VINT128_DW ( 0x3f8e000000000000, 0 ));
+    pc[1] = one;
+    for (i = 2; i < 9; i++)
+      pc[i] = vec_xfer_vui64t_2_bin128 ( vf128_zero );
+    t = vec_polyf128 (one, pc, 1);
+    rc += check_f128 ("check vec_polyf128 tie", one, t, one);
+    t = vec_polyf128 (one, pc, 8);
+    rc += check_f128 ("check vec_polyf128 tie", one, t, one);
+    // vec_polyf128o keeps the sticky bit.
+    t = vec_polyf128o (one, pc, 8);
+    e = vec_xfer_vui64t_2_bin128 (CONST_VINT128_DW ( 0x3fff000000000000, 1 ));
+    rc += check_f128 ("check vec_polyf128o", one, t, e);
+  }
+
+  // The arrays must match vec_polyf128 exactly.
+  for (i = 0; i < 5; i++)
+    {
+      dx[i] = (double) (i - 2) * 0.375;
+      qx[i] = vec_xscvdpqp (vec_splats (dx[i]));
+    }
+  __VEC_PWR_IMP (vec_polyf128_array) (qr, qx, qc, 9, 5);
+  for (i = 0; i < 5; i++)
+    {
+      e = vec_polyf128 (qx[i], qc, 9);
+      rc += check_f128 ("check vec_polyf128_array", qx[i], qr[i], e);
+    }
+
+  // 2**61 - 1 is exact in binary128 and rounds once to double.
+  dx[0] = dx[1] = 2.0;
+  __VEC_PWR_IMP (vec_polyf128f64_array) (dr, dx, qc, 60,
+					 VEC_ROUND_HALF_EVEN, 2);
+  __VEC_PWR_IMP (vec_polyf128f64_array) (&dr[1], &dx[1], qc, 60,
+					 VEC_ROUND_TRUNC, 1);
+  if (dr[0] != 0x1p61 || dr[1] != 0x1.fffffffffffffp60)
+    {
+      printf ("check vec_polyf128f64_array is %a %a should be %a %a\n",
+	      dr[0], dr[1], 0x1p61, 0x1.fffffffffffffp60);
+      rc++;
+    }
+
+  return (rc);
+}
+
+/* The out-of-line implementations in libpvecstatic.a, selected by
+   __VEC_PWR_IMP for this -mcpu, must match the inline operations.  */
+int
+test_f128_runtime (void)
+{
+  __binary128 x[6], t, e;
+  vui64_t xui;
+  int i, j;
+  int rc = 0;
+  printf ("\n%s\n", __FUNCTION__);
+
+  x[0] = vec_xscvdpqp (vec_splats (2.5));
+  x[1] = vec_xscvdpqp (vec_splats (-3.75));
+  x[2] = vec_xscvdpqp (vec_splats (0x1.fffffffffffffp100));
+  // 1/3 with an inexact low doubleword
+  xui = CONST_VINT128_DW ( 0x3ffd555555555555, 0x5555555555555555 );
+  x[3] = vec_xfer_vui64t_2_bin128 ( xui );
+  // Above 2**111, the last bit is 0.5
+  xui = CONST_VINT128_DW ( 0x406e123456789abc, 0xdef0123456789abd );
+  x[4] = vec_xfer_vui64t_2_bin128 ( xui );
+  // Smallest normal
+  xui = CONST_VINT128_DW ( 0x0001000000000000, 0 );
+  x[5] = vec_xfer_vui64t_2_bin128 ( xui );
+
+  for (i = 0; i < 6; i++)
+    {
+      for (j = 0; j < 6; j++)
+	{
+	  t = __VEC_PWR_IMP (vec_xsaddqpo) (x[i], x[j]);
+	  e = vec_xsaddqpo (x[i], x[j]);
+	  rc += check_f128 ("check vec_xsaddqpo_PWRn", x[i], t, e);
+	  t = __VEC_PWR_IMP (vec_xssubqpo) (x[i], x[j]);
+	  e = vec_xssubqpo (x[i], x[j]);
+	  rc += check_f128 ("check vec_xssubqpo_PWRn", x[i], t, e);
+	  t = __VEC_PWR_IMP (vec_xsmulqpo) (x[i], x[j]);
+	  e = vec_xsmulqpo (x[i], x[j]);
+	  rc += check_f128 ("check vec_xsmulqpo_PWRn", x[i], t, e);
+	  t = __VEC_PWR_IMP (vec_fmodf128) (x[i], x[j]);
+	  e = vec_fmodf128 (x[i], x[j]);
+	  rc += check_f128 ("check vec_fmodf128_PWRn", x[i], t, e);
+	  t = __VEC_PWR_IMP (vec_remainderf128) (x[i], x[j]);
+	  e = vec_remainderf128 (x[i], x[j]);
+	  rc += check_f128 ("check vec_remainderf128_PWRn", x[i], t, e);
+	}
+
+      rc += check_v2f64x ("check vec_xscvqpdpo_PWRn",
+			  __VEC_PWR_IMP (vec_xscvqpdpo) (x[i]),
+			  vec_xscvqpdpo (x[i]));
+      rc += check_vuint128x ("check vec_xscvqpudz_PWRn",
+			     (vui128_t) __VEC_PWR_IMP (vec_xscvqpudz) (x[i]),
+			     (vui128_t) vec_xscvqpudz (x[i]));
+      rc += check_vuint128x ("check vec_xscvqpuqz_PWRn",
+			     __VEC_PWR_IMP (vec_xscvqpuqz) (x[i]),
+			     vec_xscvqpuqz (x[i]));
+      t = __VEC_PWR_IMP (vec_xsrqpi_rnd) (x[i], VEC_ROUND_FLOOR);
+      e = vec_xsrqpi_rnd (x[i], VEC_ROUND_FLOOR);
+      rc += check_f128 ("check vec_xsrqpi_rnd_PWRn", x[i], t, e);
+      t = __VEC_PWR_IMP (vec_xsrqpi_rnd) (x[i], VEC_ROUND_HALF_EVEN);
+      e = vec_xsrqpi_rnd (x[i], VEC_ROUND_HALF_EVEN);
+      rc += check_f128 ("check vec_xsrqpi_rnd_PWRn", x[i], t, e);
+    }
+
+  return (rc);
+}
+
 //#define __DEBUG_PRINT__ 1
 #ifdef __DEBUG_PRINT__
 #define test_xsmulqpo(_l,_k)	db_vec_xsmulqpo(_l,_k)
@@ -17623,6 +18456,9 @@ test_vec_f128 (void)
   rc += test_convert_qpuqz ();
   rc += test_convert_qpudz ();
   rc += test_convert_qpdpo ();
+  rc += test_convert_matrix ();
+  rc += test_round_f128 ();
+  rc += test_convert_ibm ();
 
   rc += test_mul_qpo ();
   rc += test_mul_qpo_xtra ();
@@ -17634,5 +18470,9 @@ test_vec_f128 (void)
 
   rc += test_sub_qpo ();
   rc += test_sub_qpo_xtra ();
+
+  rc += test_linalg_f128 ();
+  rc += test_poly_f128 ();
+  rc += test_f128_runtime ();
   return (rc);
 }
@@ -2306,6 +2306,280 @@ test_setb_sp (void)
   return (rc);
 }
 
+int
+test_f16_bf16 (void)
+{
+  vui32_t i, e;
+  vf32_t x, xt;
+  vui16_t h, ht;
+  unsigned short a16[21], b16[21];
+  float a32[21], b32[21], r32[21];
+  float dot, dott;
+  long k;
+  int rc = 0;
+
+  printf ("\ntest_f16_bf16 ...\n");
+
+  i = CONST_VINT128_W(0x3c00, 0xc000, 0x0001, 0x7c00);
+  xt = (vf32_t) CONST_VINT128_W(__FLOAT_ONE, 0xc0000000, 0x33800000,
+				__FLOAT_INF);
+  x = vec_xvcvhpsp (i);
+  rc += check_v4f32x ("check vec_xvcvhpsp 1", x, xt);
+
+  i = CONST_VINT128_W(0x7bff, 0x8000, 0x03ff, 0x7e00);
+  xt = (vf32_t) CONST_VINT128_W(0x477fe000, __FLOAT_NZERO, 0x387fc000,
+				0x7fc00000);
+  x = vec_xvcvhpsp (i);
+  rc += check_v4f32x ("check vec_xvcvhpsp 2", x, xt);
+
+  // 65520.0 is halfway to infinity, 3 * 2**-25 rounds to even.
+  x = (vf32_t) CONST_VINT128_W(__FLOAT_ONE, 0xc0000000, 0x477ff000,
+			       0x33c00000);
+  e = CONST_VINT128_W(0x3c00, 0xc000, 0x7c00, 0x0002);
+  i = vec_xvcvsphp (x);
+  rc += check_vuint128x ("check vec_xvcvsphp 1", (vui128_t) i, (vui128_t) e);
+
+  x = (vf32_t) CONST_VINT128_W(0x33000000, __FLOAT_NZERO, 0x7fc00000,
+			       __FLOAT_NINF);
+  e = CONST_VINT128_W(0x0000, 0x8000, 0x7e00, 0xfc00);
+  i = vec_xvcvsphp (x);
+  rc += check_vuint128x ("check vec_xvcvsphp 2", (vui128_t) i, (vui128_t) e);
+
+  i = CONST_VINT128_W(0x3f80, 0xbf80, 0x7f80, 0x0001);
+  xt = (vf32_t) CONST_VINT128_W(__FLOAT_ONE, __FLOAT_NONE, __FLOAT_INF,
+				0x00010000);
+  x = vec_xvcvbf16spn (i);
+  rc += check_v4f32x ("check vec_xvcvbf16spn 1", x, xt);
+
+  x = (vf32_t) CONST_VINT128_W(__FLOAT_ONE, 0x3f808000, 0x3f818000,
+			       __FLOAT_MAX);
+  e = CONST_VINT128_W(0x3f80, 0x3f80, 0x3f82, 0x7f80);
+  i = vec_xvcvspbf16 (x);
+  rc += check_vuint128x ("check vec_xvcvspbf16 1", (vui128_t) i,
+			 (vui128_t) e);
+
+  x = (vf32_t) CONST_VINT128_W(0xff800001, __FLOAT_NZERO, __FLOAT_SUB,
+			       __FLOAT_INF);
+  e = CONST_VINT128_W(0xffc0, 0x8000, 0x0000, 0x7f80);
+  i = vec_xvcvspbf16 (x);
+  rc += check_vuint128x ("check vec_xvcvspbf16 2", (vui128_t) i,
+			 (vui128_t) e);
+
+  h = (vui16_t) { 0x3c00, 0x4000, 0x4200, 0x4400,
+		  0xbc00, 0xc000, 0xc200, 0xc400 };
+  xt = (vf32_t) { 1.0f, 2.0f, 3.0f, 4.0f };
+  x = vec_unpackh_f16 (h);
+  rc += check_v4f32 ("check vec_unpackh_f16", x, xt);
+  xt = (vf32_t) { -1.0f, -2.0f, -3.0f, -4.0f };
+  x = vec_unpackl_f16 (h);
+  rc += check_v4f32 ("check vec_unpackl_f16", x, xt);
+  ht = vec_pack_f16 (vec_unpackh_f16 (h), vec_unpackl_f16 (h));
+  rc += check_vuint128x ("check vec_pack_f16", (vui128_t) ht, (vui128_t) h);
+
+  h = (vui16_t) { 0x3f80, 0x4000, 0x4040, 0x4080,
+		  0xbf80, 0xc000, 0xc040, 0xc080 };
+  xt = (vf32_t) { 1.0f, 2.0f, 3.0f, 4.0f };
+  x = vec_unpackh_bf16 (h);
+  rc += check_v4f32 ("check vec_unpackh_bf16", x, xt);
+  xt = (vf32_t) { -1.0f, -2.0f, -3.0f, -4.0f };
+  x = vec_unpackl_bf16 (h);
+  rc += check_v4f32 ("check vec_unpackl_bf16", x, xt);
+  ht = vec_pack_bf16 (vec_unpackh_bf16 (h), vec_unpackl_bf16 (h));
+  rc += check_vuint128x ("check vec_pack_bf16", (vui128_t) ht, (vui128_t) h);
+
+  /* 21 elements covers the 16 element loop and a partial vector.
+     The values and the products are exact in binary16, bfloat16 and
+     float, so the dot products are exact.  */
+  dott = 0.0f;
+  for (k = 0; k < 21; k++)
+    {
+      a32[k] = (float) (k - 10) * 0.25f;
+      b32[k] = (float) k * 0.5f;
+      dott += a32[k] * b32[k];
+    }
+
+  __VEC_PWR_IMP (vec_cvf32f16_array) (a16, a32, 21);
+  __VEC_PWR_IMP (vec_cvf32f16_array) (b16, b32, 21);
+  __VEC_PWR_IMP (vec_cvf16f32_array) (r32, a16, 21);
+  for (k = 0; k < 21; k++)
+    {
+      if (r32[k] != a32[k])
+	{
+	  printf ("check vec_cvf16f32_array [%ld] is %f should be %f\n",
+		  k, r32[k], a32[k]);
+	  rc++;
+	}
+    }
+  dot = __VEC_PWR_IMP (vec_dotf16_array) (a16, b16, 21);
+  if (dot != dott)
+    {
+      printf ("check vec_dotf16_array is %f should be %f\n", dot, dott);
+      rc++;
+    }
+  dot = __VEC_PWR_IMP (vec_dotf16f32_array) (a16, b32, 21);
+  if (dot != dott)
+    {
+      printf ("check vec_dotf16f32_array is %f should be %f\n", dot, dott);
+      rc++;
+    }
+
+  __VEC_PWR_IMP (vec_cvf32bf16_array) (a16, a32, 21);
+  __VEC_PWR_IMP (vec_cvf32bf16_array) (b16, b32, 21);
+  __VEC_PWR_IMP (vec_cvbf16f32_array) (r32, a16, 21);
+  for (k = 0; k < 21; k++)
+    {
+      if (r32[k] != a32[k])
+	{
+	  printf ("check vec_cvbf16f32_array [%ld] is %f should be %f\n",
+		  k, r32[k], a32[k]);
+	  rc++;
+	}
+    }
+  dot = __VEC_PWR_IMP (vec_dotbf16_array) (a16, b16, 21);
+  if (dot != dott)
+    {
+      printf ("check vec_dotbf16_array is %f should be %f\n", dot, dott);
+      rc++;
+    }
+  dot = __VEC_PWR_IMP (vec_dotbf16f32_array) (a16, b32, 21);
+  if (dot != dott)
+    {
+      printf ("check vec_dotbf16f32_array is %f should be %f\n", dot, dott);
+      rc++;
+    }
+
+  return (rc);
+}
+
+/* Check that each element of val128 is within 1 ULP of the correctly
+   rounded shouldbe. NaNs only need to match as NaNs, other values
+   must have the same sign.  */
+static int
+check_v4f32_ulp (char *prefix, vf32_t val128, vf32_t shouldbe)
+{
+  vui32_t v = (vui32_t) val128;
+  vui32_t e = (vui32_t) shouldbe;
+  unsigned int d;
+  int i, rc = 0;
+
+  for (i = 0; i < 4; i++)
+    {
+      if (val128[i] != val128[i] && shouldbe[i] != shouldbe[i])
+	continue;
+      d = (v[i] > e[i]) ? (v[i] - e[i]) : (e[i] - v[i]);
+      if (d > 1 || ((v[i] ^ e[i]) >> 31))
+	rc = 1;
+    }
+  if (rc)
+    {
+      printf ("%s\n", prefix);
+      print_v4f32x ("\tshould be: ", shouldbe);
+      print_v4f32x ("\t       is: ", val128);
+    }
+
+  return (rc);
+}
+
+int
+test_float_elementary (void)
+{
+  vf32_t i, j, e, k;
+  vf64_t d;
+  float a[11], b[11], r[11];
+  long n;
+  int rc = 0;
+
+  printf ("\ntest_float_elementary ...\n");
+
+  i = (vf32_t) { 1.0f, -0.5f, 0x1p-149f, 0x1.fffffep+127f };
+  d = vec_unpackh_f32 (i);
+  rc += check_v2f64x ("check vec_unpackh_f32", d,
+		      (vf64_t) { 1.0, -0.5 });
+  d = vec_unpackl_f32 (i);
+  rc += check_v2f64x ("check vec_unpackl_f32", d,
+		      (vf64_t) { 0x1p-149, 0x1.fffffep+127 });
+  k = vec_pack_f32 (vec_unpackh_f32 (i), vec_unpackl_f32 (i));
+  rc += check_v4f32x ("check vec_pack_f32", k, i);
+
+  /* The expected values are correctly rounded.  */
+  i = (vf32_t) { 1.0f, -100.0f, 88.5f, -0x1.9fe368p+6f };
+  e = (vf32_t) { 0x1.5bf0a8p+1f, 0x1.bp-145f, 0x1.99b988p+127f, 0x1p-149f };
+  k = vec_expf32 (i);
+  rc += check_v4f32_ulp ("check vec_expf32", k, e);
+
+  i = (vf32_t) { 0.5f, -149.0f, 128.0f, 0x1.fffffep+6f };
+  e = (vf32_t) { 0x1.6a09e6p+0f, 0x1p-149f, __builtin_inff (),
+		 0x1.ffff4ep+127f };
+  k = vec_exp2f32 (i);
+  rc += check_v4f32_ulp ("check vec_exp2f32", k, e);
+
+  i = (vf32_t) { 2.0f, 0x1p-149f, 0x1.fffffep+127f, 0.75f };
+  e = (vf32_t) { 0x1.62e43p-1f, -0x1.9d1dap+6f, 0x1.62e43p+6f,
+		 -0x1.269622p-2f };
+  k = vec_logf32 (i);
+  rc += check_v4f32_ulp ("check vec_logf32", k, e);
+
+  i = (vf32_t) { 3.0f, 0x1.000002p+0f, 10.0f, 0x1p-140f };
+  e = (vf32_t) { 0x1.95c01ap+0f, 0x1.715474p-23f, 0x1.a934fp+1f, -140.0f };
+  k = vec_log2f32 (i);
+  rc += check_v4f32_ulp ("check vec_log2f32", k, e);
+
+  i = (vf32_t) { 1.0f, -0x1.921fb6p+0f, 0x1p+100f, 0x1.fffffep+127f };
+  e = (vf32_t) { 0x1.aed548p-1f, -1.0f, -0x1.be8edap-1f, -0x1.0b3366p-1f };
+  k = vec_sinf32 (i);
+  rc += check_v4f32_ulp ("check vec_sinf32", k, e);
+
+  i = (vf32_t) { 1.0f, 0x1.921fb6p+0f, 1.0e20f, -0.0f };
+  e = (vf32_t) { 0x1.14a28p-1f, -0x1.777a5cp-25f, 0x1.822e46p-1f, 1.0f };
+  k = vec_cosf32 (i);
+  rc += check_v4f32_ulp ("check vec_cosf32", k, e);
+
+  i = (vf32_t) { 0.5f, -0x1p-30f, -3.0f, 10.0f };
+  e = (vf32_t) { 0x1.d9353ep-2f, -0x1p-30f, -0x1.fd77d2p-1f, 1.0f };
+  k = vec_tanhf32 (i);
+  rc += check_v4f32_ulp ("check vec_tanhf32", k, e);
+
+  i = (vf32_t) { 0.5f, -1.5f, 0x1p-140f, 4.0f };
+  e = (vf32_t) { 0x1.0a7ef6p-1f, -0x1.eea556p-1f, 0x1.21p-140f, 1.0f };
+  k = vec_erff32 (i);
+  rc += check_v4f32_ulp ("check vec_erff32", k, e);
+
+  i = (vf32_t) { 2.0f, -2.0f, 10.0f, -0.0f };
+  j = (vf32_t) { 0.5f, 3.0f, -3.0f, -1.0f };
+  e = (vf32_t) { 0x1.6a09e6p+0f, -8.0f, 0x1.0624dep-10f, -__builtin_inff () };
+  k = vec_powf32 (i, j);
+  rc += check_v4f32_ulp ("check vec_powf32", k, e);
+
+  /* 11 elements covers the 8 element loop and a partial vector. The
+     arrays must match the vector functions exactly.  */
+  for (n = 0; n < 11; n++)
+    {
+      a[n] = (float) (n - 5) * 0.75f;
+      b[n] = (float) n * 0.5f;
+    }
+  __VEC_PWR_IMP (vec_logf32_array) (r, b, 11);
+  for (n = 0; n < 8; n += 4)
+    {
+      i = (vf32_t) { b[n], b[n + 1], b[n + 2], b[n + 3] };
+      e = vec_logf32 (i);
+      k = (vf32_t) { r[n], r[n + 1], r[n + 2], r[n + 3] };
+      rc += check_v4f32x ("check vec_logf32_array", k, e);
+    }
+  __VEC_PWR_IMP (vec_erff32_array) (r, a, 11);
+  i = (vf32_t) { a[8], a[9], a[10], a[10] };
+  e = vec_erff32 (i);
+  k = (vf32_t) { r[8], r[9], r[10], r[10] };
+  rc += check_v4f32x ("check vec_erff32_array", k, e);
+  __VEC_PWR_IMP (vec_powf32_array) (r, b, a, 11);
+  i = (vf32_t) { b[7], b[8], b[9], b[10] };
+  j = (vf32_t) { a[7], a[8], a[9], a[10] };
+  e = vec_powf32 (i, j);
+  k = (vf32_t) { r[7], r[8], r[9], r[10] };
+  rc += check_v4f32x ("check vec_powf32_array", k, e);
+
+  return (rc);
+}
+
 int
 test_vec_f32 (void)
 {
@@ -2328,6 +2602,8 @@ test_vec_f32 (void)
   rc += test_lvgfsx ();
   rc += test_stvgfsx ();
   rc += test_f32_indentity_array ();
+  rc += test_f16_bf16 ();
+  rc += test_float_elementary ();
 
   return (rc);
 }
@@ -3020,6 +3020,289 @@ test_indentity_array ()
   return rc;
 }
 
+/* Check that each element of val128 is within 1 ULP of the correctly
+   rounded shouldbe. NaNs only need to match as NaNs, other values
+   must have the same sign.  */
+static int
+check_v2f64_ulp (char *prefix, vf64_t val128, vf64_t shouldbe)
+{
+  vui64_t v = (vui64_t) val128;
+  vui64_t e = (vui64_t) shouldbe;
+  unsigned long long d;
+  int i, rc = 0;
+
+  for (i = 0; i < 2; i++)
+    {
+      if (val128[i] != val128[i] && shouldbe[i] != shouldbe[i])
+	continue;
+      d = (v[i] > e[i]) ? (v[i] - e[i]) : (e[i] - v[i]);
+      if (d > 1 || ((v[i] ^ e[i]) >> 63))
+	rc = 1;
+    }
+  if (rc)
+    {
+      printf ("%s\n", prefix);
+      print_v2f64x ("\tshould be: ", shouldbe);
+      print_v2f64x ("\t       is: ", val128);
+    }
+
+  return (rc);
+}
+
+int
+test_double_elementary (void)
+{
+  const vf64_t inf = { __builtin_inf (), -__builtin_inf () };
+  const vf64_t nan = { __builtin_nan (""), -__builtin_nan ("") };
+  double a[11], b[11], r[11];
+  vf64_t i, j, e, k;
+  long n;
+  int rc = 0;
+
+  printf ("\n%s double elementary functions\n", __FUNCTION__);
+
+  /* The expected values are correctly rounded.  */
+  i = (vf64_t) { 1.0, -0x1.6p+9 };
+  e = (vf64_t) { 0x1.5bf0a8b145769p+1, 0x1.44a3824e5285fp-1016 };
+  k = vec_expf64 (i);
+  rc += check_v2f64_ulp ("vec_expf64 1:", k, e);
+
+  i = (vf64_t) { 0x1.62e42fefa39efp+9, -0x1.74385446d71c3p+9 };
+  e = (vf64_t) { 0x1.fffffffffff2ap+1023, __DBL_DENORM_MIN__ };
+  k = vec_expf64 (i);
+  rc += check_v2f64_ulp ("vec_expf64 2:", k, e);
+
+  e = (vf64_t) { __builtin_inf (), 0.0 };
+  k = vec_expf64 (inf);
+  rc += check_v2f64x ("vec_expf64 3:", k, e);
+
+  i = (vf64_t) { 0.5, -1074.0 };
+  e = (vf64_t) { 0x1.6a09e667f3bcdp+0, __DBL_DENORM_MIN__ };
+  k = vec_exp2f64 (i);
+  rc += check_v2f64_ulp ("vec_exp2f64 1:", k, e);
+
+  i = (vf64_t) { 1023.75, 1024.0 };
+  e = (vf64_t) { 0x1.ae89f995ad3adp+1023, __builtin_inf () };
+  k = vec_exp2f64 (i);
+  rc += check_v2f64_ulp ("vec_exp2f64 2:", k, e);
+
+  i = (vf64_t) { 2.0, __DBL_DENORM_MIN__ };
+  e = (vf64_t) { 0x1.62e42fefa39efp-1, -0x1.74385446d71c3p+9 };
+  k = vec_logf64 (i);
+  rc += check_v2f64_ulp ("vec_logf64 1:", k, e);
+
+  i = (vf64_t) { __DBL_MAX__, 0.75 };
+  e = (vf64_t) { 0x1.62e42fefa39efp+9, -0x1.269621134db92p-2 };
+  k = vec_logf64 (i);
+  rc += check_v2f64_ulp ("vec_logf64 2:", k, e);
+
+  i = (vf64_t) { -0.0, -1.0 };
+  e = (vf64_t) { -__builtin_inf (), __builtin_nan ("") };
+  k = vec_logf64 (i);
+  rc += check_v2f64_ulp ("vec_logf64 3:", k, e);
+
+  i = (vf64_t) { 3.0, 0x1.0000000000001p+0 };
+  e = (vf64_t) { 0x1.95c01a39fbd68p+0, 0x1.71547652b82fdp-52 };
+  k = vec_log2f64 (i);
+  rc += check_v2f64_ulp ("vec_log2f64 1:", k, e);
+
+  i = (vf64_t) { 1.0, -0x1.921fb54442d18p+0 };
+  e = (vf64_t) { 0x1.aed548f090ceep-1, -1.0 };
+  k = vec_sinf64 (i);
+  rc += check_v2f64_ulp ("vec_sinf64 1:", k, e);
+
+  /* Large arguments take the Payne-Hanek reduction.  */
+  i = (vf64_t) { 0x1p+100, __DBL_MAX__ };
+  e = (vf64_t) { -0x1.be8ed97ac1f59p-1, 0x1.452fc98b34e97p-8 };
+  k = vec_sinf64 (i);
+  rc += check_v2f64_ulp ("vec_sinf64 2:", k, e);
+
+  i = (vf64_t) { -0.0, __builtin_inf () };
+  e = (vf64_t) { -0.0, __builtin_nan ("") };
+  k = vec_sinf64 (i);
+  rc += check_v2f64_ulp ("vec_sinf64 3:", k, e);
+
+  i = (vf64_t) { 1.0, 0x1.921fb54442d18p+0 };
+  e = (vf64_t) { 0x1.14a280fb5068cp-1, 0x1.1a62633145c07p-54 };
+  k = vec_cosf64 (i);
+  rc += check_v2f64_ulp ("vec_cosf64 1:", k, e);
+
+  /* 0x1.6ac5b262ca1ffp+849 is the double closest to a multiple of
+     pi/2.  */
+  i = (vf64_t) { 1.0e22, 0x1.6ac5b262ca1ffp+849 };
+  e = (vf64_t) { 0x1.0be2cef01c8f4p-1, -0x1.14ae72e6ba22fp-61 };
+  k = vec_cosf64 (i);
+  rc += check_v2f64_ulp ("vec_cosf64 2:", k, e);
+
+  i = (vf64_t) { -0.0, __builtin_nan ("") };
+  e = (vf64_t) { 1.0, __builtin_nan ("") };
+  k = vec_cosf64 (i);
+  rc += check_v2f64_ulp ("vec_cosf64 3:", k, e);
+
+  i = (vf64_t) { 0.5, -0x1p-30 };
+  e = (vf64_t) { 0x1.d9353d7568af3p-2, -0x1p-30 };
+  k = vec_tanhf64 (i);
+  rc += check_v2f64_ulp ("vec_tanhf64 1:", k, e);
+
+  i = (vf64_t) { -3.0, 20.0 };
+  e = (vf64_t) { -0x1.fd77d111a0bp-1, 1.0 };
+  k = vec_tanhf64 (i);
+  rc += check_v2f64_ulp ("vec_tanhf64 2:", k, e);
+
+  e = (vf64_t) { 1.0, -1.0 };
+  k = vec_tanhf64 (inf);
+  rc += check_v2f64x ("vec_tanhf64 3:", k, e);
+
+  i = (vf64_t) { 0.5, -1.5 };
+  e = (vf64_t) { 0x1.0a7ef5c18edd2p-1, -0x1.eea5557137aep-1 };
+  k = vec_erff64 (i);
+  rc += check_v2f64_ulp ("vec_erff64 1:", k, e);
+
+  i = (vf64_t) { 0x1p-1000, 5.5 };
+  e = (vf64_t) { 0x1.20dd750429b6dp-1000, 0x1.fffffffffffbep-1 };
+  k = vec_erff64 (i);
+  rc += check_v2f64_ulp ("vec_erff64 2:", k, e);
+
+  e = (vf64_t) { 1.0, -1.0 };
+  k = vec_erff64 (inf);
+  rc += check_v2f64x ("vec_erff64 3:", k, e);
+
+  k = vec_erff64 (nan);
+  rc += check_v2f64_ulp ("vec_erff64 4:", k, nan);
+
+  i = (vf64_t) { 2.0, -8.0 };
+  j = (vf64_t) { 0.5, 3.0 };
+  e = (vf64_t) { 0x1.6a09e667f3bcdp+0, -512.0 };
+  k = vec_powf64 (i, j);
+  rc += check_v2f64_ulp ("vec_powf64 1:", k, e);
+
+  i = (vf64_t) { 0x1.0000000000001p+0, 1.5 };
+  j = (vf64_t) { 0x1p+52, -1200.0 };
+  e = (vf64_t) { 0x1.5bf0a8b145769p+1, 0x1.081c592902e6ep-702 };
+  k = vec_powf64 (i, j);
+  rc += check_v2f64_ulp ("vec_powf64 2:", k, e);
+
+  /* pow(-8, 1/3) is NaN, pow(-0, -1) is -Inf.  */
+  i = (vf64_t) { -8.0, -0.0 };
+  j = (vf64_t) { 1.0 / 3.0, -1.0 };
+  e = (vf64_t) { __builtin_nan (""), -__builtin_inf () };
+  k = vec_powf64 (i, j);
+  rc += check_v2f64_ulp ("vec_powf64 3:", k, e);
+
+  /* pow(NaN, 0) and pow(1, NaN) are 1.  */
+  i = (vf64_t) { __builtin_nan (""), 1.0 };
+  j = (vf64_t) { 0.0, __builtin_nan ("") };
+  e = (vf64_t) { 1.0, 1.0 };
+  k = vec_powf64 (i, j);
+  rc += check_v2f64x ("vec_powf64 4:", k, e);
+
+  /* 11 elements covers the 4 element loop and a partial vector. The
+     arrays must match the vector functions exactly.  */
+  for (n = 0; n < 11; n++)
+    {
+      a[n] = (double) (n - 5) * 0.75;
+      b[n] = (double) n * 0.5;
+    }
+  __VEC_PWR_IMP (vec_expf64_array) (r, a, 11);
+  for (n = 0; n < 10; n += 2)
+    {
+      i = (vf64_t) { a[n], a[n + 1] };
+      e = vec_expf64 (i);
+      k = (vf64_t) { r[n], r[n + 1] };
+      rc += check_v2f64x ("vec_expf64_array:", k, e);
+    }
+  __VEC_PWR_IMP (vec_sinf64_array) (r, a, 11);
+  i = (vf64_t) { a[10], a[10] };
+  e = vec_sinf64 (i);
+  k = (vf64_t) { r[10], r[10] };
+  rc += check_v2f64x ("vec_sinf64_array:", k, e);
+  __VEC_PWR_IMP (vec_powf64_array) (r, b, a, 11);
+  i = (vf64_t) { b[9], b[10] };
+  j = (vf64_t) { a[9], a[10] };
+  e = vec_powf64 (i, j);
+  k = (vf64_t) { r[9], r[10] };
+  rc += check_v2f64x ("vec_powf64_array:", k, e);
+
+  return (rc);
+}
+
+int
+test_double_poly (void)
+{
+  double c[64], cd[128], a[11], r[22];
+  vf64_t i, e, k, l;
+  double e0, e1;
+  long n, deg;
+  int rc = 0;
+
+  printf ("\n%s double polynomial evaluation\n", __FUNCTION__);
+
+  /* All ones at +-2.0 sums powers of 2, exact in double up to degree
+     52. Degrees 5 and 6 use Horner's rule, 7 and up Estrin's scheme
+     with 0 to 7 Horner coefficients on top.  */
+  for (n = 0; n < 64; n++)
+    {
+      c[n] = 1.0;
+      cd[2 * n] = 1.0;
+      cd[2 * n + 1] = 0.0;
+    }
+  i = (vf64_t) { 2.0, -2.0 };
+  for (deg = 5; deg <= 52; deg++)
+    {
+      e0 = e1 = 0.0;
+      for (n = deg; n >= 0; n--)
+	{
+	  e0 = e0 * 2.0 + 1.0;
+	  e1 = e1 * -2.0 + 1.0;
+	}
+      e = (vf64_t) { e0, e1 };
+      k = vec_polyf64 (i, c, deg);
+      rc += check_v2f64x ("vec_polyf64:", k, e);
+      k = vec_polyf64_dd (i, cd, deg, &l);
+      rc += check_v2f64x ("vec_polyf64_dd:", k, e);
+    }
+
+  /* 2**61 - 1 is the double-double (2**61, -1.0).  */
+  i = (vf64_t) { 2.0, 2.0 };
+  k = vec_polyf64_dd (i, cd, 60, &l);
+  e = (vf64_t) { 0x1p61, 0x1p61 };
+  rc += check_v2f64x ("vec_polyf64_dd 60:", k, e);
+  e = (vf64_t) { -1.0, -1.0 };
+  rc += check_v2f64x ("vec_polyf64_dd 60 low:", l, e);
+
+  /* (1.0 + 2**-60) + 1.0 * x with x = 0.5.  */
+  cd[1] = 0x1p-60;
+  i = (vf64_t) { 0.5, 0.5 };
+  k = vec_polyf64_dd (i, cd, 1, &l);
+  e = (vf64_t) { 1.5, 1.5 };
+  rc += check_v2f64x ("vec_polyf64_dd 1:", k, e);
+  e = (vf64_t) { 0x1p-60, 0x1p-60 };
+  rc += check_v2f64x ("vec_polyf64_dd 1 low:", l, e);
+
+  /* The arrays must match the vector functions exactly.  */
+  for (n = 0; n < 64; n++)
+    c[n] = 1.0 / (double) (n + 1);
+  for (n = 0; n < 11; n++)
+    a[n] = (double) (n - 5) * 0.125;
+  __VEC_PWR_IMP (vec_polyf64_array) (r, a, c, 11, 11);
+  for (n = 0; n < 10; n += 2)
+    {
+      i = (vf64_t) { a[n], a[n + 1] };
+      e = vec_polyf64 (i, c, 11);
+      k = (vf64_t) { r[n], r[n + 1] };
+      rc += check_v2f64x ("vec_polyf64_array:", k, e);
+    }
+  __VEC_PWR_IMP (vec_polyf64_dd_array) (r, a, cd, 9, 11);
+  i = (vf64_t) { a[9], a[10] };
+  e = vec_polyf64_dd (i, cd, 9, &l);
+  k = (vf64_t) { r[18], r[20] };
+  rc += check_v2f64x ("vec_polyf64_dd_array:", k, e);
+  k = (vf64_t) { r[19], r[21] };
+  rc += check_v2f64x ("vec_polyf64_dd_array low:", k, l);
+
+  return (rc);
+}
+
 int
 test_vec_f64 (void)
 {
@@ -3043,6 +3326,8 @@ test_vec_f64 (void)
   rc += test_lvgdfdx ();
   rc += test_stvgdfdx ();
   rc += test_indentity_array ();
+  rc += test_double_elementary ();
+  rc += test_double_poly ();
 
   return (rc);
 }
@@ -10205,6 +10205,119 @@ test_longdiv_e32 (void)
   return (rc);
 }
 
+/* Check vec_div10k_uq, vec_mod10k_uq and the rounding of
+   vec_div10k_rnd_uq for x / 10**k, against scalar __int128.  */
+static int
+test_div10k_check (unsigned __int128 x, unsigned int k)
+{
+  vui128_t vx, q, r, e;
+  unsigned __int128 d, eq, er, half;
+  int rc = 0;
+
+  vx = vec_transfer_uint128_to_vui128t (x);
+  d = vec_transfer_vui128t_to_uint128 (vtipowof10[k]);
+  eq = x / d;
+  er = x % d;
+
+  q = vec_div10k_uq (vx, k);
+  r = vec_mod10k_uq (vx, q, k);
+  rc += check_vuint128x ("vec_div10k_uq:", q,
+			 vec_transfer_uint128_to_vui128t (eq));
+  rc += check_vuint128x ("vec_mod10k_uq:", r,
+			 vec_transfer_uint128_to_vui128t (er));
+
+  e = vec_transfer_uint128_to_vui128t (eq + (er != 0));
+  rc += check_vuint128x ("vec_div10k_rnd_uq up:",
+			 vec_div10k_rnd_uq (vx, k, VEC_ROUND_UP), e);
+  rc += check_vuint128x ("vec_div10k_rnd_uq ceil:",
+			 vec_div10k_rnd_uq (vx, k, VEC_ROUND_CEIL), e);
+  e = vec_transfer_uint128_to_vui128t (eq);
+  rc += check_vuint128x ("vec_div10k_rnd_uq trunc:",
+			 vec_div10k_rnd_uq (vx, k, VEC_ROUND_TRUNC), e);
+  rc += check_vuint128x ("vec_div10k_rnd_uq floor:",
+			 vec_div10k_rnd_uq (vx, k, VEC_ROUND_FLOOR), e);
+
+  half = d / 2;
+  e = vec_transfer_uint128_to_vui128t (eq + (k > 0 && er >= half));
+  rc += check_vuint128x ("vec_div10k_rnd_uq half_up:",
+			 vec_div10k_rnd_uq (vx, k, VEC_ROUND_HALF_UP), e);
+  e = vec_transfer_uint128_to_vui128t (
+      eq + (k > 0 && (er > half || (er == half && (eq & 1)))));
+  rc += check_vuint128x ("vec_div10k_rnd_uq half_even:",
+			 vec_div10k_rnd_uq (vx, k, VEC_ROUND_HALF_EVEN), e);
+
+  if (rc)
+    {
+      printf ("test_div10k k=%u\n", k);
+      print_vint128x (" x = ", vx);
+    }
+
+  return rc;
+}
+
+int
+test_div_mod10k_uq (void)
+{
+  const unsigned __int128 max = ~(unsigned __int128) 0;
+  unsigned __int128 d, x;
+  vui128_t vx, l, h, e;
+  unsigned int k;
+  int rc = 0;
+
+  printf ("\ntest Vector multiply/divide by 10**k Unsigned Quadword\n");
+
+  for (k = 0; k <= 38; k++)
+    {
+      d = vec_transfer_vui128t_to_uint128 (vtipowof10[k]);
+
+      /* max * 10**k = (10**k - 1) * 2**128 + (2**128 - 10**k).  */
+      vx = vec_transfer_uint128_to_vui128t (max);
+      l = vec_cmul10k_cuq (&h, vx, k);
+      rc += check_vuint128x ("vec_cmul10k_cuq low:", l,
+			     vec_transfer_uint128_to_vui128t (-d));
+      rc += check_vuint128x ("vec_cmul10k_cuq high:", h,
+			     vec_transfer_uint128_to_vui128t (d - 1));
+      rc += check_vuint128x ("vec_mul10k_uq:", vec_mul10k_uq (vx, k),
+			     vec_transfer_uint128_to_vui128t (-d));
+
+      x = max / d;
+      e = vec_transfer_uint128_to_vui128t (x * d);
+      rc += check_vuint128x ("vec_mul10k_uq max/10**k:",
+			     vec_mul10k_uq (vec_transfer_uint128_to_vui128t (x),
+					    k), e);
+
+      rc += test_div10k_check (max, k);
+      rc += test_div10k_check (0, k);
+      rc += test_div10k_check (d, k);
+      rc += test_div10k_check (d - 1, k);
+      /* Exact ties with even and odd quotients, and next to them.  */
+      if (d <= max / 9)
+	{
+	  x = (d / 2) + d * 6;
+	  rc += test_div10k_check (x, k);
+	  rc += test_div10k_check (x - 1, k);
+	  rc += test_div10k_check (x + 1, k);
+	  x = (d / 2) + d * 7;
+	  rc += test_div10k_check (x, k);
+	  rc += test_div10k_check (x + d, k);
+	}
+      rc += test_div10k_check (max - (max % d) - 1, k);
+    }
+
+  /* For k > 38 the quotient is 0 and only up/ceil round.  */
+  vx = vec_transfer_uint128_to_vui128t (max);
+  e = vec_transfer_uint128_to_vui128t (0);
+  rc += check_vuint128x ("vec_div10k_uq 39:", vec_div10k_uq (vx, 39), e);
+  rc += check_vuint128x ("vec_mod10k_uq 39:", vec_mod10k_uq (vx, e, 39), vx);
+  rc += check_vuint128x ("vec_div10k_rnd_uq 39 half_up:",
+			 vec_div10k_rnd_uq (vx, 39, VEC_ROUND_HALF_UP), e);
+  e = vec_transfer_uint128_to_vui128t (1);
+  rc += check_vuint128x ("vec_div10k_rnd_uq 40 up:",
+			 vec_div10k_rnd_uq (vx, 40, VEC_ROUND_UP), e);
+
+  return (rc);
+}
+
 int
 test_xfer_int128 (void)
 {
@@ -10253,6 +10366,81 @@ test_xfer_int128 (void)
   return (rc);
 }
 
+/* The out-of-line implementations in libpvecstatic.a, selected by
+   __VEC_PWR_IMP for this -mcpu, must match the inline operations.  */
+int
+test_div_mod_10e3x_runtime (void)
+{
+  const unsigned __int128 ten16 = 10000000000000000UL;
+  const unsigned __int128 ten31 = ten16 * 1000000000000000UL;
+  const unsigned __int128 max = ~(unsigned __int128) 0;
+  unsigned __int128 x[6];
+  vui128_t vx, vy, q, qh, ql, qr, e, eh;
+  vi128_t sx, sq;
+  int i, rc = 0;
+
+  printf ("\n%s Vector divide/modulo 10**31/10**32 runtime */\n",
+	  __FUNCTION__);
+
+  x[0] = max;
+  x[1] = ten31 - 1;
+  x[2] = ten31;
+  x[3] = ten31 * 10;
+  x[4] = ten31 * 10 + 1;
+  x[5] = ((unsigned __int128) 0x0123456789abcdefUL << 64)
+      | 0xfedcba9876543210UL;
+
+  for (i = 0; i < 6; i++)
+    {
+      vx = vec_transfer_uint128_to_vui128t (x[i]);
+      vy = vec_transfer_uint128_to_vui128t (x[(i + 1) % 6] % ten31);
+
+      q = __VEC_PWR_IMP (vec_divuq_10e31) (vx);
+      e = vec_transfer_uint128_to_vui128t (x[i] / ten31);
+      rc += check_vuint128x ("vec_divuq_10e31_PWRn:", q, e);
+      e = vec_transfer_uint128_to_vui128t (x[i] % ten31);
+      rc += check_vuint128x ("vec_moduq_10e31_PWRn:",
+			     __VEC_PWR_IMP (vec_moduq_10e31) (vx, q), e);
+
+      q = __VEC_PWR_IMP (vec_divuq_10e32) (vx);
+      e = vec_transfer_uint128_to_vui128t (x[i] / (ten31 * 10));
+      rc += check_vuint128x ("vec_divuq_10e32_PWRn:", q, e);
+      e = vec_transfer_uint128_to_vui128t (x[i] % (ten31 * 10));
+      rc += check_vuint128x ("vec_moduq_10e32_PWRn:",
+			     __VEC_PWR_IMP (vec_moduq_10e32) (vx, q), e);
+
+      /* The double quadword forms need a high part less than the
+	 divisor. The modulo takes the quotient from the divide.  */
+      ql = __VEC_PWR_IMP (vec_divudq_10e31) (&qh, vy, vx);
+      e = vec_divudq_10e31 (&eh, vy, vx);
+      rc += check_vuint128x ("vec_divudq_10e31_PWRn:", ql, e);
+      rc += check_vuint128x ("vec_divudq_10e31_PWRn high:", qh, eh);
+      qr = __VEC_PWR_IMP (vec_modudq_10e31) (vy, vx, &ql);
+      rc += check_vuint128x ("vec_modudq_10e31_PWRn:", qr,
+			     vec_modudq_10e31 (vy, vx, &ql));
+
+      ql = __VEC_PWR_IMP (vec_divudq_10e32) (&qh, vy, vx);
+      e = vec_divudq_10e32 (&eh, vy, vx);
+      rc += check_vuint128x ("vec_divudq_10e32_PWRn:", ql, e);
+      rc += check_vuint128x ("vec_divudq_10e32_PWRn high:", qh, eh);
+      qr = __VEC_PWR_IMP (vec_modudq_10e32) (vy, vx, &ql);
+      rc += check_vuint128x ("vec_modudq_10e32_PWRn:", qr,
+			     vec_modudq_10e32 (vy, vx, &ql));
+
+      sx = (vi128_t) vec_transfer_uint128_to_vui128t (x[i] >> 1);
+      if (i & 1)
+	sx = vec_negsq (sx);
+      sq = __VEC_PWR_IMP (vec_divsq_10e31) (sx);
+      rc += check_vuint128x ("vec_divsq_10e31_PWRn:", (vui128_t) sq,
+			     (vui128_t) vec_divsq_10e31 (sx));
+      rc += check_vuint128x ("vec_modsq_10e31_PWRn:",
+			     (vui128_t) __VEC_PWR_IMP (vec_modsq_10e31) (sx, sq),
+			     (vui128_t) vec_modsq_10e31 (sx, sq));
+    }
+
+  return (rc);
+}
+
 int
 test_vec_i128 (void)
 {
@@ -10314,6 +10502,8 @@ test_vec_i128 (void)
   rc += test_div_modudq_e31 ();
   rc += test_longdiv_e31 ();
   rc += test_longdiv_e32 ();
+  rc += test_div_mod10k_uq ();
+  rc += test_div_mod_10e3x_runtime ();
 #endif
   return (rc);
 }
@@ -2421,6 +2421,355 @@ test_mul2048x2048 (void)
 
   return (rc);
 }
+
+/* Scalar helpers for test_powof10_512. Keep them independent of the
+   vector operations under test: limb arrays of unsigned __int128,
+   low order first.  */
+static void
+test_512_to_limbs (unsigned __int128 l[4], __VEC_U_512 a)
+{
+  __VEC_U_128 t;
+
+  t.vx1 = a.vx0; l[0] = t.ui128;
+  t.vx1 = a.vx1; l[1] = t.ui128;
+  t.vx1 = a.vx2; l[2] = t.ui128;
+  t.vx1 = a.vx3; l[3] = t.ui128;
+}
+
+static __VEC_U_512
+test_limbs_to_512 (const unsigned __int128 l[4])
+{
+  __VEC_U_512 r;
+  __VEC_U_128 t;
+
+  t.ui128 = l[0]; r.vx0 = t.vx1;
+  t.ui128 = l[1]; r.vx1 = t.vx1;
+  t.ui128 = l[2]; r.vx2 = t.vx1;
+  t.ui128 = l[3]; r.vx3 = t.vx1;
+  return r;
+}
+
+static __VEC_U_512
+test_sr512 (__VEC_U_512 a, unsigned int sh)
+{
+  unsigned __int128 l[4], r[4];
+  unsigned int q = sh / 128, b = sh % 128;
+  int i;
+
+  test_512_to_limbs (l, a);
+  for (i = 0; i < 4; i++)
+    {
+      unsigned __int128 lo = (i + q < 4) ? l[i + q] : 0;
+      unsigned __int128 hi = (i + q + 1 < 4) ? l[i + q + 1] : 0;
+      r[i] = (b == 0) ? lo : (lo >> b) | (hi << (128 - b));
+    }
+  return test_limbs_to_512 (r);
+}
+
+/* Return a - b and set *borrow if a < b.  */
+static __VEC_U_512
+test_sub512 (__VEC_U_512 a, __VEC_U_512 b, int *borrow)
+{
+  unsigned __int128 x[4], y[4], r[4];
+  int i, c = 0;
+
+  test_512_to_limbs (x, a);
+  test_512_to_limbs (y, b);
+  for (i = 0; i < 4; i++)
+    {
+      r[i] = x[i] - y[i] - c;
+      c = (x[i] < y[i]) || (x[i] == y[i] && c);
+    }
+  *borrow = c;
+  return test_limbs_to_512 (r);
+}
+
+static __VEC_U_512
+test_256_to_512 (__VEC_U_256 a)
+{
+  __VEC_U_512 r = vec512_zeros;
+
+  r.vx0 = a.vx0;
+  r.vx1 = a.vx1;
+  return r;
+}
+
+/* Check q == floor (n / 10**k) as q * 10**k <= n < (q+1) * 10**k.  */
+static int
+test_check_div10k (char *prefix, unsigned int k, __VEC_U_512 n,
+		   __VEC_U_512 q)
+{
+  __VEC_U_1024x512 p;
+  __VEC_U_512 r;
+  int borrow, rc = 0;
+
+  p.x1024 = __VEC_PWR_IMP (vec_mul512x512) (q, vec512_powof10[k]);
+  r = test_sub512 (n, p.x2.v0x512, &borrow);
+  if (borrow || vec_cmpuq_all_ne (p.x2.v1x512.vx0, vec512_zeros.vx0)
+      || vec_cmpuq_all_ne (p.x2.v1x512.vx1, vec512_zeros.vx0)
+      || vec_cmpuq_all_ne (p.x2.v1x512.vx2, vec512_zeros.vx0)
+      || vec_cmpuq_all_ne (p.x2.v1x512.vx3, vec512_zeros.vx0))
+    rc = 1;
+  else
+    {
+      /* The remainder must be less than 10**k.  */
+      test_sub512 (r, vec512_powof10[k], &borrow);
+      if (!borrow)
+	rc = 1;
+    }
+  if (rc)
+    {
+      printf ("%s 10**%u fail\n", prefix, k);
+      print_vint512x (" n = ", n);
+      print_vint512x (" q = ", q);
+    }
+  return rc;
+}
+
+int
+test_powof10_512 (void)
+{
+  __VEC_U_512x1 t;
+  __VEC_U_1024x512 p;
+  __VEC_U_512 n[5], n256, q, p256;
+  __VEC_U_256 s256;
+  vui128_t ten = (vui128_t) CONST_VINT128_W (0, 0, 0, 10);
+  int borrow, rc = 0;
+  unsigned int k, i;
+
+  printf ("\ntest_powof10_512 power of ten and reciprocal tables\n");
+
+  /* Each power is the previous power times 10, without carry out.  */
+  rc += check_vuint128 ("vec512_powof10 38:", vec512_powof10[38].vx0,
+			vtipowof10[38]);
+  for (k = 1; k <= 154; k++)
+    {
+      t.x640 = __VEC_PWR_IMP (vec_mul512x128) (vec512_powof10[k - 1], ten);
+      rc += check_vuint128 ("vec512_powof10 carry:", t.x2.v1x128,
+			    vec512_zeros.vx0);
+      rc += check_vint512 ("vec512_powof10:", vec512_powof10[k],
+			   t.x2.v0x512);
+    }
+  for (k = 0; k <= 77; k++)
+    rc += check_vint512 ("vec256_powof10:",
+			 test_256_to_512 (vec256_powof10[k]),
+			 vec512_powof10[k]);
+
+  /* n / 10**k = ((n >> k) * recip[k]) >> (N + sh[k]) for all n.  */
+  for (k = 1; k <= 154; k++)
+    {
+      n[0] = vec512_foxes;
+      n[1] = vec512_foxeasy;
+      n[2] = vec512_powof10[k];
+      n[3] = test_sub512 (vec512_powof10[k], vec512_one, &borrow);
+      n[4] = vec512_powof10[154];
+      for (i = 0; i < 5; i++)
+	{
+	  p.x1024 = __VEC_PWR_IMP (vec_mul512x512) (test_sr512 (n[i], k),
+						    vec512_recipof10[k]);
+	  q = test_sr512 (p.x2.v1x512, vec_recipof10_sh[k]);
+	  rc += test_check_div10k ("vec512_recipof10:", k, n[i], q);
+
+	  if (k > 77)
+	    continue;
+	  /* Same for the low 256 bits of n.  */
+	  n256 = vec512_zeros;
+	  n256.vx0 = n[i].vx0;
+	  n256.vx1 = n[i].vx1;
+	  q = test_sr512 (n256, k);
+	  s256.vx0 = q.vx0;
+	  s256.vx1 = q.vx1;
+	  p256 = __VEC_PWR_IMP (vec_mul256x256) (s256, vec256_recipof10[k]);
+	  q = vec512_zeros;
+	  q.vx0 = p256.vx2;
+	  q.vx1 = p256.vx3;
+	  q = test_sr512 (q, vec_recipof10_sh[k]);
+	  rc += test_check_div10k ("vec256_recipof10:", k, n256, q);
+	}
+    }
+
+  return (rc);
+}
+
+int
+test_mul_div10k_byN (void)
+{
+  const vui128_t zero = (vui128_t) ((unsigned __int128) 0);
+  __VEC_U_512 n, q, p, q0, e, half;
+  vui128_t c, r;
+  unsigned int k;
+  int borrow, rc = 0;
+
+  printf ("\ntest_mul_div10k_byN multiply/divide 512-bits by 10**k\n");
+
+  /* __VEC_U_512 has the same quadword order as a vui128_t[4].  */
+  for (k = 0; k <= 38; k++)
+    {
+      n = vec512_foxes;
+      r = __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n,
+					  k, VEC_ROUND_TRUNC, 4);
+      rc += test_check_div10k ("vec_div10k_byN:", k, n, q);
+      c = __VEC_PWR_IMP (vec_mul10k_byN) ((vui128_t *) &p, (vui128_t *) &q,
+					  k, 4);
+      rc += check_vuint128 ("vec_mul10k_byN carry:", c, zero);
+      e = vec512_zeros;
+      e.vx0 = r;
+      rc += check_vint512 ("vec_div10k_byN rem:", test_sub512 (n, p, &borrow),
+			   e);
+
+      /* foxes * 10**k = (10**k - 1) * 2**512 + (2**512 - 10**k).  */
+      c = __VEC_PWR_IMP (vec_mul10k_byN) ((vui128_t *) &p, (vui128_t *) &n,
+					  k, 4);
+      rc += check_vuint128 ("vec_mul10k_byN carry max:", c,
+			    vec_subuqm (vtipowof10[k], vec512_one.vx0));
+      rc += check_vint512 ("vec_mul10k_byN max:", p,
+			   test_sub512 (vec512_zeros, vec512_powof10[k],
+					&borrow));
+      if (k == 0)
+	continue;
+
+      /* n = q0 * 10**k + 10**k / 2, with q0 odd and a carry into
+         every quadword when rounded up.  */
+      q0 = vec512_foxes;
+      q0.vx3 = zero;
+      __VEC_PWR_IMP (vec_mul10k_byN) ((vui128_t *) &p, (vui128_t *) &q0,
+				      k, 4);
+      half = vec512_zeros;
+      half.vx0 = vec_srqi (vtipowof10[k], 1);
+      n = vec_add512um (p, half);
+      e = vec512_zeros;
+      e.vx3 = vec512_one.vx0;
+      __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n, k,
+				      VEC_ROUND_TRUNC, 4);
+      rc += check_vint512 ("vec_div10k_byN trunc:", q, q0);
+      __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n, k,
+				      VEC_ROUND_HALF_UP, 4);
+      rc += check_vint512 ("vec_div10k_byN half_up:", q, e);
+      __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n, k,
+				      VEC_ROUND_HALF_EVEN, 4);
+      rc += check_vint512 ("vec_div10k_byN half_even odd:", q, e);
+      __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n, k,
+				      VEC_ROUND_UP, 4);
+      rc += check_vint512 ("vec_div10k_byN up:", q, e);
+
+      /* Same with q0 even, ties stay and below half truncates.  */
+      q0.vx0 = vec_subuqm (q0.vx0, vec512_one.vx0);
+      __VEC_PWR_IMP (vec_mul10k_byN) ((vui128_t *) &p, (vui128_t *) &q0,
+				      k, 4);
+      n = vec_add512um (p, half);
+      __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n, k,
+				      VEC_ROUND_HALF_EVEN, 4);
+      rc += check_vint512 ("vec_div10k_byN half_even even:", q, q0);
+      n = test_sub512 (n, vec512_one, &borrow);
+      __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n, k,
+				      VEC_ROUND_HALF_UP, 4);
+      rc += check_vint512 ("vec_div10k_byN half_up below:", q, q0);
+    }
+
+  return (rc);
+}
+
+/* Reference x / 10**k rounded as rnd, from the C truncated
+   quotient and remainder.  */
+static __int128
+test_rnd10k_sq (__int128 x, __int128 d, vec_round_t rnd)
+{
+  __int128 q = x / d;
+  __int128 r = x % d;
+  __int128 ar = (r < 0) ? -r : r;
+  __int128 s = (x < 0) ? -1 : 1;
+
+  if (r == 0)
+    return q;
+  switch (rnd)
+    {
+    case VEC_ROUND_UP:
+      return q + s;
+    case VEC_ROUND_FLOOR:
+      return (x < 0) ? q - 1 : q;
+    case VEC_ROUND_CEIL:
+      return (x < 0) ? q : q + 1;
+    case VEC_ROUND_HALF_UP:
+      return ((ar * 2) >= d) ? q + s : q;
+    case VEC_ROUND_HALF_EVEN:
+      if ((ar * 2) > d || ((ar * 2) == d && (q & 1)))
+	return q + s;
+      return q;
+    default:
+      return q;
+    }
+}
+
+int
+test_rescalesq_array (void)
+{
+  const __int128 smax = (__int128) (~(unsigned __int128) 0 >> 1);
+  const __int128 smin = -smax - 1;
+  __int128 x[8] = { 12345, -12345, 12355, -12355, smax, smin, 0, 15 };
+  vi128_t a[8], r[8];
+  unsigned char ovf[8];
+  __int128 d, e;
+  long novf;
+  int i, k, rnd, rc = 0;
+
+  printf ("\ntest_rescalesq_array rescale signed quadwords by 10**k\n");
+
+  for (i = 0; i < 8; i++)
+    a[i] = (vi128_t) vec_transfer_uint128_to_vui128t (x[i]);
+
+  for (k = 1; k <= 3; k++)
+    {
+      d = vec_transfer_vui128t_to_uint128 (vtipowof10[k]);
+      for (rnd = VEC_ROUND_TRUNC; rnd <= VEC_ROUND_CEIL; rnd++)
+	{
+	  novf = __VEC_PWR_IMP (vec_rescalesq_array) (r, a, -k, rnd, ovf, 8);
+	  rc += check_int64 ("vec_rescalesq_array novf:", novf, 0);
+	  for (i = 0; i < 8; i++)
+	    {
+	      e = test_rnd10k_sq (x[i], d, rnd);
+	      rc += check_int128 ("vec_rescalesq_array div:",
+				  vec_transfer_vui128t_to_uint128 (
+				      (vui128_t) r[i]), e);
+	      rc += check_int128 ("vec_div10k_rnd_sq:",
+				  vec_transfer_vui128t_to_uint128 (
+				      (vui128_t) vec_div10k_rnd_sq (a[i], k,
+								    rnd)), e);
+	      rc += check_int64 ("vec_rescalesq_array ovf:", ovf[i], 0);
+	    }
+	}
+    }
+
+  /* Scale up by 100. smax / 100 and smin / 100 fit, the next values
+     out and smax, smin overflow to the low 128 bits of the product.  */
+  x[0] = smax / 100;
+  x[1] = x[0] + 1;
+  x[2] = smin / 100;
+  x[3] = x[2] - 1;
+  for (i = 0; i < 8; i++)
+    a[i] = (vi128_t) vec_transfer_uint128_to_vui128t (x[i]);
+  novf = __VEC_PWR_IMP (vec_rescalesq_array) (r, a, 2, VEC_ROUND_TRUNC,
+					      ovf, 8);
+  rc += check_int64 ("vec_rescalesq_array novf up:", novf, 4);
+  for (i = 0; i < 8; i++)
+    {
+      e = (__int128) ((unsigned __int128) x[i] * 100);
+      rc += check_int128 ("vec_rescalesq_array mul:",
+			  vec_transfer_vui128t_to_uint128 ((vui128_t) r[i]),
+			  e);
+      rc += check_int64 ("vec_rescalesq_array ovf up:", ovf[i],
+			 (i == 1 || i == 3 || i == 4 || i == 5));
+    }
+
+  /* 10**39 exceeds 128 bits, only 0 does not overflow.  */
+  novf = __VEC_PWR_IMP (vec_rescalesq_array) (&r[6], &a[6], 39,
+					      VEC_ROUND_TRUNC, NULL, 2);
+  rc += check_int64 ("vec_rescalesq_array novf 39:", novf, 1);
+  rc += check_int128 ("vec_rescalesq_array 0*10**39:",
+		      vec_transfer_vui128t_to_uint128 ((vui128_t) r[6]), 0);
+
+  return (rc);
+}
+
 #undef __DEBUG_PRINT__
 
 int
@@ -2440,6 +2789,9 @@ test_vec_i512 (void)
   rc += test_mul512x128_MN ();
   rc += test_mul512x512_MN ();
   rc += test_mul2048x2048_MN ();
+  rc += test_powof10_512 ();
+  rc += test_mul_div10k_byN ();
+  rc += test_rescalesq_array ();
 
   return (rc);
 }
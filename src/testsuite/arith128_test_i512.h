@@ -72,6 +72,9 @@ extern int test_mul512x128 (void);
 extern int test_mul512x512 (void);
 extern int test_mul1024x1024 (void);
 extern int test_mul2048x2048 (void);
+extern int test_powof10_512 (void);
+extern int test_mul_div10k_byN (void);
+extern int test_rescalesq_array (void);
 
 extern int test_vec_i512 (void);
 
@@ -169,6 +169,42 @@ test_vec_bcddiv (vBCD_t a, vBCD_t b)
   return vec_bcddiv (a, b);
 }
 
+vBCD_t
+test_vec_bcdmul_rdx (vBCD_t a, vBCD_t b)
+{
+  return vec_bcdmul_rdx (a, b);
+}
+
+vBCD_t
+test_vec_bcdmulh_rdx (vBCD_t a, vBCD_t b)
+{
+  return vec_bcdmulh_rdx (a, b);
+}
+
+vBCD_t
+test_vec_bcddiv_rdx (vBCD_t a, vBCD_t b)
+{
+  return vec_bcddiv_rdx (a, b);
+}
+
+vBCD_t
+test_vec_bcddive_rdx (vBCD_t a, vBCD_t b)
+{
+  return vec_bcddive_rdx (a, b);
+}
+
+vui128_t
+test_vec_bcdctuq_rdx (vBCD_t a)
+{
+  return vec_bcdctuq_rdx (a);
+}
+
+vBCD_t
+test_vec_bcdcfuq_rdx (vui128_t a)
+{
+  return vec_bcdcfuq_rdx (a);
+}
+
 vi128_t
 test_vec_bcdctsq (vBCD_t a)
 {
@@ -0,0 +1,250 @@
+#!/bin/sh
+#
+# Copyright (c) [2026] IBM Corporation.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Static instruction count report for the libvecdummy wrappers.
+#
+# Disassemble each test_* / __test_* function of the libvecdummy
+# archives, count instructions by class (VSX, VMX, load/store, branch,
+# fixed-point and other) and, if llvm-mca is available, estimate the
+# latency (total cycles for one iteration) and the reciprocal
+# throughput of the straight line (non-branch) code.
+#
+# Usage:
+#   vec_dummy_report.sh [-b baseline] [-u] [-t percent] [-o report] \
+#       LABEL:MCPU:ARCHIVE ...
+#
+#   LABEL    name of the target in the report and baseline (PWR9)
+#   MCPU     llvm-mca -mcpu value (pwr8, pwr9, pwr10)
+#   ARCHIVE  archive or object to disassemble (.libs/libvecdummy.a)
+#
+#   -b FILE  baseline of "LABEL function insns" lines
+#   -u       write the current counts to the baseline file
+#   -t PCT   allowed instruction count growth over the baseline
+#            (default $VEC_DUMMY_THRESHOLD or 10 percent)
+#   -o FILE  write the report to FILE instead of stdout
+#
+# Exits 1 if any function's instruction count exceeds its baseline
+# by more than the threshold, and 77 (skipped) if the baseline is
+# missing or has no entries. Functions missing from the baseline,
+# missing archives and a missing llvm-mca are reported but do not fail.
+# The environment variables OBJDUMP and LLVM_MCA select the tools.
+
+OBJDUMP=${OBJDUMP:-objdump}
+LLVM_MCA=${LLVM_MCA:-llvm-mca}
+threshold=${VEC_DUMMY_THRESHOLD:-10}
+baseline=""
+update=0
+report=""
+
+while getopts "b:ut:o:" opt; do
+	case $opt in
+	b) baseline=$OPTARG ;;
+	u) update=1 ;;
+	t) threshold=$OPTARG ;;
+	o) report=$OPTARG ;;
+	*) sed -n '/^# Usage:/,/^# The environment/s/^# \{0,1\}//p' "$0" >&2
+	   exit 2 ;;
+	esac
+done
+shift $((OPTIND - 1))
+
+tmp=$(mktemp -d) || exit 2
+trap 'rm -rf "$tmp"' EXIT
+
+have_mca=0
+if command -v "$LLVM_MCA" >/dev/null 2>&1; then
+	have_mca=1
+else
+	echo "vec_dummy_report: $LLVM_MCA not found, no cycle estimates" >&2
+fi
+
+: > "$tmp/counts"
+for spec in "$@"; do
+	label=${spec%%:*}
+	rest=${spec#*:}
+	mcpu=${rest%%:*}
+	archive=${rest#*:}
+
+	if [ ! -f "$archive" ]; then
+		echo "vec_dummy_report: $label: $archive not found, skipped" >&2
+		continue
+	fi
+	if ! "$OBJDUMP" -d "$archive" > "$tmp/dis.txt" 2>/dev/null; then
+		echo "vec_dummy_report: $label: $OBJDUMP -d $archive failed," \
+		     "skipped" >&2
+		continue
+	fi
+	if grep -q -e 'powerpcle' -e 'littlepowerpc' -e 'elf64-ppc64le' \
+		"$tmp/dis.txt"; then
+		triple=powerpc64le-unknown-linux-gnu
+	else
+		triple=powerpc64-unknown-linux-gnu
+	fi
+
+	rm -rf "$tmp/fn"
+	mkdir "$tmp/fn"
+	# Split the disassembly into one llvm-mca input per function and
+	# count instruction classes. Handles both GNU objdump
+	# (addr:<tab>bytes<tab>insn) and llvm-objdump (addr: bytes insn).
+	awk -v label="$label" -v dir="$tmp/fn" -v counts="$tmp/counts" '
+	function flush() {
+		if (fname == "")
+			return
+		printf "%s %s %d %d %d %d %d %d\n", label, fname, n, vsx, vmx,
+			ldst, br, fxu >> counts
+		close (dir "/" fname ".s")
+		fname = ""
+	}
+	/^[0-9a-f]+ <[^>]+>:$/ {
+		flush()
+		name = $2
+		gsub (/[<>:]/, "", name)
+		if (name !~ /^_*test_/)
+			next
+		seen[name]++
+		fname = (seen[name] > 1) ? name "." seen[name] : name
+		n = vsx = vmx = ldst = br = fxu = 0
+		printf "" > (dir "/" fname ".s")
+		next
+	}
+	fname != "" && /^[ \t]*[0-9a-f]+:/ {
+		line = $0
+		sub (/^[ \t]*[0-9a-f]+:[ \t]*/, "", line)
+		while (sub (/^[0-9a-f][0-9a-f] [0-9a-f][0-9a-f] [0-9a-f][0-9a-f] [0-9a-f][0-9a-f][ \t]*/, "", line))
+			;
+		sub (/[ \t]*[#<].*$/, "", line)
+		if (line == "" || line ~ /^[.<]/)
+			next
+		split (line, f, /[ \t]+/)
+		m = f[1]
+		n++
+		if (m ~ /^b/) {
+			br++
+			next
+		}
+		if (m ~ /^st/ || (m ~ /^l/ && m !~ /^(li|lis|lvsl|lvsr)$/))
+			ldst++
+		else if ((m ~ /^x/ && m !~ /^xor/) || m ~ /^m[ft]vsr/)
+			vsx++
+		else if (m ~ /^v/ || m ~ /^lvs/ || m ~ /^m[ft]vscr/)
+			vmx++
+		else
+			fxu++
+		# llvm-mc wants bare register numbers.
+		ops = line
+		sub (/^[^ \t]+[ \t]*/, "", ops)
+		ops = "," ops
+		gsub (/[ \t]/, "", ops)
+		while (match (ops, /[,(](vs|v|r|f|cr)[0-9]+/)) {
+			pre = substr (ops, 1, RSTART)
+			reg = substr (ops, RSTART + 1, RLENGTH - 1)
+			sub (/^[a-z]+/, "", reg)
+			ops = pre reg substr (ops, RSTART + RLENGTH)
+		}
+		sub (/^,/, "", ops)
+		print m " " ops >> (dir "/" fname ".s")
+	}
+	END { flush() }
+	' "$tmp/dis.txt"
+
+	# Attach llvm-mca estimates (or "-") to this label's counts.
+	grep "^$label " "$tmp/counts" | while read -r l fname n rest; do
+		cyc=-
+		rthru=-
+		if [ $have_mca = 1 ] && [ -s "$tmp/fn/$fname.s" ]; then
+			"$LLVM_MCA" -mtriple=$triple -mcpu=$mcpu -iterations=1 \
+				"$tmp/fn/$fname.s" > "$tmp/mca.txt" 2>/dev/null
+			if [ $? = 0 ]; then
+				cyc=$(sed -n 's/^Total Cycles: *//p' "$tmp/mca.txt")
+				rthru=$(sed -n 's/^Block RThroughput: *//p' "$tmp/mca.txt")
+			fi
+		fi
+		echo "$l $fname $n $rest ${cyc:--} ${rthru:--}"
+	done >> "$tmp/table"
+done
+
+if [ ! -s "$tmp/table" ]; then
+	echo "vec_dummy_report: no functions found, nothing to report" >&2
+	exit 0
+fi
+
+{
+	printf "%-6s %-40s %5s %4s %4s %4s %4s %4s %7s %6s\n" \
+		cpu function insns vsx vmx ldst br fxu mca-cyc rthru
+	sort -k1,1 -k2,2 "$tmp/table" | awk '{
+		printf "%-6s %-40s %5d %4d %4d %4d %4d %4d %7s %6s\n",
+			$1, $2, $3, $4, $5, $6, $7, $8, $9, $10
+	}'
+} > "$tmp/report"
+
+if [ -n "$report" ]; then
+	cp "$tmp/report" "$report"
+	echo "vec_dummy_report: $(wc -l < "$tmp/table") functions," \
+	     "report in $report"
+else
+	cat "$tmp/report"
+fi
+
+if [ -z "$baseline" ]; then
+	exit 0
+fi
+
+if [ $update = 1 ]; then
+	{
+		echo "# Instruction counts of the libvecdummy wrappers:"
+		echo "# LABEL function insns. Regenerate with make dummy-baseline."
+		sort -k1,1 -k2,2 "$tmp/table" | awk '{ print $1, $2, $3 }'
+	} > "$baseline"
+	echo "vec_dummy_report: baseline written to $baseline"
+	exit 0
+fi
+
+# A missing or empty baseline would pass every check, so report the
+# check as skipped until one is generated on the target.
+if [ ! -f "$baseline" ] || ! grep -q -v '^#' "$baseline"; then
+	echo "vec_dummy_report: WARNING: baseline $baseline is missing or" \
+	     "empty, skipping the check; run make dummy-baseline and commit it" >&2
+	exit 77
+fi
+
+awk -v pct="$threshold" '
+	FNR == NR {
+		if ($0 !~ /^#/ && NF >= 3)
+			base[$1 " " $2] = $3
+		next
+	}
+	{
+		key = $1 " " $2
+		if (!(key in base)) {
+			new++
+			next
+		}
+		if ($3 > base[key] * (100 + pct) / 100) {
+			printf "REGRESSION %s %s: %d instructions, baseline %d\n",
+				$1, $2, $3, base[key]
+			fail++
+		}
+	}
+	END {
+		if (new)
+			printf "vec_dummy_report: %d functions not in baseline\n", new
+		if (fail) {
+			printf "vec_dummy_report: %d instruction count regressions" \
+				" (threshold %s%%)\n", fail, pct
+			exit 1
+		}
+	}
+' "$baseline" "$tmp/table"
@@ -58,6 +58,54 @@ test_vec_xvxsigsp (vf32_t f32)
   return vec_xvxsigsp (f32);
 }
 
+vf32_t
+test_vec_xvcvhpsp (vui32_t f16)
+{
+  return vec_xvcvhpsp (f16);
+}
+
+vui32_t
+test_vec_xvcvsphp (vf32_t f32)
+{
+  return vec_xvcvsphp (f32);
+}
+
+vf32_t
+test_vec_xvcvbf16spn (vui32_t bf16)
+{
+  return vec_xvcvbf16spn (bf16);
+}
+
+vui32_t
+test_vec_xvcvspbf16 (vf32_t f32)
+{
+  return vec_xvcvspbf16 (f32);
+}
+
+vf32_t
+test_vec_unpackh_f16 (vui16_t f16)
+{
+  return vec_unpackh_f16 (f16);
+}
+
+vui16_t
+test_vec_pack_f16 (vf32_t a, vf32_t b)
+{
+  return vec_pack_f16 (a, b);
+}
+
+vf32_t
+test_vec_unpackl_bf16 (vui16_t bf16)
+{
+  return vec_unpackl_bf16 (bf16);
+}
+
+vui16_t
+test_vec_pack_bf16 (vf32_t a, vf32_t b)
+{
+  return vec_pack_bf16 (a, b);
+}
+
 vb32_t
 __test_setb_sp (vf32_t f)
 {
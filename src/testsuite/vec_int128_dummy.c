@@ -931,6 +931,38 @@ test_cmul100ecuq (vui128_t *cout, vui128_t a, vui128_t cin)
   return vec_cmul100ecuq (cout, a, cin);
 }
 
+vui128_t
+test_vec_mul10k_uq (vui128_t a, unsigned int k)
+{
+  return vec_mul10k_uq (a, k);
+}
+
+vui128_t
+test_vec_cmul10k_cuq (vui128_t *cout, vui128_t a, unsigned int k)
+{
+  return vec_cmul10k_cuq (cout, a, k);
+}
+
+vui128_t
+test_vec_div10k_uq (vui128_t a, unsigned int k)
+{
+  return vec_div10k_uq (a, k);
+}
+
+vui128_t
+test_vec_divmod10k_uq (vui128_t *r, vui128_t a, unsigned int k)
+{
+  vui128_t q = vec_div10k_uq (a, k);
+  *r = vec_mod10k_uq (a, q, k);
+  return q;
+}
+
+vui128_t
+test_vec_div10k_rnd_uq (vui128_t a, unsigned int k)
+{
+  return vec_div10k_rnd_uq (a, k, VEC_ROUND_HALF_EVEN);
+}
+
 vui128_t
 test_vec_mul10uq_c (vui128_t *p, vui128_t a)
 {
@@ -0,0 +1,361 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_counters.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include <testsuite/vec_perf_counters.h>
+
+/* Sysfs directory of the core PMU.  */
+#define VEC_PERF_PMU_DIR "/sys/bus/event_source/devices/cpu"
+
+typedef struct
+{
+  char name[64];
+  int fd;
+} vec_perf_counter_t;
+
+static vec_perf_counter_t perf_counters[VEC_PERF_MAX_COUNTERS];
+static int perf_ncounters = 0;
+
+int
+vec_perf_counters_count (void)
+{
+  return perf_ncounters;
+}
+
+const char *
+vec_perf_counter_name (int i)
+{
+  return perf_counters[i].name;
+}
+
+int
+vec_perf_counter_find (const char *name)
+{
+  int i;
+
+  for (i = 0; i < perf_ncounters; i++)
+    if (strcmp (perf_counters[i].name, name) == 0)
+      return i;
+  return -1;
+}
+
+#ifdef __linux__
+/* Generic events with a fixed perf type/config.  */
+static const struct
+{
+  const char *name;
+  uint32_t type;
+  uint64_t config;
+} perf_generic_events[] =
+{
+  { "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+  { "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+  { "branches", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+  { "branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+  { "cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES },
+  { "cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+  { "stalled-cycles-frontend", PERF_TYPE_HARDWARE,
+    PERF_COUNT_HW_STALLED_CYCLES_FRONTEND },
+  { "stalled-cycles-backend", PERF_TYPE_HARDWARE,
+    PERF_COUNT_HW_STALLED_CYCLES_BACKEND },
+  { "L1-dcache-loads", PERF_TYPE_HW_CACHE,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+    | (PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16) },
+  { "L1-dcache-load-misses", PERF_TYPE_HW_CACHE,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+  { "LLC-loads", PERF_TYPE_HW_CACHE,
+    PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+    | (PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16) },
+  { "LLC-load-misses", PERF_TYPE_HW_CACHE,
+    PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+  { NULL, 0, 0 }
+};
+
+static int
+vec_perf_read_line (const char *path, char *buf, size_t len)
+{
+  FILE *f;
+  char *nl;
+
+  f = fopen (path, "r");
+  if (f == NULL)
+    return -1;
+  if (fgets (buf, len, f) == NULL)
+    {
+      fclose (f);
+      return -1;
+    }
+  fclose (f);
+  nl = strchr (buf, '\n');
+  if (nl)
+    *nl = '\0';
+  return 0;
+}
+
+/* Place VAL into attr per the sysfs format of TERM, for example
+   format/event contains "config:0-49".  */
+static int
+vec_perf_apply_term (struct perf_event_attr *attr, const char *term,
+		     uint64_t val)
+{
+  char path[256], fmt[128];
+  __u64 *field;
+  unsigned lo, hi;
+  int n;
+
+  snprintf (path, sizeof (path), VEC_PERF_PMU_DIR "/format/%s", term);
+  if (vec_perf_read_line (path, fmt, sizeof (fmt)) != 0)
+    return -1;
+
+  if (strncmp (fmt, "config1:", 8) == 0)
+    field = &attr->config1;
+  else if (strncmp (fmt, "config2:", 8) == 0)
+    field = &attr->config2;
+  else if (strncmp (fmt, "config:", 7) == 0)
+    field = &attr->config;
+  else
+    return -1;
+
+  n = sscanf (strchr (fmt, ':') + 1, "%u-%u", &lo, &hi);
+  if (n < 1 || lo > 63)
+    return -1;
+  if (n == 1)
+    hi = lo;
+  if (hi > 63)
+    hi = 63;
+  if (hi - lo < 63)
+    val &= (((uint64_t) 1 << (hi - lo + 1)) - 1);
+  *field |= val << lo;
+  return 0;
+}
+
+/* Look up NAME in the PMU events directory. The file contains
+   terms like "event=0x4e010" or "event=0x3c,umask=0x1".  */
+static int
+vec_perf_sysfs_event (struct perf_event_attr *attr, const char *name)
+{
+  char path[256], spec[256], type[32];
+  char *term, *save;
+
+  snprintf (path, sizeof (path), VEC_PERF_PMU_DIR "/events/%s", name);
+  if (vec_perf_read_line (path, spec, sizeof (spec)) != 0)
+    return -1;
+
+  snprintf (path, sizeof (path), VEC_PERF_PMU_DIR "/type");
+  if (vec_perf_read_line (path, type, sizeof (type)) == 0)
+    attr->type = strtoul (type, NULL, 0);
+  else
+    attr->type = PERF_TYPE_RAW;
+
+  for (term = strtok_r (spec, ",", &save); term != NULL;
+       term = strtok_r (NULL, ",", &save))
+    {
+      char *eq = strchr (term, '=');
+      uint64_t val = 1;
+
+      if (eq)
+	{
+	  *eq = '\0';
+	  val = strtoull (eq + 1, NULL, 0);
+	}
+      if (vec_perf_apply_term (attr, term, val) != 0)
+	return -1;
+    }
+  return 0;
+}
+
+static int
+vec_perf_event_attr (struct perf_event_attr *attr, const char *name)
+{
+  int i;
+
+  memset (attr, 0, sizeof (*attr));
+  attr->size = sizeof (*attr);
+
+  for (i = 0; perf_generic_events[i].name != NULL; i++)
+    if (strcmp (name, perf_generic_events[i].name) == 0)
+      {
+	attr->type = perf_generic_events[i].type;
+	attr->config = perf_generic_events[i].config;
+	return 0;
+      }
+
+  if (name[0] == 'r' && name[1] != '\0'
+      && strspn (name + 1, "0123456789abcdefABCDEF") == strlen (name + 1))
+    {
+      attr->type = PERF_TYPE_RAW;
+      attr->config = strtoull (name + 1, NULL, 16);
+      return 0;
+    }
+
+  return vec_perf_sysfs_event (attr, name);
+}
+
+static int
+vec_perf_open_one (const char *name)
+{
+  struct perf_event_attr attr;
+  int fd;
+
+  if (vec_perf_event_attr (&attr, name) != 0)
+    {
+      fprintf (stderr, "perf counter %s: unknown event, ignored\n", name);
+      return -1;
+    }
+  attr.disabled = 1;
+  /* User space only, so perf_event_paranoid=2 is sufficient.  */
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+      | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  fd = syscall (__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  if (fd < 0)
+    fprintf (stderr, "perf counter %s: %s, ignored\n", name,
+	     strerror (errno));
+  return fd;
+}
+
+int
+vec_perf_counters_open (const char *events)
+{
+  char list[512];
+  char *name, *save;
+
+  if (events == NULL)
+    return 0;
+  if (strcmp (events, "default") == 0)
+    events = "cycles,instructions,branch-misses,cache-misses";
+  snprintf (list, sizeof (list), "%s", events);
+
+  for (name = strtok_r (list, ",", &save); name != NULL;
+       name = strtok_r (NULL, ",", &save))
+    {
+      int fd;
+
+      if (perf_ncounters >= VEC_PERF_MAX_COUNTERS)
+	{
+	  fprintf (stderr, "perf counter %s: more than %d counters,"
+		   " ignored\n", name, VEC_PERF_MAX_COUNTERS);
+	  continue;
+	}
+      fd = vec_perf_open_one (name);
+      if (fd < 0)
+	continue;
+      perf_counters[perf_ncounters].fd = fd;
+      snprintf (perf_counters[perf_ncounters].name,
+		sizeof (perf_counters[0].name), "%s", name);
+      perf_ncounters++;
+    }
+
+  if (perf_ncounters == 0)
+    fprintf (stderr, "perf counters unavailable, timing only\n");
+  return perf_ncounters;
+}
+
+void
+vec_perf_counters_close (void)
+{
+  int i;
+
+  for (i = 0; i < perf_ncounters; i++)
+    close (perf_counters[i].fd);
+  perf_ncounters = 0;
+}
+
+void
+vec_perf_counters_start (void)
+{
+  int i;
+
+  for (i = 0; i < perf_ncounters; i++)
+    {
+      ioctl (perf_counters[i].fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl (perf_counters[i].fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void
+vec_perf_counters_stop (double *vals)
+{
+  int i;
+
+  for (i = 0; i < perf_ncounters; i++)
+    ioctl (perf_counters[i].fd, PERF_EVENT_IOC_DISABLE, 0);
+
+  for (i = 0; i < perf_ncounters; i++)
+    {
+      /* value, time_enabled, time_running.  */
+      uint64_t buf[3];
+
+      if (read (perf_counters[i].fd, buf, sizeof (buf)) != sizeof (buf)
+	  || buf[2] == 0)
+	vals[i] = -1.0;
+      else if (buf[2] < buf[1])
+	vals[i] = (double) buf[0] * ((double) buf[1] / (double) buf[2]);
+      else
+	vals[i] = (double) buf[0];
+    }
+}
+#else
+/* No perf_event_open, run with timing only.  */
+int
+vec_perf_counters_open (const char *events)
+{
+  if (events != NULL)
+    fprintf (stderr, "perf counters not supported, timing only\n");
+  return 0;
+}
+
+void
+vec_perf_counters_close (void)
+{
+}
+
+void
+vec_perf_counters_start (void)
+{
+}
+
+void
+vec_perf_counters_stop (double *vals)
+{
+  (void) vals;
+}
+#endif
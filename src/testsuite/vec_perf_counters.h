@@ -0,0 +1,79 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_counters.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_COUNTERS_H_
+#define SRC_TESTSUITE_VEC_PERF_COUNTERS_H_
+
+#include <stdint.h>
+
+/* Optional hardware performance counters (Linux perf_event_open) for
+   the perf harness. Events are given as a comma separated list of:
+   - generic names: cycles, instructions, branches, branch-misses,
+     cache-references, cache-misses, stalled-cycles-frontend,
+     stalled-cycles-backend, L1-dcache-loads, L1-dcache-load-misses,
+     LLC-loads, LLC-load-misses,
+   - raw event codes rHEX (for example r4e010),
+   - PMU event names from /sys/bus/event_source/devices/cpu/events
+     (for example PM_RUN_INST_CMPL or PM_VSU_FIN on POWER).
+   "default" selects cycles,instructions,branch-misses,cache-misses.
+
+   Events that can not be opened (no PMU access in containers,
+   perf_event_paranoid, unknown names) are reported once and dropped.
+   If none can be opened the harness runs with timing only.  */
+
+/*! \brief Upper bound on simultaneously open counters.  */
+#define VEC_PERF_MAX_COUNTERS 8
+
+/*! \brief Open the counters in the comma separated events list.
+ *  Returns the number of counters opened (possibly 0).  */
+extern int
+vec_perf_counters_open (const char *events);
+
+/*! \brief Close all open counters.  */
+extern void
+vec_perf_counters_close (void);
+
+/*! \brief Number of open counters.  */
+extern int
+vec_perf_counters_count (void);
+
+/*! \brief Name of counter i, as given in the events list.  */
+extern const char *
+vec_perf_counter_name (int i);
+
+/*! \brief Reset and enable all open counters.  */
+extern void
+vec_perf_counters_start (void);
+
+/*! \brief Disable all open counters and store their values in
+ *  vals[0 .. vec_perf_counters_count () - 1]. Values are scaled if
+ *  the kernel multiplexed the counters and set to -1.0 if a counter
+ *  was never scheduled.  */
+extern void
+vec_perf_counters_stop (double *vals);
+
+/*! \brief Return the index of the open counter for the generic event
+ *  NAME, or -1 if it is not open.  */
+extern int
+vec_perf_counter_find (const char *name);
+
+#endif /* SRC_TESTSUITE_VEC_PERF_COUNTERS_H_ */
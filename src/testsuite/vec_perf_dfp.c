@@ -0,0 +1,379 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_dfp.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/* The vec_dfp128_ conversions against the C casts, which call the
+   libgcc (__dpd_*) soft conversions, the shortest double and
+   float formatting against snprintf, and the decimal batch sum, dot
+   product and scale against the DFP loops.  */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <pveclib/vec_bcd_ppc.h>
+
+#include <testsuite/vec_perf_dfp.h>
+
+#ifndef PVECLIB_DISABLE_DFP
+#define N 64
+
+static vi128_t dfp_sq[N];
+static double dfp_f64[N];
+static __binary128 dfp_f128[N];
+static _Decimal128 dfp_d128[N];
+static _Decimal128 dfp_r128[N];
+static double dfp_rf64[N];
+static __binary128 dfp_rf128[N];
+static vi128_t dfp_rsq[N];
+static float dfp_f32[N];
+static char dfp_str[N * 32];
+static _Decimal128 dfp_c128[N];
+static _Decimal64 dfp_c64[N];
+static _Decimal64 dfp_r64[N];
+
+int
+timed_setup_dfp_conv (void)
+{
+  __VEC_U_128 t;
+  double d = 1.0;
+  int i;
+
+  // Mixed magnitudes, including values that need the exact path.
+  for (i = 0; i < N; i++)
+    {
+      t.ulong.upper = (i * 0x9e3779b97f4a7c15UL) >> (i % 64);
+      t.ulong.lower = i * 0xbf58476d1ce4e5b9UL;
+      dfp_sq[i] = (vi128_t) t.vx1;
+      d = d * -3.7e9 + (double) i;
+      if (i % 8 == 7)
+	d = 1.0 / d;
+      dfp_f64[i] = d;
+      dfp_f32[i] = (float) d;
+      dfp_d128[i] = __VEC_PWR_IMP (vec_dfp128_cff64) (d);
+      dfp_f128[i] = __VEC_PWR_IMP (vec_dfp128_ctf128) (dfp_d128[i]);
+    }
+  return 0;
+}
+
+int
+timed_dfp128_cfsq (void)
+{
+  __VEC_PWR_IMP (vec_dfp128_cfsq_array) (dfp_r128, dfp_sq, N);
+  return 0;
+}
+
+int
+timed_dfp128_cfsq_libgcc (void)
+{
+  __VEC_U_128 t;
+  int i;
+
+  for (i = 0; i < N; i++)
+    {
+      t.vx1 = (vui128_t) dfp_sq[i];
+      dfp_r128[i] = (_Decimal128) t.i128;
+    }
+  return 0;
+}
+
+int
+timed_dfp128_ctsqz (void)
+{
+  __VEC_PWR_IMP (vec_dfp128_ctsqz_array) (dfp_rsq, dfp_d128, N);
+  return 0;
+}
+
+int
+timed_dfp128_ctsqz_libgcc (void)
+{
+  __VEC_U_128 t;
+  int i;
+
+  for (i = 0; i < N; i++)
+    {
+      t.i128 = (__int128) dfp_d128[i];
+      dfp_rsq[i] = (vi128_t) t.vx1;
+    }
+  return 0;
+}
+
+int
+timed_dfp128_cff64 (void)
+{
+  __VEC_PWR_IMP (vec_dfp128_cff64_array) (dfp_r128, dfp_f64, N);
+  return 0;
+}
+
+int
+timed_dfp128_cff64_libgcc (void)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    dfp_r128[i] = (_Decimal128) dfp_f64[i];
+  return 0;
+}
+
+int
+timed_dfp128_ctf64 (void)
+{
+  __VEC_PWR_IMP (vec_dfp128_ctf64_array) (dfp_rf64, dfp_d128, N);
+  return 0;
+}
+
+int
+timed_dfp128_ctf64_libgcc (void)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    dfp_rf64[i] = (double) dfp_d128[i];
+  return 0;
+}
+
+int
+timed_dfp128_cff128 (void)
+{
+  __VEC_PWR_IMP (vec_dfp128_cff128_array) (dfp_r128, dfp_f128, N);
+  return 0;
+}
+
+int
+timed_dfp128_cff128_libgcc (void)
+{
+#ifdef __FLOAT128__
+  int i;
+
+  for (i = 0; i < N; i++)
+    dfp_r128[i] = (_Decimal128) dfp_f128[i];
+#endif
+  return 0;
+}
+
+int
+timed_dfp128_ctf128 (void)
+{
+  __VEC_PWR_IMP (vec_dfp128_ctf128_array) (dfp_rf128, dfp_d128, N);
+  return 0;
+}
+
+int
+timed_dfp128_ctf128_libgcc (void)
+{
+#ifdef __FLOAT128__
+  int i;
+
+  for (i = 0; i < N; i++)
+    dfp_rf128[i] = (__binary128) dfp_d128[i];
+#endif
+  return 0;
+}
+
+int
+timed_f64_ctstr (void)
+{
+  __VEC_PWR_IMP (vec_f64_ctstr_array) (dfp_str, dfp_f64, N, ',');
+  return 0;
+}
+
+int
+timed_f64_ctstr_printf (void)
+{
+  char *p = dfp_str;
+  int i;
+
+  // "%.17g" always round trips, but is not the shortest.
+  for (i = 0; i < N; i++)
+    p += snprintf (p, 32, "%.17g,", dfp_f64[i]);
+  return 0;
+}
+
+int
+timed_f32_ctstr (void)
+{
+  __VEC_PWR_IMP (vec_f32_ctstr_array) (dfp_str, dfp_f32, N, ',');
+  return 0;
+}
+
+int
+timed_f32_ctstr_printf (void)
+{
+  char *p = dfp_str;
+  int i;
+
+  for (i = 0; i < N; i++)
+    p += snprintf (p, 32, "%.9g,", dfp_f32[i]);
+  return 0;
+}
+
+int
+timed_setup_dfp_batch (void)
+{
+  long v = 1;
+  int i;
+
+  // A column of prices, 2 fraction digits and mixed signs.
+  for (i = 0; i < N; i++)
+    {
+      v = (v * 7919 + 12345) % 10000000;
+      dfp_c64[i] = (_Decimal64) ((i % 3 == 2) ? -v : v) * 0.01DD;
+      dfp_c128[i] = dfp_c64[i];
+    }
+  return 0;
+}
+
+int
+timed_dfp128_sum (void)
+{
+  dfp_r128[0] = __VEC_PWR_IMP (vec_dfp128_sum_array) (dfp_c128, N);
+  return 0;
+}
+
+int
+timed_dfp128_sum_dfp (void)
+{
+  _Decimal128 r = 0DL;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += dfp_c128[i];
+  dfp_r128[0] = r;
+  return 0;
+}
+
+int
+timed_dfp128_dot (void)
+{
+  dfp_r128[0] = __VEC_PWR_IMP (vec_dfp128_dot_array) (dfp_c128, dfp_c128,
+						       N);
+  return 0;
+}
+
+int
+timed_dfp128_dot_dfp (void)
+{
+  _Decimal128 r = 0DL;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += dfp_c128[i] * dfp_c128[i];
+  dfp_r128[0] = r;
+  return 0;
+}
+
+int
+timed_dfp128_scale (void)
+{
+  __VEC_PWR_IMP (vec_dfp128_scale_array) (dfp_r128, dfp_c128, 1.0825DL, N);
+  return 0;
+}
+
+int
+timed_dfp128_scale_dfp (void)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    dfp_r128[i] = dfp_c128[i] * 1.0825DL;
+  return 0;
+}
+
+int
+timed_dfp64_sum (void)
+{
+  dfp_r128[0] = __VEC_PWR_IMP (vec_dfp64_sum_array) (dfp_c64, N);
+  return 0;
+}
+
+int
+timed_dfp64_sum_dfp (void)
+{
+  _Decimal128 r = 0DL;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += dfp_c64[i];
+  dfp_r128[0] = r;
+  return 0;
+}
+
+int
+timed_dfp64_scale (void)
+{
+  __VEC_PWR_IMP (vec_dfp64_scale_array) (dfp_r64, dfp_c64, 1.0825DD, N);
+  return 0;
+}
+
+int
+timed_dfp64_scale_dfp (void)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    dfp_r64[i] = dfp_c64[i] * 1.0825DD;
+  return 0;
+}
+
+/* Operations per call: each kernel converts N elements. The libgcc
+   kernels are the C casts of the same data. The __binary128 casts
+   need __FLOAT128__, otherwise these kernels are empty. The _printf
+   kernels format the same values as the vec_f64_ctstr_array() and
+   vec_f32_ctstr_array() kernels with "%.17g" and "%.9g". The batch
+   kernels sum, multiply or scale N elements, the _dfp kernels are
+   the C loops of DFP adds and multiplies.  */
+const vec_perf_kernel_t vec_perf_dfp_kernels[] =
+{
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_cfsq, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_cfsq_libgcc, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_ctsqz, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_ctsqz_libgcc, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_cff64, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_cff64_libgcc, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_ctf64, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_ctf64_libgcc, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_cff128, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_cff128_libgcc, N,
+			 timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_ctf128, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_ctf128_libgcc, N,
+			 timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, f64_ctstr, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, f64_ctstr_printf, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, f32_ctstr, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, f32_ctstr_printf, N, timed_setup_dfp_conv),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_sum, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_sum_dfp, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_dot, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_dot_dfp, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_scale, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp128_scale_dfp, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp64_sum, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp64_sum_dfp, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp64_scale, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_SETUP (dfp, dfp64_scale_dfp, N, timed_setup_dfp_batch),
+  VEC_PERF_KERNEL_END
+};
+#else
+const vec_perf_kernel_t vec_perf_dfp_kernels[] =
+{
+  VEC_PERF_KERNEL_END
+};
+#endif /* PVECLIB_DISABLE_DFP */
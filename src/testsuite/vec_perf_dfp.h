@@ -0,0 +1,59 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_dfp.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_DFP_H_
+#define SRC_TESTSUITE_VEC_PERF_DFP_H_
+
+#include <testsuite/vec_perf_harness.h>
+
+extern int timed_setup_dfp_conv (void);
+extern int timed_dfp128_cfsq (void);
+extern int timed_dfp128_cfsq_libgcc (void);
+extern int timed_dfp128_ctsqz (void);
+extern int timed_dfp128_ctsqz_libgcc (void);
+extern int timed_dfp128_cff64 (void);
+extern int timed_dfp128_cff64_libgcc (void);
+extern int timed_dfp128_ctf64 (void);
+extern int timed_dfp128_ctf64_libgcc (void);
+extern int timed_dfp128_cff128 (void);
+extern int timed_dfp128_cff128_libgcc (void);
+extern int timed_dfp128_ctf128 (void);
+extern int timed_dfp128_ctf128_libgcc (void);
+extern int timed_f64_ctstr (void);
+extern int timed_f64_ctstr_printf (void);
+extern int timed_f32_ctstr (void);
+extern int timed_f32_ctstr_printf (void);
+extern int timed_setup_dfp_batch (void);
+extern int timed_dfp128_sum (void);
+extern int timed_dfp128_sum_dfp (void);
+extern int timed_dfp128_dot (void);
+extern int timed_dfp128_dot_dfp (void);
+extern int timed_dfp128_scale (void);
+extern int timed_dfp128_scale_dfp (void);
+extern int timed_dfp64_sum (void);
+extern int timed_dfp64_sum_dfp (void);
+extern int timed_dfp64_scale (void);
+extern int timed_dfp64_scale_dfp (void);
+
+extern const vec_perf_kernel_t vec_perf_dfp_kernels[];
+
+#endif /* SRC_TESTSUITE_VEC_PERF_DFP_H_ */
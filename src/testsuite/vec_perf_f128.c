@@ -882,5 +882,286 @@ int timed_expxsuba_v2_f128 (void)
 }
 #endif
 
+#define F128_N 256
+static __binary128 f128_a[F128_N], f128_r[F128_N];
+static double f64_a[F128_N], f64_r[F128_N];
+static float f32_r[F128_N];
+static long long i64_r[F128_N];
+static vi128_t i128_a[F128_N];
+/* IBM long double pairs (high, low), accessed as __IBM128.  */
+static double ibm_a[2 * F128_N], ibm_r[2 * F128_N];
+
+int
+timed_setup_f128_array (void)
+{
+  int i;
+
+  for (i = 0; i < F128_N; i++)
+    f64_a[i] = (double) ((i * 37) % 101 - 50) * 1.0e15 / (double) (i + 3);
+  for (i = 0; i < F128_N; i++)
+    {
+      ibm_a[2 * i] = f64_a[i];
+      ibm_a[2 * i + 1] = f64_a[(i + 1) % F128_N] * 0x1.0p-60;
+    }
+  __VEC_PWR_IMP (vec_f128_cff64_array) (f128_a, f64_a, F128_N);
+  __VEC_PWR_IMP (vec_f128_ctsqz_array) (i128_a, f128_a, F128_N);
+  __VEC_PWR_IMP (vec_f128_cfibm_array) (f128_r, (__IBM128 *) ibm_a, F128_N);
+  return 0;
+}
+
+int
+timed_cff64_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_cff64_array) (f128_r, f64_a, F128_N);
+  return 0;
+}
+
+int
+timed_ctf64_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_ctf64_array) (f64_r, f128_a, VEC_ROUND_HALF_EVEN,
+					F128_N);
+  return 0;
+}
+
+int
+timed_ctf32_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_ctf32_array) (f32_r, f128_a, VEC_ROUND_HALF_EVEN,
+					F128_N);
+  return 0;
+}
+
+int
+timed_ctsdz_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_ctsdz_array) (i64_r, f128_a, F128_N);
+  return 0;
+}
+
+int
+timed_cfsq_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_cfsq_array) (f128_r, i128_a, F128_N);
+  return 0;
+}
+
+int
+timed_ctsqz_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_ctsqz_array) (i128_a, f128_a, F128_N);
+  return 0;
+}
+
+int
+timed_cfibm_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_cfibm_array) (f128_r, (__IBM128 *) ibm_a, F128_N);
+  return 0;
+}
+
+int
+timed_ctibm_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_ctibm_array) ((__IBM128 *) ibm_r, f128_r, F128_N);
+  return 0;
+}
+
+/* The linear algebra kernels treat f128_a (f64_a) as a F128_LA_M by
+   F128_LA_M row-major matrix, and its first row as a vector. The gcc
+   kernels are the plain C loops with __float128 arithmetic (libgcc
+   calls for POWER8, serial xsmaddqp for POWER9). beta is zero, so
+   repeated calls do not overflow f128_r.  */
+#define F128_LA_M 16
+
+int
+timed_dot_array_f128 (void)
+{
+  f128_r[0] = __VEC_PWR_IMP (vec_f128_dot_array) (f128_a, f128_a, F128_N);
+  return 0;
+}
+
+int
+timed_dotf64_array_f128 (void)
+{
+  f128_r[0] = __VEC_PWR_IMP (vec_f128_dotf64_array) (f64_a, f64_a, F128_N);
+  return 0;
+}
+
+int
+timed_gcc_dot_f128 (void)
+{
+  __binary128 s = 0;
+  int i;
+
+  for (i = 0; i < F128_N; i++)
+    s += f128_a[i] * f128_a[i];
+  f128_r[0] = s;
+  return 0;
+}
+
+int
+timed_gemv_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_gemv) (F128_LA_M, F128_LA_M, f128_a[1], f128_a,
+				 F128_LA_M, f128_a, 0, f128_r);
+  return 0;
+}
+
+int
+timed_gemvf64_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_gemvf64) (F128_LA_M, F128_LA_M, f128_a[1], f64_a,
+				    F128_LA_M, f64_a, 0, f128_r);
+  return 0;
+}
+
+int
+timed_gemm_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_gemm) (F128_LA_M, F128_LA_M, F128_LA_M, f128_a[1],
+				 f128_a, F128_LA_M, f128_a, F128_LA_M,
+				 0, f128_r, F128_LA_M);
+  return 0;
+}
+
+int
+timed_gemmf64_f128 (void)
+{
+  __VEC_PWR_IMP (vec_f128_gemmf64) (F128_LA_M, F128_LA_M, F128_LA_M,
+				    f128_a[1], f64_a, F128_LA_M, f64_a,
+				    F128_LA_M, 0, f128_r, F128_LA_M);
+  return 0;
+}
+
+int
+timed_gcc_gemm_f128 (void)
+{
+  __binary128 s;
+  int i, j, p;
+
+  for (i = 0; i < F128_LA_M; i++)
+    for (j = 0; j < F128_LA_M; j++)
+      {
+	s = 0;
+	for (p = 0; p < F128_LA_M; p++)
+	  s += f128_a[i * F128_LA_M + p] * f128_a[p * F128_LA_M + j];
+	f128_r[i * F128_LA_M + j] = f128_a[1] * s;
+      }
+  return 0;
+}
+
+/* The degree 8 Taylor series of the timed_expxsuba kernels as a
+   coefficient array (1/n!), evaluated over F128_N arguments in
+   [-1, 1).  */
+static __binary128 poly_fact[9], poly_qx[F128_N];
+static double poly_dx[F128_N];
+
+int
+timed_setup_f128_poly (void)
+{
+  int i;
+
+  poly_fact[0] = f128_one;
+  poly_fact[1] = f128_one;
+  poly_fact[2] = inv_fact2;
+  poly_fact[3] = inv_fact3;
+  poly_fact[4] = inv_fact4;
+  poly_fact[5] = inv_fact5;
+  poly_fact[6] = inv_fact6;
+  poly_fact[7] = inv_fact7;
+  poly_fact[8] = inv_fact8;
+  for (i = 0; i < F128_N; i++)
+    {
+      poly_dx[i] = (double) (i - F128_N / 2) / (double) (F128_N / 2);
+      poly_qx[i] = poly_dx[i];
+    }
+  return 0;
+}
+
+int
+timed_polyf128_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_polyf128_array) (f128_r, poly_qx, poly_fact, 8, F128_N);
+  return 0;
+}
+
+int
+timed_polyf128f64_array_f128 (void)
+{
+  __VEC_PWR_IMP (vec_polyf128f64_array) (f64_r, poly_dx, poly_fact, 8,
+					 VEC_ROUND_HALF_EVEN, F128_N);
+  return 0;
+}
+
+/* Operations per call: each kernel applies the operation to 8
+   (10 for dpqp, 7 compares for max8) operands N times. The array
+   kernels convert F128_N elements. The dot and gemv kernels do F128_N
+   multiply-adds, gemm F128_LA_M * F128_N. The polynomial kernels
+   evaluate F128_N elements.  */
+const vec_perf_kernel_t vec_perf_f128_kernels[] =
+{
+  VEC_PERF_KERNEL (f128, gcc_max8_f128, 7 * N),
+  VEC_PERF_KERNEL (f128, lib_max8_f128, 7 * N),
+  VEC_PERF_KERNEL (f128, vec_max8_f128, 7 * N),
+  VEC_PERF_KERNEL (f128, vec_max8_f128uz, 7 * N),
+  VEC_PERF_KERNEL (f128, gcc_dpqp_f128, 10 * N),
+  VEC_PERF_KERNEL (f128, lib_dpqp_f128, 10 * N),
+  VEC_PERF_KERNEL (f128, vec_dpqp_f128, 10 * N),
+  VEC_PERF_KERNEL (f128, gcc_uqqp_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, lib_uqqp_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, vec_uqqp_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, gcc_qpuq_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, lib_qpuq_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, vec_qpuq_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, gcc_qpdpo_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, lib_qpdpo_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, vec_qpdpo_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, gcc_mulqpn_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, lib_mulqpo_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, lib_mulqpn_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, gcc_addqpn_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, lib_addqpo_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, gcc_subqpn_f128, 8 * N),
+  VEC_PERF_KERNEL (f128, lib_subqpo_f128, 8 * N),
+  VEC_PERF_KERNEL_SETUP (f128, cff64_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, ctf64_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, ctf32_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, ctsdz_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, cfsq_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, ctsqz_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, cfibm_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, ctibm_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, dot_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, dotf64_array_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, gcc_dot_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, gemv_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, gemvf64_f128, F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, gemm_f128, F128_LA_M * F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, gemmf64_f128, F128_LA_M * F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, gcc_gemm_f128, F128_LA_M * F128_N,
+			 timed_setup_f128_array),
+  VEC_PERF_KERNEL_SETUP (f128, polyf128_array_f128, F128_N,
+			 timed_setup_f128_poly),
+  VEC_PERF_KERNEL_SETUP (f128, polyf128f64_array_f128, F128_N,
+			 timed_setup_f128_poly),
+  VEC_PERF_KERNEL_END
+};
+
 #endif
 #endif
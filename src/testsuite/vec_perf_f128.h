@@ -22,6 +22,8 @@
 #ifndef SRC_TESTSUITE_VEC_PERF_F128_H_
 #define SRC_TESTSUITE_VEC_PERF_F128_H_
 
+#include <testsuite/vec_perf_harness.h>
+
 #if 0 // turn off until Round-to-odd implementation is ready
 extern int timed_expxsuba_v1_f128 (void);
 extern int timed_expxsuba_v2_f128 (void);
@@ -58,4 +60,29 @@ extern int timed_lib_addqpo_f128 (void);
 extern int timed_gcc_subqpn_f128 (void);
 extern int timed_lib_subqpo_f128 (void);
 
+extern int timed_setup_f128_array (void);
+extern int timed_cff64_array_f128 (void);
+extern int timed_ctf64_array_f128 (void);
+extern int timed_ctf32_array_f128 (void);
+extern int timed_ctsdz_array_f128 (void);
+extern int timed_cfsq_array_f128 (void);
+extern int timed_ctsqz_array_f128 (void);
+extern int timed_cfibm_array_f128 (void);
+extern int timed_ctibm_array_f128 (void);
+extern int timed_dot_array_f128 (void);
+extern int timed_dotf64_array_f128 (void);
+extern int timed_gcc_dot_f128 (void);
+extern int timed_gemv_f128 (void);
+extern int timed_gemvf64_f128 (void);
+extern int timed_gemm_f128 (void);
+extern int timed_gemmf64_f128 (void);
+extern int timed_gcc_gemm_f128 (void);
+extern int timed_setup_f128_poly (void);
+extern int timed_polyf128_array_f128 (void);
+extern int timed_polyf128f64_array_f128 (void);
+
+#ifndef PVECLIB_DISABLE_F128ARITH
+extern const vec_perf_kernel_t vec_perf_f128_kernels[];
+#endif
+
 #endif /* SRC_TESTSUITE_VEC_PERF_F128_H_ */
@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include <fenv.h>
 #include <float.h>
+#include <math.h>
 
 //#define __DEBUG_PRINT__
 #include <pveclib/vec_f32_ppc.h>
@@ -144,3 +145,235 @@ timed_gatherx4_f32_transpose ()
   return rc;
 }
 #endif
+
+#define F16_N 1024
+static unsigned short f16_a[F16_N], f16_b[F16_N];
+static float f32_b[F16_N], f32_r[F16_N], f32_t[F16_N];
+static float f32_dot;
+
+int
+timed_setup_f16 (void)
+{
+  int i;
+
+  for (i = 0; i < F16_N; i++)
+    {
+      f32_b[i] = (float) ((i * 37) % 101 - 50) * 0.125f;
+      f32_r[i] = (float) ((i * 53) % 97 - 48) * 0.0625f;
+    }
+  __VEC_PWR_IMP (vec_cvf32f16_array) (f16_a, f32_r, F16_N);
+  __VEC_PWR_IMP (vec_cvf32f16_array) (f16_b, f32_b, F16_N);
+  return 0;
+}
+
+int
+timed_cvf16f32 (void)
+{
+  __VEC_PWR_IMP (vec_cvf16f32_array) (f32_r, f16_a, F16_N);
+  return 0;
+}
+
+int
+timed_cvf32f16 (void)
+{
+  __VEC_PWR_IMP (vec_cvf32f16_array) (f16_a, f32_b, F16_N);
+  return 0;
+}
+
+int
+timed_dotf16 (void)
+{
+  f32_dot = __VEC_PWR_IMP (vec_dotf16_array) (f16_a, f16_b, F16_N);
+  return 0;
+}
+
+int
+timed_dotf16f32 (void)
+{
+  f32_dot = __VEC_PWR_IMP (vec_dotf16f32_array) (f16_a, f32_b, F16_N);
+  return 0;
+}
+
+/* The widened copy the fused dot product avoids: convert both
+   arrays to float in memory, then a scalar dot product.  */
+int
+timed_dotf16_widen (void)
+{
+  float r = 0.0f;
+  int i;
+
+  __VEC_PWR_IMP (vec_cvf16f32_array) (f32_r, f16_a, F16_N);
+  __VEC_PWR_IMP (vec_cvf16f32_array) (f32_t, f16_b, F16_N);
+  for (i = 0; i < F16_N; i++)
+    r += f32_r[i] * f32_t[i];
+  f32_dot = r;
+  return 0;
+}
+
+int
+timed_dotbf16f32 (void)
+{
+  f32_dot = __VEC_PWR_IMP (vec_dotbf16f32_array) (f16_a, f32_b, F16_N);
+  return 0;
+}
+
+/* The elementary function arrays against the scalar glibc loops.
+   glibc provides no vector math library (libmvec) for POWER, so the
+   scalar loop is the alternative. The *_glibc kernels compute the
+   same values with expf() and friends. math_a covers [-8, 8) for
+   the functions defined everywhere, math_b (0, 16] for logf and
+   powf.  */
+#define MATH_N 256
+static float math_a[MATH_N], math_b[MATH_N], math_r[MATH_N];
+
+int
+timed_setup_math_f32 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    {
+      math_a[i] = (float) (i - 128) * 0.0625f;
+      math_b[i] = (float) (i + 1) * 0.0625f;
+    }
+  return 0;
+}
+
+int
+timed_exp_array_f32 (void)
+{
+  __VEC_PWR_IMP (vec_expf32_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_exp_glibc_f32 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = expf (math_a[i]);
+  return 0;
+}
+
+int
+timed_log_array_f32 (void)
+{
+  __VEC_PWR_IMP (vec_logf32_array) (math_r, math_b, MATH_N);
+  return 0;
+}
+
+int
+timed_log_glibc_f32 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = logf (math_b[i]);
+  return 0;
+}
+
+int
+timed_pow_array_f32 (void)
+{
+  __VEC_PWR_IMP (vec_powf32_array) (math_r, math_b, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_pow_glibc_f32 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = powf (math_b[i], math_a[i]);
+  return 0;
+}
+
+int
+timed_sin_array_f32 (void)
+{
+  __VEC_PWR_IMP (vec_sinf32_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_sin_glibc_f32 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = sinf (math_a[i]);
+  return 0;
+}
+
+int
+timed_tanh_array_f32 (void)
+{
+  __VEC_PWR_IMP (vec_tanhf32_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_tanh_glibc_f32 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = tanhf (math_a[i]);
+  return 0;
+}
+
+int
+timed_erf_array_f32 (void)
+{
+  __VEC_PWR_IMP (vec_erff32_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_erf_glibc_f32 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = erff (math_a[i]);
+  return 0;
+}
+
+/* Operations per call: the predicate kernels apply 5 predicates N
+   times, the transpose kernels move MN x MN elements, the binary16
+   kernels convert or multiply F16_N elements, the math kernels
+   evaluate MATH_N elements.  */
+const vec_perf_kernel_t vec_perf_f32_kernels[] =
+{
+  VEC_PERF_KERNEL (f32, is_f32, 5 * N),
+  VEC_PERF_KERNEL (f32, fpclassify_f32, N),
+  VEC_PERF_KERNEL_SETUP (f32, scalar_f32_transpose, MN * MN,
+			 timed_setup_f32_transpose),
+  VEC_PERF_KERNEL_SETUP (f32, gather_f32_transpose, MN * MN,
+			 timed_setup_f32_transpose),
+  VEC_PERF_KERNEL_SETUP (f32, gatherx2_f32_transpose, MN * MN,
+			 timed_setup_f32_transpose),
+  VEC_PERF_KERNEL_SETUP (f32, gatherx4_f32_transpose, MN * MN,
+			 timed_setup_f32_transpose),
+  VEC_PERF_KERNEL_SETUP (f32, cvf16f32, F16_N, timed_setup_f16),
+  VEC_PERF_KERNEL_SETUP (f32, cvf32f16, F16_N, timed_setup_f16),
+  VEC_PERF_KERNEL_SETUP (f32, dotf16, F16_N, timed_setup_f16),
+  VEC_PERF_KERNEL_SETUP (f32, dotf16f32, F16_N, timed_setup_f16),
+  VEC_PERF_KERNEL_SETUP (f32, dotf16_widen, F16_N, timed_setup_f16),
+  VEC_PERF_KERNEL_SETUP (f32, dotbf16f32, F16_N, timed_setup_f16),
+  VEC_PERF_KERNEL_SETUP (f32, exp_array_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, exp_glibc_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, log_array_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, log_glibc_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, pow_array_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, pow_glibc_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, sin_array_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, sin_glibc_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, tanh_array_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, tanh_glibc_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, erf_array_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_SETUP (f32, erf_glibc_f32, MATH_N, timed_setup_math_f32),
+  VEC_PERF_KERNEL_END
+};
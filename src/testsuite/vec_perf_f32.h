@@ -23,6 +23,8 @@
 #ifndef TESTSUITE_VEC_PERF_F32_H_
 #define TESTSUITE_VEC_PERF_F32_H_
 
+#include <testsuite/vec_perf_harness.h>
+
 extern int timed_is_f32 (void);
 extern int timed_fpclassify_f32 (void);
 extern int timed_setup_f32_transpose ();
@@ -30,5 +32,27 @@ extern int timed_scalar_f32_transpose ();
 extern int timed_gather_f32_transpose ();
 extern int timed_gatherx2_f32_transpose ();
 extern int timed_gatherx4_f32_transpose ();
+extern int timed_setup_f16 (void);
+extern int timed_cvf16f32 (void);
+extern int timed_cvf32f16 (void);
+extern int timed_dotf16 (void);
+extern int timed_dotf16f32 (void);
+extern int timed_dotf16_widen (void);
+extern int timed_dotbf16f32 (void);
+extern int timed_setup_math_f32 (void);
+extern int timed_exp_array_f32 (void);
+extern int timed_exp_glibc_f32 (void);
+extern int timed_log_array_f32 (void);
+extern int timed_log_glibc_f32 (void);
+extern int timed_pow_array_f32 (void);
+extern int timed_pow_glibc_f32 (void);
+extern int timed_sin_array_f32 (void);
+extern int timed_sin_glibc_f32 (void);
+extern int timed_tanh_array_f32 (void);
+extern int timed_tanh_glibc_f32 (void);
+extern int timed_erf_array_f32 (void);
+extern int timed_erf_glibc_f32 (void);
+
+extern const vec_perf_kernel_t vec_perf_f32_kernels[];
 
 #endif /* TESTSUITE_VEC_PERF_F32_H_ */
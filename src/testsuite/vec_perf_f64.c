@@ -25,6 +25,7 @@
 #include <stdio.h>
 #include <fenv.h>
 #include <float.h>
+#include <math.h>
 
 //#define __DEBUG_PRINT__
 #include <pveclib/vec_f64_ppc.h>
@@ -141,3 +142,270 @@ timed_gatherx4_f64_transpose ()
 
   return rc;
 }
+
+/* The elementary function arrays against the scalar glibc loops.
+   glibc provides no vector math library (libmvec) for POWER, so the
+   scalar loop is the alternative. The *_glibc kernels compute the
+   same values with exp() and friends. math_a covers [-8, 8) for
+   the functions defined everywhere, math_b (0, 16] for log and
+   pow.  */
+#define MATH_N 256
+static double math_a[MATH_N], math_b[MATH_N], math_r[MATH_N];
+
+int
+timed_setup_math_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    {
+      math_a[i] = (double) (i - 128) * 0.0625;
+      math_b[i] = (double) (i + 1) * 0.0625;
+    }
+  return 0;
+}
+
+int
+timed_exp_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_expf64_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_exp_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = exp (math_a[i]);
+  return 0;
+}
+
+int
+timed_exp2_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_exp2f64_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_exp2_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = exp2 (math_a[i]);
+  return 0;
+}
+
+int
+timed_log_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_logf64_array) (math_r, math_b, MATH_N);
+  return 0;
+}
+
+int
+timed_log_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = log (math_b[i]);
+  return 0;
+}
+
+int
+timed_log2_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_log2f64_array) (math_r, math_b, MATH_N);
+  return 0;
+}
+
+int
+timed_log2_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = log2 (math_b[i]);
+  return 0;
+}
+
+int
+timed_pow_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_powf64_array) (math_r, math_b, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_pow_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = pow (math_b[i], math_a[i]);
+  return 0;
+}
+
+int
+timed_sin_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_sinf64_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_sin_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = sin (math_a[i]);
+  return 0;
+}
+
+int
+timed_cos_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_cosf64_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_cos_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = cos (math_a[i]);
+  return 0;
+}
+
+int
+timed_tanh_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_tanhf64_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_tanh_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = tanh (math_a[i]);
+  return 0;
+}
+
+int
+timed_erf_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_erff64_array) (math_r, math_a, MATH_N);
+  return 0;
+}
+
+int
+timed_erf_glibc_f64 (void)
+{
+  int i;
+
+  for (i = 0; i < MATH_N; i++)
+    math_r[i] = erf (math_a[i]);
+  return 0;
+}
+
+/* A degree 15 polynomial over math_a, against Horner's rule in a
+   plain C loop (which the compiler does not reorder).  */
+#define POLY_DEG 15
+static double poly_c[POLY_DEG + 1], poly_cd[2 * POLY_DEG + 2];
+static double poly_r[2 * MATH_N];
+
+int
+timed_setup_poly_f64 (void)
+{
+  int i;
+
+  timed_setup_math_f64 ();
+  for (i = 0; i <= POLY_DEG; i++)
+    {
+      poly_c[i] = 1.0 / (double) (i + 1);
+      poly_cd[2 * i] = poly_c[i];
+      poly_cd[2 * i + 1] = poly_c[i] * 0x1p-60;
+    }
+  return 0;
+}
+
+int
+timed_poly_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_polyf64_array) (math_r, math_a, poly_c, POLY_DEG,
+				     MATH_N);
+  return 0;
+}
+
+int
+timed_poly_horner_f64 (void)
+{
+  double r;
+  int i, j;
+
+  for (i = 0; i < MATH_N; i++)
+    {
+      r = poly_c[POLY_DEG];
+      for (j = POLY_DEG - 1; j >= 0; j--)
+	r = r * math_a[i] + poly_c[j];
+      math_r[i] = r;
+    }
+  return 0;
+}
+
+int
+timed_polydd_array_f64 (void)
+{
+  __VEC_PWR_IMP (vec_polyf64_dd_array) (poly_r, math_a, poly_cd, POLY_DEG,
+					MATH_N);
+  return 0;
+}
+
+/* Operations per call: the predicate kernels apply 10 predicates N
+   times, the transpose kernels move MN x MN elements, the math
+   and polynomial kernels evaluate MATH_N elements.  */
+const vec_perf_kernel_t vec_perf_f64_kernels[] =
+{
+  VEC_PERF_KERNEL (f64, is_f64, 10 * N),
+  VEC_PERF_KERNEL (f64, fpclassify_f64, N),
+  VEC_PERF_KERNEL_SETUP (f64, scalar_f64_transpose, MN * MN,
+			 timed_setup_f64_transpose),
+  VEC_PERF_KERNEL_SETUP (f64, gather_f64_transpose, MN * MN,
+			 timed_setup_f64_transpose),
+  VEC_PERF_KERNEL_SETUP (f64, gatherx2_f64_transpose, MN * MN,
+			 timed_setup_f64_transpose),
+  VEC_PERF_KERNEL_SETUP (f64, gatherx4_f64_transpose, MN * MN,
+			 timed_setup_f64_transpose),
+  VEC_PERF_KERNEL_SETUP (f64, exp_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, exp_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, exp2_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, exp2_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, log_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, log_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, log2_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, log2_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, pow_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, pow_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, sin_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, sin_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, cos_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, cos_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, tanh_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, tanh_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, erf_array_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, erf_glibc_f64, MATH_N, timed_setup_math_f64),
+  VEC_PERF_KERNEL_SETUP (f64, poly_array_f64, MATH_N, timed_setup_poly_f64),
+  VEC_PERF_KERNEL_SETUP (f64, poly_horner_f64, MATH_N, timed_setup_poly_f64),
+  VEC_PERF_KERNEL_SETUP (f64, polydd_array_f64, MATH_N, timed_setup_poly_f64),
+  VEC_PERF_KERNEL_END
+};
@@ -23,6 +23,8 @@
 #ifndef TESTSUITE_VEC_PERF_F64_H_
 #define TESTSUITE_VEC_PERF_F64_H_
 
+#include <testsuite/vec_perf_harness.h>
+
 extern int timed_is_f64 (void);
 extern int timed_fpclassify_f64 (void);
 extern int timed_setup_f64_transpose ();
@@ -30,5 +32,30 @@ extern int timed_scalar_f64_transpose ();
 extern int timed_gather_f64_transpose ();
 extern int timed_gatherx2_f64_transpose ();
 extern int timed_gatherx4_f64_transpose ();
+extern int timed_setup_math_f64 (void);
+extern int timed_exp_array_f64 (void);
+extern int timed_exp_glibc_f64 (void);
+extern int timed_exp2_array_f64 (void);
+extern int timed_exp2_glibc_f64 (void);
+extern int timed_log_array_f64 (void);
+extern int timed_log_glibc_f64 (void);
+extern int timed_log2_array_f64 (void);
+extern int timed_log2_glibc_f64 (void);
+extern int timed_pow_array_f64 (void);
+extern int timed_pow_glibc_f64 (void);
+extern int timed_sin_array_f64 (void);
+extern int timed_sin_glibc_f64 (void);
+extern int timed_cos_array_f64 (void);
+extern int timed_cos_glibc_f64 (void);
+extern int timed_tanh_array_f64 (void);
+extern int timed_tanh_glibc_f64 (void);
+extern int timed_erf_array_f64 (void);
+extern int timed_erf_glibc_f64 (void);
+extern int timed_setup_poly_f64 (void);
+extern int timed_poly_array_f64 (void);
+extern int timed_poly_horner_f64 (void);
+extern int timed_polydd_array_f64 (void);
+
+extern const vec_perf_kernel_t vec_perf_f64_kernels[];
 
 #endif /* TESTSUITE_VEC_PERF_F64_H_ */
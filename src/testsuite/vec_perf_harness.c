@@ -0,0 +1,633 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_harness.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fnmatch.h>
+#include <getopt.h>
+#include <sched.h>
+
+#include <testsuite/vec_perf_harness.h>
+
+/* Upper bound on registered kernels across all groups.  */
+#define VEC_PERF_MAX_KERNELS 512
+/* Upper bound on timed samples per kernel.  */
+#define VEC_PERF_MAX_REPS 1000
+
+/* Defaults. The original pveclib_perf ran each kernel
+   TIMING_ITERATIONS (10) times in a single sample.  */
+#define VEC_PERF_DEFAULT_WARMUP 2
+#define VEC_PERF_DEFAULT_REPS 21
+#define VEC_PERF_DEFAULT_ITERS 10
+/* Timebase frequency for POWER8 and later.  */
+#define VEC_PERF_DEFAULT_TB_FREQ 512.0e+06
+
+static const vec_perf_kernel_t *perf_registry[VEC_PERF_MAX_KERNELS];
+static int perf_registered = 0;
+
+int
+vec_perf_register (const vec_perf_kernel_t *table)
+{
+  int n = 0;
+
+  for (; table->func != NULL; table++)
+    {
+      if (perf_registered >= VEC_PERF_MAX_KERNELS)
+	{
+	  fprintf (stderr, "vec_perf_register: registry full at %s/%s\n",
+		   table->group, table->name);
+	  break;
+	}
+      perf_registry[perf_registered++] = table;
+      n++;
+    }
+  return n;
+}
+
+/* Probe "timebase" (Hz) and "clock" (MHz) from /proc/cpuinfo.
+   Either may be missing (for example in some containers) so leave
+   the defaults in place if the lines are not found.  */
+static void
+vec_perf_probe_cpuinfo (double *tb_freq, double *cpu_freq)
+{
+  char line[256];
+  FILE *f;
+
+  f = fopen ("/proc/cpuinfo", "r");
+  if (f == NULL)
+    return;
+
+  while (fgets (line, sizeof (line), f) != NULL)
+    {
+      double val;
+
+      if (strncmp (line, "timebase", 8) == 0)
+	{
+	  if (sscanf (strchr (line, ':') + 1, "%lf", &val) == 1 && val > 0.0)
+	    *tb_freq = val;
+	}
+      else if (strncmp (line, "clock", 5) == 0 && *cpu_freq == 0.0)
+	{
+	  if (sscanf (strchr (line, ':') + 1, "%lf", &val) == 1 && val > 0.0)
+	    *cpu_freq = val * 1.0e+06;
+	}
+    }
+  fclose (f);
+}
+
+void
+vec_perf_default_opts (vec_perf_opts_t *opts)
+{
+  memset (opts, 0, sizeof (*opts));
+  opts->filter = NULL;
+  opts->warmup = VEC_PERF_DEFAULT_WARMUP;
+  opts->repetitions = VEC_PERF_DEFAULT_REPS;
+  opts->iterations = VEC_PERF_DEFAULT_ITERS;
+  opts->cpu = -1;
+  opts->tb_freq = VEC_PERF_DEFAULT_TB_FREQ;
+  opts->cpu_freq = 0.0;
+  vec_perf_probe_cpuinfo (&opts->tb_freq, &opts->cpu_freq);
+}
+
+static void
+vec_perf_usage (const char *prog)
+{
+  fprintf (stderr,
+	   "Usage: %s [options]\n"
+	   "  -f, --filter=PATTERN  run kernels whose group/name match"
+	   " the fnmatch PATTERN\n"
+	   "  -l, --list            list registered kernels and exit\n"
+	   "  -V, --variants        time the per-CPU libpvec implementations\n"
+	   "                        side by side\n"
+	   "  -L, --latency         time the inline operations as one"
+	   " dependent chain\n"
+	   "                        (latency) and as independent chains"
+	   " (throughput)\n"
+	   "  -w, --warmup=N        untimed batches before sampling (%d)\n"
+	   "  -r, --reps=N          timed samples per kernel (%d)\n"
+	   "  -i, --iters=N         kernel calls per sample (%d)\n"
+	   "  -p, --pin=CPU         pin the process to CPU\n"
+	   "  -F, --freq=MHZ        processor clock for cycles/op\n"
+	   "  -e, --events=LIST     count perf events (comma separated,"
+	   " or \"default\")\n"
+	   "                        cycles, instructions, branch-misses,"
+	   " cache-misses,\n"
+	   "                        rHEX raw codes or PMU event names\n"
+	   "  -c, --csv=FILE        write results as CSV\n"
+	   "  -j, --json=FILE       write results as JSON\n",
+	   prog, VEC_PERF_DEFAULT_WARMUP, VEC_PERF_DEFAULT_REPS,
+	   VEC_PERF_DEFAULT_ITERS);
+}
+
+int
+vec_perf_parse_opts (vec_perf_opts_t *opts, int argc, char *argv[])
+{
+  static const struct option long_opts[] =
+    {
+      { "filter", required_argument, NULL, 'f' },
+      { "list", no_argument, NULL, 'l' },
+      { "variants", no_argument, NULL, 'V' },
+      { "latency", no_argument, NULL, 'L' },
+      { "warmup", required_argument, NULL, 'w' },
+      { "reps", required_argument, NULL, 'r' },
+      { "iters", required_argument, NULL, 'i' },
+      { "pin", required_argument, NULL, 'p' },
+      { "freq", required_argument, NULL, 'F' },
+      { "events", required_argument, NULL, 'e' },
+      { "csv", required_argument, NULL, 'c' },
+      { "json", required_argument, NULL, 'j' },
+      { "help", no_argument, NULL, 'h' },
+      { NULL, 0, NULL, 0 }
+    };
+  int c;
+
+  while ((c = getopt_long (argc, argv, "f:lVLw:r:i:p:F:e:c:j:h", long_opts,
+			   NULL)) != -1)
+    {
+      switch (c)
+	{
+	case 'f':
+	  opts->filter = optarg;
+	  break;
+	case 'l':
+	  opts->list_only = 1;
+	  break;
+	case 'V':
+	  opts->variants = 1;
+	  break;
+	case 'L':
+	  opts->latency = 1;
+	  break;
+	case 'w':
+	  opts->warmup = strtoul (optarg, NULL, 0);
+	  break;
+	case 'r':
+	  opts->repetitions = strtoul (optarg, NULL, 0);
+	  if (opts->repetitions == 0)
+	    opts->repetitions = 1;
+	  if (opts->repetitions > VEC_PERF_MAX_REPS)
+	    opts->repetitions = VEC_PERF_MAX_REPS;
+	  break;
+	case 'i':
+	  opts->iterations = strtoul (optarg, NULL, 0);
+	  if (opts->iterations == 0)
+	    opts->iterations = 1;
+	  break;
+	case 'p':
+	  opts->cpu = atoi (optarg);
+	  break;
+	case 'F':
+	  opts->cpu_freq = strtod (optarg, NULL) * 1.0e+06;
+	  break;
+	case 'e':
+	  opts->events = optarg;
+	  break;
+	case 'c':
+	  opts->csv_file = optarg;
+	  break;
+	case 'j':
+	  opts->json_file = optarg;
+	  break;
+	default:
+	  vec_perf_usage (argv[0]);
+	  return -1;
+	}
+    }
+  return 0;
+}
+
+static int
+vec_perf_match (const vec_perf_opts_t *opts, const vec_perf_kernel_t *k)
+{
+  char fullname[256];
+
+  if (opts->filter == NULL)
+    return 1;
+
+  snprintf (fullname, sizeof (fullname), "%s/%s", k->group, k->name);
+  return (fnmatch (opts->filter, fullname, 0) == 0
+      || fnmatch (opts->filter, k->name, 0) == 0);
+}
+
+static int
+vec_perf_pin (int cpu)
+{
+  cpu_set_t set;
+
+  CPU_ZERO (&set);
+  CPU_SET (cpu, &set);
+  if (sched_setaffinity (0, sizeof (set), &set) != 0)
+    {
+      perror ("sched_setaffinity");
+      return -1;
+    }
+  return 0;
+}
+
+static int
+vec_perf_cmp_u64 (const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *) a;
+  uint64_t y = *(const uint64_t *) b;
+
+  return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted sample array.  */
+static uint64_t
+vec_perf_percentile (const uint64_t *sorted, unsigned long n, unsigned pct)
+{
+  unsigned long rank;
+
+  rank = (pct * n + 99) / 100;
+  if (rank > 0)
+    rank--;
+  if (rank >= n)
+    rank = n - 1;
+  return sorted[rank];
+}
+
+/* Derive instructions per cycle from the generic counters.  */
+static void
+vec_perf_compute_ipc (vec_perf_result_t *res)
+{
+  int cyc = vec_perf_counter_find ("cycles");
+  int ins = vec_perf_counter_find ("instructions");
+
+  res->ipc = 0.0;
+  if (cyc >= 0 && ins >= 0 && res->counters[cyc] > 0.0
+      && res->counters[ins] >= 0.0)
+    res->ipc = res->counters[ins] / res->counters[cyc];
+}
+
+/* Run one kernel: setup and validation call, warmup, then
+   opts->repetitions samples of opts->iterations calls each.  */
+static void
+vec_perf_measure (const vec_perf_opts_t *opts, const vec_perf_kernel_t *k,
+		  vec_perf_result_t *res)
+{
+  uint64_t samples[VEC_PERF_MAX_REPS];
+  unsigned long i, j, reps;
+  double ns_per_tick, ops;
+  int sink = 0;
+
+  memset (res, 0, sizeof (*res));
+  res->kernel = k;
+  res->ops_per_sample = opts->iterations * k->ops;
+
+  if (k->setup)
+    res->fails += k->setup ();
+  /* Only the validation call contributes to the failure count.
+     The timed calls return the same result for the same inputs.  */
+  res->fails += k->func ();
+
+  for (i = 0; i < opts->warmup; i++)
+    for (j = 0; j < opts->iterations; j++)
+      sink += k->func ();
+
+  reps = opts->repetitions;
+  /* Counters run across all samples (enabled/disabled once) so they
+     do not perturb the individual timebase samples.  */
+  vec_perf_counters_start ();
+  for (i = 0; i < reps; i++)
+    {
+      uint64_t t_start, t_end;
+
+      t_start = vec_perf_timebase ();
+      for (j = 0; j < opts->iterations; j++)
+	sink += k->func ();
+      t_end = vec_perf_timebase ();
+      samples[i] = t_end - t_start;
+    }
+  vec_perf_counters_stop (res->counters);
+  qsort (samples, reps, sizeof (samples[0]), vec_perf_cmp_u64);
+
+  ns_per_tick = 1.0e+09 / opts->tb_freq;
+  ops = (res->ops_per_sample != 0) ? (double) res->ops_per_sample : 1.0;
+  for (i = 0; i < (unsigned long) vec_perf_counters_count (); i++)
+    if (res->counters[i] >= 0.0)
+      res->counters[i] /= ops * reps;
+  vec_perf_compute_ipc (res);
+  res->ns_med = (vec_perf_percentile (samples, reps, 50) * ns_per_tick) / ops;
+  res->ns_p5 = (vec_perf_percentile (samples, reps, 5) * ns_per_tick) / ops;
+  res->ns_p95 = (vec_perf_percentile (samples, reps, 95) * ns_per_tick) / ops;
+  if (opts->cpu_freq != 0.0)
+    {
+      double cyc_per_ns = opts->cpu_freq * 1.0e-09;
+
+      res->cyc_med = res->ns_med * cyc_per_ns;
+      res->cyc_p5 = res->ns_p5 * cyc_per_ns;
+      res->cyc_p95 = res->ns_p95 * cyc_per_ns;
+    }
+  (void) sink;
+}
+
+static const char *
+vec_perf_variant (const vec_perf_kernel_t *k)
+{
+  return k->variant ? k->variant : "";
+}
+
+static void
+vec_perf_print_header (void)
+{
+  printf ("\n%-6s %-28s %-6s %8s %11s %11s %11s %9s %9s %9s\n",
+	  "group", "kernel", "var", "ops", "ns/op", "ns/op p5", "ns/op p95",
+	  "cyc/op", "cyc p5", "cyc p95");
+}
+
+static void
+vec_perf_print_result (const vec_perf_result_t *res)
+{
+  printf ("%-6s %-28s %-6s %8lu %11.3f %11.3f %11.3f %9.2f %9.2f %9.2f%s\n",
+	  res->kernel->group, res->kernel->name,
+	  vec_perf_variant (res->kernel), res->ops_per_sample,
+	  res->ns_med, res->ns_p5, res->ns_p95,
+	  res->cyc_med, res->cyc_p5, res->cyc_p95,
+	  res->fails ? "  FAIL" : "");
+
+  if (vec_perf_counters_count () > 0)
+    {
+      int i;
+
+      printf ("       ");
+      for (i = 0; i < vec_perf_counters_count (); i++)
+	{
+	  if (res->counters[i] < 0.0)
+	    printf (" %s n/a", vec_perf_counter_name (i));
+	  else
+	    printf (" %s %.3f/op", vec_perf_counter_name (i),
+		    res->counters[i]);
+	}
+      if (res->ipc != 0.0)
+	printf (" IPC %.2f", res->ipc);
+      printf ("\n");
+    }
+}
+
+static void
+vec_perf_write_csv (const vec_perf_opts_t *opts,
+		    const vec_perf_result_t *res, int n)
+{
+  FILE *f;
+  int i, c;
+
+  f = fopen (opts->csv_file, "w");
+  if (f == NULL)
+    {
+      perror (opts->csv_file);
+      return;
+    }
+
+  fprintf (f, "group,kernel,variant,ops,iterations,repetitions,"
+	   "ns_med,ns_p5,ns_p95,cyc_med,cyc_p5,cyc_p95,fails");
+  /* Per-op counter columns, empty if the counter did not run.  */
+  for (c = 0; c < vec_perf_counters_count (); c++)
+    fprintf (f, ",%s_per_op", vec_perf_counter_name (c));
+  if (vec_perf_counters_count () > 0)
+    fprintf (f, ",ipc");
+  fprintf (f, "\n");
+  for (i = 0; i < n; i++)
+    {
+      fprintf (f, "%s,%s,%s,%lu,%lu,%lu,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f,%d",
+	       res[i].kernel->group, res[i].kernel->name,
+	       vec_perf_variant (res[i].kernel), res[i].kernel->ops,
+	       opts->iterations, opts->repetitions,
+	       res[i].ns_med, res[i].ns_p5, res[i].ns_p95,
+	       res[i].cyc_med, res[i].cyc_p5, res[i].cyc_p95, res[i].fails);
+      for (c = 0; c < vec_perf_counters_count (); c++)
+	{
+	  if (res[i].counters[c] < 0.0)
+	    fprintf (f, ",");
+	  else
+	    fprintf (f, ",%.4f", res[i].counters[c]);
+	}
+      if (vec_perf_counters_count () > 0)
+	fprintf (f, ",%.3f", res[i].ipc);
+      fprintf (f, "\n");
+    }
+  fclose (f);
+}
+
+static void
+vec_perf_write_json (const vec_perf_opts_t *opts,
+		     const vec_perf_result_t *res, int n)
+{
+  FILE *f;
+  int i;
+
+  f = fopen (opts->json_file, "w");
+  if (f == NULL)
+    {
+      perror (opts->json_file);
+      return;
+    }
+
+  fprintf (f, "{\n  \"timebase_hz\": %.0f,\n  \"cpu_hz\": %.0f,\n"
+	   "  \"warmup\": %lu,\n  \"iterations\": %lu,\n"
+	   "  \"repetitions\": %lu,\n  \"results\": [",
+	   opts->tb_freq, opts->cpu_freq, opts->warmup,
+	   opts->iterations, opts->repetitions);
+  for (i = 0; i < n; i++)
+    {
+      fprintf (f, "%s\n    { \"group\": \"%s\", \"kernel\": \"%s\","
+	       " \"variant\": \"%s\", \"ops\": %lu,\n"
+	       "      \"ns_per_op\": { \"median\": %.4f,"
+	       " \"p5\": %.4f, \"p95\": %.4f },\n"
+	       "      \"cycles_per_op\": { \"median\": %.3f,"
+	       " \"p5\": %.3f, \"p95\": %.3f },\n      \"fails\": %d",
+	       i ? "," : "", res[i].kernel->group, res[i].kernel->name,
+	       vec_perf_variant (res[i].kernel), res[i].kernel->ops,
+	       res[i].ns_med, res[i].ns_p5, res[i].ns_p95,
+	       res[i].cyc_med, res[i].cyc_p5, res[i].cyc_p95, res[i].fails);
+      if (vec_perf_counters_count () > 0)
+	{
+	  int c;
+
+	  fprintf (f, ",\n      \"counters_per_op\": {");
+	  for (c = 0; c < vec_perf_counters_count (); c++)
+	    {
+	      fprintf (f, "%s \"%s\": ", c ? "," : "",
+		       vec_perf_counter_name (c));
+	      if (res[i].counters[c] < 0.0)
+		fprintf (f, "null");
+	      else
+		fprintf (f, "%.4f", res[i].counters[c]);
+	    }
+	  fprintf (f, " },\n      \"ipc\": %.3f", res[i].ipc);
+	}
+      fprintf (f, " }");
+    }
+  fprintf (f, "\n  ]\n}\n");
+  fclose (f);
+}
+
+static int
+vec_perf_same_kernel (const vec_perf_kernel_t *a, const vec_perf_kernel_t *b)
+{
+  return (strcmp (a->group, b->group) == 0 && strcmp (a->name, b->name) == 0);
+}
+
+/* For kernels registered with implementation variants, print one
+   row per kernel with the median ns/op of each variant and the
+   speedup relative to the first (baseline) variant.  */
+static void
+vec_perf_print_variants (const vec_perf_result_t *res, int n)
+{
+  int i, j, k;
+
+  printf ("\n%-6s %-28s  median ns/op by variant (speedup vs first)\n",
+	  "group", "kernel");
+  for (i = 0; i < n; i++)
+    {
+      if (res[i].kernel->variant == NULL)
+	continue;
+      /* Skip kernels already printed as part of an earlier row.  */
+      for (k = 0; k < i; k++)
+	if (res[k].kernel->variant != NULL
+	    && vec_perf_same_kernel (res[k].kernel, res[i].kernel))
+	  break;
+      if (k < i)
+	continue;
+
+      printf ("%-6s %-28s", res[i].kernel->group, res[i].kernel->name);
+      for (j = i; j < n; j++)
+	{
+	  if (res[j].kernel->variant == NULL
+	      || !vec_perf_same_kernel (res[j].kernel, res[i].kernel))
+	    continue;
+	  printf ("  %s %9.3f (%4.2fx)", res[j].kernel->variant, res[j].ns_med,
+		  (res[j].ns_med != 0.0) ? res[i].ns_med / res[j].ns_med : 0.0);
+	}
+      printf ("\n");
+    }
+}
+
+/* Pair each latency kernel with the throughput kernel of the same
+   name and variant and print the cycles (or ns) per op of both.
+   The ratio is the average number of operations in flight when the
+   chains are independent.  */
+static void
+vec_perf_print_latency (const vec_perf_result_t *res, int n)
+{
+  int i, j;
+  int cycles = 0;
+
+  for (i = 0; i < n; i++)
+    if (res[i].cyc_med != 0.0)
+      cycles = 1;
+
+  printf ("\n%-28s %-6s %11s %11s %9s\n", "kernel", "var",
+	  cycles ? "lat cyc" : "lat ns", cycles ? "rthru cyc" : "rthru ns",
+	  "lat/rthru");
+  for (i = 0; i < n; i++)
+    {
+      double lat, thru;
+
+      if (strcmp (res[i].kernel->group, VEC_PERF_GROUP_LAT) != 0)
+	continue;
+      for (j = 0; j < n; j++)
+	if (strcmp (res[j].kernel->group, VEC_PERF_GROUP_TPUT) == 0
+	    && strcmp (res[j].kernel->name, res[i].kernel->name) == 0
+	    && strcmp (vec_perf_variant (res[j].kernel),
+		       vec_perf_variant (res[i].kernel)) == 0)
+	  break;
+      if (j == n)
+	continue;
+
+      lat = cycles ? res[i].cyc_med : res[i].ns_med;
+      thru = cycles ? res[j].cyc_med : res[j].ns_med;
+      printf ("%-28s %-6s %11.2f %11.2f %9.2f\n", res[i].kernel->name,
+	      vec_perf_variant (res[i].kernel), lat, thru,
+	      (thru != 0.0) ? lat / thru : 0.0);
+    }
+}
+
+int
+vec_perf_run (const vec_perf_opts_t *opts)
+{
+  static vec_perf_result_t results[VEC_PERF_MAX_KERNELS];
+  int i, n = 0;
+  int variants = 0;
+  int latency = 0;
+  int rc = 0;
+
+  if (opts->list_only)
+    {
+      for (i = 0; i < perf_registered; i++)
+	if (vec_perf_match (opts, perf_registry[i]))
+	  printf ("%s/%s %s\n", perf_registry[i]->group, perf_registry[i]->name,
+		  vec_perf_variant (perf_registry[i]));
+      return 0;
+    }
+
+  if (opts->cpu >= 0)
+    vec_perf_pin (opts->cpu);
+  if (opts->events)
+    vec_perf_counters_open (opts->events);
+
+  printf ("timebase %.0f Hz, clock %.0f MHz, warmup %lu, "
+	  "%lu samples x %lu iterations\n",
+	  opts->tb_freq, opts->cpu_freq * 1.0e-06, opts->warmup,
+	  opts->repetitions, opts->iterations);
+  vec_perf_print_header ();
+
+  for (i = 0; i < perf_registered; i++)
+    {
+      if (!vec_perf_match (opts, perf_registry[i]))
+	continue;
+      if (perf_registry[i]->available && !perf_registry[i]->available ())
+	{
+	  printf ("%-6s %-28s %-6s skipped, not supported on this host\n",
+		  perf_registry[i]->group, perf_registry[i]->name,
+		  vec_perf_variant (perf_registry[i]));
+	  continue;
+	}
+      if (perf_registry[i]->variant)
+	variants++;
+      if (strcmp (perf_registry[i]->group, VEC_PERF_GROUP_LAT) == 0)
+	latency++;
+
+      vec_perf_measure (opts, perf_registry[i], &results[n]);
+      vec_perf_print_result (&results[n]);
+      rc += results[n].fails;
+      n++;
+    }
+
+  if (variants)
+    vec_perf_print_variants (results, n);
+  if (latency)
+    vec_perf_print_latency (results, n);
+
+  if (opts->csv_file)
+    vec_perf_write_csv (opts, results, n);
+  if (opts->json_file)
+    vec_perf_write_json (opts, results, n);
+
+  vec_perf_counters_close ();
+  return rc;
+}
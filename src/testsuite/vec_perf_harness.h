@@ -0,0 +1,163 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_harness.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_HARNESS_H_
+#define SRC_TESTSUITE_VEC_PERF_HARNESS_H_
+
+#include <stdint.h>
+
+#include <testsuite/vec_perf_counters.h>
+
+/* The timed_* kernels run a fixed (small) sequence of operations and
+   return a count of failed checks. The harness calls each kernel
+   "iterations" times per sample, collects "repetitions" samples after
+   "warmup" untimed batches, and normalizes the timebase deltas by the
+   number of operations the kernel declares for each call.  */
+
+/*! \brief Timed kernel, returns the number of failed checks.  */
+typedef int (*vec_perf_func_t) (void);
+
+/*! \brief Registration record for one timed kernel.  */
+typedef struct
+{
+  /*! \brief Kernel group (f32, f64, f128, i128, i512, ...).  */
+  const char *group;
+  /*! \brief Kernel name, unique within the group.  */
+  const char *name;
+  /*! \brief Operations performed by one call of func.  */
+  unsigned long ops;
+  /*! \brief Optional setup, called once before warmup.  */
+  vec_perf_func_t setup;
+  /*! \brief The timed kernel.  */
+  vec_perf_func_t func;
+  /*! \brief Implementation variant (PWR8, PWR9, ...) or NULL.
+   *  Kernels with the same group/name and different variants are
+   *  reported side by side.  */
+  const char *variant;
+  /*! \brief Optional check that the host can execute this kernel.
+   *  Returns nonzero if the kernel can run.  */
+  vec_perf_func_t available;
+} vec_perf_kernel_t;
+
+/*! \brief Define a kernel table entry for timed_NAME.  */
+#define VEC_PERF_KERNEL(GROUP, NAME, OPS) \
+  { #GROUP, #NAME, (OPS), NULL, timed_ ## NAME, NULL, NULL }
+
+/*! \brief Define a kernel table entry with a setup function.  */
+#define VEC_PERF_KERNEL_SETUP(GROUP, NAME, OPS, SETUP) \
+  { #GROUP, #NAME, (OPS), SETUP, timed_ ## NAME, NULL, NULL }
+
+/*! \brief Define a kernel table entry for the VARIANT implementation
+ *  of NAME, timed by timed_NAME_VARIANT.  */
+#define VEC_PERF_KERNEL_VARIANT(GROUP, NAME, VARIANT, OPS, AVAIL) \
+  { #GROUP, #NAME, (OPS), NULL, timed_ ## NAME ## _ ## VARIANT, \
+    #VARIANT, AVAIL }
+
+/*! \brief Groups of the latency (one dependent chain) and
+ *  reciprocal throughput (independent chains) kernels. Kernels with
+ *  the same name and variant in both groups are summarized side by
+ *  side.  */
+#define VEC_PERF_GROUP_LAT "lat"
+#define VEC_PERF_GROUP_TPUT "tput"
+
+/*! \brief Terminate a kernel table.  */
+#define VEC_PERF_KERNEL_END { NULL, NULL, 0, NULL, NULL, NULL, NULL }
+
+/*! \brief Harness run options.  */
+typedef struct
+{
+  /*! \brief fnmatch pattern applied to "group/name", NULL for all.  */
+  const char *filter;
+  /*! \brief Untimed batches before sampling.  */
+  unsigned long warmup;
+  /*! \brief Number of timed samples per kernel.  */
+  unsigned long repetitions;
+  /*! \brief Kernel calls per timed sample.  */
+  unsigned long iterations;
+  /*! \brief CPU to pin to, or -1 to leave affinity alone.  */
+  int cpu;
+  /*! \brief Timebase frequency in Hz.  */
+  double tb_freq;
+  /*! \brief Processor clock in Hz, 0.0 if unknown.  */
+  double cpu_freq;
+  /*! \brief Optional CSV output file name.  */
+  const char *csv_file;
+  /*! \brief Optional JSON output file name.  */
+  const char *json_file;
+  /*! \brief Only list the registered kernels.  */
+  int list_only;
+  /*! \brief Run the per-CPU implementation variants side by side.  */
+  int variants;
+  /*! \brief Run the latency / throughput kernels.  */
+  int latency;
+  /*! \brief Comma separated perf counter events, NULL for none.
+   *  See vec_perf_counters.h.  */
+  const char *events;
+} vec_perf_opts_t;
+
+/*! \brief Summary statistics for one kernel.  */
+typedef struct
+{
+  const vec_perf_kernel_t *kernel;
+  /*! \brief Total operations per sample (iterations * ops).  */
+  unsigned long ops_per_sample;
+  /*! \brief Nanoseconds per operation, median, p5 and p95.  */
+  double ns_med, ns_p5, ns_p95;
+  /*! \brief Processor cycles per operation, 0.0 if clock unknown.  */
+  double cyc_med, cyc_p5, cyc_p95;
+  /*! \brief Failed checks reported by the kernel.  */
+  int fails;
+  /*! \brief Perf counter events per operation, indexed as the open
+   *  counters. Negative if the counter did not run.  */
+  double counters[VEC_PERF_MAX_COUNTERS];
+  /*! \brief Instructions per cycle, 0.0 unless both are counted.  */
+  double ipc;
+} vec_perf_result_t;
+
+/*! \brief Add a VEC_PERF_KERNEL_END terminated table to the registry.
+ *  Returns the number of kernels registered from the table.  */
+extern int
+vec_perf_register (const vec_perf_kernel_t *table);
+
+/*! \brief Fill opts with defaults and probe the timebase and
+ *  processor frequencies from /proc/cpuinfo.  */
+extern void
+vec_perf_default_opts (vec_perf_opts_t *opts);
+
+/*! \brief Parse command line options into opts.
+ *  Returns 0 for success, -1 for a usage error.  */
+extern int
+vec_perf_parse_opts (vec_perf_opts_t *opts, int argc, char *argv[]);
+
+/*! \brief Run all registered kernels selected by opts.
+ *  Returns the sum of failed checks.  */
+extern int
+vec_perf_run (const vec_perf_opts_t *opts);
+
+/*! \brief Read the timebase register.  */
+static inline uint64_t
+vec_perf_timebase (void)
+{
+  return __builtin_ppc_get_timebase ();
+}
+
+#endif /* SRC_TESTSUITE_VEC_PERF_HARNESS_H_ */
@@ -506,3 +506,107 @@ timed_ctmaxdouble_10e32 (void)
 #endif
   return rc;
 }
+
+/* Scale by 10**k for k = 1-38 with one call each, compared to the
+   same scale as k steps of vec_mul10uq() / divide by 10.  */
+int
+timed_mul10k_uq (void)
+{
+  vui128_t i, k;
+  unsigned int ii;
+  int rc = 0;
+
+  i = (vui128_t) c_one;
+  for (ii = 1; ii < 39; ii++)
+    {
+      k = vec_mul10k_uq (i, ii);
+#ifdef __DEBUG_PRINT__
+      rc += check_vuint128 ("vec_mul10k_uq:", k, vtipowof10[ii]);
+#endif
+    }
+  rc += check_vuint128 ("vec_mul10k_uq:", k, vtipowof10[38]);
+
+  return rc;
+}
+
+int
+timed_mul10k_steps (void)
+{
+  vui128_t i, k;
+  unsigned int ii, jj;
+  int rc = 0;
+
+  i = (vui128_t) c_one;
+  for (ii = 1; ii < 39; ii++)
+    {
+      k = i;
+      for (jj = 0; jj < ii; jj++)
+	k = vec_mul10uq (k);
+#ifdef __DEBUG_PRINT__
+      rc += check_vuint128 ("vec_mul10uq steps:", k, vtipowof10[ii]);
+#endif
+    }
+  rc += check_vuint128 ("vec_mul10uq steps:", k, vtipowof10[38]);
+
+  return rc;
+}
+
+int
+timed_div10k_uq (void)
+{
+  const vui128_t e = (vui128_t) CONST_VINT128_W (0, 0, 0, 3);
+  vui128_t i, k;
+  unsigned int ii;
+  int rc = 0;
+
+  i = (vui128_t) CONST_VINT128_DW128 (__UINT64_MAX__, __UINT64_MAX__);
+  for (ii = 1; ii < 39; ii++)
+    k = vec_div10k_uq (i, ii);
+  rc += check_vuint128 ("vec_div10k_uq:", k, e);
+
+  return rc;
+}
+
+int
+timed_div10k_steps (void)
+{
+  const vui128_t e = (vui128_t) CONST_VINT128_W (0, 0, 0, 3);
+  vui128_t i, k;
+  unsigned int ii, jj;
+  int rc = 0;
+
+  i = (vui128_t) CONST_VINT128_DW128 (__UINT64_MAX__, __UINT64_MAX__);
+  for (ii = 1; ii < 39; ii++)
+    {
+      k = i;
+      for (jj = 0; jj < ii; jj++)
+	k = vec_div10k_uq (k, 1);
+    }
+  rc += check_vuint128 ("vec_div10k_uq steps:", k, e);
+
+  return rc;
+}
+
+/* Operations per call. The long division/conversion kernels count
+   quadword steps (calls times quadwords per call).  */
+const vec_perf_kernel_t vec_perf_i128_kernels[] =
+{
+  VEC_PERF_KERNEL (i128, mul10uq, 38),
+  VEC_PERF_KERNEL (i128, mul10uq2x, 2 * 38),
+  VEC_PERF_KERNEL (i128, cmul10ecuq, 64),
+  VEC_PERF_KERNEL (i128, mulluq, 38),
+  VEC_PERF_KERNEL (i128, muludq, 6),
+  VEC_PERF_KERNEL (i128, muludqx, 6),
+  VEC_PERF_KERNEL (i128, longdiv_e32, 4 * 4),
+  VEC_PERF_KERNEL (i128, mul10k_uq, 38),
+  VEC_PERF_KERNEL (i128, mul10k_steps, 38),
+  VEC_PERF_KERNEL (i128, div10k_uq, 38),
+  VEC_PERF_KERNEL (i128, div10k_steps, 38),
+#ifndef PVECLIB_DISABLE_DFP
+  VEC_PERF_KERNEL (i128, longbcdcf_10e32, 8 * 8 + 1),
+  VEC_PERF_KERNEL (i128, longbcdct_10e32, 10 * 8),
+#endif
+  VEC_PERF_KERNEL (i128, cfmaxdouble_10e32, 1),
+  VEC_PERF_KERNEL (i128, ctmaxdouble_10e32, 1),
+  VEC_PERF_KERNEL_END
+};
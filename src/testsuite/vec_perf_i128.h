@@ -23,6 +23,8 @@
 #ifndef TESTSUITE_VEC_PERF_I128_H_
 #define TESTSUITE_VEC_PERF_I128_H_
 
+#include <testsuite/vec_perf_harness.h>
+
 extern int timed_mul10uq (void);
 extern int timed_mul10uq2x (void);
 extern int timed_cmul10ecuq (void);
@@ -30,6 +32,10 @@ extern int timed_mulluq (void);
 extern int timed_muludq (void);
 extern int timed_muludqx (void);
 extern int timed_longdiv_e32 (void);
+extern int timed_mul10k_uq (void);
+extern int timed_mul10k_steps (void);
+extern int timed_div10k_uq (void);
+extern int timed_div10k_steps (void);
 #ifndef PVECLIB_DISABLE_DFP
 extern int timed_longbcdcf_10e32 (void);
 extern int timed_longbcdct_10e32 (void);
@@ -37,4 +43,6 @@ extern int timed_longbcdct_10e32 (void);
 extern int timed_cfmaxdouble_10e32 (void);
 extern int timed_ctmaxdouble_10e32 (void);
 
+extern const vec_perf_kernel_t vec_perf_i128_kernels[];
+
 #endif /* TESTSUITE_VEC_PERF_I128_H_ */
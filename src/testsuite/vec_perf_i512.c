@@ -1178,3 +1178,102 @@ timed_mul512x512 (void)
 
   return (rc);
 }
+
+/* Scale a 512-bit integer by 10**k, k = 1-38, with one call each,
+   compared to k passes of multiply (divide) by 10.  */
+int
+timed_mul10k_byN (void)
+{
+  __VEC_U_512 m, p;
+  unsigned int k;
+  int rc = 0;
+
+  m = vec512_one;
+  for (k = 1; k < 39; k++)
+    __VEC_PWR_IMP (vec_mul10k_byN) ((vui128_t *) &p, (vui128_t *) &m, k, 4);
+  rc += check_vuint128 ("vec_mul10k_byN:", p.vx0, vtipowof10[38]);
+
+  return (rc);
+}
+
+int
+timed_mul10k_byN_steps (void)
+{
+  __VEC_U_512 p;
+  vui128_t c;
+  unsigned int j, k;
+  int rc = 0;
+
+  for (k = 1; k < 39; k++)
+    {
+      p = vec512_one;
+      for (j = 0; j < k; j++)
+	{
+	  p.vx0 = vec_cmul10ecuq (&c, p.vx0, c_zero);
+	  p.vx1 = vec_cmul10ecuq (&c, p.vx1, c);
+	  p.vx2 = vec_cmul10ecuq (&c, p.vx2, c);
+	  p.vx3 = vec_cmul10ecuq (&c, p.vx3, c);
+	}
+    }
+  rc += check_vuint128 ("vec_cmul10ecuq steps:", p.vx0, vtipowof10[38]);
+
+  return (rc);
+}
+
+int
+timed_div10k_byN (void)
+{
+  const vui128_t e = (vui128_t) ((unsigned __int128) 3);
+  __VEC_U_512 n, q;
+  unsigned int k;
+  int rc = 0;
+
+  n = vec512_foxes;
+  for (k = 1; k < 39; k++)
+    __VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &n, k,
+				    VEC_ROUND_TRUNC, 4);
+  rc += check_vuint128 ("vec_div10k_byN:", q.vx3, e);
+
+  return (rc);
+}
+
+int
+timed_div10k_byN_steps (void)
+{
+  const vui128_t e = (vui128_t) ((unsigned __int128) 3);
+  __VEC_U_512 q;
+  unsigned int j, k;
+  int rc = 0;
+
+  for (k = 1; k < 39; k++)
+    {
+      q = vec512_foxes;
+      for (j = 0; j < k; j++)
+	__VEC_PWR_IMP (vec_div10k_byN) ((vui128_t *) &q, (vui128_t *) &q, 1,
+					VEC_ROUND_TRUNC, 4);
+    }
+  rc += check_vuint128 ("vec_div10k_byN steps:", q.vx3, e);
+
+  return (rc);
+}
+
+/* Operations per call. The *by8 and _MN kernels chain 8 multiplies,
+   the single-shot kernels one.  */
+const vec_perf_kernel_t vec_perf_i512_kernels[] =
+{
+  VEC_PERF_KERNEL (i512, mul128x128, 8),
+  VEC_PERF_KERNEL (i512, mul256x256, 8),
+  VEC_PERF_KERNEL (i512, mul512x512, 1),
+  VEC_PERF_KERNEL (i512, mul512x512by8, 8),
+  VEC_PERF_KERNEL (i512, mul1024x1024, 1),
+  VEC_PERF_KERNEL (i512, mul1024x1024by8, 8),
+  VEC_PERF_KERNEL (i512, mul2048x2048, 1),
+  VEC_PERF_KERNEL (i512, mul2048x2048by8, 8),
+  VEC_PERF_KERNEL (i512, mul2048x2048_MN, 8),
+  VEC_PERF_KERNEL (i512, mul4096x4096_MN, 8),
+  VEC_PERF_KERNEL (i512, mul10k_byN, 38),
+  VEC_PERF_KERNEL (i512, mul10k_byN_steps, 38),
+  VEC_PERF_KERNEL (i512, div10k_byN, 38),
+  VEC_PERF_KERNEL (i512, div10k_byN_steps, 38),
+  VEC_PERF_KERNEL_END
+};
@@ -23,6 +23,8 @@
 #ifndef SRC_TESTSUITE_VEC_PERF_I512_H_
 #define SRC_TESTSUITE_VEC_PERF_I512_H_
 
+#include <testsuite/vec_perf_harness.h>
+
 extern int timed_mul128x128 (void);
 extern int timed_mul256x256 (void);
 extern int timed_mul512x512 (void);
@@ -33,5 +35,11 @@ extern int timed_mul2048x2048 (void);
 extern int timed_mul2048x2048by8 (void);
 extern int timed_mul2048x2048_MN (void);
 extern int timed_mul4096x4096_MN (void);
+extern int timed_mul10k_byN (void);
+extern int timed_mul10k_byN_steps (void);
+extern int timed_div10k_byN (void);
+extern int timed_div10k_byN_steps (void);
+
+extern const vec_perf_kernel_t vec_perf_i512_kernels[];
 
 #endif /* SRC_TESTSUITE_VEC_PERF_I512_H_ */
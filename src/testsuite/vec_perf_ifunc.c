@@ -0,0 +1,562 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_ifunc.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+//#define __DEBUG_PRINT__
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int512_ppc.h>
+
+#include <testsuite/arith128_print.h>
+#include <testsuite/arith128_test_i512.h>
+#include <testsuite/vec_perf_ifunc.h>
+
+/* libpvecstatic.a contains every platform variant built for this
+   endian (see vec_runtime_DYN.c). Select the same set the IFUNC
+   resolvers choose from.  */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#ifndef PVECLIB_DISABLE_POWER7
+#define VEC_PERF_IFUNC_PWR7 1
+#endif
+#else
+#ifndef PVECLIB_DISABLE_POWER10
+#define VEC_PERF_IFUNC_PWR10 1
+#endif
+#endif
+#ifndef PVECLIB_DISABLE_POWER9
+#define VEC_PERF_IFUNC_PWR9 1
+#endif
+
+typedef __VEC_U_256 (*mul128x128_t) (vui128_t, vui128_t);
+typedef __VEC_U_512 (*mul256x256_t) (__VEC_U_256, __VEC_U_256);
+typedef __VEC_U_640 (*mul512x128_t) (__VEC_U_512, vui128_t);
+typedef __VEC_U_640 (*madd512x128a512_t) (__VEC_U_512, vui128_t,
+					  __VEC_U_512);
+typedef __VEC_U_1024 (*mul512x512_t) (__VEC_U_512, __VEC_U_512);
+typedef void (*mul1024x1024_t) (__VEC_U_2048 *, __VEC_U_1024 *,
+				__VEC_U_1024 *);
+typedef void (*mul2048x2048_t) (__VEC_U_4096 *, __VEC_U_2048 *,
+				__VEC_U_2048 *);
+typedef void (*mul128_byMN_t) (vui128_t *, vui128_t *, vui128_t *,
+			       unsigned long, unsigned long);
+typedef void (*mul512_byMN_t) (__VEC_U_512 *, __VEC_U_512 *, __VEC_U_512 *,
+			       unsigned long, unsigned long);
+
+/* Declare the platform specific implementations of each IFUNC.  */
+#define VEC_PERF_IFUNC_EXTERNS(VARIANT) \
+  extern __VEC_U_256 vec_mul128x128_ ## VARIANT (vui128_t, vui128_t); \
+  extern __VEC_U_512 vec_mul256x256_ ## VARIANT (__VEC_U_256, __VEC_U_256); \
+  extern __VEC_U_640 vec_mul512x128_ ## VARIANT (__VEC_U_512, vui128_t); \
+  extern __VEC_U_640 vec_madd512x128a512_ ## VARIANT (__VEC_U_512, \
+						      vui128_t, __VEC_U_512); \
+  extern __VEC_U_1024 vec_mul512x512_ ## VARIANT (__VEC_U_512, __VEC_U_512); \
+  extern void vec_mul1024x1024_ ## VARIANT (__VEC_U_2048 *, __VEC_U_1024 *, \
+					     __VEC_U_1024 *); \
+  extern void vec_mul2048x2048_ ## VARIANT (__VEC_U_4096 *, __VEC_U_2048 *, \
+					     __VEC_U_2048 *); \
+  extern void vec_mul128_byMN_ ## VARIANT (vui128_t *, vui128_t *, \
+					    vui128_t *, unsigned long, \
+					    unsigned long); \
+  extern void vec_mul512_byMN_ ## VARIANT (__VEC_U_512 *, __VEC_U_512 *, \
+					    __VEC_U_512 *, unsigned long, \
+					    unsigned long);
+
+#ifdef VEC_PERF_IFUNC_PWR7
+VEC_PERF_IFUNC_EXTERNS (PWR7)
+#endif
+VEC_PERF_IFUNC_EXTERNS (PWR8)
+#ifdef VEC_PERF_IFUNC_PWR9
+VEC_PERF_IFUNC_EXTERNS (PWR9)
+#endif
+#ifdef VEC_PERF_IFUNC_PWR10
+VEC_PERF_IFUNC_EXTERNS (PWR10)
+#endif
+
+static const vui128_t c_zero =  (vui128_t) ((unsigned __int128) 0);
+static const vui128_t c_one =  (vui128_t) ((unsigned __int128) 1);
+static const vui128_t c_ten =  (vui128_t) ((unsigned __int128) 10);
+static const vui128_t c_hundred =  (vui128_t) ((unsigned __int128) 100);
+static const vui128_t c_10k =  (vui128_t) ((unsigned __int128) 10000);
+static const vui128_t c_100m =  (vui128_t) ((unsigned __int128) 100000000);
+static const vui128_t c_111m =  (vui128_t) ((unsigned __int128) 111111111);
+/* 10^64th as a binary const requiring 256-bits.  */
+static const vui32_t ten_64h =
+    CONST_VINT32_W(0x00000000, 0x00184f03, 0xe93ff9f4, 0xdaa797ed);
+static const vui32_t ten_64l =
+    CONST_VINT32_W(0x6e38ed64, 0xbf6a1f01, 0x00000000, 0x00000000);
+
+/* Availability of each variant on this host. Variants for the
+   compile target or older always run.  */
+#ifdef VEC_PERF_IFUNC_PWR7
+static int
+vec_perf_have_PWR7 (void)
+{
+  return 1;
+}
+#endif
+
+static int
+vec_perf_have_PWR8 (void)
+{
+#if defined (_ARCH_PWR8)
+  return 1;
+#elif defined (__BUILTIN_CPU_SUPPORTS__)
+  return __builtin_cpu_supports ("arch_2_07");
+#else
+  return 0;
+#endif
+}
+
+#ifdef VEC_PERF_IFUNC_PWR9
+static int
+vec_perf_have_PWR9 (void)
+{
+#if defined (_ARCH_PWR9)
+  return 1;
+#elif defined (__BUILTIN_CPU_SUPPORTS__)
+  return __builtin_cpu_supports ("arch_3_00");
+#else
+  return 0;
+#endif
+}
+#endif
+
+#ifdef VEC_PERF_IFUNC_PWR10
+static int
+vec_perf_have_PWR10 (void)
+{
+#if defined (_ARCH_PWR10)
+  return 1;
+#elif defined (__BUILTIN_CPU_SUPPORTS__)
+  return __builtin_cpu_supports ("arch_3_1");
+#else
+  return 0;
+#endif
+}
+#endif
+
+/* The drivers below follow the timed_* kernels of vec_perf_i512.c,
+   but call the implementation through a function pointer so the same
+   sequence (and check) is timed for each platform variant.  */
+
+static int
+drive_mul128x128 (mul128x128_t mul128x128)
+{
+  vui128_t i, j;
+  __VEC_U_256 k, k2;
+  int rc = 0;
+
+  i = (vui128_t) c_ten;
+  j = (vui128_t) c_one;
+  k2 = mul128x128 (j, j);
+  j = k2.vx0;
+  k  = mul128x128 (i, j);
+  i = k.vx0;
+  k2 = mul128x128 (i, i);
+  i = k2.vx0;
+  k  = mul128x128 (i, i);
+  i = k.vx0;
+  k2 = mul128x128 (i, i);
+  i = k2.vx0;
+  k  = mul128x128 (i, i);
+  i = k.vx0;
+  k2 = mul128x128 (i, i);
+  i = k2.vx0;
+  k  = mul128x128 (i, i);
+
+  rc += check_vint256 ("vec_mul128x128 1:", k.vx1, k.vx0, (vui128_t)ten_64h, (vui128_t)ten_64l);
+
+  return rc;
+}
+
+static int
+drive_mul256x256 (mul256x256_t mul256x256)
+{
+  __VEC_U_256 i, j;
+  __VEC_U_512 k, k2;
+  int rc = 0;
+
+  i.vx0 = (vui128_t) c_ten;
+  i.vx1 = (vui128_t) c_zero;
+  j.vx0 = (vui128_t) c_one;
+  j.vx1 = (vui128_t) c_zero;
+
+  k2 = mul256x256 (i, j);
+  i.vx0 = k2.vx0;
+  i.vx1 = k2.vx1;
+  k  = mul256x256 (i, i);
+  i.vx0 = k.vx0;
+  i.vx1 = k.vx1;
+  k2 = mul256x256 (i, i);
+  i.vx0 = k2.vx0;
+  i.vx1 = k2.vx1;
+  k  = mul256x256 (i, i);
+  i.vx0 = k.vx0;
+  i.vx1 = k.vx1;
+  k2 = mul256x256 (i, i);
+  i.vx0 = k2.vx0;
+  i.vx1 = k2.vx1;
+  k  = mul256x256 (i, i);
+  i.vx0 = k.vx0;
+  i.vx1 = k.vx1;
+  k2 = mul256x256 (i, i);
+  i.vx0 = k2.vx0;
+  i.vx1 = k2.vx1;
+  k  = mul256x256 (i, i);
+
+  rc += check_vint512 ("vec_mul256x256:", k, vec512_ten128th);
+
+  return rc;
+}
+
+static int
+drive_mul512x128 (mul512x128_t mul512x128)
+{
+  __VEC_U_640 k;
+  __VEC_U_512 i, e;
+  int n, rc = 0;
+
+  i = vec512_one;
+  /* 1 * 10^8 <- */
+  for (n = 0; n < 8; n++)
+    {
+      k = mul512x128 (i, c_ten);
+      i.vx0 = k.vx0;
+      i.vx1 = k.vx1;
+      i.vx2 = k.vx2;
+      i.vx3 = k.vx3;
+    }
+
+  e = vec512_zeros;
+  e.vx0 = c_100m;
+  rc += check_vint512 ("vec_mul512x128:", i, e);
+
+  return rc;
+}
+
+static int
+drive_madd512x128a512 (madd512x128a512_t madd512x128a512)
+{
+  __VEC_U_640 k;
+  __VEC_U_512 i, e;
+  int n, rc = 0;
+
+  i = vec512_one;
+  /* ((1 * 10) + 1) * 10 + 1 ... <- 111111111 */
+  for (n = 0; n < 8; n++)
+    {
+      k = madd512x128a512 (i, c_ten, vec512_one);
+      i.vx0 = k.vx0;
+      i.vx1 = k.vx1;
+      i.vx2 = k.vx2;
+      i.vx3 = k.vx3;
+    }
+
+  e = vec512_zeros;
+  e.vx0 = c_111m;
+  rc += check_vint512 ("vec_madd512x128a512:", i, e);
+
+  return rc;
+}
+
+static int
+drive_mul512x512 (mul512x512_t mul512x512)
+{
+  __VEC_U_512 i;
+  __VEC_U_1024x512 k, k2;
+  int rc = 0;
+
+  i.vx0 = (vui128_t) c_ten;
+  i.vx1 = (vui128_t) c_zero;
+  i.vx2 = (vui128_t) c_zero;
+  i.vx3 = (vui128_t) c_zero;
+
+  k2.x1024 = mul512x512 (i, i);
+  k.x1024 = mul512x512 (k2.x2.v0x512, k2.x2.v0x512);
+  k2.x1024 = mul512x512 (k.x2.v0x512, k.x2.v0x512);
+  k.x1024 = mul512x512 (k2.x2.v0x512, k2.x2.v0x512);
+  k2.x1024 = mul512x512 (k.x2.v0x512, k.x2.v0x512);
+  k.x1024 = mul512x512 (k2.x2.v0x512, k2.x2.v0x512);
+  k2.x1024 = mul512x512 (k.x2.v0x512, k.x2.v0x512);
+  k.x1024 = mul512x512 (k2.x2.v0x512, k2.x2.v0x512);
+
+  rc += check_vint512 ("vec_mul512x512a:", k.x2.v1x512, vec512_ten256_h);
+  rc += check_vint512 ("vec_mul512x512b:", k.x2.v0x512, vec512_ten256_l);
+
+  return rc;
+}
+
+static int
+drive_mul1024x1024 (mul1024x1024_t mul1024x1024)
+{
+  __VEC_U_2048x512 k1, k2;
+  __VEC_U_1024x512 m1;
+  int rc = 0;
+
+  m1.x2.v1x512 = vec512_zeros;
+  m1.x2.v0x512.vx3 = c_zero;
+  m1.x2.v0x512.vx2 = c_zero;
+  m1.x2.v0x512.vx1 = c_zero;
+  m1.x2.v0x512.vx0 = c_hundred;
+  // 10^4 <-
+  mul1024x1024 (&k1.x2048, &m1.x1024, &m1.x1024);
+  // 10^8 <-
+  mul1024x1024 (&k2.x2048, &k1.x2.v0x1024, &k1.x2.v0x1024);
+  // 10^16 <-
+  mul1024x1024 (&k1.x2048, &k2.x2.v0x1024, &k2.x2.v0x1024);
+  // 10^32 <-
+  mul1024x1024 (&k2.x2048, &k1.x2.v0x1024, &k1.x2.v0x1024);
+  // 10^64 <-
+  mul1024x1024 (&k1.x2048, &k2.x2.v0x1024, &k2.x2.v0x1024);
+  // 10^128 <-
+  mul1024x1024 (&k2.x2048, &k1.x2.v0x1024, &k1.x2.v0x1024);
+  // 10^256 <-
+  mul1024x1024 (&k1.x2048, &k2.x2.v0x1024, &k2.x2.v0x1024);
+  // 10^512 <-
+  mul1024x1024 (&k2.x2048, &k1.x2.v0x1024, &k1.x2.v0x1024);
+
+  rc += check_vint512 ("vec_mul1024x1024 10a:", k2.x4.v3x512, vec512_ten512_3);
+  rc += check_vint512 ("vec_mul1024x1024 10b:", k2.x4.v2x512, vec512_ten512_2);
+  rc += check_vint512 ("vec_mul1024x1024 10c:", k2.x4.v1x512, vec512_ten512_1);
+  rc += check_vint512 ("vec_mul1024x1024 10d:", k2.x4.v0x512, vec512_ten512_0);
+
+  return (rc);
+}
+
+/* Check the 10^1024 product of the 2048-bit chains.  */
+static int
+check_ten1024 (char *prefix, __VEC_U_4096x512 *k)
+{
+  int rc = 0;
+
+  rc += check_vint512 (prefix, k->x8.v6x512, vec512_ten1024_6);
+  rc += check_vint512 (prefix, k->x8.v5x512, vec512_ten1024_5);
+  rc += check_vint512 (prefix, k->x8.v4x512, vec512_ten1024_4);
+  rc += check_vint512 (prefix, k->x8.v3x512, vec512_ten1024_3);
+  rc += check_vint512 (prefix, k->x8.v2x512, vec512_ten1024_2);
+
+  return (rc);
+}
+
+static int
+drive_mul2048x2048 (mul2048x2048_t mul2048x2048)
+{
+  __VEC_U_4096x512 k1, k2;
+  __VEC_U_2048x512 m1;
+
+  m1.x4.v3x512 = vec512_zeros;
+  m1.x4.v2x512 = vec512_zeros;
+  m1.x4.v1x512 = vec512_zeros;
+  m1.x4.v0x512.vx3 = c_zero;
+  m1.x4.v0x512.vx2 = c_zero;
+  m1.x4.v0x512.vx1 = c_zero;
+  m1.x4.v0x512.vx0 = c_10k;
+  // 10^8 <-
+  mul2048x2048 (&k1.x4096, &m1.x2048, &m1.x2048);
+  // 10^16 <-
+  mul2048x2048 (&k2.x4096, &k1.x2.v0x2048, &k1.x2.v0x2048);
+  // 10^32 <-
+  mul2048x2048 (&k1.x4096, &k2.x2.v0x2048, &k2.x2.v0x2048);
+  // 10^64 <-
+  mul2048x2048 (&k2.x4096, &k1.x2.v0x2048, &k1.x2.v0x2048);
+  // 10^128 <-
+  mul2048x2048 (&k1.x4096, &k2.x2.v0x2048, &k2.x2.v0x2048);
+  // 10^256 <-
+  mul2048x2048 (&k2.x4096, &k1.x2.v0x2048, &k1.x2.v0x2048);
+  // 10^512 <-
+  mul2048x2048 (&k1.x4096, &k2.x2.v0x2048, &k2.x2.v0x2048);
+  // 10^1024 <-
+  mul2048x2048 (&k2.x4096, &k1.x2.v0x2048, &k1.x2.v0x2048);
+
+  return check_ten1024 ("vec_mul2048x2048:", &k2);
+}
+
+/* The byMN chains use the same 2048-bit operands as drive_mul2048x2048,
+   as 4 x 512-bit or 16 x 128-bit elements. For Big Endian the first
+   (lowest address) element is the most significant.  */
+static int
+drive_mul512_byMN (mul512_byMN_t mul512_byMN)
+{
+  __VEC_U_4096x512 k1, k2;
+  __VEC_U_2048x512 m1;
+  __VEC_U_512 *kp1, *kp2, *ip, *jp1, *jp2;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  kp1 = &k1.x8.v0x512;
+  kp2 = &k2.x8.v0x512;
+  ip = &m1.x4.v0x512;
+  // Low order 2048-bits of k1/k2
+  jp1 = &k1.x8.v0x512;
+  jp2 = &k2.x8.v0x512;
+#else
+  kp1 = &k1.x8.v7x512;
+  kp2 = &k2.x8.v7x512;
+  ip = &m1.x4.v3x512;
+  // Low order 2048-bits of k1/k2
+  jp1 = &k1.x8.v3x512;
+  jp2 = &k2.x8.v3x512;
+#endif
+
+  m1.x4.v3x512 = vec512_zeros;
+  m1.x4.v2x512 = vec512_zeros;
+  m1.x4.v1x512 = vec512_zeros;
+  m1.x4.v0x512.vx3 = c_zero;
+  m1.x4.v0x512.vx2 = c_zero;
+  m1.x4.v0x512.vx1 = c_zero;
+  m1.x4.v0x512.vx0 = c_10k;
+  // 10^8 <-
+  mul512_byMN (kp1, ip, ip, 4, 4);
+  // 10^16 <-
+  mul512_byMN (kp2, jp1, jp1, 4, 4);
+  // 10^32 <-
+  mul512_byMN (kp1, jp2, jp2, 4, 4);
+  // 10^64 <-
+  mul512_byMN (kp2, jp1, jp1, 4, 4);
+  // 10^128 <-
+  mul512_byMN (kp1, jp2, jp2, 4, 4);
+  // 10^256 <-
+  mul512_byMN (kp2, jp1, jp1, 4, 4);
+  // 10^512 <-
+  mul512_byMN (kp1, jp2, jp2, 4, 4);
+  // 10^1024 <-
+  mul512_byMN (kp2, jp1, jp1, 4, 4);
+
+  return check_ten1024 ("vec_mul512_byMN:", &k2);
+}
+
+static int
+drive_mul128_byMN (mul128_byMN_t mul128_byMN)
+{
+  __VEC_U_4096x512 k1, k2;
+  __VEC_U_2048x512 m1;
+  vui128_t *kp1, *kp2, *ip, *jp1, *jp2;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  kp1 = (vui128_t *) &k1.x8.v0x512;
+  kp2 = (vui128_t *) &k2.x8.v0x512;
+  ip = (vui128_t *) &m1.x4.v0x512;
+  // Low order 2048-bits of k1/k2
+  jp1 = (vui128_t *) &k1.x8.v0x512;
+  jp2 = (vui128_t *) &k2.x8.v0x512;
+#else
+  kp1 = (vui128_t *) &k1.x8.v7x512;
+  kp2 = (vui128_t *) &k2.x8.v7x512;
+  ip = (vui128_t *) &m1.x4.v3x512;
+  // Low order 2048-bits of k1/k2
+  jp1 = (vui128_t *) &k1.x8.v3x512;
+  jp2 = (vui128_t *) &k2.x8.v3x512;
+#endif
+
+  m1.x4.v3x512 = vec512_zeros;
+  m1.x4.v2x512 = vec512_zeros;
+  m1.x4.v1x512 = vec512_zeros;
+  m1.x4.v0x512.vx3 = c_zero;
+  m1.x4.v0x512.vx2 = c_zero;
+  m1.x4.v0x512.vx1 = c_zero;
+  m1.x4.v0x512.vx0 = c_10k;
+  // 10^8 <-
+  mul128_byMN (kp1, ip, ip, 16, 16);
+  // 10^16 <-
+  mul128_byMN (kp2, jp1, jp1, 16, 16);
+  // 10^32 <-
+  mul128_byMN (kp1, jp2, jp2, 16, 16);
+  // 10^64 <-
+  mul128_byMN (kp2, jp1, jp1, 16, 16);
+  // 10^128 <-
+  mul128_byMN (kp1, jp2, jp2, 16, 16);
+  // 10^256 <-
+  mul128_byMN (kp2, jp1, jp1, 16, 16);
+  // 10^512 <-
+  mul128_byMN (kp1, jp2, jp2, 16, 16);
+  // 10^1024 <-
+  mul128_byMN (kp2, jp1, jp1, 16, 16);
+
+  return check_ten1024 ("vec_mul128_byMN:", &k2);
+}
+
+/* Generate timed_<op>_<VARIANT> for each driver.  */
+#define VEC_PERF_IFUNC_TIMED(NAME, VARIANT) \
+  static int \
+  timed_ ## NAME ## _ ## VARIANT (void) \
+  { \
+    return drive_ ## NAME (vec_ ## NAME ## _ ## VARIANT); \
+  }
+
+#define VEC_PERF_IFUNC_VARIANT(VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul128x128, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul256x256, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul512x128, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (madd512x128a512, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul512x512, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul1024x1024, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul2048x2048, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul128_byMN, VARIANT) \
+  VEC_PERF_IFUNC_TIMED (mul512_byMN, VARIANT)
+
+#ifdef VEC_PERF_IFUNC_PWR7
+VEC_PERF_IFUNC_VARIANT (PWR7)
+#endif
+VEC_PERF_IFUNC_VARIANT (PWR8)
+#ifdef VEC_PERF_IFUNC_PWR9
+VEC_PERF_IFUNC_VARIANT (PWR9)
+#endif
+#ifdef VEC_PERF_IFUNC_PWR10
+VEC_PERF_IFUNC_VARIANT (PWR10)
+#endif
+
+/* Each driver chains 8 calls.  */
+#define VEC_PERF_IFUNC_KERNELS(VARIANT) \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul128x128, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul256x256, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul512x128, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, madd512x128a512, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul512x512, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul1024x1024, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul2048x2048, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul128_byMN, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT), \
+  VEC_PERF_KERNEL_VARIANT (ifunc, mul512_byMN, VARIANT, 8, \
+			   vec_perf_have_ ## VARIANT)
+
+const vec_perf_kernel_t vec_perf_ifunc_kernels[] =
+{
+#ifdef VEC_PERF_IFUNC_PWR7
+  VEC_PERF_IFUNC_KERNELS (PWR7),
+#endif
+  VEC_PERF_IFUNC_KERNELS (PWR8),
+#ifdef VEC_PERF_IFUNC_PWR9
+  VEC_PERF_IFUNC_KERNELS (PWR9),
+#endif
+#ifdef VEC_PERF_IFUNC_PWR10
+  VEC_PERF_IFUNC_KERNELS (PWR10),
+#endif
+  VEC_PERF_KERNEL_END
+};
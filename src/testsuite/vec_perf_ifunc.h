@@ -0,0 +1,32 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_ifunc.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_IFUNC_H_
+#define SRC_TESTSUITE_VEC_PERF_IFUNC_H_
+
+#include <testsuite/vec_perf_harness.h>
+
+/* Kernels timing each platform variant (_PWR7, _PWR8, _PWR9, _PWR10)
+   of the IFUNC exported multiplies. Registered for --variants.  */
+extern const vec_perf_kernel_t vec_perf_ifunc_kernels[];
+
+#endif /* SRC_TESTSUITE_VEC_PERF_IFUNC_H_ */
@@ -0,0 +1,331 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_lat.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_f128_ppc.h>
+#include <pveclib/vec_bcd_ppc.h>
+#include <testsuite/vec_perf_lat.h>
+
+/* The Makefile compiles this file with -DVEC_PERF_LAT_PWR9 or
+   -DVEC_PERF_LAT_PWR10 and the matching -mcpu for the per target
+   archives. The table stays empty if the compiler did not accept
+   that -mcpu.  */
+#if defined (VEC_PERF_LAT_PWR10)
+#define VEC_PERF_LAT_TABLE vec_perf_lat_kernels_PWR10
+#define VEC_PERF_LAT_AVAIL vec_perf_lat_have_PWR10
+#ifdef _ARCH_PWR10
+#define VEC_PERF_LAT_VARIANT "PWR10"
+#endif
+#elif defined (VEC_PERF_LAT_PWR9)
+#define VEC_PERF_LAT_TABLE vec_perf_lat_kernels_PWR9
+#define VEC_PERF_LAT_AVAIL vec_perf_lat_have_PWR9
+#if defined (_ARCH_PWR9) && !defined (_ARCH_PWR10)
+#define VEC_PERF_LAT_VARIANT "PWR9"
+#endif
+#else
+#define VEC_PERF_LAT_TABLE vec_perf_lat_kernels
+#define VEC_PERF_LAT_AVAIL NULL
+#if defined (_ARCH_PWR10)
+#define VEC_PERF_LAT_VARIANT "PWR10"
+#elif defined (_ARCH_PWR9)
+#define VEC_PERF_LAT_VARIANT "PWR9"
+#elif defined (_ARCH_PWR8)
+#define VEC_PERF_LAT_VARIANT "PWR8"
+#else
+#define VEC_PERF_LAT_VARIANT "PWR7"
+#endif
+#endif
+
+#ifdef VEC_PERF_LAT_VARIANT
+/* Operations per kernel call, in both modes.  */
+#define VEC_PERF_LAT_N 256
+/* Independent chains in throughput mode. Enough to cover the
+   latency x issue width of the vector units of POWER8-10 for most
+   operations, while x, s and c for all chains still fit in the
+   32 VRs.  */
+#define VEC_PERF_LAT_STREAMS 8
+
+/* Hide a value from the compiler so that constant inputs are not
+   folded and independent chains with the same input are not
+   merged.  */
+#define VEC_PERF_LAT_HIDE(X) __asm__ __volatile__ ("" : "+v" (X))
+/* Keep a result alive without storing it.  */
+#define VEC_PERF_LAT_USE(X) __asm__ __volatile__ ("" : : "v" (X))
+
+#ifdef VEC_PERF_LAT_PWR9
+static int
+vec_perf_lat_have_PWR9 (void)
+{
+#if defined (__BUILTIN_CPU_SUPPORTS__)
+  return __builtin_cpu_supports ("arch_3_00");
+#else
+  return 0;
+#endif
+}
+#endif
+
+#ifdef VEC_PERF_LAT_PWR10
+static int
+vec_perf_lat_have_PWR10 (void)
+{
+#if defined (__BUILTIN_CPU_SUPPORTS__)
+  return __builtin_cpu_supports ("arch_3_1");
+#else
+  return 0;
+#endif
+}
+#endif
+
+/* Steps for operations that do not map x, c directly to the next x.
+   A second result is folded into s, which is off the critical path
+   but keeps the compiler from dropping that part of the operation.
+   Operations whose result decays (quotients) fold the loop invariant
+   operand c back in; the VXOR is included in the time per op.  */
+static inline vui128_t
+lat_xor128 (vui128_t a, vui128_t b)
+{
+  return (vui128_t) vec_xor ((vui32_t) a, (vui32_t) b);
+}
+
+static inline vui128_t
+lat_muludq (vui128_t x, vui128_t c, vui128_t *s)
+{
+  vui128_t h, l;
+
+  l = vec_muludq (&h, x, c);
+  *s = lat_xor128 (*s, h);
+  return l;
+}
+
+static inline vui128_t
+lat_madduq (vui128_t x, vui128_t c, vui128_t *s)
+{
+  vui128_t h, l;
+
+  l = vec_madduq (&h, x, c, *s);
+  *s = lat_xor128 (*s, h);
+  return l;
+}
+
+static inline vui128_t
+lat_addcuq (vui128_t x, vui128_t c, vui128_t *s)
+{
+  *s = lat_xor128 (*s, vec_addcuq (x, c));
+  return vec_adduqm (x, c);
+}
+
+static inline vui128_t
+lat_divuq_10e31 (vui128_t x, vui128_t c)
+{
+  return lat_xor128 (vec_divuq_10e31 (x), c);
+}
+
+static inline vui128_t
+lat_divuq_10e32 (vui128_t x, vui128_t c)
+{
+  return lat_xor128 (vec_divuq_10e32 (x), c);
+}
+
+static inline vui128_t
+lat_moduq_10e31 (vui128_t x, vui128_t c)
+{
+  vui128_t q = vec_divuq_10e31 (x);
+
+  return lat_xor128 (vec_moduq_10e31 (x, q), c);
+}
+
+/* The timed operations, one line per op.
+   X (NAME, TYPE, INIT, OPND, EXPR)
+   The kernels start each chain from INIT and compute the next x as
+   EXPR of x, the loop invariant c (initialized to OPND) and the
+   second result accumulator s (TYPE *). NAME must be unique; it is
+   the kernel name reported.  */
+#define VEC_PERF_LAT_OPS_I128(X) \
+  X (vec_addudm, vui64_t, CONST_VINT128_DW (1, 2), \
+     CONST_VINT128_DW (3, 5), vec_addudm (x, c)) \
+  X (vec_muludm, vui64_t, CONST_VINT128_DW (7, 11), \
+     CONST_VINT128_DW (13, 17), vec_muludm (x, c)) \
+  X (vec_mulhud, vui64_t, CONST_VINT128_DW (-7, -11), \
+     CONST_VINT128_DW (-1, -1), vec_mulhud (x, c)) \
+  X (vec_vmuloud, vui64_t, CONST_VINT128_DW (7, 11), \
+     CONST_VINT128_DW (13, 17), (vui64_t) vec_vmuloud (x, c)) \
+  X (vec_clzd, vui64_t, CONST_VINT128_DW (1, 2), \
+     CONST_VINT128_DW (0, 0), vec_clzd (x)) \
+  X (vec_popcntd, vui64_t, CONST_VINT128_DW (-1, 2), \
+     CONST_VINT128_DW (0, 0), vec_popcntd (x)) \
+  X (vec_adduqm, vui128_t, (vui128_t) CONST_VINT128_DW (0, 1), \
+     (vui128_t) CONST_VINT128_DW (0, 3), vec_adduqm (x, c)) \
+  X (vec_addcuq, vui128_t, (vui128_t) CONST_VINT128_DW (-1, 1), \
+     (vui128_t) CONST_VINT128_DW (0, 3), lat_addcuq (x, c, s)) \
+  X (vec_mulluq, vui128_t, (vui128_t) CONST_VINT128_DW (7, 11), \
+     (vui128_t) CONST_VINT128_DW (13, 17), vec_mulluq (x, c)) \
+  X (vec_mulhuq, vui128_t, (vui128_t) CONST_VINT128_DW (-7, -11), \
+     (vui128_t) CONST_VINT128_DW (-1, -1), vec_mulhuq (x, c)) \
+  X (vec_muludq, vui128_t, (vui128_t) CONST_VINT128_DW (7, 11), \
+     (vui128_t) CONST_VINT128_DW (13, 17), lat_muludq (x, c, s)) \
+  X (vec_madduq, vui128_t, (vui128_t) CONST_VINT128_DW (7, 11), \
+     (vui128_t) CONST_VINT128_DW (13, 17), lat_madduq (x, c, s)) \
+  X (vec_mul10uq, vui128_t, (vui128_t) CONST_VINT128_DW (0, 1), \
+     (vui128_t) CONST_VINT128_DW (0, 0), vec_mul10uq (x)) \
+  X (vec_divuq_10e31, vui128_t, (vui128_t) CONST_VINT128_DW (-1, -1), \
+     (vui128_t) CONST_VINT128_DW (-1, -1), lat_divuq_10e31 (x, c)) \
+  X (vec_divuq_10e32, vui128_t, (vui128_t) CONST_VINT128_DW (-1, -1), \
+     (vui128_t) CONST_VINT128_DW (-1, -1), lat_divuq_10e32 (x, c)) \
+  X (vec_moduq_10e31, vui128_t, (vui128_t) CONST_VINT128_DW (-1, -1), \
+     (vui128_t) CONST_VINT128_DW (-1, -1), lat_moduq_10e31 (x, c)) \
+  X (vec_clzq, vui128_t, (vui128_t) CONST_VINT128_DW (0, 1), \
+     (vui128_t) CONST_VINT128_DW (0, 0), vec_clzq (x)) \
+  X (vec_popcntq, vui128_t, (vui128_t) CONST_VINT128_DW (-1, 1), \
+     (vui128_t) CONST_VINT128_DW (0, 0), vec_popcntq (x)) \
+  X (vec_rlq, vui128_t, (vui128_t) CONST_VINT128_DW (1, 2), \
+     (vui128_t) CONST_VINT128_DW (0, 13), vec_rlq (x, c)) \
+  X (vec_srqi, vui128_t, (vui128_t) CONST_VINT128_DW (-1, -1), \
+     (vui128_t) CONST_VINT128_DW (0, 0), vec_srqi (x, 13))
+
+#define VEC_PERF_LAT_OPS_BCD(X) \
+  X (vec_bcdadd, vBCD_t, CONST_VINT128_W (0x01234567, 0x89012345, \
+					   0x67890123, 0x4567890c), \
+     CONST_VINT128_W (0, 0, 0, 0x1c), vec_bcdadd (x, c)) \
+  X (vec_bcdsub, vBCD_t, CONST_VINT128_W (0x01234567, 0x89012345, \
+					   0x67890123, 0x4567890c), \
+     CONST_VINT128_W (0, 0, 0, 0x1c), vec_bcdsub (x, c)) \
+  X (vec_bcdmul, vBCD_t, CONST_VINT128_W (0x01234567, 0x89012345, \
+					   0x67890123, 0x4567890c), \
+     CONST_VINT128_W (0, 0, 0, 0x1c), vec_bcdmul (x, c)) \
+  X (vec_bcddiv, vBCD_t, CONST_VINT128_W (0x01234567, 0x89012345, \
+					   0x67890123, 0x4567890c), \
+     CONST_VINT128_W (0, 0, 0, 0x1c), vec_bcddiv (x, c)) \
+  X (vec_bcdmul_rdx, vBCD_t, CONST_VINT128_W (0x01234567, 0x89012345, \
+					       0x67890123, 0x4567890c), \
+     CONST_VINT128_W (0, 0, 0, 0x1c), vec_bcdmul_rdx (x, c)) \
+  X (vec_bcddiv_rdx, vBCD_t, CONST_VINT128_W (0x01234567, 0x89012345, \
+					       0x67890123, 0x4567890c), \
+     CONST_VINT128_W (0, 0, 0, 0x1c), vec_bcddiv_rdx (x, c)) \
+  X (vec_bcdcfuq_ctuq, vui128_t, (vui128_t) CONST_VINT128_DW (0, 12345), \
+     (vui128_t) CONST_VINT128_DW (0, 0), \
+     vec_bcdctuq (vec_bcdcfuq (x))) \
+  X (vec_bcdcfuq_ctuq_rdx, vui128_t, (vui128_t) CONST_VINT128_DW (0, 12345), \
+     (vui128_t) CONST_VINT128_DW (0, 0), \
+     vec_bcdctuq_rdx (vec_bcdcfuq_rdx (x)))
+
+#if defined (__FLOAT128__) && !defined (PVECLIB_DISABLE_F128ARITH)
+#define VEC_PERF_LAT_OPS_F128(X) \
+  X (vec_xsaddqpo, __binary128, 1.5Q, 0.0Q, vec_xsaddqpo (x, c)) \
+  X (vec_xssubqpo, __binary128, 1.5Q, 0.0Q, vec_xssubqpo (x, c)) \
+  X (vec_xsmulqpo, __binary128, 1.5Q, 1.0Q, vec_xsmulqpo (x, c))
+#else
+#define VEC_PERF_LAT_OPS_F128(X)
+#endif
+
+#define VEC_PERF_LAT_OPS(X) \
+  VEC_PERF_LAT_OPS_I128 (X) \
+  VEC_PERF_LAT_OPS_BCD (X) \
+  VEC_PERF_LAT_OPS_F128 (X)
+
+/* Generate lat_op_NAME, timed_lat_NAME (one chain of
+   VEC_PERF_LAT_N dependent ops) and timed_tput_NAME
+   (VEC_PERF_LAT_STREAMS chains of VEC_PERF_LAT_N / STREAMS ops).
+   The throughput kernel reports a failure if the first and last
+   chain, which start from the same value, disagree.  */
+#define VEC_PERF_LAT_GEN(NAME, TYPE, INIT, OPND, EXPR) \
+  static inline TYPE __attribute__ ((always_inline)) \
+  lat_op_ ## NAME (TYPE x, TYPE c, TYPE *s) \
+  { \
+    (void) c; \
+    (void) s; \
+    return EXPR; \
+  } \
+  \
+  static int \
+  timed_lat_ ## NAME (void) \
+  { \
+    TYPE x = INIT, s = INIT, c = OPND; \
+    int i; \
+    \
+    VEC_PERF_LAT_HIDE (x); \
+    VEC_PERF_LAT_HIDE (c); \
+    for (i = 0; i < VEC_PERF_LAT_N; i++) \
+      x = lat_op_ ## NAME (x, c, &s); \
+    VEC_PERF_LAT_USE (x); \
+    VEC_PERF_LAT_USE (s); \
+    return 0; \
+  } \
+  \
+  static int \
+  timed_tput_ ## NAME (void) \
+  { \
+    TYPE x0 = INIT, x1 = INIT, x2 = INIT, x3 = INIT; \
+    TYPE x4 = INIT, x5 = INIT, x6 = INIT, x7 = INIT; \
+    TYPE s0 = INIT, s1 = INIT, s2 = INIT, s3 = INIT; \
+    TYPE s4 = INIT, s5 = INIT, s6 = INIT, s7 = INIT; \
+    TYPE c = OPND; \
+    int i; \
+    \
+    VEC_PERF_LAT_HIDE (x0); VEC_PERF_LAT_HIDE (x1); \
+    VEC_PERF_LAT_HIDE (x2); VEC_PERF_LAT_HIDE (x3); \
+    VEC_PERF_LAT_HIDE (x4); VEC_PERF_LAT_HIDE (x5); \
+    VEC_PERF_LAT_HIDE (x6); VEC_PERF_LAT_HIDE (x7); \
+    VEC_PERF_LAT_HIDE (c); \
+    for (i = 0; i < VEC_PERF_LAT_N / VEC_PERF_LAT_STREAMS; i++) \
+      { \
+	x0 = lat_op_ ## NAME (x0, c, &s0); \
+	x1 = lat_op_ ## NAME (x1, c, &s1); \
+	x2 = lat_op_ ## NAME (x2, c, &s2); \
+	x3 = lat_op_ ## NAME (x3, c, &s3); \
+	x4 = lat_op_ ## NAME (x4, c, &s4); \
+	x5 = lat_op_ ## NAME (x5, c, &s5); \
+	x6 = lat_op_ ## NAME (x6, c, &s6); \
+	x7 = lat_op_ ## NAME (x7, c, &s7); \
+      } \
+    VEC_PERF_LAT_USE (x1); VEC_PERF_LAT_USE (x2); \
+    VEC_PERF_LAT_USE (x3); VEC_PERF_LAT_USE (x4); \
+    VEC_PERF_LAT_USE (x5); VEC_PERF_LAT_USE (x6); \
+    VEC_PERF_LAT_USE (s0); VEC_PERF_LAT_USE (s1); \
+    VEC_PERF_LAT_USE (s2); VEC_PERF_LAT_USE (s3); \
+    VEC_PERF_LAT_USE (s4); VEC_PERF_LAT_USE (s5); \
+    VEC_PERF_LAT_USE (s6); VEC_PERF_LAT_USE (s7); \
+    return (memcmp (&x0, &x7, sizeof (TYPE)) != 0); \
+  }
+
+VEC_PERF_LAT_OPS (VEC_PERF_LAT_GEN)
+
+#define VEC_PERF_LAT_ENTRIES(NAME, TYPE, INIT, OPND, EXPR) \
+  { VEC_PERF_GROUP_LAT, #NAME, VEC_PERF_LAT_N, NULL, timed_lat_ ## NAME, \
+    VEC_PERF_LAT_VARIANT, VEC_PERF_LAT_AVAIL }, \
+  { VEC_PERF_GROUP_TPUT, #NAME, VEC_PERF_LAT_N, NULL, \
+    timed_tput_ ## NAME, VEC_PERF_LAT_VARIANT, VEC_PERF_LAT_AVAIL },
+
+const vec_perf_kernel_t VEC_PERF_LAT_TABLE[] =
+{
+  VEC_PERF_LAT_OPS (VEC_PERF_LAT_ENTRIES)
+  VEC_PERF_KERNEL_END
+};
+#else
+const vec_perf_kernel_t VEC_PERF_LAT_TABLE[] =
+{
+  VEC_PERF_KERNEL_END
+};
+#endif /* VEC_PERF_LAT_VARIANT */
@@ -0,0 +1,41 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_lat.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_LAT_H_
+#define SRC_TESTSUITE_VEC_PERF_LAT_H_
+
+#include <testsuite/vec_perf_harness.h>
+
+/* Latency and reciprocal throughput kernels for the inline
+   operations, registered for --latency. Each operation is timed
+   twice: group "lat" runs one dependent chain and group "tput" runs
+   VEC_PERF_LAT_STREAMS independent chains.
+
+   vec_perf_lat.c is compiled once with the default CFLAGS and again
+   for each -mcpu target (libvecperfPWR9.a, libvecperfPWR10.a). The
+   variant of each kernel names the target it was compiled for. A
+   table is empty if the compiler does not support its target.  */
+extern const vec_perf_kernel_t vec_perf_lat_kernels[];
+extern const vec_perf_kernel_t vec_perf_lat_kernels_PWR9[];
+extern const vec_perf_kernel_t vec_perf_lat_kernels_PWR10[];
+
+#endif /* SRC_TESTSUITE_VEC_PERF_LAT_H_ */
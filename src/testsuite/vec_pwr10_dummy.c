@@ -63,6 +63,24 @@ __test_splatudi_12_PWR10_v0 (void)
   return vec_splats ((unsigned long long) 12);
 }
 
+vf32_t
+test_vec_xvcvbf16spn_PWR10 (vui32_t bf16)
+{
+  return vec_xvcvbf16spn (bf16);
+}
+
+vui32_t
+test_vec_xvcvspbf16_PWR10 (vf32_t f32)
+{
+  return vec_xvcvspbf16 (f32);
+}
+
+vui16_t
+test_vec_pack_bf16_PWR10 (vf32_t a, vf32_t b)
+{
+  return vec_pack_bf16 (a, b);
+}
+
 #if defined (_ARCH_PWR10) && (__GNUC__ > 11) \
     || ((__GNUC__ == 11) && (__GNUC_MINOR__ > 3))
 // New support defined in Power Vector Intrinsic Programming Reference.
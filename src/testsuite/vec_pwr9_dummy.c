@@ -871,6 +871,24 @@ test_vec_xvxsigsp_PWR9 (vf32_t f32)
   return vec_xvxsigsp (f32);
 }
 
+vf32_t
+test_vec_xvcvhpsp_PWR9 (vui32_t f16)
+{
+  return vec_xvcvhpsp (f16);
+}
+
+vui32_t
+test_vec_xvcvsphp_PWR9 (vf32_t f32)
+{
+  return vec_xvcvsphp (f32);
+}
+
+vui16_t
+test_vec_pack_f16_PWR9 (vf32_t a, vf32_t b)
+{
+  return vec_pack_f16 (a, b);
+}
+
 vf64_t
 test_vec_xviexpdp_PWR9 (vui64_t sig, vui64_t exp)
 {
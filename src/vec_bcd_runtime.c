@@ -0,0 +1,2956 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_bcd_runtime.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/* Out-of-line, platform suffixed (__VEC_PWR_IMP) implementations of
+   the heavier vec_bcd_ppc.h operations. Included by
+   vec_runtime_PWR7/8/9/10.c. The conversions go through the DFP unit
+   on POWER7/8, POWER9/10 use the BCD and quadword integer
+   instructions.
+
+   The multiplies select the binary (_rdx) implementations for POWER8
+   and later. These are vector integer code and pipeline, the DFP
+   multiply does not, so they win for any batch of operations.
+   POWER7 lacks the doubleword multiply and stays with DFP.
+   The binary divide needs the POWER10 vdivuq instruction to beat the
+   DFP divide.
+
+   The N quadword (_byN) operations work on the magnitudes and apply
+   the sign at the end. The multiply block products follow the
+   multiply selection above.
+
+   The record (vec_bcdrec_) conversions read each field with aligned
+   quadword loads and vec_perm, so they never load past the quadword
+   holding the last byte of the field.
+
+   The binary floating point to/from _Decimal128 conversions use the
+   exact decpowof2[] or double powers of ten when one multiply or
+   divide gives the correctly rounded result. Other values build the
+   exact integer with the N quadword scale by 10**k operations and
+   round once at the end.
+
+   The binary128 string conversions share that exact path as the
+   fallback of the parser. The double and float formatters work on
+   lane pairs.
+
+   The _Decimal128/_Decimal64 batch sum, dot product and scale select
+   the binary path for POWER8 and later, decoding the DPD in software
+   and accumulating exact N quadword sums so the DFP unit only rounds
+   the final result. POWER7 uses the DFP unit for each step.  */
+
+#include <string.h>
+#include <pveclib/vec_bcd_ppc.h>
+#include <pveclib/vec_int512_ppc.h>
+
+#ifndef PVECLIB_DISABLE_DFP
+vBCD_t
+__VEC_PWR_IMP (vec_bcdmul) (vBCD_t a, vBCD_t b)
+{
+#ifdef _ARCH_PWR8
+  return vec_bcdmul_rdx (a, b);
+#else
+  return vec_bcdmul (a, b);
+#endif
+}
+
+vBCD_t
+__VEC_PWR_IMP (vec_bcdmulh) (vBCD_t a, vBCD_t b)
+{
+#ifdef _ARCH_PWR8
+  return vec_bcdmulh_rdx (a, b);
+#else
+  return vec_bcdmulh (a, b);
+#endif
+}
+
+vBCD_t
+__VEC_PWR_IMP (vec_bcddiv) (vBCD_t a, vBCD_t b)
+{
+#ifdef _ARCH_PWR10
+  return vec_bcddiv_rdx (a, b);
+#else
+  return vec_bcddiv (a, b);
+#endif
+}
+
+vBCD_t
+__VEC_PWR_IMP (vec_bcddive) (vBCD_t a, vBCD_t b)
+{
+#ifdef _ARCH_PWR10
+  return vec_bcddive_rdx (a, b);
+#else
+  return vec_bcddive (a, b);
+#endif
+}
+
+vBCD_t
+__VEC_PWR_IMP (vec_bcdcfsq) (vi128_t vrb)
+{
+  return vec_bcdcfsq (vrb);
+}
+
+vBCD_t
+__VEC_PWR_IMP (vec_bcdcfuq) (vui128_t vra)
+{
+  return vec_bcdcfuq (vra);
+}
+
+vi128_t
+__VEC_PWR_IMP (vec_bcdctsq) (vBCD_t vra)
+{
+  return vec_bcdctsq (vra);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_bcdctuq) (vBCD_t vra)
+{
+  return vec_bcdctuq (vra);
+}
+
+/* Return nonzero if the N quadword value is negative. Zero elements
+   may have either sign and are skipped.  */
+static int
+__VEC_PWR_IMP (vec_bcdsignbit_byN_static) (vBCD_t *a, unsigned long N)
+{
+  const vui32_t sign_mask = (vui32_t) _BCD_CONST_SIGN_MASK;
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t t;
+  unsigned long i;
+
+  for (i = 0; i < N; i++)
+    {
+      t = (vui128_t) vec_andc ((vui32_t) a[i], sign_mask);
+      if (vec_cmpuq_all_ne (t, zero))
+	return (vec_signbit_bcdsq (a[i]) != 0);
+    }
+  return 0;
+}
+
+/* Set the sign of all N elements of r. Zero is always positive.  */
+static void
+__VEC_PWR_IMP (vec_bcdsetsgn_byN_static) (vBCD_t *r, int neg,
+					  unsigned long N)
+{
+  const vui32_t sign_mask = (vui32_t) _BCD_CONST_SIGN_MASK;
+  const vui32_t zero = vec_splat_u32 (0);
+  vui32_t nz = zero;
+  vBCD_t sgn = _BCD_CONST_ZERO;
+  unsigned long i;
+
+  if (neg)
+    {
+      for (i = 0; i < N; i++)
+	nz = vec_or (nz, vec_andc ((vui32_t) r[i], sign_mask));
+      if (!vec_all_eq (nz, zero))
+	sgn = _BCD_CONST_MINUS_ONE;
+    }
+  for (i = 0; i < N; i++)
+    r[i] = vec_bcdcpsgn (r[i], sgn);
+}
+
+/* Compare the magnitudes, ignoring the signs. With the sign nibble
+   cleared the BCD digits compare as unsigned quadwords.  */
+static int
+__VEC_PWR_IMP (vec_bcdcmpmag_byN_static) (vBCD_t *a, vBCD_t *b,
+					  unsigned long N)
+{
+  const vui32_t sign_mask = (vui32_t) _BCD_CONST_SIGN_MASK;
+  vui128_t ma, mb;
+  unsigned long i;
+
+  for (i = 0; i < N; i++)
+    {
+      ma = (vui128_t) vec_andc ((vui32_t) a[i], sign_mask);
+      mb = (vui128_t) vec_andc ((vui32_t) b[i], sign_mask);
+      if (vec_cmpuq_all_gt (ma, mb))
+	return 1;
+      if (vec_cmpuq_all_lt (ma, mb))
+	return -1;
+    }
+  return 0;
+}
+
+/* r = |a| + |b| (sb positive) or |a| - |b| (sb negative) with
+   |a| >= |b|, from the low order quadword up. Returns the
+   carry out (+0 or +1).  */
+static vBCD_t
+__VEC_PWR_IMP (vec_bcdaddmag_byN_static) (vBCD_t *r, vBCD_t *a, vBCD_t *b,
+					  vBCD_t sb, unsigned long N)
+{
+  vBCD_t c = _BCD_CONST_ZERO;
+  vBCD_t ma, mb;
+  long i;
+
+  for (i = (long) N - 1; i >= 0; i--)
+    {
+      ma = vec_bcdcpsgn (a[i], _BCD_CONST_ZERO);
+      mb = vec_bcdcpsgn (b[i], sb);
+      r[i] = vec_cbcdaddecsq (&c, ma, mb, c);
+    }
+  return c;
+}
+
+static vBCD_t
+__VEC_PWR_IMP (vec_bcdaddsub_byN_static) (vBCD_t *r, vBCD_t *a, vBCD_t *b,
+					  int subtract, unsigned long N)
+{
+  vBCD_t c = _BCD_CONST_ZERO;
+  int na, nb, neg;
+
+  na = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (a, N);
+  nb = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (b, N);
+  if (subtract)
+    nb = !nb;
+
+  if (na == nb)
+    {
+      c = __VEC_PWR_IMP (vec_bcdaddmag_byN_static) (r, a, b,
+						    _BCD_CONST_ZERO, N);
+      neg = na;
+    }
+  else if (__VEC_PWR_IMP (vec_bcdcmpmag_byN_static) (a, b, N) >= 0)
+    {
+      __VEC_PWR_IMP (vec_bcdaddmag_byN_static) (r, a, b,
+						_BCD_CONST_MINUS_ONE, N);
+      neg = na;
+    }
+  else
+    {
+      __VEC_PWR_IMP (vec_bcdaddmag_byN_static) (r, b, a,
+						_BCD_CONST_MINUS_ONE, N);
+      neg = nb;
+    }
+
+  __VEC_PWR_IMP (vec_bcdsetsgn_byN_static) (r, neg, N);
+  if (neg)
+    c = vec_bcdsub (_BCD_CONST_ZERO, c);
+  return c;
+}
+
+vBCD_t
+__VEC_PWR_IMP (vec_bcdadd_byN) (vBCD_t *r, vBCD_t *a, vBCD_t *b,
+				unsigned long N)
+{
+  return __VEC_PWR_IMP (vec_bcdaddsub_byN_static) (r, a, b, 0, N);
+}
+
+vBCD_t
+__VEC_PWR_IMP (vec_bcdsub_byN) (vBCD_t *r, vBCD_t *a, vBCD_t *b,
+				unsigned long N)
+{
+  return __VEC_PWR_IMP (vec_bcdaddsub_byN_static) (r, a, b, 1, N);
+}
+
+int
+__VEC_PWR_IMP (vec_bcdcmp_byN) (vBCD_t *a, vBCD_t *b, unsigned long N)
+{
+  int na, nb, cm;
+
+  na = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (a, N);
+  nb = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (b, N);
+  if (na != nb)
+    return na ? -1 : 1;
+
+  cm = __VEC_PWR_IMP (vec_bcdcmpmag_byN_static) (a, b, N);
+  return na ? -cm : cm;
+}
+
+/* 62 digit product of two positive 31 digit blocks.  */
+static inline vBCD_t
+__VEC_PWR_IMP (vec_bcdmulblk_static) (vBCD_t *p_high, vBCD_t a, vBCD_t b)
+{
+#ifdef _ARCH_PWR8
+  vui128_t ua, ub, ph, pl, qh, ql, r;
+  vBCD_t th, tl;
+
+  ua = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) a, 4));
+  ub = vec_bcdctuq_rdx ((vBCD_t) vec_srqi ((vui128_t) b, 4));
+  pl = vec_muludq (&ph, ua, ub);
+  ql = vec_divudq_10e31 (&qh, ph, pl);
+  r = vec_modudq_10e31 (ph, pl, &ql);
+  // The product is < 10**62 so the quotient is < 10**31.
+  th = (vBCD_t) vec_slqi ((vui128_t) vec_bcdcfuq_rdx (ql), 4);
+  tl = (vBCD_t) vec_slqi ((vui128_t) vec_bcdcfuq_rdx (r), 4);
+  *p_high = vec_bcdcpsgn (th, _BCD_CONST_ZERO);
+  return vec_bcdcpsgn (tl, _BCD_CONST_ZERO);
+#else
+  return vec_cbcdmul (p_high, a, b);
+#endif
+}
+
+void
+__VEC_PWR_IMP (vec_bcdmul_byMN) (vBCD_t *p, vBCD_t *m1, vBCD_t *m2,
+				 unsigned long M, unsigned long N)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vBCD_t a, b, pl, ph, c, c1, c2, t;
+  long i, j;
+  int neg;
+
+  neg = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (m1, M)
+      ^ __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (m2, N);
+
+  for (i = 0; i < (long) (M + N); i++)
+    p[i] = _BCD_CONST_ZERO;
+
+  // Row j adds m1 * m2[j] into p[j, j+M].
+  for (j = (long) N - 1; j >= 0; j--)
+    {
+      b = vec_bcdcpsgn (m2[j], _BCD_CONST_ZERO);
+      if (vec_cmpuq_all_eq ((vui128_t) vec_srqi ((vui128_t) b, 4), zero))
+	continue;
+      c = _BCD_CONST_ZERO;
+      for (i = (long) M - 1; i >= 0; i--)
+	{
+	  a = vec_bcdcpsgn (m1[i], _BCD_CONST_ZERO);
+	  pl = __VEC_PWR_IMP (vec_bcdmulblk_static) (&ph, a, b);
+	  t = vec_cbcdaddcsq (&c1, p[i + j + 1], pl);
+	  p[i + j + 1] = vec_cbcdaddcsq (&c2, t, c);
+	  // ph <= 10**31 - 2, so the carry to the next block fits.
+	  c = vec_bcdaddesqm (ph, c1, c2);
+	}
+      p[j] = c;
+    }
+
+  __VEC_PWR_IMP (vec_bcdsetsgn_byN_static) (p, neg, M + N);
+}
+
+void
+__VEC_PWR_IMP (vec_bcdsl_byN) (vBCD_t *r, vBCD_t *a, unsigned int k,
+			       unsigned long N)
+{
+  const vui32_t sign_mask = (vui32_t) _BCD_CONST_SIGN_MASK;
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  const long q = k / 31;
+  const unsigned int s = k % 31;
+  const vui128_t shl = (vui128_t) vec_splats ((unsigned char) (s * 4));
+  const vui128_t shr = (vui128_t) vec_splats ((unsigned char) ((31 - s) * 4));
+  vui128_t hi, lo, t;
+  long i;
+  int neg;
+
+  neg = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (a, N);
+
+  // Sources are at or below r[i] in significance, so go high to low.
+  for (i = 0; i < (long) N; i++)
+    {
+      hi = zero;
+      lo = zero;
+      if ((i + q) < (long) N)
+	hi = (vui128_t) vec_andc ((vui32_t) a[i + q], sign_mask);
+      if ((i + q + 1) < (long) N)
+	lo = (vui128_t) vec_andc ((vui32_t) a[i + q + 1], sign_mask);
+      t = hi;
+      if (s != 0)
+	{
+	  // The high s digits of lo fill the low s digits.
+	  lo = (vui128_t) vec_andc ((vui32_t) vec_srq (lo, shr), sign_mask);
+	  t = (vui128_t) vec_or ((vui32_t) vec_slq (hi, shl), (vui32_t) lo);
+	}
+      r[i] = (vBCD_t) t;
+    }
+
+  __VEC_PWR_IMP (vec_bcdsetsgn_byN_static) (r, neg, N);
+}
+
+/* Shift the magnitude right k digits, positive result. Returns +1 if
+   the last digit shifted out is 5 or more, else +0.  */
+static vBCD_t
+__VEC_PWR_IMP (vec_bcdsr_byN_static) (vBCD_t *r, vBCD_t *a, unsigned int k,
+				      unsigned long N)
+{
+  const vui32_t sign_mask = (vui32_t) _BCD_CONST_SIGN_MASK;
+  const vui32_t rnd6 = CONST_VINT128_W (0, 0, 0, (5 + 6));
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  const long q = k / 31;
+  const unsigned int s = k % 31;
+  const vui128_t shr = (vui128_t) vec_splats ((unsigned char) (s * 4));
+  const vui128_t shl = (vui128_t) vec_splats ((unsigned char) ((31 - s) * 4));
+  vBCD_t rnd = _BCD_CONST_ZERO;
+  vui128_t hi, lo, t;
+  vui32_t r_d;
+  long i;
+
+  // Extract the last digit shifted out before r (maybe a) is written.
+  if (k > 0 && ((k - 1) / 31) < N)
+    {
+      unsigned int d = k - 1;
+      vui128_t shd = (vui128_t) vec_splats ((unsigned char) (((d % 31) + 1)
+							     * 4));
+      t = vec_srq ((vui128_t) a[N - 1 - (d / 31)], shd);
+      r_d = vec_and ((vui32_t) t, sign_mask);
+      // Add decimal 6's +5 to carry a digit >= 5 into a BCD 1.
+      r_d = vec_add (r_d, rnd6);
+      rnd = vec_bcdcpsgn ((vBCD_t) r_d, _BCD_CONST_ZERO);
+    }
+
+  // Sources are at or above r[i] in significance, so go low to high.
+  for (i = (long) N - 1; i >= 0; i--)
+    {
+      hi = zero;
+      lo = zero;
+      if ((i - q) >= 0)
+	lo = (vui128_t) vec_andc ((vui32_t) a[i - q], sign_mask);
+      if ((i - q - 1) >= 0)
+	hi = (vui128_t) vec_andc ((vui32_t) a[i - q - 1], sign_mask);
+      t = lo;
+      if (s != 0)
+	{
+	  // The low s digits of hi fill the high s digits.
+	  lo = (vui128_t) vec_andc ((vui32_t) vec_srq (lo, shr), sign_mask);
+	  t = (vui128_t) vec_or ((vui32_t) vec_slq (hi, shl), (vui32_t) lo);
+	}
+      r[i] = vec_bcdcpsgn ((vBCD_t) t, _BCD_CONST_ZERO);
+    }
+  return rnd;
+}
+
+void
+__VEC_PWR_IMP (vec_bcdsr_byN) (vBCD_t *r, vBCD_t *a, unsigned int k,
+			       unsigned long N)
+{
+  int neg;
+
+  neg = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (a, N);
+  __VEC_PWR_IMP (vec_bcdsr_byN_static) (r, a, k, N);
+  __VEC_PWR_IMP (vec_bcdsetsgn_byN_static) (r, neg, N);
+}
+
+void
+__VEC_PWR_IMP (vec_bcdsrr_byN) (vBCD_t *r, vBCD_t *a, unsigned int k,
+				unsigned long N)
+{
+  vBCD_t c;
+  long i;
+  int neg;
+
+  neg = __VEC_PWR_IMP (vec_bcdsignbit_byN_static) (a, N);
+  c = __VEC_PWR_IMP (vec_bcdsr_byN_static) (r, a, k, N);
+  // Propagate the round increment. After a shift of 1 or more
+  // digits this can not carry out of r[0].
+  for (i = (long) N - 1; i >= 0; i--)
+    r[i] = vec_cbcdaddcsq (&c, r[i], c);
+  __VEC_PWR_IMP (vec_bcdsetsgn_byN_static) (r, neg, N);
+}
+
+/* Load len (1-16) bytes at p as a quadword, right justified (the
+   last byte is the low order byte) and zero extended.  */
+static inline vui8_t
+__VEC_PWR_IMP (vec_bcdrec_ld_static) (const unsigned char *p,
+				      unsigned int len)
+{
+  const vui8_t iota = { 0, 1, 2, 3, 4, 5, 6, 7,
+			8, 9, 10, 11, 12, 13, 14, 15 };
+  const vui8_t zero = vec_splat_u8 (0);
+  const unsigned int off = (unsigned long) p & 15;
+  vui8_t q0, q1, sel;
+  vb8_t valid;
+
+  // Aligned loads, only touch the next quadword if the field
+  // crosses into it.
+  q0 = vec_ld (0, p);
+  q1 = q0;
+  if ((off + len) > 16)
+    q1 = vec_ld (16, p);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  sel = vec_sub (vec_splats ((unsigned char) (off + len - 1)), iota);
+  valid = vec_cmplt (iota, vec_splats ((unsigned char) len));
+#else
+  sel = vec_add (iota, vec_splats ((unsigned char) (off + len - 16)));
+  valid = vec_cmpgt (iota, vec_splats ((unsigned char) (15 - len)));
+#endif
+  return vec_sel (zero, vec_perm (q0, q1, sel), valid);
+}
+
+/* Store the low order len (1-16) bytes of vra at p, high order
+   byte first.  */
+static inline void
+__VEC_PWR_IMP (vec_bcdrec_st_static) (unsigned char *p, unsigned int len,
+				      vui8_t vra)
+{
+  __VEC_U_128 t;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  t.vx1 = vec_revbq ((vui128_t) vra);
+#else
+  t.vx16 = vra;
+#endif
+  memcpy (p, (unsigned char *) &t + (16 - len), len);
+}
+
+/* Convert zoned field of len (1-16) bytes to 16 BCD digits, ignoring
+   the zones and sign.  */
+static inline vui128_t
+__VEC_PWR_IMP (vec_bcdrec_ldz_static) (const unsigned char *p,
+				       unsigned int len)
+{
+  const vui8_t dmask = vec_splat_u8 (15);
+  const vui8_t zone = vec_splats ((unsigned char) 0x30);
+  vui8_t z;
+
+  z = __VEC_PWR_IMP (vec_bcdrec_ld_static) (p, len);
+  // Force ASCII zones (leading zero bytes become '0') for bcdcfz.
+  z = vec_or (vec_and (z, dmask), zone);
+  return vec_srqi ((vui128_t) vec_bcdcfz (z), 4);
+}
+
+/* Load a decimal field as signed BCD with the preferred sign.  */
+static vBCD_t
+__VEC_PWR_IMP (vec_bcdrec_ldfld_static) (const unsigned char *p,
+					 unsigned int len,
+					 vec_bcdrec_fmt_t fmt)
+{
+  unsigned int sign = p[len - 1];
+  vui128_t t;
+  int neg;
+
+  if (fmt == VEC_BCDREC_PACKED)
+    {
+      t = (vui128_t) __VEC_PWR_IMP (vec_bcdrec_ld_static) (p, len);
+      sign &= 0x0f;
+      neg = (sign == 0x0b) || (sign == 0x0d);
+    }
+  else
+    {
+      unsigned int n = (len > 16) ? 16 : len;
+
+      t = __VEC_PWR_IMP (vec_bcdrec_ldz_static) (p + len - n, n);
+      if (len > 16)
+	{
+	  vui128_t h;
+	  // The high (len - 16) digits.
+	  h = __VEC_PWR_IMP (vec_bcdrec_ldz_static) (p, len - 16);
+	  t = vec_mrgald (h, t);
+	}
+      t = vec_slqi (t, 4);
+      sign >>= 4;
+      if (fmt == VEC_BCDREC_ZONED)
+	neg = (sign == 0x0b) || (sign == 0x0d);
+      else
+	neg = (sign & 0x04) != 0;
+    }
+  return vec_bcdcpsgn ((vBCD_t) t,
+		       neg ? _BCD_CONST_MINUS_ONE : _BCD_CONST_PLUS_ONE);
+}
+
+/* Store signed BCD as a decimal field. Return 1 if high order
+   digits were lost.  */
+static int
+__VEC_PWR_IMP (vec_bcdrec_stfld_static) (unsigned char *p,
+					 unsigned int len,
+					 vec_bcdrec_fmt_t fmt, vBCD_t bcd)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t t = zero;
+
+  if (fmt == VEC_BCDREC_PACKED)
+    {
+      __VEC_PWR_IMP (vec_bcdrec_st_static) (p, len, (vui8_t) bcd);
+      if (len < 16)
+	t = vec_srq ((vui128_t) bcd,
+		     (vui128_t) vec_splats ((unsigned char) (len * 8)));
+    }
+  else
+    {
+      const vui8_t dmask = vec_splat_u8 (15);
+      const vui8_t smask = (vui8_t) CONST_VINT128_W (0, 0, 0, 0xf0);
+      const int ascii = (fmt == VEC_BCDREC_ZONED_ASCII);
+      const int neg = (vec_signbit_bcdsq (bcd) != 0);
+      unsigned int n = (len > 16) ? 16 : len;
+      unsigned char zc, sc;
+      vui8_t z, zone;
+
+      zc = ascii ? 0x30 : 0xf0;
+      if (ascii)
+	sc = neg ? 0x70 : 0x30;
+      else
+	sc = neg ? 0xd0 : 0xc0;
+      // Digit zones plus the sign zone in the low order byte.
+      zone = vec_sel (vec_splats (zc), vec_splats (sc), smask);
+      z = vec_or (vec_and (vec_bcdctz (bcd), dmask), zone);
+      __VEC_PWR_IMP (vec_bcdrec_st_static) (p + len - n, n, z);
+      if (len > 16)
+	{
+	  vBCD_t h;
+	  // Digits 16-30 as a positive BCD value.
+	  h = (vBCD_t) vec_srqi ((vui128_t) bcd, 64);
+	  h = vec_bcdcpsgn (h, _BCD_CONST_PLUS_ONE);
+	  z = vec_or (vec_and (vec_bcdctz (h), dmask), vec_splats (zc));
+	  __VEC_PWR_IMP (vec_bcdrec_st_static) (p, len - 16, z);
+	}
+      if (len < 31)
+	t = vec_srq ((vui128_t) bcd,
+		     (vui128_t) vec_splats ((unsigned char) ((len + 1) * 4)));
+    }
+  return vec_cmpuq_all_ne (t, zero);
+}
+
+/* Convert signed BCD to element i of the column. Return 1 if the
+   value does not fit.  */
+static int
+__VEC_PWR_IMP (vec_bcdrec_tocol_static) (const vec_bcdrec_field_t *fd,
+					 unsigned long i, vBCD_t bcd)
+{
+  __VEC_U_128 t;
+  long long v;
+
+  switch (fd->type)
+    {
+    case VEC_BCDREC_INT64:
+      t.vx1 = (vui128_t) __VEC_PWR_IMP (vec_bcdctsq) (bcd);
+      v = (long long) t.i128;
+      ((long long *) fd->column)[i] = v;
+      return (v != t.i128);
+    case VEC_BCDREC_INT128:
+      ((vi128_t *) fd->column)[i] = __VEC_PWR_IMP (vec_bcdctsq) (bcd);
+      return 0;
+    default:
+      // The integer coefficient with exponent -scale.
+      ((_Decimal128 *) fd->column)[i] =
+	  __builtin_diexq (6176 - (long long) fd->scale, vec_BCD2DFP (bcd));
+      return 0;
+    }
+}
+
+/* Convert element i of the column to signed BCD. Return 1 if the
+   value does not fit 31 digits.  */
+static int
+__VEC_PWR_IMP (vec_bcdrec_fromcol_static) (vBCD_t *bcd,
+					   const vec_bcdrec_field_t *fd,
+					   unsigned long i)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  __VEC_U_128 t;
+  vi128_t x, q;
+  _Decimal128 d;
+  long long e;
+
+  switch (fd->type)
+    {
+    case VEC_BCDREC_INT64:
+      t.i128 = ((long long *) fd->column)[i];
+      *bcd = __VEC_PWR_IMP (vec_bcdcfsq) ((vi128_t) t.vx1);
+      return 0;
+    case VEC_BCDREC_INT128:
+      x = ((vi128_t *) fd->column)[i];
+      q = vec_divsq_10e31 (x);
+      if (vec_cmpuq_all_ne ((vui128_t) q, zero))
+	{
+	  *bcd = __VEC_PWR_IMP (vec_bcdcfsq) (vec_modsq_10e31 (x, q));
+	  return 1;
+	}
+      *bcd = __VEC_PWR_IMP (vec_bcdcfsq) (x);
+      return 0;
+    default:
+      d = ((_Decimal128 *) fd->column)[i];
+      // Scale by 10**scale (exact) and truncate to an integer.
+      e = __builtin_dxexq (d);
+      if (e >= 0 && (e + fd->scale) <= 12287)
+	{
+	  d = __builtin_diexq (e + fd->scale, d);
+	  d = vec_quantize0_Decimal128 (d);
+	  // A NaN here is an integer part over 34 digits.
+	  if (__builtin_dxexq (d) >= 0)
+	    {
+	      *bcd = vec_DFP2BCD (d);
+	      return (__builtin_dscriq (d, 31) != 0);
+	    }
+	}
+      // Infinity, NaN or too large.
+      *bcd = _BCD_CONST_ZERO;
+      return 1;
+    }
+}
+
+/* Return 0 if a field of the schema does not fit the record or is
+   not a supported format and type.  */
+static int
+__VEC_PWR_IMP (vec_bcdrec_valid_static) (unsigned long reclen,
+					 const vec_bcdrec_field_t *schema,
+					 unsigned long nfields)
+{
+  unsigned long f;
+
+  for (f = 0; f < nfields; f++)
+    {
+      const vec_bcdrec_field_t *fd = &schema[f];
+      unsigned int max;
+
+      if ((unsigned int) fd->format > VEC_BCDREC_ZONED_ASCII
+	  || (unsigned int) fd->type > VEC_BCDREC_DEC128
+	  || fd->scale > 31)
+	return 0;
+      max = (fd->format == VEC_BCDREC_PACKED) ? 16 : 31;
+      if (fd->length < 1 || fd->length > max || fd->offset > reclen
+	  || fd->length > (reclen - fd->offset))
+	return 0;
+    }
+  return 1;
+}
+
+long
+__VEC_PWR_IMP (vec_bcdrec_decode) (const unsigned char *rec,
+				   unsigned long reclen, unsigned long nrec,
+				   const vec_bcdrec_field_t *schema,
+				   unsigned long nfields)
+{
+  long ovf = 0;
+  unsigned long f, i;
+
+  if (!__VEC_PWR_IMP (vec_bcdrec_valid_static) (reclen, schema, nfields))
+    return -1;
+
+  // A column at a time, the field format and type are loop invariant.
+  for (f = 0; f < nfields; f++)
+    {
+      const vec_bcdrec_field_t *fd = &schema[f];
+      const unsigned char *p = rec + fd->offset;
+      vBCD_t bcd;
+
+      for (i = 0; i < nrec; i++, p += reclen)
+	{
+	  bcd = __VEC_PWR_IMP (vec_bcdrec_ldfld_static) (p, fd->length,
+							 fd->format);
+	  ovf += __VEC_PWR_IMP (vec_bcdrec_tocol_static) (fd, i, bcd);
+	}
+    }
+  return ovf;
+}
+
+long
+__VEC_PWR_IMP (vec_bcdrec_encode) (unsigned char *rec,
+				   unsigned long reclen, unsigned long nrec,
+				   const vec_bcdrec_field_t *schema,
+				   unsigned long nfields)
+{
+  long ovf = 0;
+  unsigned long f, i;
+
+  if (!__VEC_PWR_IMP (vec_bcdrec_valid_static) (reclen, schema, nfields))
+    return -1;
+
+  for (f = 0; f < nfields; f++)
+    {
+      const vec_bcdrec_field_t *fd = &schema[f];
+      unsigned char *p = rec + fd->offset;
+      vBCD_t bcd;
+      int lost;
+
+      for (i = 0; i < nrec; i++, p += reclen)
+	{
+	  lost = __VEC_PWR_IMP (vec_bcdrec_fromcol_static) (&bcd, fd, i);
+	  lost |= __VEC_PWR_IMP (vec_bcdrec_stfld_static) (p, fd->length,
+							   fd->format, bcd);
+	  ovf += lost;
+	}
+    }
+  return ovf;
+}
+/* Binary floating point to/from _Decimal128. The wide intermediate
+   values are exact integers in a buffer of quadwords, held at the
+   low order end of the buffer for either endian so the byN
+   operations see an n quadword integer. VEC_DFPCONV_Q (x, cap, i) is
+   quadword i (from the low order) and VEC_DFPCONV_P (x, cap, n) the
+   byN array pointer.  */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define VEC_DFPCONV_Q(x, cap, i) (x)[(i)]
+#define VEC_DFPCONV_P(x, cap, n) (x)
+#else
+#define VEC_DFPCONV_Q(x, cap, i) (x)[(cap) - 1 - (i)]
+#define VEC_DFPCONV_P(x, cap, n) ((x) + (cap) - (n))
+#endif
+/* (2**113 - 1) * 5**16494 is less than 2**38414.  */
+#define VEC_DFPCONV_CFQ 304
+/* 10**34 * 2**16730 or 10**38 * 10**4933 is less than 2**16850.  */
+#define VEC_DFPCONV_CTQ 136
+
+static inline int
+__VEC_PWR_IMP (vec_dfpconv_bitlen_static) (unsigned __int128 x)
+{
+  unsigned long long h = x >> 64, l = x;
+
+  if (h != 0)
+    return 128 - __builtin_clzll (h);
+  if (l != 0)
+    return 64 - __builtin_clzll (l);
+  return 0;
+}
+
+static inline int
+__VEC_PWR_IMP (vec_dfpconv_ctz_static) (unsigned __int128 x)
+{
+  unsigned long long l = x;
+
+  if (l != 0)
+    return __builtin_ctzll (l);
+  return 64 + __builtin_ctzll ((unsigned long long) (x >> 64));
+}
+
+/* Bit length of the n quadword integer x.  */
+static int
+__VEC_PWR_IMP (vec_dfpconv_bitlenN_static) (vui128_t *x, unsigned long cap,
+					    unsigned long n)
+{
+  unsigned __int128 t;
+
+  t = vec_transfer_vui128t_to_uint128 (VEC_DFPCONV_Q (x, cap, n - 1));
+  return ((n - 1) * 128) + __VEC_PWR_IMP (vec_dfpconv_bitlen_static) (t);
+}
+
+/* Set x to v << s and return the number of quadwords.  */
+static unsigned long
+__VEC_PWR_IMP (vec_dfpconv_setsl_static) (vui128_t *x, unsigned long cap,
+					  unsigned __int128 v, unsigned long s)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  unsigned long i, iq = s / 128;
+  unsigned int sh = s % 128;
+
+  for (i = 0; i < iq; i++)
+    VEC_DFPCONV_Q (x, cap, i) = zero;
+  VEC_DFPCONV_Q (x, cap, iq) = vec_transfer_uint128_to_vui128t (v << sh);
+  if (sh != 0 && (v >> (128 - sh)) != 0)
+    {
+      VEC_DFPCONV_Q (x, cap, iq + 1) =
+	  vec_transfer_uint128_to_vui128t (v >> (128 - sh));
+      return iq + 2;
+    }
+  return iq + 1;
+}
+
+/* Divide the n quadword integer x by 10**k, truncated. Return the
+   new quadword count and set *sticky if the remainder is not 0.  */
+static unsigned long
+__VEC_PWR_IMP (vec_dfpconv_div10k_static) (vui128_t *x, unsigned long cap,
+					   unsigned long n, long k,
+					   int *sticky)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t *xp, rem;
+  unsigned int c;
+
+  for (; k > 0; k -= c)
+    {
+      c = (k < 38) ? k : 38;
+      xp = VEC_DFPCONV_P (x, cap, n);
+      rem = __VEC_PWR_IMP (vec_div10k_byN) (xp, xp, c, VEC_ROUND_TRUNC, n);
+      if (vec_cmpuq_all_ne (rem, zero))
+	*sticky = 1;
+      while (n > 1 && vec_cmpuq_all_eq (VEC_DFPCONV_Q (x, cap, n - 1), zero))
+	n--;
+    }
+  return n;
+}
+
+/* Convert the magnitude x with sign neg to _Decimal128, rounded to
+   34 digits. As vec_dfp128_cfuq() with the sign applied before the
+   rounding, for the directed rounding modes.  */
+static _Decimal128
+__VEC_PWR_IMP (vec_dfpconv_cfuq_static) (unsigned __int128 x, int neg)
+{
+  vui128_t v, q, r;
+  vBCD_t b_h, b_l;
+
+  v = vec_transfer_uint128_to_vui128t (x);
+  q = vec_divuq_10e31 (v);
+  r = vec_moduq_10e31 (v, q);
+  b_h = __VEC_PWR_IMP (vec_bcdcfsq) ((vi128_t) q);
+  b_l = __VEC_PWR_IMP (vec_bcdcfsq) ((vi128_t) r);
+  if (neg)
+    {
+      b_h = vec_bcdcpsgn (b_h, _BCD_CONST_MINUS_ONE);
+      b_l = vec_bcdcpsgn (b_l, _BCD_CONST_MINUS_ONE);
+    }
+  return __builtin_diexq (6176 + 31, vec_BCD2DFP (b_h)) + vec_BCD2DFP (b_l);
+}
+
+/* Convert (-1)**neg * x * 10**k10, x the n quadword integer, to
+   _Decimal128 with one rounding. x is overwritten.  */
+static _Decimal128
+__VEC_PWR_IMP (vec_dfpconv_cfN_static) (vui128_t *x, unsigned long cap,
+					unsigned long n, long k10, int neg)
+{
+  _Decimal128 d;
+  long r, b;
+  int sticky;
+
+  b = __VEC_PWR_IMP (vec_dfpconv_bitlenN_static) (x, cap, n);
+  if (b <= 128)
+    {
+      d = __VEC_PWR_IMP (vec_dfpconv_cfuq_static) (
+	  vec_transfer_vui128t_to_uint128 (VEC_DFPCONV_Q (x, cap, 0)), neg);
+      return __builtin_diexq (__builtin_dxexq (d) + k10, d);
+    }
+  // Divide out r digits leaving 37-38 digits. 1233/4096 is just
+  // under log10(2), so the digit estimate is a floor and the quotient
+  // times 10 still fits in a quadword. Then append a digit, not 0 if
+  // the remainder was not 0, so the final rounding sees the discarded
+  // digits.
+  r = (((b - 1) * 1233) >> 12) - 36;
+  sticky = 0;
+  n = __VEC_PWR_IMP (vec_dfpconv_div10k_static) (x, cap, n, r, &sticky);
+  d = __VEC_PWR_IMP (vec_dfpconv_cfuq_static) (
+      vec_transfer_vui128t_to_uint128 (VEC_DFPCONV_Q (x, cap, 0)) * 10
+      + sticky, neg);
+  return __builtin_diexq (__builtin_dxexq (d) + k10 + r - 1, d);
+}
+
+/* Convert (-1)**neg * m * 2**e to _Decimal128.  */
+static _Decimal128
+__VEC_PWR_IMP (vec_dfpconv_cfbin_static) (unsigned __int128 m, long e,
+					  int neg)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t x[VEC_DFPCONV_CFQ];
+  vui128_t f, lo, hi, carry;
+  unsigned __int128 p5;
+  _Decimal128 d;
+  unsigned long n, i;
+  long k, k10;
+  int c;
+
+  if (m == 0)
+    return neg ? -0.0DL : 0.0DL;
+  c = __VEC_PWR_IMP (vec_dfpconv_ctz_static) (m);
+  m >>= c;
+  e += c;
+  // m and 2**|e| are exact _Decimal128 values, so one rounding.
+  if (__VEC_PWR_IMP (vec_dfpconv_bitlen_static) (m) <= 112
+      && e >= -112 && e <= 112)
+    {
+      d = __VEC_PWR_IMP (vec_dfpconv_cfuq_static) (m, neg);
+      if (e >= 0)
+	return d * decpowof2[e];
+      else
+	return d / decpowof2[-e];
+    }
+
+  if (e >= 0)
+    {
+      // X = m * 2**e
+      n = __VEC_PWR_IMP (vec_dfpconv_setsl_static) (x, VEC_DFPCONV_CFQ,
+						    m, e);
+      k10 = 0;
+    }
+  else
+    {
+      // m * 2**e = (m * 5**-e) * 10**e, 5**54 < 2**128.
+      VEC_DFPCONV_Q (x, VEC_DFPCONV_CFQ, 0) =
+	  vec_transfer_uint128_to_vui128t (m);
+      n = 1;
+      for (k = -e; k > 0; k -= c)
+	{
+	  c = (k < 54) ? k : 54;
+	  for (p5 = 1, i = 0; i < (unsigned long) c; i++)
+	    p5 *= 5;
+	  f = vec_transfer_uint128_to_vui128t (p5);
+	  carry = zero;
+	  for (i = 0; i < n; i++)
+	    {
+	      lo = vec_madduq (&hi, VEC_DFPCONV_Q (x, VEC_DFPCONV_CFQ, i), f,
+			       carry);
+	      VEC_DFPCONV_Q (x, VEC_DFPCONV_CFQ, i) = lo;
+	      carry = hi;
+	    }
+	  if (vec_cmpuq_all_ne (carry, zero))
+	    VEC_DFPCONV_Q (x, VEC_DFPCONV_CFQ, n++) = carry;
+	}
+      k10 = e;
+    }
+
+  return __VEC_PWR_IMP (vec_dfpconv_cfN_static) (x, VEC_DFPCONV_CFQ, n, k10,
+						neg);
+}
+
+/* Return the coefficient of the finite d128 and set *neg to its
+   sign.  */
+static unsigned __int128
+__VEC_PWR_IMP (vec_dfpconv_coef_static) (_Decimal128 d128, int *neg)
+{
+  __VEC_U_128 t;
+  vBCD_t b_h, b_l;
+  unsigned __int128 c_h, c_l;
+
+  b_h = vec_DFP2BCD (__builtin_dscriq (d128, 31));
+  b_l = vec_DFP2BCD (d128);
+  t.vx4 = b_l;
+  *neg = ((t.ulong.lower & 0xf) == 0xd);
+  b_h = vec_bcdcpsgn (b_h, _BCD_CONST_PLUS_ONE);
+  b_l = vec_bcdcpsgn (b_l, _BCD_CONST_PLUS_ONE);
+  c_h = vec_transfer_vui128t_to_uint128 (
+      (vui128_t) __VEC_PWR_IMP (vec_bcdctsq) (b_h));
+  c_l = vec_transfer_vui128t_to_uint128 (
+      (vui128_t) __VEC_PWR_IMP (vec_bcdctsq) (b_l));
+  return c_h * vec_transfer_vui128t_to_uint128 (vtipowof10[31]) + c_l;
+}
+
+/* Shift the n quadword integer x left s bits and return the new
+   quadword count.  */
+static unsigned long
+__VEC_PWR_IMP (vec_dfpconv_slN_static) (vui128_t *x, unsigned long cap,
+					unsigned long n, unsigned long s)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  unsigned long i, nn, iq = s / 128;
+  unsigned int sh = s % 128;
+  unsigned __int128 t, u;
+
+  // High to low, so x can be shifted in place.
+  t = vec_transfer_vui128t_to_uint128 (VEC_DFPCONV_Q (x, cap, n - 1));
+  if (sh != 0 && (t >> (128 - sh)) != 0)
+    {
+      VEC_DFPCONV_Q (x, cap, n + iq) =
+	  vec_transfer_uint128_to_vui128t (t >> (128 - sh));
+      nn = n + iq + 1;
+    }
+  else
+    nn = n + iq;
+  for (i = n - 1; i > 0; i--)
+    {
+      u = vec_transfer_vui128t_to_uint128 (VEC_DFPCONV_Q (x, cap, i - 1));
+      if (sh != 0)
+	t = (t << sh) | (u >> (128 - sh));
+      VEC_DFPCONV_Q (x, cap, i + iq) = vec_transfer_uint128_to_vui128t (t);
+      t = u;
+    }
+  VEC_DFPCONV_Q (x, cap, iq) = vec_transfer_uint128_to_vui128t (t << sh);
+  for (i = 0; i < iq; i++)
+    VEC_DFPCONV_Q (x, cap, i) = zero;
+  return nn;
+}
+
+/* Round the n quadword integer x (not 0) times 2**e, plus a sticky
+   bit for discarded non zero bits below x, to binary floating point
+   with p significand bits and exponent bias emax, nearest even.
+   The result is the encoding without the sign bit.  */
+static unsigned __int128
+__VEC_PWR_IMP (vec_dfpconv_rndN_static) (vui128_t *x, unsigned long cap,
+					 unsigned long n, long e, int sticky,
+					 int p, long emax)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  const unsigned __int128 inf = (unsigned __int128) (2 * emax + 1) << (p - 1);
+  const int w = p + 3;
+  unsigned __int128 t, mant, rem, half;
+  unsigned long i, iq;
+  long te, drop, b;
+  int sh, bt;
+
+  // Keep the leading w bits of x, the rest is sticky.
+  b = __VEC_PWR_IMP (vec_dfpconv_bitlenN_static) (x, cap, n);
+  if (b > w)
+    {
+      iq = (b - w) / 128;
+      sh = (b - w) % 128;
+      t = vec_transfer_vui128t_to_uint128 (VEC_DFPCONV_Q (x, cap, iq));
+      if (sh != 0 && (t << (128 - sh)) != 0)
+	sticky = 1;
+      t >>= sh;
+      if (sh != 0 && (iq + 1) < n)
+	t |= vec_transfer_vui128t_to_uint128 (
+	    VEC_DFPCONV_Q (x, cap, iq + 1)) << (128 - sh);
+      t &= ((unsigned __int128) 1 << w) - 1;
+      for (i = 0; i < iq; i++)
+	if (vec_cmpuq_all_ne (VEC_DFPCONV_Q (x, cap, i), zero))
+	  sticky = 1;
+      e += b - w;
+    }
+  else
+    t = vec_transfer_vui128t_to_uint128 (VEC_DFPCONV_Q (x, cap, 0));
+
+  // t * 2**e, te the unbiased exponent of the leading bit.
+  bt = __VEC_PWR_IMP (vec_dfpconv_bitlen_static) (t);
+  te = e + bt - 1;
+  if (te > emax)
+    return inf;
+  if (te < (1 - emax))
+    te = 1 - emax;
+  drop = (te - p + 1) - e;
+  if (drop <= 0)
+    mant = t << -drop;
+  else if (drop > (bt + 1))
+    mant = 0;
+  else
+    {
+      half = (unsigned __int128) 1 << (drop - 1);
+      rem = t & ((half << 1) - 1);
+      mant = t >> drop;
+      if (rem > half || (rem == half && (sticky || (mant & 1))))
+	mant++;
+    }
+  // A subnormal has biased exponent 0, a carry out of the
+  // significand increments the exponent.
+  t = ((unsigned __int128) (te + emax - 1) << (p - 1)) + mant;
+  return (t < inf) ? t : inf;
+}
+
+/* Convert the n quadword integer x (not 0) times 10**q to binary
+   floating point, as vec_dfpconv_rndN_static(). x (cap quadwords)
+   is the work space, the caller checks that x * 10**q fits (q >= 0)
+   or that x * 2**s for s = p + 6 + ceil (-q * log2 (10)) fits
+   (q < 0).  */
+static unsigned __int128
+__VEC_PWR_IMP (vec_dfpconv_ctbinN_static) (vui128_t *x, unsigned long cap,
+					   unsigned long n, long q, int p,
+					   long emax)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  const int w = p + 3;
+  vui128_t *xp, carry;
+  long e, k, s;
+  int ck, sticky = 0;
+
+  if (q >= 0)
+    {
+      // X = x * 10**q, exact.
+      for (k = q; k > 0; k -= ck)
+	{
+	  ck = (k < 38) ? k : 38;
+	  xp = VEC_DFPCONV_P (x, cap, n);
+	  carry = __VEC_PWR_IMP (vec_mul10k_byN) (xp, xp, ck, n);
+	  if (vec_cmpuq_all_ne (carry, zero))
+	    VEC_DFPCONV_Q (x, cap, n++) = carry;
+	}
+      e = 0;
+    }
+  else
+    {
+      // X = (x * 2**s) / 10**k with at least w + 1 bits,
+      // 3402/1024 is just over log2(10).
+      k = -q;
+      s = w + 2 + ((k * 3402) >> 10) + 1
+	  - (__VEC_PWR_IMP (vec_dfpconv_bitlenN_static) (x, cap, n) - 1);
+      if (s < 0)
+	s = 0;
+      n = __VEC_PWR_IMP (vec_dfpconv_slN_static) (x, cap, n, s);
+      n = __VEC_PWR_IMP (vec_dfpconv_div10k_static) (x, cap, n, k, &sticky);
+      e = -s;
+    }
+  return __VEC_PWR_IMP (vec_dfpconv_rndN_static) (x, cap, n, e, sticky, p,
+						  emax);
+}
+
+/* Convert c * 10**q to binary floating point with p significand bits
+   and exponent bias emax, rounded to nearest even. The result is the
+   encoding without the sign bit. c * 10**q is 0 for q < -kmax and
+   infinity for q >= qmax.  */
+static unsigned __int128
+__VEC_PWR_IMP (vec_dfpconv_ctbin_static) (unsigned __int128 c, long q,
+					  int p, long emax, long qmax,
+					  long kmax)
+{
+  vui128_t x[VEC_DFPCONV_CTQ];
+
+  if (c == 0 || q < -kmax)
+    return 0;
+  if (q >= qmax)
+    return (unsigned __int128) (2 * emax + 1) << (p - 1);
+
+  VEC_DFPCONV_Q (x, VEC_DFPCONV_CTQ, 0) = vec_transfer_uint128_to_vui128t (c);
+  return __VEC_PWR_IMP (vec_dfpconv_ctbinN_static) (x, VEC_DFPCONV_CTQ, 1, q,
+						    p, emax);
+}
+
+_Decimal128
+__VEC_PWR_IMP (vec_dfp128_cff64) (double f64)
+{
+  union
+  {
+    double d;
+    unsigned long long u;
+  } x;
+  unsigned long long m;
+  long e;
+  int neg;
+
+  x.d = f64;
+  neg = (x.u >> 63);
+  e = (x.u >> 52) & 0x7ff;
+  m = x.u & ((1ULL << 52) - 1);
+  if (e == 0x7ff)
+    {
+      if (m != 0)
+	return __builtin_nand128 ("");
+      return neg ? -__builtin_infd128 () : __builtin_infd128 ();
+    }
+  if (e == 0)
+    e = 1;
+  else
+    m |= (1ULL << 52);
+  return __VEC_PWR_IMP (vec_dfpconv_cfbin_static) (m, e - 1075, neg);
+}
+
+_Decimal128
+__VEC_PWR_IMP (vec_dfp128_cff128) (__binary128 f128)
+{
+  const unsigned __int128 hidden = (unsigned __int128) 1 << 112;
+  unsigned __int128 x, m;
+  long e;
+  int neg;
+
+  x = vec_transfer_vui128t_to_uint128 (vec_xfer_bin128_2_vui128t (f128));
+  neg = (x >> 127);
+  e = (x >> 112) & 0x7fff;
+  m = x & (hidden - 1);
+  if (e == 0x7fff)
+    {
+      if (m != 0)
+	return __builtin_nand128 ("");
+      return neg ? -__builtin_infd128 () : __builtin_infd128 ();
+    }
+  if (e == 0)
+    e = 1;
+  else
+    m |= hidden;
+  return __VEC_PWR_IMP (vec_dfpconv_cfbin_static) (m, e - 16495, neg);
+}
+
+double
+__VEC_PWR_IMP (vec_dfp128_ctf64) (_Decimal128 d128)
+{
+  // Exact double powers of ten for the fast path.
+  static const double pow10[] =
+    {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+  union
+  {
+    double d;
+    unsigned long long u;
+  } r;
+  unsigned __int128 c;
+  long long e;
+  double fpscr;
+  int neg;
+
+  e = __builtin_dxexq (d128);
+  if (e < 0)
+    {
+      // -1 infinity, -2/-3 NaN.
+      r.u = (e == -1) ? 0x7ff0000000000000ULL : 0x7ff8000000000000ULL;
+      if (e == -1 && d128 < 0.0DL)
+	r.u |= (1ULL << 63);
+      return r.d;
+    }
+  c = __VEC_PWR_IMP (vec_dfpconv_coef_static) (d128, &neg);
+  e -= 6176;
+  if (c < ((unsigned __int128) 1 << 53) && e >= -22 && e <= 22)
+    {
+      // One multiply or divide of exact values, rounded in FPSCR[RN].
+      // Use it only if that is nearest even (0b00), like the slow path.
+      __asm__ __volatile__(
+	  "mffs %0"
+	  : "=f" (fpscr)
+	  : : );
+      r.d = fpscr;
+      if ((r.u & 3) == 0)
+	{
+	  r.d = (double) (unsigned long long) c;
+	  r.d = (e >= 0) ? r.d * pow10[e] : r.d / pow10[-e];
+	  return neg ? -r.d : r.d;
+	}
+    }
+  r.u = __VEC_PWR_IMP (vec_dfpconv_ctbin_static) (c, e, 53, 1023, 309, 359);
+  if (neg)
+    r.u |= (1ULL << 63);
+  return r.d;
+}
+
+__binary128
+__VEC_PWR_IMP (vec_dfp128_ctf128) (_Decimal128 d128)
+{
+  unsigned __int128 c, t;
+  long long e;
+  int neg;
+
+  e = __builtin_dxexq (d128);
+  if (e < 0)
+    {
+      t = (unsigned __int128) 0x7fff << 112;
+      if (e != -1)
+	t |= (unsigned __int128) 1 << 111;
+      else if (d128 < 0.0DL)
+	t |= (unsigned __int128) 1 << 127;
+    }
+  else
+    {
+      c = __VEC_PWR_IMP (vec_dfpconv_coef_static) (d128, &neg);
+      t = __VEC_PWR_IMP (vec_dfpconv_ctbin_static) (c, e - 6176, 113, 16383,
+						    4933, 5000);
+      if (neg)
+	t |= (unsigned __int128) 1 << 127;
+    }
+  return vec_xfer_vui128t_2_bin128 (vec_transfer_uint128_to_vui128t (t));
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_cfsq_array) (_Decimal128 *r, vi128_t *a,
+				       unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = vec_dfp128_cfsq (a[i]);
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_cfuq_array) (_Decimal128 *r, vui128_t *a,
+				       unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = vec_dfp128_cfuq (a[i]);
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_cff64_array) (_Decimal128 *r, double *a,
+					unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = __VEC_PWR_IMP (vec_dfp128_cff64) (a[i]);
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_cff128_array) (_Decimal128 *r, __binary128 *a,
+					 unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = __VEC_PWR_IMP (vec_dfp128_cff128) (a[i]);
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_ctsqz_array) (vi128_t *r, _Decimal128 *a,
+					unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = vec_dfp128_ctsqz (a[i]);
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_ctuqz_array) (vui128_t *r, _Decimal128 *a,
+					unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = vec_dfp128_ctuqz (a[i]);
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_ctf64_array) (double *r, _Decimal128 *a,
+					unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = __VEC_PWR_IMP (vec_dfp128_ctf64) (a[i]);
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_ctf128_array) (__binary128 *r, _Decimal128 *a,
+					 unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    r[i] = __VEC_PWR_IMP (vec_dfp128_ctf128) (a[i]);
+}
+
+long
+__VEC_PWR_IMP (vec_bcdrescale_array) (vBCD_t *r, vBCD_t *a, int k,
+				      vec_round_t rnd, unsigned char *ovf,
+				      unsigned long n)
+{
+  const vui32_t sign_mask = (vui32_t) _BCD_CONST_SIGN_MASK;
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t shl, shr, t;
+  unsigned long i;
+  unsigned int kx;
+  long novf = 0;
+  int of;
+
+  if (k <= 0)
+    {
+      kx = -k;
+      for (i = 0; i < n; i++)
+	r[i] = vec_bcdsr_rnd (a[i], kx, rnd);
+      if (ovf)
+	for (i = 0; i < n; i++)
+	  ovf[i] = 0;
+      return 0;
+    }
+
+  kx = (k < 31) ? k : 31;
+  shl = (vui128_t) vec_splats ((unsigned char) (kx * 4));
+  shr = (vui128_t) vec_splats ((unsigned char) (128 - (kx * 4)));
+  for (i = 0; i < n; i++)
+    {
+      t = (vui128_t) vec_andc ((vui32_t) a[i], sign_mask);
+      // The high k digits are shifted out.
+      if (kx < 31)
+	{
+	  of = vec_cmpuq_all_ne (vec_srq (t, shr), zero);
+	  t = vec_slq (t, shl);
+	}
+      else
+	{
+	  of = vec_cmpuq_all_ne (t, zero);
+	  t = zero;
+	}
+      r[i] = vec_bcdcpsgn ((vBCD_t) t, a[i]);
+      if (ovf)
+	ovf[i] = of;
+      novf += of;
+    }
+
+  return novf;
+}
+
+long
+__VEC_PWR_IMP (vec_dfp128_rescale_array) (_Decimal128 *r, _Decimal128 *a,
+					  unsigned int scale,
+					  vec_round_t rnd,
+					  unsigned char *ovf,
+					  unsigned long n)
+{
+  const long long e = 6176 - (long long) scale;
+  unsigned long i;
+  long novf = 0;
+  int of;
+
+  for (i = 0; i < n; i++)
+    {
+      r[i] = vec_dfp128_quantize (a[i], scale, rnd);
+      // A finite value that does not fit 34 digits at exponent
+      // -scale quantizes to NaN, or rounds to another exponent.
+      of = (__builtin_dxexq (a[i]) >= 0) && (__builtin_dxexq (r[i]) != e);
+      if (ovf)
+	ovf[i] = of;
+      novf += of;
+    }
+
+  return novf;
+}
+
+/* Binary128 to/from decimal strings. The formatter is Ryu (Ulf
+   Adams, "Ryu: fast float-to-string conversion") in its 128-bit
+   form. The 249-bit powers of 5 are rebuilt from the compressed
+   vec256_powof5[] and vec256_recipof5[] tables with two
+   vec_mul128x128_inline() products, and the digits go out through
+   vec_bcdcfuq() and vec_bcdctz().
+
+   The parser follows Eisel and Lemire: the leading 38 digits times
+   the 249-bit power of 5 place the value in a small interval. If
+   both ends of the interval round to the same binary128 that is
+   the result. Otherwise the exact N quadword path
+   (vec_dfpconv_ctbinN_static) decides, with all the digits.  */
+#define VEC_F128CONV_BITS 249
+/* Significant digits kept by the exact path. A binary128 halfway
+   point has at most 11564, later digits only matter as a sticky
+   digit.  */
+#define VEC_F128CONV_DIG 11568
+/* 11569 digits times 10**-16534 need x * 2**s with s just over
+   116 + 16534 * log2 (10), less than 2**55060.  */
+#define VEC_F128CONV_Q 440
+
+/* ceil (log2 (5**e)) for 0 < e <= 16600, 1 for e == 0.  */
+static inline long
+__VEC_PWR_IMP (vec_f128conv_pow5bits_static) (long e)
+{
+  return (long) (((unsigned long) e * 163391164108059UL) >> 46) + 1;
+}
+
+/* floor (log10 (2**e)) for 0 <= e <= 16600.  */
+static inline long
+__VEC_PWR_IMP (vec_f128conv_log10pow2_static) (long e)
+{
+  return (long) (((unsigned long) e * 169464822037455UL) >> 49);
+}
+
+/* floor (log10 (5**e)) for 0 <= e <= 16600.  */
+static inline long
+__VEC_PWR_IMP (vec_f128conv_log10pow5_static) (long e)
+{
+  return (long) (((unsigned long) e * 196742565691928UL) >> 48);
+}
+
+/* Set p (low to high order) to the 384-bit product m * r.  */
+static inline void
+__VEC_PWR_IMP (vec_f128conv_mul_static) (unsigned __int128 *p,
+					 unsigned __int128 m,
+					 const unsigned __int128 *r)
+{
+  __VEC_U_256 l, h;
+  unsigned __int128 l1, h0;
+
+  l = vec_mul128x128_inline (vec_transfer_uint128_to_vui128t (m),
+			     vec_transfer_uint128_to_vui128t (r[0]));
+  h = vec_mul128x128_inline (vec_transfer_uint128_to_vui128t (m),
+			     vec_transfer_uint128_to_vui128t (r[1]));
+  l1 = vec_transfer_vui128t_to_uint128 (l.vx1);
+  h0 = vec_transfer_vui128t_to_uint128 (h.vx0);
+  p[0] = vec_transfer_vui128t_to_uint128 (l.vx0);
+  p[1] = l1 + h0;
+  p[2] = vec_transfer_vui128t_to_uint128 (h.vx1) + (p[1] < l1);
+}
+
+/* Set r (low, high) to the leading 249 bits of 5**i (inv == 0) or
+   to floor (2**(pow5bits (i) + 248) / 5**i) + 1 (inv == 1),
+   0 <= i <= 5096.  */
+static void
+__VEC_PWR_IMP (vec_f128conv_pow5_static) (unsigned __int128 *r, long i,
+					  int inv)
+{
+  const unsigned long long *err;
+  __VEC_U_256 m;
+  unsigned __int128 p[3], c;
+  long b, off, d;
+
+  if (inv)
+    {
+      b = (i + 55) / 56;
+      off = (b * 56) - i;
+      m = vec256_recipof5[b];
+      err = vec_recipof5_err;
+      d = __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (b * 56)
+	  - __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (i);
+    }
+  else
+    {
+      b = i / 56;
+      off = i - (b * 56);
+      m = vec256_powof5[b];
+      err = vec_powof5_err;
+      d = __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (i)
+	  - __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (b * 56);
+    }
+  r[0] = vec_transfer_vui128t_to_uint128 (m.vx0);
+  r[1] = vec_transfer_vui128t_to_uint128 (m.vx1);
+  if (off != 0)
+    {
+      // 5**off * r >> d, then the correction.
+      __VEC_PWR_IMP (vec_f128conv_mul_static) (
+	  p, vec_transfer_vui128t_to_uint128 (vec128_powof5[off]), r);
+      if (d >= 128)
+	{
+	  p[0] = p[1];
+	  p[1] = p[2];
+	  p[2] = 0;
+	  d -= 128;
+	}
+      if (d != 0)
+	{
+	  p[0] = (p[0] >> d) | (p[1] << (128 - d));
+	  p[1] = (p[1] >> d) | (p[2] << (128 - d));
+	}
+      r[0] = p[0];
+      r[1] = p[1];
+    }
+  c = ((err[i / 32] >> (2 * (i % 32))) & 3) + inv;
+  r[0] += c;
+  r[1] += (r[0] < c);
+}
+
+/* (m * r) >> j, 128 <= j < 384.  */
+static inline unsigned __int128
+__VEC_PWR_IMP (vec_f128conv_mulsh_static) (unsigned __int128 m,
+					   const unsigned __int128 *r,
+					   long j)
+{
+  unsigned __int128 p[3];
+
+  __VEC_PWR_IMP (vec_f128conv_mul_static) (p, m, r);
+  j -= 128;
+  if (j >= 128)
+    return p[2] >> (j - 128);
+  if (j == 0)
+    return p[1];
+  return (p[1] >> j) | (p[2] << (128 - j));
+}
+
+static inline unsigned __int128
+__VEC_PWR_IMP (vec_f128conv_div10_static) (unsigned __int128 x)
+{
+  return vec_transfer_vui128t_to_uint128 (
+      vec_div10k_uq (vec_transfer_uint128_to_vui128t (x), 1));
+}
+
+/* x is a multiple of 5**p, p <= 55.  */
+static inline int
+__VEC_PWR_IMP (vec_f128conv_mulof5_static) (unsigned __int128 x, long p)
+{
+  return (x % vec_transfer_vui128t_to_uint128 (vec128_powof5[p])) == 0;
+}
+
+/* Store the decimal digits of x < 10**36 as 36 characters.  */
+static void
+__VEC_PWR_IMP (vec_f128conv_digits_static) (unsigned char *d,
+					    unsigned __int128 x)
+{
+  const vui8_t dmask = vec_splat_u8 (15);
+  const vui8_t zone = vec_splats ((unsigned char) '0');
+  vui128_t v, q, r;
+  vBCD_t b;
+  vui8_t z;
+  unsigned int h, i;
+
+  v = vec_transfer_uint128_to_vui128t (x);
+  q = vec_divuq_10e32 (v);
+  r = vec_moduq_10e32 (v, q);
+  // The low 32 digits as unsigned BCD, then each 16 digit half as
+  // signed BCD for vec_bcdctz.
+  b = vec_bcdcfuq (r);
+  z = vec_bcdctz (vec_bcdcpsgn ((vBCD_t) vec_srqi ((vui128_t) b, 60),
+				_BCD_CONST_PLUS_ONE));
+  __VEC_PWR_IMP (vec_bcdrec_st_static) (d + 4, 16,
+					vec_or (vec_and (z, dmask), zone));
+  z = vec_bcdctz (vec_bcdcpsgn ((vBCD_t) vec_slqi ((vui128_t) b, 4),
+				_BCD_CONST_PLUS_ONE));
+  __VEC_PWR_IMP (vec_bcdrec_st_static) (d + 20, 16,
+					vec_or (vec_and (z, dmask), zone));
+  h = (unsigned int) vec_transfer_vui128t_to_uint128 (q);
+  for (i = 4; i > 0; i--, h /= 10)
+    d[i - 1] = '0' + (h % 10);
+}
+
+/* The number of decimal digits of x. 1233/4096 is just under
+   log10(2), so k is a floor estimate of the digits, corrected by one
+   compare with 10**k.  */
+static inline int
+__VEC_PWR_IMP (vec_f128conv_len_static) (unsigned __int128 x)
+{
+  int k = (__VEC_PWR_IMP (vec_dfpconv_bitlen_static) (x) * 1233) >> 12;
+
+  return k + (x >= vec_transfer_vui128t_to_uint128 (vtipowof10[k]));
+}
+
+/* Write the len digits at d with the exponent e10 of the last digit
+   in the "%.*e" format and return the length.  */
+static int
+__VEC_PWR_IMP (vec_f128conv_put_static) (char *p, const unsigned char *d,
+					 int len, long e10)
+{
+  char *s = p;
+  int i, k;
+
+  *p++ = d[0];
+  if (len > 1)
+    {
+      *p++ = '.';
+      memcpy (p, d + 1, len - 1);
+      p += len - 1;
+    }
+  e10 += len - 1;
+  *p++ = 'e';
+  *p++ = (e10 < 0) ? '-' : '+';
+  if (e10 < 0)
+    e10 = -e10;
+  k = (e10 >= 1000) ? 4 : (e10 >= 100) ? 3 : 2;
+  for (i = k; i > 0; i--, e10 /= 10)
+    p[i - 1] = '0' + (e10 % 10);
+  p[k] = '\0';
+  return (p - s) + k;
+}
+
+int
+__VEC_PWR_IMP (vec_f128_ctstr) (char *buf, __binary128 f128)
+{
+  const unsigned __int128 hidden = (unsigned __int128) 1 << 112;
+  unsigned __int128 x, m2, mv, mm, vr, vp, vm, vrd, vpd, vmd, r[2];
+  unsigned char d[36];
+  char *p = buf;
+  long e2, e10, q, i, k;
+  int even, mmshift, vmtz = 0, vrtz = 0, last = 0, len;
+
+  x = vec_transfer_vui128t_to_uint128 (vec_xfer_bin128_2_vui128t (f128));
+  e2 = (x >> 112) & 0x7fff;
+  m2 = x & (hidden - 1);
+  if (x >> 127)
+    *p++ = '-';
+  if (e2 == 0x7fff)
+    {
+      memcpy (p, (m2 != 0) ? "nan" : "inf", 4);
+      return (p - buf) + 3;
+    }
+  if (e2 == 0 && m2 == 0)
+    {
+      memcpy (p, "0e+00", 6);
+      return (p - buf) + 5;
+    }
+
+  // The lower neighbor is closer for a power of 2, except the
+  // smallest normal.
+  mmshift = (m2 != 0) || (e2 <= 1);
+  if (e2 == 0)
+    e2 = 1 - 16383 - 112 - 2;
+  else
+    {
+      e2 = e2 - 16383 - 112 - 2;
+      m2 |= hidden;
+    }
+  even = (m2 & 1) == 0;
+  mv = 4 * m2;
+  mm = mv - 1 - mmshift;
+
+  // vr, vp and vm are (mv, mv + 2, mm) * 2**e2 / 10**e10, truncated.
+  // vrtz and vmtz are set if the truncated vr or vm are exact.
+  if (e2 >= 0)
+    {
+      q = __VEC_PWR_IMP (vec_f128conv_log10pow2_static) (e2) - (e2 > 3);
+      e10 = q;
+      k = VEC_F128CONV_BITS
+	  + __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (q) - 1;
+      i = -e2 + q + k;
+      __VEC_PWR_IMP (vec_f128conv_pow5_static) (r, q, 1);
+      vr = __VEC_PWR_IMP (vec_f128conv_mulsh_static) (mv, r, i);
+      vp = __VEC_PWR_IMP (vec_f128conv_mulsh_static) (mv + 2, r, i);
+      vm = __VEC_PWR_IMP (vec_f128conv_mulsh_static) (mm, r, i);
+      // 5**55 is the largest power of 5 below 2**128.
+      if (q <= 55)
+	{
+	  // Only one of mv, mv + 2 and mm can be a multiple of 5.
+	  if ((mv % 5) == 0)
+	    vrtz = __VEC_PWR_IMP (vec_f128conv_mulof5_static) (mv, q);
+	  else if (even)
+	    vmtz = __VEC_PWR_IMP (vec_f128conv_mulof5_static) (mm, q);
+	  else
+	    vp -= __VEC_PWR_IMP (vec_f128conv_mulof5_static) (mv + 2, q);
+	}
+    }
+  else
+    {
+      q = __VEC_PWR_IMP (vec_f128conv_log10pow5_static) (-e2) - (-e2 > 1);
+      e10 = q + e2;
+      i = -e2 - q;
+      k = __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (i)
+	  - VEC_F128CONV_BITS;
+      __VEC_PWR_IMP (vec_f128conv_pow5_static) (r, i, 0);
+      vr = __VEC_PWR_IMP (vec_f128conv_mulsh_static) (mv, r, q - k);
+      vp = __VEC_PWR_IMP (vec_f128conv_mulsh_static) (mv + 2, r, q - k);
+      vm = __VEC_PWR_IMP (vec_f128conv_mulsh_static) (mm, r, q - k);
+      if (q <= 1)
+	{
+	  // mv has 2 trailing 0 bits, mv + 2 one and mm one if mmshift.
+	  vrtz = 1;
+	  if (even)
+	    vmtz = mmshift;
+	  else
+	    vp--;
+	}
+      else if (q < 128)
+	vrtz = (mv & (((unsigned __int128) 1 << q) - 1)) == 0;
+    }
+
+  // Remove the digits vp and vm do not need, keeping the last
+  // removed digit of vr for the rounding.
+  for (;;)
+    {
+      vpd = __VEC_PWR_IMP (vec_f128conv_div10_static) (vp);
+      vmd = __VEC_PWR_IMP (vec_f128conv_div10_static) (vm);
+      if (vpd <= vmd)
+	break;
+      vrd = __VEC_PWR_IMP (vec_f128conv_div10_static) (vr);
+      vmtz &= (vm - (vmd * 10)) == 0;
+      vrtz &= last == 0;
+      last = (int) (vr - (vrd * 10));
+      vr = vrd;
+      vp = vpd;
+      vm = vmd;
+      e10++;
+    }
+  if (vmtz)
+    for (;;)
+      {
+	vmd = __VEC_PWR_IMP (vec_f128conv_div10_static) (vm);
+	if (vm != (vmd * 10))
+	  break;
+	vpd = __VEC_PWR_IMP (vec_f128conv_div10_static) (vp);
+	vrd = __VEC_PWR_IMP (vec_f128conv_div10_static) (vr);
+	vrtz &= last == 0;
+	last = (int) (vr - (vrd * 10));
+	vr = vrd;
+	vp = vpd;
+	vm = vmd;
+	e10++;
+      }
+  // Round half even if the exact value ends in 5 0...0. Take vr + 1
+  // if vr is outside the interval or rounds up.
+  if (vrtz && last == 5 && (vr & 1) == 0)
+    last = 4;
+  vr += ((vr == vm && (!even || !vmtz)) || last >= 5);
+
+  len = __VEC_PWR_IMP (vec_f128conv_len_static) (vr);
+  __VEC_PWR_IMP (vec_f128conv_digits_static) (d, vr);
+  return (p - buf)
+      + __VEC_PWR_IMP (vec_f128conv_put_static) (p, d + 36 - len, len, e10);
+}
+
+/* Return the length of the case insensitive match of s to the
+   lower case word lc, 0 if it does not match.  */
+static inline int
+__VEC_PWR_IMP (vec_f128conv_match_static) (const char *s, const char *lc)
+{
+  int i;
+
+  for (i = 0; lc[i] != '\0'; i++)
+    if ((s[i] | 0x20) != lc[i])
+      return 0;
+  return i;
+}
+
+/* Round w * 10**q (w not 0, with trunc set if non zero digits
+   followed w) from the interval the 249-bit powers of 5 give. Set
+   *t to the encoding and return 1 if both ends of the interval
+   round the same.  */
+static int
+__VEC_PWR_IMP (vec_f128conv_fast_static) (unsigned __int128 *t,
+					  unsigned __int128 w, long q,
+					  int trunc)
+{
+  vui128_t x[3];
+  unsigned __int128 r[2], p[3], h[3], t_l, t_h;
+  long e2, lz;
+  int i;
+
+  lz = 128 - __VEC_PWR_IMP (vec_dfpconv_bitlen_static) (w);
+  w <<= lz;
+  if (q >= 0)
+    {
+      // 5**q is exact for q <= 107, otherwise it is low by less
+      // than 1 (w * 1 < 2**128).
+      __VEC_PWR_IMP (vec_f128conv_pow5_static) (r, q, 0);
+      e2 = q - lz + __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (q)
+	   - VEC_F128CONV_BITS;
+      __VEC_PWR_IMP (vec_f128conv_mul_static) (p, w, r);
+      h[0] = p[0];
+      h[1] = p[1] + (q > 107);
+      h[2] = p[2] + (h[1] < p[1]);
+    }
+  else
+    {
+      // 2**K / 5**-q rounded up, high by less than 1.
+      __VEC_PWR_IMP (vec_f128conv_pow5_static) (r, -q, 1);
+      e2 = q - lz - (__VEC_PWR_IMP (vec_f128conv_pow5bits_static) (-q)
+		     - 1 + VEC_F128CONV_BITS);
+      __VEC_PWR_IMP (vec_f128conv_mul_static) (h, w, r);
+      p[0] = h[0];
+      p[1] = h[1] - 1;
+      p[2] = h[2] - (h[1] == 0);
+    }
+  // Lost digits add less than 2**lz * r < 2**(lz + 249).
+  if (trunc)
+    {
+      i = lz + VEC_F128CONV_BITS;
+      if (i >= 256)
+	h[2] += (unsigned __int128) 1 << (i - 256);
+      else
+	{
+	  t_l = h[1];
+	  h[1] += (unsigned __int128) 1 << (i - 128);
+	  h[2] += (h[1] < t_l);
+	}
+    }
+
+  for (i = 0; i < 3; i++)
+    VEC_DFPCONV_Q (x, 3, i) = vec_transfer_uint128_to_vui128t (p[i]);
+  t_l = __VEC_PWR_IMP (vec_dfpconv_rndN_static) (x, 3, 3, e2, 0, 113,
+						 16383);
+  for (i = 0; i < 3; i++)
+    VEC_DFPCONV_Q (x, 3, i) = vec_transfer_uint128_to_vui128t (h[i]);
+  t_h = __VEC_PWR_IMP (vec_dfpconv_rndN_static) (x, 3, 3, e2, 0, 113,
+						 16383);
+  *t = t_l;
+  return t_l == t_h;
+}
+
+/* Round the nd significant digits from s times 10**q (q the
+   exponent of the last digit) exactly. The digits may include one
+   decimal point.  */
+static unsigned __int128
+__VEC_PWR_IMP (vec_f128conv_exact_static) (const char *s, unsigned long nd,
+					   long q)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t x[VEC_F128CONV_Q];
+  vui128_t *xp, carry;
+  unsigned __int128 c, u;
+  unsigned long n = 1, k = 0, i, lim;
+  unsigned int dg, cd = 0;
+  int sticky = 0;
+
+  lim = (nd < VEC_F128CONV_DIG) ? nd : VEC_F128CONV_DIG;
+  q += nd - lim;
+  VEC_DFPCONV_Q (x, VEC_F128CONV_Q, 0) = zero;
+  for (c = 0; k < nd; s++)
+    {
+      dg = (unsigned int) (*s - '0');
+      if (dg > 9 || (k == 0 && dg == 0))
+	continue;
+      if (k++ >= lim)
+	{
+	  sticky |= (dg != 0);
+	  continue;
+	}
+      c = (c * 10) + dg;
+      // x = x * 10**cd + c every 38 digits.
+      if (++cd == 38 || k == lim)
+	{
+	  xp = VEC_DFPCONV_P (x, VEC_F128CONV_Q, n);
+	  carry = __VEC_PWR_IMP (vec_mul10k_byN) (xp, xp, cd, n);
+	  if (vec_cmpuq_all_ne (carry, zero))
+	    VEC_DFPCONV_Q (x, VEC_F128CONV_Q, n++) = carry;
+	  for (i = 0; c != 0; i++)
+	    {
+	      if (i == n)
+		VEC_DFPCONV_Q (x, VEC_F128CONV_Q, n++) = zero;
+	      u = vec_transfer_vui128t_to_uint128 (
+		  VEC_DFPCONV_Q (x, VEC_F128CONV_Q, i)) + c;
+	      VEC_DFPCONV_Q (x, VEC_F128CONV_Q, i) =
+		  vec_transfer_uint128_to_vui128t (u);
+	      c = (u < c);
+	    }
+	  cd = 0;
+	}
+    }
+  // Append a 1 digit for non zero digits past lim.
+  if (sticky)
+    {
+      xp = VEC_DFPCONV_P (x, VEC_F128CONV_Q, n);
+      carry = __VEC_PWR_IMP (vec_mul10k_byN) (xp, xp, 1, n);
+      if (vec_cmpuq_all_ne (carry, zero))
+	VEC_DFPCONV_Q (x, VEC_F128CONV_Q, n++) = carry;
+      // The low quadword is a multiple of 10, no carry out.
+      u = vec_transfer_vui128t_to_uint128 (
+	  VEC_DFPCONV_Q (x, VEC_F128CONV_Q, 0)) + 1;
+      VEC_DFPCONV_Q (x, VEC_F128CONV_Q, 0) =
+	  vec_transfer_uint128_to_vui128t (u);
+      q--;
+    }
+  return __VEC_PWR_IMP (vec_dfpconv_ctbinN_static) (x, VEC_F128CONV_Q, n,
+						    q, 113, 16383);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_f128_cfstr) (const char *str, char **endptr)
+{
+  const unsigned __int128 inf = (unsigned __int128) 0x7fff << 112;
+  const char *s = str, *d0, *e;
+  unsigned long long c_h = 0, c_l = 0, m_l = 1;
+  unsigned __int128 t = 0;
+  unsigned long nd = 0, nw;
+  unsigned int dg;
+  long q = 0, ex = 0;
+  int neg = 0, point = 0, digits = 0, trunc = 0, eneg;
+
+  while (*s == ' ' || (*s >= '\t' && *s <= '\r'))
+    s++;
+  if (*s == '-' || *s == '+')
+    neg = (*s++ == '-');
+  if (__VEC_PWR_IMP (vec_f128conv_match_static) (s, "inf"))
+    {
+      s += 3;
+      s += __VEC_PWR_IMP (vec_f128conv_match_static) (s, "inity");
+      t = inf;
+      goto done;
+    }
+  if (__VEC_PWR_IMP (vec_f128conv_match_static) (s, "nan"))
+    {
+      s += 3;
+      // Accept and ignore nan(n-char-sequence).
+      if (*s == '(')
+	{
+	  for (e = s + 1; (*e >= '0' && *e <= '9') || *e == '_'
+	       || ((*e | 0x20) >= 'a' && (*e | 0x20) <= 'z'); e++)
+	    ;
+	  if (*e == ')')
+	    s = e + 1;
+	}
+      t = inf | ((unsigned __int128) 1 << 111);
+      goto done;
+    }
+
+  // The leading 38 significant digits go to w = c_h * m_l + c_l,
+  // q is the exponent of the last digit of w.
+  for (d0 = s;; s++)
+    {
+      dg = (unsigned int) (*s - '0');
+      if (dg <= 9)
+	{
+	  digits = 1;
+	  if (nd == 0 && dg == 0)
+	    q -= point;
+	  else
+	    {
+	      if (nd < 19)
+		c_h = (c_h * 10) + dg;
+	      else if (nd < 38)
+		{
+		  c_l = (c_l * 10) + dg;
+		  m_l *= 10;
+		}
+	      else
+		trunc |= (dg != 0);
+	      q += (nd < 38) ? -point : !point;
+	      nd++;
+	    }
+	}
+      else if (*s == '.' && !point)
+	point = 1;
+      else
+	break;
+    }
+  if (!digits)
+    {
+      s = str;
+      neg = 0;
+      goto done;
+    }
+  if ((*s | 0x20) == 'e')
+    {
+      e = s + 1;
+      eneg = 0;
+      if (*e == '-' || *e == '+')
+	eneg = (*e++ == '-');
+      if ((unsigned int) (*e - '0') <= 9)
+	{
+	  for (; (unsigned int) (*e - '0') <= 9; e++)
+	    if (ex < 100000)
+	      ex = (ex * 10) + (*e - '0');
+	  s = e;
+	  q += eneg ? -ex : ex;
+	}
+    }
+
+  nw = (nd < 38) ? nd : 38;
+  if (nd == 0 || (q + (long) nw) < -4965)
+    t = 0;
+  else if ((q + (long) nw - 1) > 4932)
+    t = inf;
+  else if (!__VEC_PWR_IMP (vec_f128conv_fast_static) (
+	       &t, ((unsigned __int128) c_h * m_l) + c_l, q, trunc))
+    t = __VEC_PWR_IMP (vec_f128conv_exact_static) (d0, nd,
+						   q - (long) (nd - nw));
+
+done:
+  if (endptr)
+    *endptr = (char *) s;
+  if (neg)
+    t |= (unsigned __int128) 1 << 127;
+  return vec_xfer_vui128t_2_bin128 (vec_transfer_uint128_to_vui128t (t));
+}
+
+
+/* Double and float to decimal strings. This is Ryu (d2s) with the
+   full 125-bit tables vec128_f64powof5[] and vec128_f64recipof5[].
+   A float goes through the same code with its own significand,
+   exponent and interval, which gives the same digits as Ryu f2s.
+
+   Values are formatted as lane pairs. The 64 x 128-bit products of
+   both lanes go through vec_vmuleud() and vec_vmuloud(), and the
+   digits of both through one vec_bcdcfud(). Only the digit removal
+   loop, which is data dependent, runs per lane.  */
+#define VEC_F64CONV_BITS 125
+
+static const char vec_f64conv_sp[3][6] = { "0e+00", "inf", "nan" };
+
+/* x is a multiple of 5**p, p <= 27.  */
+static inline int
+__VEC_PWR_IMP (vec_f64conv_mulof5_static) (unsigned long long x, long p)
+{
+  return (x % (unsigned long long) vec_transfer_vui128t_to_uint128 (
+      vec128_powof5[p])) == 0;
+}
+
+/* Remove the digits vp and vm do not need from vr and round. Add the
+   number of digits removed to *e10 and return the digits.  */
+static inline unsigned long long
+__VEC_PWR_IMP (vec_f64conv_trim_static) (unsigned long long vr,
+					 unsigned long long vp,
+					 unsigned long long vm, long *e10,
+					 int even, int vrtz, int vmtz)
+{
+  unsigned long long vrd, vpd, vmd;
+  int last = 0;
+
+  if (!vrtz && !vmtz)
+    {
+      // The usual case, no exact value to track. Try 2 digits at
+      // a time first.
+      vpd = vp / 100;
+      vmd = vm / 100;
+      if (vpd > vmd)
+	{
+	  vrd = vr / 100;
+	  last = (vr - (vrd * 100)) >= 50;
+	  vr = vrd;
+	  vp = vpd;
+	  vm = vmd;
+	  *e10 += 2;
+	}
+      for (;;)
+	{
+	  vpd = vp / 10;
+	  vmd = vm / 10;
+	  if (vpd <= vmd)
+	    break;
+	  vrd = vr / 10;
+	  last = (vr - (vrd * 10)) >= 5;
+	  vr = vrd;
+	  vp = vpd;
+	  vm = vmd;
+	  *e10 += 1;
+	}
+      return vr + (vr == vm || last);
+    }
+
+  for (;;)
+    {
+      vpd = vp / 10;
+      vmd = vm / 10;
+      if (vpd <= vmd)
+	break;
+      vrd = vr / 10;
+      vmtz &= (vm - (vmd * 10)) == 0;
+      vrtz &= last == 0;
+      last = (int) (vr - (vrd * 10));
+      vr = vrd;
+      vp = vpd;
+      vm = vmd;
+      *e10 += 1;
+    }
+  if (vmtz)
+    for (;;)
+      {
+	vmd = vm / 10;
+	if (vm != (vmd * 10))
+	  break;
+	vpd = vp / 10;
+	vrd = vr / 10;
+	vrtz &= last == 0;
+	last = (int) (vr - (vrd * 10));
+	vr = vrd;
+	vp = vpd;
+	vm = vmd;
+	*e10 += 1;
+      }
+  if (vrtz && last == 5 && (vr & 1) == 0)
+    last = 4;
+  return vr + ((vr == vm && (!even || !vmtz)) || last >= 5);
+}
+
+/* Store the decimal digits of x0 and x1 (< 10**17) as 17 characters
+   each.  */
+static void
+__VEC_PWR_IMP (vec_f64conv_digits2_static) (unsigned char *d0,
+					    unsigned char *d1,
+					    unsigned long long x0,
+					    unsigned long long x1)
+{
+  const unsigned long long e16 = 10000000000000000ULL;
+  const vui8_t dmask = vec_splat_u8 (15);
+  const vui8_t zone = vec_splats ((unsigned char) '0');
+  unsigned long long h0 = x0 / e16, h1 = x1 / e16;
+  __VEC_U_128 t;
+  vBCD_t b;
+  vui8_t z;
+
+  // The low 16 digits of both as unsigned BCD doublewords, then
+  // each as signed BCD for vec_bcdctz.
+  t.ulong.upper = x0 - (h0 * e16);
+  t.ulong.lower = x1 - (h1 * e16);
+  b = vec_bcdcfud (t.vx2);
+  z = vec_bcdctz (vec_bcdcpsgn ((vBCD_t) vec_srqi ((vui128_t) b, 60),
+				_BCD_CONST_PLUS_ONE));
+  __VEC_PWR_IMP (vec_bcdrec_st_static) (d0 + 1, 16,
+					vec_or (vec_and (z, dmask), zone));
+  z = vec_bcdctz (vec_bcdcpsgn ((vBCD_t) vec_slqi ((vui128_t) b, 4),
+				_BCD_CONST_PLUS_ONE));
+  __VEC_PWR_IMP (vec_bcdrec_st_static) (d1 + 1, 16,
+					vec_or (vec_and (z, dmask), zone));
+  d0[0] = '0' + h0;
+  d1[0] = '0' + h1;
+}
+
+/* Format x[0], and x[1] if nl == 2, as double (f32 == 0) or float
+   (f32 != 0, in the low word) bits. The strings are separated by
+   sep. Return the length, not including the terminating null.  */
+static int
+__VEC_PWR_IMP (vec_f64conv_ctstr2_static) (char *buf,
+					   const unsigned long long *x,
+					   int nl, int f32, char sep)
+{
+  const int mb = f32 ? 23 : 52;
+  const long emax = f32 ? 0xff : 0x7ff;
+  const long bias = f32 ? 127 : 1023;
+  const vui128_t *mul[2];
+  unsigned long long m[3][2], v[3][2], vr[2], vpdec[2], m2, mv;
+  __VEC_U_128 t;
+  vui128_t mlo, mhi, pe, po, he, ho;
+  unsigned __int128 s;
+  unsigned char d[2][17];
+  long e2, ex, q, i, k, e10[2], j[2];
+  int l, n, len, sp[2], sgn[2], even[2], vrtz[2], vmtz[2], mmshift;
+  char *p = buf;
+
+  for (l = 0; l < 2; l++)
+    {
+      m[0][l] = m[1][l] = m[2][l] = 0;
+      mul[l] = vec128_f64powof5;
+      j[l] = 64;
+      vr[l] = 0;
+    }
+
+  for (l = 0; l < nl; l++)
+    {
+      ex = (x[l] >> mb) & emax;
+      m2 = x[l] & ((1ULL << mb) - 1);
+      sgn[l] = (x[l] >> (f32 ? 31 : 63)) & 1;
+      // Zero, infinity and NaN are strings from vec_f64conv_sp.
+      sp[l] = -1;
+      if (ex == emax || (ex == 0 && m2 == 0))
+	{
+	  sp[l] = (ex == 0) ? 0 : (m2 != 0) ? 2 : 1;
+	  continue;
+	}
+
+      // The lower neighbor is closer for a power of 2, except the
+      // smallest normal.
+      mmshift = (m2 != 0) || (ex <= 1);
+      if (ex == 0)
+	e2 = 1 - bias - mb - 2;
+      else
+	{
+	  e2 = ex - bias - mb - 2;
+	  m2 |= 1ULL << mb;
+	}
+      even[l] = (m2 & 1) == 0;
+      mv = 4 * m2;
+      m[0][l] = mv;
+      m[1][l] = mv + 2;
+      m[2][l] = mv - 1 - mmshift;
+      vrtz[l] = vmtz[l] = 0;
+      vpdec[l] = 0;
+
+      // vr, vp and vm are (mv, mv + 2, mm) * 2**e2 / 10**e10,
+      // truncated, and vrtz and vmtz are set if vr or vm are exact.
+      if (e2 >= 0)
+	{
+	  q = __VEC_PWR_IMP (vec_f128conv_log10pow2_static) (e2) - (e2 > 3);
+	  e10[l] = q;
+	  k = VEC_F64CONV_BITS
+	      + __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (q) - 1;
+	  j[l] = -e2 + q + k;
+	  mul[l] = &vec128_f64recipof5[q];
+	  // 5**21 is the largest power of 5 that can divide mv.
+	  if (q <= 21)
+	    {
+	      if ((mv % 5) == 0)
+		vrtz[l] = __VEC_PWR_IMP (vec_f64conv_mulof5_static) (mv, q);
+	      else if (even[l])
+		vmtz[l] = __VEC_PWR_IMP (vec_f64conv_mulof5_static) (
+		    m[2][l], q);
+	      else
+		vpdec[l] = __VEC_PWR_IMP (vec_f64conv_mulof5_static) (
+		    m[1][l], q);
+	    }
+	}
+      else
+	{
+	  q = __VEC_PWR_IMP (vec_f128conv_log10pow5_static) (-e2)
+	      - (-e2 > 1);
+	  e10[l] = q + e2;
+	  i = -e2 - q;
+	  k = __VEC_PWR_IMP (vec_f128conv_pow5bits_static) (i)
+	      - VEC_F64CONV_BITS;
+	  j[l] = q - k;
+	  mul[l] = &vec128_f64powof5[i];
+	  if (q <= 1)
+	    {
+	      vrtz[l] = 1;
+	      if (even[l])
+		vmtz[l] = mmshift;
+	      else
+		vpdec[l] = 1;
+	    }
+	  else if (q < 63)
+	    vrtz[l] = (mv & ((1ULL << q) - 1)) == 0;
+	}
+    }
+
+  // (m * mul) >> j for mv, mv + 2 and mm of both lanes. The even
+  // doubleword products are lane 0, the odd lane 1.
+  mlo = (vui128_t) vec_mrgald (*mul[0], *mul[1]);
+  mhi = (vui128_t) vec_mrgahd (*mul[0], *mul[1]);
+  for (n = 0; n < 3; n++)
+    {
+      t.ulong.upper = m[n][0];
+      t.ulong.lower = m[n][1];
+      pe = vec_vmuleud (t.vx2, (vui64_t) mlo);
+      po = vec_vmuloud (t.vx2, (vui64_t) mlo);
+      he = vec_vmuleud (t.vx2, (vui64_t) mhi);
+      ho = vec_vmuloud (t.vx2, (vui64_t) mhi);
+      pe = vec_adduqm (vec_srqi (pe, 64), he);
+      po = vec_adduqm (vec_srqi (po, 64), ho);
+      s = vec_transfer_vui128t_to_uint128 (pe);
+      v[n][0] = (unsigned long long) (s >> (j[0] - 64));
+      s = vec_transfer_vui128t_to_uint128 (po);
+      v[n][1] = (unsigned long long) (s >> (j[1] - 64));
+    }
+
+  for (l = 0; l < nl; l++)
+    if (sp[l] < 0)
+      vr[l] = __VEC_PWR_IMP (vec_f64conv_trim_static) (
+	  v[0][l], v[1][l] - vpdec[l], v[2][l], &e10[l], even[l], vrtz[l],
+	  vmtz[l]);
+  __VEC_PWR_IMP (vec_f64conv_digits2_static) (d[0], d[1], vr[0], vr[1]);
+
+  for (l = 0; l < nl; l++)
+    {
+      if (l != 0)
+	*p++ = sep;
+      if (sgn[l])
+	*p++ = '-';
+      if (sp[l] >= 0)
+	{
+	  len = (sp[l] == 0) ? 5 : 3;
+	  memcpy (p, vec_f64conv_sp[sp[l]], len + 1);
+	  p += len;
+	  continue;
+	}
+      len = __VEC_PWR_IMP (vec_f128conv_len_static) (vr[l]);
+      p += __VEC_PWR_IMP (vec_f128conv_put_static) (p, d[l] + 17 - len,
+						     len, e10[l]);
+    }
+  return p - buf;
+}
+
+int
+__VEC_PWR_IMP (vec_f64_ctstr) (char *buf, double f64)
+{
+  unsigned long long x[1];
+
+  memcpy (x, &f64, sizeof (f64));
+  return __VEC_PWR_IMP (vec_f64conv_ctstr2_static) (buf, x, 1, 0, 0);
+}
+
+int
+__VEC_PWR_IMP (vec_f32_ctstr) (char *buf, float f32)
+{
+  unsigned int w;
+  unsigned long long x[1];
+
+  memcpy (&w, &f32, sizeof (f32));
+  x[0] = w;
+  return __VEC_PWR_IMP (vec_f64conv_ctstr2_static) (buf, x, 1, 1, 0);
+}
+
+long
+__VEC_PWR_IMP (vec_f64_ctstr_array) (char *buf, const double *f64,
+				     unsigned long n, char sep)
+{
+  unsigned long long x[2];
+  unsigned long i;
+  char *p = buf;
+
+  for (i = 0; i < n; i += 2)
+    {
+      if (i != 0)
+	*p++ = sep;
+      memcpy (x, &f64[i], sizeof (double) * ((n - i) > 1 ? 2 : 1));
+      p += __VEC_PWR_IMP (vec_f64conv_ctstr2_static) (
+	  p, x, (n - i) > 1 ? 2 : 1, 0, sep);
+    }
+  *p = '\0';
+  return p - buf;
+}
+
+long
+__VEC_PWR_IMP (vec_f32_ctstr_array) (char *buf, const float *f32,
+				     unsigned long n, char sep)
+{
+  unsigned int w[2];
+  unsigned long long x[2];
+  unsigned long i;
+  char *p = buf;
+
+  for (i = 0; i < n; i += 2)
+    {
+      if (i != 0)
+	*p++ = sep;
+      w[1] = 0;
+      memcpy (w, &f32[i], sizeof (float) * ((n - i) > 1 ? 2 : 1));
+      x[0] = w[0];
+      x[1] = w[1];
+      p += __VEC_PWR_IMP (vec_f64conv_ctstr2_static) (
+	  p, x, (n - i) > 1 ? 2 : 1, 1, sep);
+    }
+  *p = '\0';
+  return p - buf;
+}
+
+/* _Decimal128/_Decimal64 batch sum, dot product and scale.
+
+   The binary path decodes the DPD coefficients with vec_dpd2bin[] and
+   keeps the exact sums of the positive and negative terms as
+   VEC_DFPSUM_Q quadword integers, scaled to the smallest exponent
+   seen. The only rounding is the final conversion
+   (vec_dfpconv_cfN_static). Any infinity or NaN, or an exponent
+   spread the sums can not hold, goes to the DFP loop instead.  */
+#define VEC_DFPSUM_Q 32
+/* Above any (sum of) _Decimal128 exponents.  */
+#define VEC_DFPSUM_ENONE 0x7fffffffL
+
+/* Decode the _Decimal128 bits x to the coefficient *c, exponent *e
+   and sign *neg. Return 0 for infinity or NaN.  */
+static inline int
+__VEC_PWR_IMP (vec_dfpsum_dec128_static) (vui128_t x, vui128_t *c, long *e,
+					  int *neg)
+{
+  unsigned __int128 t = vec_transfer_vui128t_to_uint128 (x);
+  unsigned long long h = t >> 64, l = t;
+  unsigned long long hi, lo;
+  unsigned int g, i;
+
+  // The combination field holds the leading digit and the exponent
+  // high 2 bits, then 12 bits of exponent and 11 declets.
+  g = (h >> 58) & 0x1f;
+  if ((g & 0x18) == 0x18)
+    {
+      if ((g & 0x1e) == 0x1e)
+	return 0;
+      hi = 8 + (g & 1);
+      *e = (g >> 1) & 3;
+    }
+  else
+    {
+      hi = g & 7;
+      *e = g >> 3;
+    }
+  *e = ((*e << 12) | ((h >> 46) & 0xfff)) - 6176;
+  *neg = h >> 63;
+  for (i = 10; i > 6; i--)
+    hi = hi * 1000 + vec_dpd2bin[(h >> (10 * i - 64)) & 0x3ff];
+  hi = hi * 1000 + vec_dpd2bin[((h << 4) | (l >> 60)) & 0x3ff];
+  for (lo = 0, i = 6; i > 0; i--)
+    lo = lo * 1000 + vec_dpd2bin[(l >> (10 * (i - 1))) & 0x3ff];
+  *c = vec_transfer_uint128_to_vui128t (
+      (unsigned __int128) hi * 1000000000000000000ULL + lo);
+  return 1;
+}
+
+/* Decode the _Decimal64 bits x as vec_dfpsum_dec128_static.  */
+static inline int
+__VEC_PWR_IMP (vec_dfpsum_dec64_static) (unsigned long long x,
+					 unsigned long long *c, long *e,
+					 int *neg)
+{
+  unsigned long long hi;
+  unsigned int g, i;
+
+  g = (x >> 58) & 0x1f;
+  if ((g & 0x18) == 0x18)
+    {
+      if ((g & 0x1e) == 0x1e)
+	return 0;
+      hi = 8 + (g & 1);
+      *e = (g >> 1) & 3;
+    }
+  else
+    {
+      hi = g & 7;
+      *e = g >> 3;
+    }
+  *e = ((*e << 8) | ((x >> 50) & 0xff)) - 398;
+  *neg = x >> 63;
+  for (i = 5; i > 0; i--)
+    hi = hi * 1000 + vec_dpd2bin[(x >> (10 * (i - 1))) & 0x3ff];
+  *c = hi;
+  return 1;
+}
+
+/* Encode the coefficient c < 10**34 and exponent -6176 <= e <= 6111
+   as _Decimal128 bits.  */
+static inline vui128_t
+__VEC_PWR_IMP (vec_dfpsum_enc128_static) (vui128_t c, long e, int neg)
+{
+  unsigned long long hi, lo, h, l, w;
+  unsigned int g, eb = e + 6176, i;
+
+  hi = vec_transfer_vui128t_to_uint128 (vec_div10k_uq (c, 18));
+  lo = (unsigned long long) vec_transfer_vui128t_to_uint128 (c)
+      - hi * 1000000000000000000ULL;
+  for (l = 0, i = 0; i < 6; i++, lo /= 1000)
+    l |= (unsigned long long) vec_bin2dpd[lo % 1000] << (10 * i);
+  for (w = 0, i = 0; i < 5; i++, hi /= 1000)
+    w |= (unsigned long long) vec_bin2dpd[hi % 1000] << (10 * i);
+  // hi is now the leading digit.
+  if (hi < 8)
+    g = ((eb >> 12) << 3) | hi;
+  else
+    g = 0x18 | ((eb >> 12) << 1) | (hi & 1);
+  l |= w << 60;
+  h = (w >> 4) | ((unsigned long long) (eb & 0xfff) << 46)
+      | ((unsigned long long) g << 58) | ((unsigned long long) neg << 63);
+  return vec_transfer_uint128_to_vui128t (((unsigned __int128) h << 64) | l);
+}
+
+/* Encode the coefficient c < 10**16 and exponent -398 <= e <= 369
+   as _Decimal64 bits.  */
+static inline unsigned long long
+__VEC_PWR_IMP (vec_dfpsum_enc64_static) (unsigned long long c, long e,
+					 int neg)
+{
+  unsigned long long w;
+  unsigned int g, eb = e + 398, i;
+
+  for (w = 0, i = 0; i < 5; i++, c /= 1000)
+    w |= (unsigned long long) vec_bin2dpd[c % 1000] << (10 * i);
+  if (c < 8)
+    g = ((eb >> 8) << 3) | c;
+  else
+    g = 0x18 | ((eb >> 8) << 1) | (c & 1);
+  return w | ((unsigned long long) (eb & 0xff) << 50)
+      | ((unsigned long long) g << 58) | ((unsigned long long) neg << 63);
+}
+
+static inline vui128_t
+__VEC_PWR_IMP (vec_dfpsum_bits128_static) (_Decimal128 d)
+{
+  return (vui128_t) vec_pack_Decimal128 (d);
+}
+
+static inline _Decimal128
+__VEC_PWR_IMP (vec_dfpsum_from128_static) (vui128_t x)
+{
+  return vec_unpack_Decimal128 ((vf64_t) x);
+}
+
+/* Scale the n quadword x by 10**k. Return the new length, or 0 if it
+   may not fit in cap - 1 quadwords (leaving room for the carry of an
+   add).  */
+static unsigned long
+__VEC_PWR_IMP (vec_dfpsum_mul10k_static) (vui128_t *x, unsigned long cap,
+					  unsigned long n, long k)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t *xp, carry;
+  int ck;
+
+  // 10**38 < 2**128, so each 38 digits adds at most one quadword.
+  if (n + (k + 37) / 38 >= cap)
+    return 0;
+  for (; k > 0; k -= ck)
+    {
+      ck = (k < 38) ? k : 38;
+      xp = VEC_DFPCONV_P (x, cap, n);
+      carry = __VEC_PWR_IMP (vec_mul10k_byN) (xp, xp, ck, n);
+      if (vec_cmpuq_all_ne (carry, zero))
+	VEC_DFPCONV_Q (x, cap, n++) = carry;
+    }
+  return n;
+}
+
+/* Add (-1)**neg * (t1 * 2**128 + t0) * 10**e to the sums x[neg] of
+   nx[neg] quadwords at exponent *ae. Quadwords of x above nx are
+   zero. Return 0 if the sums would not fit.  */
+static int
+__VEC_PWR_IMP (vec_dfpsum_add_static) (vui128_t x[2][VEC_DFPSUM_Q],
+				       unsigned long *nx, long *ae,
+				       vui128_t t0, vui128_t t1, long e,
+				       int neg)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t t[VEC_DFPSUM_Q], c;
+  unsigned long tn, i, j;
+
+  if (e < *ae)
+    {
+      for (j = 0; j < 2; j++)
+	if (nx[j] != 0)
+	  {
+	    nx[j] = __VEC_PWR_IMP (vec_dfpsum_mul10k_static) (x[j],
+							       VEC_DFPSUM_Q,
+							       nx[j], *ae - e);
+	    if (nx[j] == 0)
+	      return 0;
+	  }
+      *ae = e;
+    }
+  if (vec_cmpuq_all_ne (t1, zero))
+    tn = 2;
+  else if (vec_cmpuq_all_ne (t0, zero))
+    tn = 1;
+  else
+    return 1;
+
+  VEC_DFPCONV_Q (t, VEC_DFPSUM_Q, 0) = t0;
+  VEC_DFPCONV_Q (t, VEC_DFPSUM_Q, 1) = t1;
+  if (e > *ae)
+    {
+      tn = __VEC_PWR_IMP (vec_dfpsum_mul10k_static) (t, VEC_DFPSUM_Q, tn,
+						      e - *ae);
+      if (tn == 0)
+	return 0;
+    }
+  if (nx[neg] + 1 >= VEC_DFPSUM_Q)
+    return 0;
+
+  c = zero;
+  for (i = 0; i < tn; i++)
+    VEC_DFPCONV_Q (x[neg], VEC_DFPSUM_Q, i) = vec_addeq (
+	&c, VEC_DFPCONV_Q (x[neg], VEC_DFPSUM_Q, i),
+	VEC_DFPCONV_Q (t, VEC_DFPSUM_Q, i), c);
+  for (; vec_cmpuq_all_ne (c, zero); i++)
+    VEC_DFPCONV_Q (x[neg], VEC_DFPSUM_Q, i) = vec_addeq (
+	&c, VEC_DFPCONV_Q (x[neg], VEC_DFPSUM_Q, i), zero, c);
+  if (i > nx[neg])
+    nx[neg] = i;
+  return 1;
+}
+
+/* Round the difference of the sums x[0] - x[1] at exponent ae to
+   *r. zneg is set if all terms were negative (for the sign of a 0
+   result). Return 0 if the result may be out of the normal range.  */
+static int
+__VEC_PWR_IMP (vec_dfpsum_result_static) (_Decimal128 *r,
+					  vui128_t x[2][VEC_DFPSUM_Q],
+					  unsigned long *nx, long ae, int zneg)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  const vui128_t one = (vui128_t) CONST_VINT128_W (0, 0, 0, 1);
+  vui128_t a, b, c;
+  unsigned long n, i;
+  long d;
+  int p;
+
+  if (ae < -6176)
+    return 0;
+  for (p = 0; p < 2; p++)
+    while (nx[p] != 0
+	   && vec_cmpuq_all_eq (VEC_DFPCONV_Q (x[p], VEC_DFPSUM_Q, nx[p] - 1),
+				zero))
+      nx[p]--;
+
+  // p selects the larger magnitude.
+  p = nx[1] > nx[0];
+  if (nx[0] == nx[1])
+    for (i = nx[0]; i > 0; i--)
+      {
+	a = VEC_DFPCONV_Q (x[0], VEC_DFPSUM_Q, i - 1);
+	b = VEC_DFPCONV_Q (x[1], VEC_DFPSUM_Q, i - 1);
+	if (vec_cmpuq_all_ne (a, b))
+	  {
+	    p = vec_cmpuq_all_lt (a, b);
+	    break;
+	  }
+      }
+  n = nx[p];
+  c = one;
+  for (i = 0; i < n; i++)
+    {
+      a = VEC_DFPCONV_Q (x[p], VEC_DFPSUM_Q, i);
+      b = VEC_DFPCONV_Q (x[1 - p], VEC_DFPSUM_Q, i);
+      VEC_DFPCONV_Q (x[p], VEC_DFPSUM_Q, i) = vec_subeuqm (a, b, c);
+      c = vec_subecuq (a, b, c);
+    }
+  while (n != 0
+	 && vec_cmpuq_all_eq (VEC_DFPCONV_Q (x[p], VEC_DFPSUM_Q, n - 1), zero))
+    n--;
+
+  if (n == 0)
+    {
+      if (ae > 6111)
+	return 0;
+      *r = __builtin_diexq (ae + 6176, zneg ? -0.0DL : 0.0DL);
+      return 1;
+    }
+  // Digits beyond 34 raise the exponent. 1233/4096 is just under
+  // log10(2), so the estimate can be 2 below the digit count. One
+  // more in the test for a rounding carry.
+  d = ((__VEC_PWR_IMP (vec_dfpconv_bitlenN_static) (x[p], VEC_DFPSUM_Q, n)
+	* 1233) >> 12) + 2;
+  if (ae + ((d > 34) ? d - 34 : 0) + 1 > 6111)
+    return 0;
+  *r = __VEC_PWR_IMP (vec_dfpconv_cfN_static) (x[p], VEC_DFPSUM_Q, n, ae,
+					       p);
+  return 1;
+}
+
+static void
+__VEC_PWR_IMP (vec_dfpsum_init_static) (vui128_t x[2][VEC_DFPSUM_Q],
+					unsigned long *nx, long *ae)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  unsigned long i;
+
+  for (i = 0; i < VEC_DFPSUM_Q; i++)
+    {
+      x[0][i] = zero;
+      x[1][i] = zero;
+    }
+  nx[0] = 0;
+  nx[1] = 0;
+  *ae = VEC_DFPSUM_ENONE;
+}
+
+_Decimal128
+__VEC_PWR_IMP (vec_dfp128_sum_array) (_Decimal128 *a, unsigned long n)
+{
+  _Decimal128 r;
+  unsigned long i;
+#ifdef _ARCH_PWR8
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t x[2][VEC_DFPSUM_Q], c;
+  unsigned long nx[2];
+  long e, ae;
+  int neg, zneg = 1;
+
+  __VEC_PWR_IMP (vec_dfpsum_init_static) (x, nx, &ae);
+  for (i = 0; i < n; i++)
+    {
+      if (!__VEC_PWR_IMP (vec_dfpsum_dec128_static) (
+	  __VEC_PWR_IMP (vec_dfpsum_bits128_static) (a[i]), &c, &e, &neg)
+	  || !__VEC_PWR_IMP (vec_dfpsum_add_static) (x, nx, &ae, c, zero, e,
+						     neg))
+	break;
+      zneg &= neg;
+    }
+  if (i == n && n != 0
+      && __VEC_PWR_IMP (vec_dfpsum_result_static) (&r, x, nx, ae, zneg))
+    return r;
+#endif
+  if (n == 0)
+    return 0.0DL;
+  r = a[0];
+  for (i = 1; i < n; i++)
+    r += a[i];
+  return r;
+}
+
+_Decimal128
+__VEC_PWR_IMP (vec_dfp128_dot_array) (_Decimal128 *a, _Decimal128 *b,
+				      unsigned long n)
+{
+  _Decimal128 r;
+  unsigned long i;
+#ifdef _ARCH_PWR8
+  vui128_t x[2][VEC_DFPSUM_Q], ca, cb;
+  __VEC_U_256 p;
+  unsigned long nx[2];
+  long ea, eb, ae;
+  int na, nb, zneg = 1;
+
+  __VEC_PWR_IMP (vec_dfpsum_init_static) (x, nx, &ae);
+  for (i = 0; i < n; i++)
+    {
+      if (!__VEC_PWR_IMP (vec_dfpsum_dec128_static) (
+	  __VEC_PWR_IMP (vec_dfpsum_bits128_static) (a[i]), &ca, &ea, &na)
+	  || !__VEC_PWR_IMP (vec_dfpsum_dec128_static) (
+	      __VEC_PWR_IMP (vec_dfpsum_bits128_static) (b[i]), &cb, &eb,
+	      &nb))
+	break;
+      p = vec_mul128x128_inline (ca, cb);
+      if (!__VEC_PWR_IMP (vec_dfpsum_add_static) (x, nx, &ae, p.vx0, p.vx1,
+						  ea + eb, na ^ nb))
+	break;
+      zneg &= na ^ nb;
+    }
+  if (i == n && n != 0
+      && __VEC_PWR_IMP (vec_dfpsum_result_static) (&r, x, nx, ae, zneg))
+    return r;
+#endif
+  if (n == 0)
+    return 0.0DL;
+  r = a[0] * b[0];
+  for (i = 1; i < n; i++)
+    r += a[i] * b[i];
+  return r;
+}
+
+void
+__VEC_PWR_IMP (vec_dfp128_scale_array) (_Decimal128 *r, _Decimal128 *a,
+					_Decimal128 s, unsigned long n)
+{
+  unsigned long i;
+#ifdef _ARCH_PWR8
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  const vui128_t ten34 = (vui128_t) CONST_VINT128_DW128 (
+      0x0001ed09bead87c0UL, 0x378d8e6400000000UL);
+  vui128_t cs, ca;
+  __VEC_U_256 p;
+  long es, ea;
+  int ns, na;
+
+  // The exact product is the DFP result when it fits the coefficient
+  // and exponent range.
+  if (__VEC_PWR_IMP (vec_dfpsum_dec128_static) (
+      __VEC_PWR_IMP (vec_dfpsum_bits128_static) (s), &cs, &es, &ns))
+    {
+      for (i = 0; i < n; i++)
+	{
+	  if (__VEC_PWR_IMP (vec_dfpsum_dec128_static) (
+	      __VEC_PWR_IMP (vec_dfpsum_bits128_static) (a[i]), &ca, &ea,
+	      &na))
+	    {
+	      p = vec_mul128x128_inline (ca, cs);
+	      ea += es;
+	      if (vec_cmpuq_all_eq (p.vx1, zero)
+		  && vec_cmpuq_all_lt (p.vx0, ten34)
+		  && ea >= -6176 && ea <= 6111)
+		{
+		  r[i] = __VEC_PWR_IMP (vec_dfpsum_from128_static) (
+		      __VEC_PWR_IMP (vec_dfpsum_enc128_static) (p.vx0, ea,
+								na ^ ns));
+		  continue;
+		}
+	    }
+	  r[i] = a[i] * s;
+	}
+      return;
+    }
+#endif
+  for (i = 0; i < n; i++)
+    r[i] = a[i] * s;
+}
+
+_Decimal128
+__VEC_PWR_IMP (vec_dfp64_sum_array) (_Decimal64 *a, unsigned long n)
+{
+  _Decimal128 r;
+  unsigned long i;
+#ifdef _ARCH_PWR8
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t x[2][VEC_DFPSUM_Q];
+  unsigned long long w, c;
+  unsigned long nx[2];
+  long e, ae;
+  int neg, zneg = 1;
+
+  __VEC_PWR_IMP (vec_dfpsum_init_static) (x, nx, &ae);
+  for (i = 0; i < n; i++)
+    {
+      memcpy (&w, &a[i], sizeof (w));
+      if (!__VEC_PWR_IMP (vec_dfpsum_dec64_static) (w, &c, &e, &neg)
+	  || !__VEC_PWR_IMP (vec_dfpsum_add_static) (
+	      x, nx, &ae, vec_transfer_uint128_to_vui128t (c), zero, e, neg))
+	break;
+      zneg &= neg;
+    }
+  if (i == n && n != 0
+      && __VEC_PWR_IMP (vec_dfpsum_result_static) (&r, x, nx, ae, zneg))
+    return r;
+#endif
+  if (n == 0)
+    return 0.0DL;
+  r = a[0];
+  for (i = 1; i < n; i++)
+    r += a[i];
+  return r;
+}
+
+_Decimal128
+__VEC_PWR_IMP (vec_dfp64_dot_array) (_Decimal64 *a, _Decimal64 *b,
+				     unsigned long n)
+{
+  _Decimal128 r;
+  unsigned long i;
+#ifdef _ARCH_PWR8
+  const vui128_t zero = (vui128_t) vec_splat_u32 (0);
+  vui128_t x[2][VEC_DFPSUM_Q];
+  unsigned long long w, ca, cb;
+  unsigned long nx[2];
+  long ea, eb, ae;
+  int na, nb, zneg = 1;
+
+  __VEC_PWR_IMP (vec_dfpsum_init_static) (x, nx, &ae);
+  for (i = 0; i < n; i++)
+    {
+      memcpy (&w, &a[i], sizeof (w));
+      if (!__VEC_PWR_IMP (vec_dfpsum_dec64_static) (w, &ca, &ea, &na))
+	break;
+      memcpy (&w, &b[i], sizeof (w));
+      if (!__VEC_PWR_IMP (vec_dfpsum_dec64_static) (w, &cb, &eb, &nb)
+	  || !__VEC_PWR_IMP (vec_dfpsum_add_static) (
+	      x, nx, &ae,
+	      vec_transfer_uint128_to_vui128t ((unsigned __int128) ca * cb),
+	      zero, ea + eb, na ^ nb))
+	break;
+      zneg &= na ^ nb;
+    }
+  if (i == n && n != 0
+      && __VEC_PWR_IMP (vec_dfpsum_result_static) (&r, x, nx, ae, zneg))
+    return r;
+#endif
+  if (n == 0)
+    return 0.0DL;
+  r = (_Decimal128) a[0] * b[0];
+  for (i = 1; i < n; i++)
+    r += (_Decimal128) a[i] * b[i];
+  return r;
+}
+
+void
+__VEC_PWR_IMP (vec_dfp64_scale_array) (_Decimal64 *r, _Decimal64 *a,
+				       _Decimal64 s, unsigned long n)
+{
+  unsigned long i;
+#ifdef _ARCH_PWR8
+  unsigned long long w, cs, ca;
+  unsigned __int128 p;
+  long es, ea;
+  int ns, na;
+
+  memcpy (&w, &s, sizeof (w));
+  if (__VEC_PWR_IMP (vec_dfpsum_dec64_static) (w, &cs, &es, &ns))
+    {
+      for (i = 0; i < n; i++)
+	{
+	  memcpy (&w, &a[i], sizeof (w));
+	  if (__VEC_PWR_IMP (vec_dfpsum_dec64_static) (w, &ca, &ea, &na))
+	    {
+	      p = (unsigned __int128) ca * cs;
+	      ea += es;
+	      if (p < 10000000000000000ULL && ea >= -398 && ea <= 369)
+		{
+		  w = __VEC_PWR_IMP (vec_dfpsum_enc64_static) (p, ea,
+							       na ^ ns);
+		  memcpy (&r[i], &w, sizeof (w));
+		  continue;
+		}
+	    }
+	  r[i] = a[i] * s;
+	}
+      return;
+    }
+#endif
+  for (i = 0; i < n; i++)
+    r[i] = a[i] * s;
+}
+
+#endif /* PVECLIB_DISABLE_DFP */
@@ -0,0 +1,671 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_f128_runtime.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/* Out-of-line, platform suffixed (__VEC_PWR_IMP) implementations of
+   the binary128 arithmetic, conversions, linear algebra kernels and
+   polynomial arrays of vec_f128_ppc.h.
+   Included by vec_runtime_PWR7/8/9/10.c. The POWER9/10 variants use
+   the native quad-precision instructions, older platforms the
+   vector integer emulation.  */
+
+#include <string.h>
+#include <pveclib/vec_f128_ppc.h>
+
+#ifndef PVECLIB_DISABLE_F128ARITH
+__binary128
+__VEC_PWR_IMP (vec_xsaddqpo) (__binary128 vfa, __binary128 vfb)
+{
+  return vec_xsaddqpo (vfa, vfb);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xssubqpo) (__binary128 vfa, __binary128 vfb)
+{
+  return vec_xssubqpo (vfa, vfb);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xsmulqpo) (__binary128 vfa, __binary128 vfb)
+{
+  return vec_xsmulqpo (vfa, vfb);
+}
+
+vf64_t
+__VEC_PWR_IMP (vec_xscvqpdpo) (__binary128 f128)
+{
+  return vec_xscvqpdpo (f128);
+}
+
+vui64_t
+__VEC_PWR_IMP (vec_xscvqpudz) (__binary128 f128)
+{
+  return vec_xscvqpudz (f128);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_xscvqpuqz) (__binary128 f128)
+{
+  return vec_xscvqpuqz (f128);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xsrqpi_rnd) (__binary128 f128, vec_round_t rnd)
+{
+  return vec_xsrqpi_rnd (f128, rnd);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_fmodf128) (__binary128 f128x, __binary128 f128y)
+{
+  return vec_fmodf128 (f128x, f128y);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_remainderf128) (__binary128 f128x, __binary128 f128y)
+{
+  return vec_remainderf128 (f128x, f128y);
+}
+
+/* The array conversions of the binary128 conversion matrix. Each
+   iteration converts 4 independent elements, so the compiler can
+   interleave the emulation sequences (POWER8, and the quadword
+   conversions of POWER9) instead of waiting out the latency of each
+   conversion in turn.  */
+#define VEC_F128CONV_ARRAY(RTYPE, CONV) \
+  { \
+    RTYPE t0, t1, t2, t3; \
+    unsigned long i; \
+    for (i = 0; (i + 4) <= n; i += 4) \
+      { \
+	t0 = CONV (a[i]); \
+	t1 = CONV (a[i + 1]); \
+	t2 = CONV (a[i + 2]); \
+	t3 = CONV (a[i + 3]); \
+	r[i] = t0; \
+	r[i + 1] = t1; \
+	r[i + 2] = t2; \
+	r[i + 3] = t3; \
+      } \
+    for (; i < n; i++) \
+      r[i] = CONV (a[i]); \
+  }
+
+#define VEC_F128CONV_CFF64(X) vec_xscvdpqp (vec_splats (X))
+#define VEC_F128CONV_CTF64(X) (vec_xscvqpdp_rnd ((X), rnd)[VEC_DW_H])
+#define VEC_F128CONV_CFF32(X) vec_xscvspqp (vec_splats (X))
+#define VEC_F128CONV_CTF32(X) (vec_xscvqpsp_rnd ((X), rnd)[VEC_W_H])
+#define VEC_F128CONV_CFSD(X) \
+  vec_xscvsdqp (vec_splats ((signed long long) (X)))
+#define VEC_F128CONV_CFUD(X) \
+  vec_xscvudqp (vec_splats ((unsigned long long) (X)))
+#define VEC_F128CONV_CTSWZ(X) ((int) vec_xscvqpswz (X)[VEC_DW_H])
+#define VEC_F128CONV_CTUWZ(X) ((unsigned int) vec_xscvqpuwz (X)[VEC_DW_H])
+#define VEC_F128CONV_CTSDZ(X) (vec_xscvqpsdz (X)[VEC_DW_H])
+#define VEC_F128CONV_CTUDZ(X) (vec_xscvqpudz (X)[VEC_DW_H])
+
+void
+__VEC_PWR_IMP (vec_f128_cff64_array) (__binary128 *r, const double *a,
+				      unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, VEC_F128CONV_CFF64);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctf64_array) (double *r, const __binary128 *a,
+				      vec_round_t rnd, unsigned long n)
+{
+  VEC_F128CONV_ARRAY (double, VEC_F128CONV_CTF64);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cff32_array) (__binary128 *r, const float *a,
+				      unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, VEC_F128CONV_CFF32);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctf32_array) (float *r, const __binary128 *a,
+				      vec_round_t rnd, unsigned long n)
+{
+  VEC_F128CONV_ARRAY (float, VEC_F128CONV_CTF32);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cfsw_array) (__binary128 *r, const int *a,
+				     unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, VEC_F128CONV_CFSD);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctswz_array) (int *r, const __binary128 *a,
+				      unsigned long n)
+{
+  VEC_F128CONV_ARRAY (int, VEC_F128CONV_CTSWZ);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cfuw_array) (__binary128 *r, const unsigned int *a,
+				     unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, VEC_F128CONV_CFUD);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctuwz_array) (unsigned int *r, const __binary128 *a,
+				      unsigned long n)
+{
+  VEC_F128CONV_ARRAY (unsigned int, VEC_F128CONV_CTUWZ);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cfsd_array) (__binary128 *r, const long long *a,
+				     unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, VEC_F128CONV_CFSD);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctsdz_array) (long long *r, const __binary128 *a,
+				      unsigned long n)
+{
+  VEC_F128CONV_ARRAY (long long, VEC_F128CONV_CTSDZ);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cfud_array) (__binary128 *r,
+				     const unsigned long long *a,
+				     unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, VEC_F128CONV_CFUD);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctudz_array) (unsigned long long *r,
+				      const __binary128 *a, unsigned long n)
+{
+  VEC_F128CONV_ARRAY (unsigned long long, VEC_F128CONV_CTUDZ);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cfsq_array) (__binary128 *r, const vi128_t *a,
+				     unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, vec_xscvsqqp);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctsqz_array) (vi128_t *r, const __binary128 *a,
+				      unsigned long n)
+{
+  VEC_F128CONV_ARRAY (vi128_t, vec_xscvqpsqz);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cfuq_array) (__binary128 *r, const vui128_t *a,
+				     unsigned long n)
+{
+  VEC_F128CONV_ARRAY (__binary128, vec_xscvuqqp);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctuqz_array) (vui128_t *r, const __binary128 *a,
+				      unsigned long n)
+{
+  VEC_F128CONV_ARRAY (vui128_t, vec_xscvqpuqz);
+}
+
+/* The IBM long double migration kernels. The IBM long double is
+   loaded and stored as its two doubles (high part at the lower
+   address) with memcpy, so the arrays may be unaligned and the
+   conversion may run in place (r == a) without aliasing problems.
+   Load 4 elements, convert, then store, so an in place conversion
+   never overwrites unread input.  */
+static inline vf64_t
+__VEC_PWR_IMP (vec_f128_ldibm_static) (const __IBM128 *a)
+{
+  double d[2];
+  vf64_t result;
+
+  memcpy (d, a, sizeof (d));
+  result[VEC_DW_H] = d[0];
+  result[VEC_DW_L] = d[1];
+  return result;
+}
+
+static inline void
+__VEC_PWR_IMP (vec_f128_stibm_static) (__IBM128 *r, vf64_t lval)
+{
+  double d[2];
+
+  d[0] = lval[VEC_DW_H];
+  d[1] = lval[VEC_DW_L];
+  memcpy (r, d, sizeof (d));
+}
+
+static inline __binary128
+__VEC_PWR_IMP (vec_f128_ldqp_static) (const __binary128 *a)
+{
+  __binary128 result;
+
+  memcpy (&result, a, sizeof (result));
+  return result;
+}
+
+static inline void
+__VEC_PWR_IMP (vec_f128_stqp_static) (__binary128 *r, __binary128 f128)
+{
+  memcpy (r, &f128, sizeof (f128));
+}
+
+void
+__VEC_PWR_IMP (vec_f128_cfibm_array) (__binary128 *r, const __IBM128 *a,
+				      unsigned long n)
+{
+  vf64_t l0, l1, l2, l3;
+  __binary128 t0, t1, t2, t3;
+  unsigned long i;
+
+  for (i = 0; (i + 4) <= n; i += 4)
+    {
+      l0 = __VEC_PWR_IMP (vec_f128_ldibm_static) (&a[i]);
+      l1 = __VEC_PWR_IMP (vec_f128_ldibm_static) (&a[i + 1]);
+      l2 = __VEC_PWR_IMP (vec_f128_ldibm_static) (&a[i + 2]);
+      l3 = __VEC_PWR_IMP (vec_f128_ldibm_static) (&a[i + 3]);
+      t0 = vec_xscvibmqp (l0);
+      t1 = vec_xscvibmqp (l1);
+      t2 = vec_xscvibmqp (l2);
+      t3 = vec_xscvibmqp (l3);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i], t0);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i + 1], t1);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i + 2], t2);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i + 3], t3);
+    }
+  for (; i < n; i++)
+    __VEC_PWR_IMP (vec_f128_stqp_static) (
+	&r[i], vec_xscvibmqp (__VEC_PWR_IMP (vec_f128_ldibm_static) (&a[i])));
+}
+
+void
+__VEC_PWR_IMP (vec_f128_ctibm_array) (__IBM128 *r, const __binary128 *a,
+				      unsigned long n)
+{
+  __binary128 q0, q1, q2, q3;
+  vf64_t t0, t1, t2, t3;
+  unsigned long i;
+
+  for (i = 0; (i + 4) <= n; i += 4)
+    {
+      q0 = __VEC_PWR_IMP (vec_f128_ldqp_static) (&a[i]);
+      q1 = __VEC_PWR_IMP (vec_f128_ldqp_static) (&a[i + 1]);
+      q2 = __VEC_PWR_IMP (vec_f128_ldqp_static) (&a[i + 2]);
+      q3 = __VEC_PWR_IMP (vec_f128_ldqp_static) (&a[i + 3]);
+      t0 = vec_xscvqpibm (q0);
+      t1 = vec_xscvqpibm (q1);
+      t2 = vec_xscvqpibm (q2);
+      t3 = vec_xscvqpibm (q3);
+      __VEC_PWR_IMP (vec_f128_stibm_static) (&r[i], t0);
+      __VEC_PWR_IMP (vec_f128_stibm_static) (&r[i + 1], t1);
+      __VEC_PWR_IMP (vec_f128_stibm_static) (&r[i + 2], t2);
+      __VEC_PWR_IMP (vec_f128_stibm_static) (&r[i + 3], t3);
+    }
+  for (; i < n; i++)
+    __VEC_PWR_IMP (vec_f128_stibm_static) (
+	&r[i], vec_xscvqpibm (__VEC_PWR_IMP (vec_f128_ldqp_static) (&a[i])));
+}
+
+/* The binary128 linear algebra kernels. The __binary128 and double
+   forms share the loop nests below, which differ only in the element
+   load (LD). vec_f128_ldf64_static converts the double exactly, so
+   the products of the f64 forms are exact even for POWER8, where
+   vec_xsmaddqpo() is not fused.
+
+   Each multiply-add depends on the previous one through its
+   accumulator, so the loops keep independent accumulators in flight:
+   4 partial sums for a dot product, 4 rows of A for gemv and a 2x4
+   block of C for gemm (each element of B is loaded once for 2 rows
+   and each element of A once for 4 columns). The rows and columns
+   left over are computed as strided dot products.
+
+   The partial sums are rounded to odd. The last multiply-add of each
+   sum, and the alpha and beta scaling, round to nearest, so the
+   stored and returned results are not biased toward odd.  */
+static inline __binary128
+__VEC_PWR_IMP (vec_f128_ldf64_static) (const double *a)
+{
+  return vec_xscvdpqp (vec_splats (*a));
+}
+
+/* Return alpha * s + beta * y, or alpha * s if beta is zero (y is not
+   read), rounded to nearest.  */
+static inline __binary128
+__VEC_PWR_IMP (vec_f128_axpby_static) (__binary128 alpha, __binary128 s,
+				       __binary128 beta, int beta0,
+				       const __binary128 *y)
+{
+  if (beta0)
+    return vec_xsmulqpn (alpha, s);
+  else
+    return vec_xsmaddqpn (alpha, s,
+			  vec_xsmulqpn (beta,
+					__VEC_PWR_IMP (vec_f128_ldqp_static) (y)));
+}
+
+/* Define NAME (a, b, ldb, n) returning the sum of a[i] * b[i * ldb].
+   The last product is added to the sum of the partial sums, rounded
+   to nearest.  */
+#define VEC_F128_DOT_STRIDED(NAME, TYPE, LD) \
+  static __binary128 \
+  NAME (const TYPE *a, const TYPE *b, unsigned long ldb, unsigned long n) \
+  { \
+    const __binary128 zero = vec_xfer_vui32t_2_bin128 (vec_splat_u32 (0)); \
+    __binary128 s0, s1, s2, s3; \
+    unsigned long i; \
+    if (n == 0) \
+      return zero; \
+    n = n - 1; \
+    s0 = s1 = s2 = s3 = zero; \
+    for (i = 0; (i + 4) <= n; i += 4) \
+      { \
+	s0 = vec_xsmaddqpo (LD (&a[i]), LD (&b[i * ldb]), s0); \
+	s1 = vec_xsmaddqpo (LD (&a[i + 1]), LD (&b[(i + 1) * ldb]), s1); \
+	s2 = vec_xsmaddqpo (LD (&a[i + 2]), LD (&b[(i + 2) * ldb]), s2); \
+	s3 = vec_xsmaddqpo (LD (&a[i + 3]), LD (&b[(i + 3) * ldb]), s3); \
+      } \
+    for (; i < n; i++) \
+      s0 = vec_xsmaddqpo (LD (&a[i]), LD (&b[i * ldb]), s0); \
+    s0 = vec_xsaddqpo (vec_xsaddqpo (s0, s1), vec_xsaddqpo (s2, s3)); \
+    return vec_xsmaddqpn (LD (&a[n]), LD (&b[n * ldb]), s0); \
+  }
+
+VEC_F128_DOT_STRIDED (__VEC_PWR_IMP (vec_f128_dotqp_strided_static),
+		      __binary128, __VEC_PWR_IMP (vec_f128_ldqp_static))
+VEC_F128_DOT_STRIDED (__VEC_PWR_IMP (vec_f128_dotdp_strided_static), double,
+		      __VEC_PWR_IMP (vec_f128_ldf64_static))
+
+#define VEC_F128_GEMV(LD, DOT) \
+  { \
+    const __binary128 zero = vec_xfer_vui32t_2_bin128 (vec_splat_u32 (0)); \
+    const int beta0 = vec_all_iszerof128 (beta); \
+    __binary128 s0, s1, s2, s3, xj; \
+    unsigned long i, j; \
+    for (i = 0; (i + 4) <= m; i += 4) \
+      { \
+	s0 = s1 = s2 = s3 = zero; \
+	for (j = 0; (j + 1) < n; j++) \
+	  { \
+	    xj = LD (&x[j]); \
+	    s0 = vec_xsmaddqpo (LD (&A[i * lda + j]), xj, s0); \
+	    s1 = vec_xsmaddqpo (LD (&A[(i + 1) * lda + j]), xj, s1); \
+	    s2 = vec_xsmaddqpo (LD (&A[(i + 2) * lda + j]), xj, s2); \
+	    s3 = vec_xsmaddqpo (LD (&A[(i + 3) * lda + j]), xj, s3); \
+	  } \
+	if (j < n) \
+	  { \
+	    xj = LD (&x[j]); \
+	    s0 = vec_xsmaddqpn (LD (&A[i * lda + j]), xj, s0); \
+	    s1 = vec_xsmaddqpn (LD (&A[(i + 1) * lda + j]), xj, s1); \
+	    s2 = vec_xsmaddqpn (LD (&A[(i + 2) * lda + j]), xj, s2); \
+	    s3 = vec_xsmaddqpn (LD (&A[(i + 3) * lda + j]), xj, s3); \
+	  } \
+	s0 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	    alpha, s0, beta, beta0, &y[i]); \
+	s1 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	    alpha, s1, beta, beta0, &y[i + 1]); \
+	s2 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	    alpha, s2, beta, beta0, &y[i + 2]); \
+	s3 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	    alpha, s3, beta, beta0, &y[i + 3]); \
+	__VEC_PWR_IMP (vec_f128_stqp_static) (&y[i], s0); \
+	__VEC_PWR_IMP (vec_f128_stqp_static) (&y[i + 1], s1); \
+	__VEC_PWR_IMP (vec_f128_stqp_static) (&y[i + 2], s2); \
+	__VEC_PWR_IMP (vec_f128_stqp_static) (&y[i + 3], s3); \
+      } \
+    for (; i < m; i++) \
+      { \
+	s0 = DOT (&A[i * lda], x, 1, n); \
+	__VEC_PWR_IMP (vec_f128_stqp_static) (&y[i], \
+		       __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+		           alpha, s0, beta, beta0, &y[i])); \
+      } \
+  }
+
+#define VEC_F128_GEMM(LD, DOT) \
+  { \
+    const __binary128 zero = vec_xfer_vui32t_2_bin128 (vec_splat_u32 (0)); \
+    const int beta0 = vec_all_iszerof128 (beta); \
+    __binary128 c00, c01, c02, c03, c10, c11, c12, c13; \
+    __binary128 a0, a1, b0, b1, b2, b3, s; \
+    unsigned long i, j, p, ic; \
+    for (i = 0; (i + 2) <= m; i += 2) \
+      { \
+	for (j = 0; (j + 4) <= n; j += 4) \
+	  { \
+	    c00 = c01 = c02 = c03 = zero; \
+	    c10 = c11 = c12 = c13 = zero; \
+	    for (p = 0; (p + 1) < k; p++) \
+	      { \
+		a0 = LD (&A[i * lda + p]); \
+		a1 = LD (&A[(i + 1) * lda + p]); \
+		b0 = LD (&B[p * ldb + j]); \
+		b1 = LD (&B[p * ldb + j + 1]); \
+		b2 = LD (&B[p * ldb + j + 2]); \
+		b3 = LD (&B[p * ldb + j + 3]); \
+		c00 = vec_xsmaddqpo (a0, b0, c00); \
+		c01 = vec_xsmaddqpo (a0, b1, c01); \
+		c02 = vec_xsmaddqpo (a0, b2, c02); \
+		c03 = vec_xsmaddqpo (a0, b3, c03); \
+		c10 = vec_xsmaddqpo (a1, b0, c10); \
+		c11 = vec_xsmaddqpo (a1, b1, c11); \
+		c12 = vec_xsmaddqpo (a1, b2, c12); \
+		c13 = vec_xsmaddqpo (a1, b3, c13); \
+	      } \
+	    if (p < k) \
+	      { \
+		a0 = LD (&A[i * lda + p]); \
+		a1 = LD (&A[(i + 1) * lda + p]); \
+		b0 = LD (&B[p * ldb + j]); \
+		b1 = LD (&B[p * ldb + j + 1]); \
+		b2 = LD (&B[p * ldb + j + 2]); \
+		b3 = LD (&B[p * ldb + j + 3]); \
+		c00 = vec_xsmaddqpn (a0, b0, c00); \
+		c01 = vec_xsmaddqpn (a0, b1, c01); \
+		c02 = vec_xsmaddqpn (a0, b2, c02); \
+		c03 = vec_xsmaddqpn (a0, b3, c03); \
+		c10 = vec_xsmaddqpn (a1, b0, c10); \
+		c11 = vec_xsmaddqpn (a1, b1, c11); \
+		c12 = vec_xsmaddqpn (a1, b2, c12); \
+		c13 = vec_xsmaddqpn (a1, b3, c13); \
+	      } \
+	    ic = i * ldc + j; \
+	    c00 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c00, beta, beta0, &C[ic]); \
+	    c01 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c01, beta, beta0, &C[ic + 1]); \
+	    c02 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c02, beta, beta0, &C[ic + 2]); \
+	    c03 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c03, beta, beta0, &C[ic + 3]); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic], c00); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic + 1], c01); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic + 2], c02); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic + 3], c03); \
+	    ic += ldc; \
+	    c10 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c10, beta, beta0, &C[ic]); \
+	    c11 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c11, beta, beta0, &C[ic + 1]); \
+	    c12 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c12, beta, beta0, &C[ic + 2]); \
+	    c13 = __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+	        alpha, c13, beta, beta0, &C[ic + 3]); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic], c10); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic + 1], c11); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic + 2], c12); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic + 3], c13); \
+	  } \
+	for (; j < n; j++) \
+	  { \
+	    ic = i * ldc + j; \
+	    s = DOT (&A[i * lda], &B[j], ldb, k); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic], \
+			   __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+			       alpha, s, beta, beta0, &C[ic])); \
+	    ic += ldc; \
+	    s = DOT (&A[(i + 1) * lda], &B[j], ldb, k); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic], \
+			   __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+			       alpha, s, beta, beta0, &C[ic])); \
+	  } \
+      } \
+    if (i < m) \
+      { \
+	for (j = 0; j < n; j++) \
+	  { \
+	    ic = i * ldc + j; \
+	    s = DOT (&A[i * lda], &B[j], ldb, k); \
+	    __VEC_PWR_IMP (vec_f128_stqp_static) (&C[ic], \
+			   __VEC_PWR_IMP (vec_f128_axpby_static) ( \
+			       alpha, s, beta, beta0, &C[ic])); \
+	  } \
+      } \
+  }
+
+__binary128
+__VEC_PWR_IMP (vec_f128_dot_array) (const __binary128 *a,
+				    const __binary128 *b, unsigned long n)
+{
+  return __VEC_PWR_IMP (vec_f128_dotqp_strided_static) (a, b, 1, n);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_f128_dotf64_array) (const double *a, const double *b,
+				       unsigned long n)
+{
+  return __VEC_PWR_IMP (vec_f128_dotdp_strided_static) (a, b, 1, n);
+}
+
+void
+__VEC_PWR_IMP (vec_f128_gemv) (unsigned long m, unsigned long n,
+			       __binary128 alpha, const __binary128 *A,
+			       unsigned long lda, const __binary128 *x,
+			       __binary128 beta, __binary128 *y)
+{
+  VEC_F128_GEMV (__VEC_PWR_IMP (vec_f128_ldqp_static),
+		 __VEC_PWR_IMP (vec_f128_dotqp_strided_static));
+}
+
+void
+__VEC_PWR_IMP (vec_f128_gemvf64) (unsigned long m, unsigned long n,
+				  __binary128 alpha, const double *A,
+				  unsigned long lda, const double *x,
+				  __binary128 beta, __binary128 *y)
+{
+  VEC_F128_GEMV (__VEC_PWR_IMP (vec_f128_ldf64_static),
+		 __VEC_PWR_IMP (vec_f128_dotdp_strided_static));
+}
+
+void
+__VEC_PWR_IMP (vec_f128_gemm) (unsigned long m, unsigned long n,
+			       unsigned long k, __binary128 alpha,
+			       const __binary128 *A, unsigned long lda,
+			       const __binary128 *B, unsigned long ldb,
+			       __binary128 beta, __binary128 *C,
+			       unsigned long ldc)
+{
+  VEC_F128_GEMM (__VEC_PWR_IMP (vec_f128_ldqp_static),
+		 __VEC_PWR_IMP (vec_f128_dotqp_strided_static));
+}
+
+void
+__VEC_PWR_IMP (vec_f128_gemmf64) (unsigned long m, unsigned long n,
+				  unsigned long k, __binary128 alpha,
+				  const double *A, unsigned long lda,
+				  const double *B, unsigned long ldb,
+				  __binary128 beta, __binary128 *C,
+				  unsigned long ldc)
+{
+  VEC_F128_GEMM (__VEC_PWR_IMP (vec_f128_ldf64_static),
+		 __VEC_PWR_IMP (vec_f128_dotdp_strided_static));
+}
+
+/* The polynomial arrays. Each iteration evaluates 4 independent
+   arguments, as the conversion arrays, so the multiply-add chains of
+   the 4 polynomials overlap.  */
+void
+__VEC_PWR_IMP (vec_polyf128_array) (__binary128 *r, const __binary128 *x,
+				    const __binary128 *c, unsigned long deg,
+				    unsigned long n)
+{
+  __binary128 t0, t1, t2, t3;
+  unsigned long i;
+
+  for (i = 0; (i + 4) <= n; i += 4)
+    {
+      t0 = vec_polyf128 (__VEC_PWR_IMP (vec_f128_ldqp_static) (&x[i]), c, deg);
+      t1 = vec_polyf128 (__VEC_PWR_IMP (vec_f128_ldqp_static) (&x[i + 1]),
+			 c, deg);
+      t2 = vec_polyf128 (__VEC_PWR_IMP (vec_f128_ldqp_static) (&x[i + 2]),
+			 c, deg);
+      t3 = vec_polyf128 (__VEC_PWR_IMP (vec_f128_ldqp_static) (&x[i + 3]),
+			 c, deg);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i], t0);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i + 1], t1);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i + 2], t2);
+      __VEC_PWR_IMP (vec_f128_stqp_static) (&r[i + 3], t3);
+    }
+  for (; i < n; i++)
+    __VEC_PWR_IMP (vec_f128_stqp_static) (
+	&r[i], vec_polyf128 (__VEC_PWR_IMP (vec_f128_ldqp_static) (&x[i]),
+			     c, deg));
+}
+
+#define VEC_F128POLY_F64(X) \
+  (vec_xscvqpdp_rnd ( \
+       vec_polyf128o (__VEC_PWR_IMP (vec_f128_ldf64_static) (&(X)), c, deg), \
+       rnd)[VEC_DW_H])
+
+void
+__VEC_PWR_IMP (vec_polyf128f64_array) (double *r, const double *x,
+				       const __binary128 *c,
+				       unsigned long deg, vec_round_t rnd,
+				       unsigned long n)
+{
+  double t0, t1, t2, t3;
+  unsigned long i;
+
+  for (i = 0; (i + 4) <= n; i += 4)
+    {
+      t0 = VEC_F128POLY_F64 (x[i]);
+      t1 = VEC_F128POLY_F64 (x[i + 1]);
+      t2 = VEC_F128POLY_F64 (x[i + 2]);
+      t3 = VEC_F128POLY_F64 (x[i + 3]);
+      r[i] = t0;
+      r[i + 1] = t1;
+      r[i + 2] = t2;
+      r[i + 3] = t3;
+    }
+  for (; i < n; i++)
+    r[i] = VEC_F128POLY_F64 (x[i]);
+}
+#endif /* PVECLIB_DISABLE_F128ARITH */
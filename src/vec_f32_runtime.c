@@ -0,0 +1,450 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_f32_runtime.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/* Out-of-line, platform suffixed (__VEC_PWR_IMP) implementations of
+   the binary16 and bfloat16 array conversions and dot products of
+   vec_f32_ppc.h. Included by vec_runtime_PWR7/8/9/10.c. The POWER9
+   variants use the binary16 conversion instructions, the POWER10
+   variants the bfloat16 instructions.
+
+   The arrays have no alignment requirement, so the vectors are
+   loaded and stored with memcpy, which the compiler turns into
+   lxvd2x/lxvw4x (and permutes) or lxv. A partial vector at the end
+   is copied through a zero padded buffer.
+
+   The float elementary function arrays follow, using the double
+   kernels of vec_f64_ppc.h through vec_expf32() and friends. Their
+   partial vector is padded with 1.0 instead of 0.0, as log(0.0) is
+   -Inf.  */
+
+#include <string.h>
+#include <pveclib/vec_f32_ppc.h>
+
+static inline vui16_t
+__VEC_PWR_IMP (vec_f16_ld_static) (const unsigned short *a)
+{
+  vui16_t v;
+  memcpy (&v, a, sizeof (v));
+  return v;
+}
+
+static inline vf32_t
+__VEC_PWR_IMP (vec_f32_ld_static) (const float *a)
+{
+  vf32_t v;
+  memcpy (&v, a, sizeof (v));
+  return v;
+}
+
+/* Horizontal sum of the 4 accumulators.  */
+static inline float
+__VEC_PWR_IMP (vec_f16_sum_static) (vf32_t acc0, vf32_t acc1,
+				    vf32_t acc2, vf32_t acc3)
+{
+  vf32_t acc;
+
+  acc = vec_add (vec_add (acc0, acc1), vec_add (acc2, acc3));
+  acc = vec_add (acc, vec_sld (acc, acc, 8));
+  acc = vec_add (acc, vec_sld (acc, acc, 4));
+  return vec_extract (acc, 0);
+}
+
+void
+__VEC_PWR_IMP (vec_cvf16f32_array) (float *r, const unsigned short *a,
+				    unsigned long n)
+{
+  unsigned short ta[8];
+  float tr[8];
+  vui16_t v;
+  vf32_t rh, rl;
+  unsigned long i;
+
+  for (i = 0; (i + 8) <= n; i += 8)
+    {
+      v = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i]);
+      rh = vec_unpackh_f16 (v);
+      rl = vec_unpackl_f16 (v);
+      memcpy (&r[i], &rh, sizeof (rh));
+      memcpy (&r[i + 4], &rl, sizeof (rl));
+    }
+  if (i < n)
+    {
+      memset (ta, 0, sizeof (ta));
+      memcpy (ta, &a[i], (n - i) * sizeof (ta[0]));
+      v = __VEC_PWR_IMP (vec_f16_ld_static) (ta);
+      rh = vec_unpackh_f16 (v);
+      rl = vec_unpackl_f16 (v);
+      memcpy (&tr[0], &rh, sizeof (rh));
+      memcpy (&tr[4], &rl, sizeof (rl));
+      memcpy (&r[i], tr, (n - i) * sizeof (tr[0]));
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_cvf32f16_array) (unsigned short *r, const float *a,
+				    unsigned long n)
+{
+  float ta[8];
+  unsigned short tr[8];
+  vui16_t v;
+  unsigned long i;
+
+  for (i = 0; (i + 8) <= n; i += 8)
+    {
+      v = vec_pack_f16 (__VEC_PWR_IMP (vec_f32_ld_static) (&a[i]),
+			__VEC_PWR_IMP (vec_f32_ld_static) (&a[i + 4]));
+      memcpy (&r[i], &v, sizeof (v));
+    }
+  if (i < n)
+    {
+      memset (ta, 0, sizeof (ta));
+      memcpy (ta, &a[i], (n - i) * sizeof (ta[0]));
+      v = vec_pack_f16 (__VEC_PWR_IMP (vec_f32_ld_static) (&ta[0]),
+			__VEC_PWR_IMP (vec_f32_ld_static) (&ta[4]));
+      memcpy (tr, &v, sizeof (v));
+      memcpy (&r[i], tr, (n - i) * sizeof (tr[0]));
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_cvbf16f32_array) (float *r, const unsigned short *a,
+				     unsigned long n)
+{
+  unsigned short ta[8];
+  float tr[8];
+  vui16_t v;
+  vf32_t rh, rl;
+  unsigned long i;
+
+  for (i = 0; (i + 8) <= n; i += 8)
+    {
+      v = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i]);
+      rh = vec_unpackh_bf16 (v);
+      rl = vec_unpackl_bf16 (v);
+      memcpy (&r[i], &rh, sizeof (rh));
+      memcpy (&r[i + 4], &rl, sizeof (rl));
+    }
+  if (i < n)
+    {
+      memset (ta, 0, sizeof (ta));
+      memcpy (ta, &a[i], (n - i) * sizeof (ta[0]));
+      v = __VEC_PWR_IMP (vec_f16_ld_static) (ta);
+      rh = vec_unpackh_bf16 (v);
+      rl = vec_unpackl_bf16 (v);
+      memcpy (&tr[0], &rh, sizeof (rh));
+      memcpy (&tr[4], &rl, sizeof (rl));
+      memcpy (&r[i], tr, (n - i) * sizeof (tr[0]));
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_cvf32bf16_array) (unsigned short *r, const float *a,
+				     unsigned long n)
+{
+  float ta[8];
+  unsigned short tr[8];
+  vui16_t v;
+  unsigned long i;
+
+  for (i = 0; (i + 8) <= n; i += 8)
+    {
+      v = vec_pack_bf16 (__VEC_PWR_IMP (vec_f32_ld_static) (&a[i]),
+			 __VEC_PWR_IMP (vec_f32_ld_static) (&a[i + 4]));
+      memcpy (&r[i], &v, sizeof (v));
+    }
+  if (i < n)
+    {
+      memset (ta, 0, sizeof (ta));
+      memcpy (ta, &a[i], (n - i) * sizeof (ta[0]));
+      v = vec_pack_bf16 (__VEC_PWR_IMP (vec_f32_ld_static) (&ta[0]),
+			 __VEC_PWR_IMP (vec_f32_ld_static) (&ta[4]));
+      memcpy (tr, &v, sizeof (v));
+      memcpy (&r[i], tr, (n - i) * sizeof (tr[0]));
+    }
+}
+
+/* The dot products take 16 elements per iteration into 4
+   independent accumulators, enough to cover the FMA latency. The
+   tail is zero padded in both operands, which adds +0.0 products.  */
+float
+__VEC_PWR_IMP (vec_dotf16_array) (const unsigned short *a,
+				  const unsigned short *b, unsigned long n)
+{
+  const vf32_t zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+  unsigned short ta[8], tb[8];
+  vf32_t acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+  vui16_t va0, vb0, va1, vb1;
+  unsigned long i;
+
+  for (i = 0; (i + 16) <= n; i += 16)
+    {
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i]);
+      vb0 = __VEC_PWR_IMP (vec_f16_ld_static) (&b[i]);
+      va1 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i + 8]);
+      vb1 = __VEC_PWR_IMP (vec_f16_ld_static) (&b[i + 8]);
+      acc0 = vec_madd (vec_unpackh_f16 (va0), vec_unpackh_f16 (vb0), acc0);
+      acc1 = vec_madd (vec_unpackl_f16 (va0), vec_unpackl_f16 (vb0), acc1);
+      acc2 = vec_madd (vec_unpackh_f16 (va1), vec_unpackh_f16 (vb1), acc2);
+      acc3 = vec_madd (vec_unpackl_f16 (va1), vec_unpackl_f16 (vb1), acc3);
+    }
+  for (; i < n; i += 8)
+    {
+      memset (ta, 0, sizeof (ta));
+      memset (tb, 0, sizeof (tb));
+      memcpy (ta, &a[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (ta[0]));
+      memcpy (tb, &b[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (tb[0]));
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (ta);
+      vb0 = __VEC_PWR_IMP (vec_f16_ld_static) (tb);
+      acc0 = vec_madd (vec_unpackh_f16 (va0), vec_unpackh_f16 (vb0), acc0);
+      acc1 = vec_madd (vec_unpackl_f16 (va0), vec_unpackl_f16 (vb0), acc1);
+    }
+  return __VEC_PWR_IMP (vec_f16_sum_static) (acc0, acc1, acc2, acc3);
+}
+
+float
+__VEC_PWR_IMP (vec_dotf16f32_array) (const unsigned short *a,
+				     const float *b, unsigned long n)
+{
+  const vf32_t zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+  unsigned short ta[8];
+  float tb[8];
+  vf32_t acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+  vui16_t va0, va1;
+  unsigned long i;
+
+  for (i = 0; (i + 16) <= n; i += 16)
+    {
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i]);
+      va1 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i + 8]);
+      acc0 = vec_madd (vec_unpackh_f16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i]), acc0);
+      acc1 = vec_madd (vec_unpackl_f16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i + 4]), acc1);
+      acc2 = vec_madd (vec_unpackh_f16 (va1),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i + 8]), acc2);
+      acc3 = vec_madd (vec_unpackl_f16 (va1),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i + 12]), acc3);
+    }
+  for (; i < n; i += 8)
+    {
+      memset (ta, 0, sizeof (ta));
+      memset (tb, 0, sizeof (tb));
+      memcpy (ta, &a[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (ta[0]));
+      memcpy (tb, &b[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (tb[0]));
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (ta);
+      acc0 = vec_madd (vec_unpackh_f16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&tb[0]), acc0);
+      acc1 = vec_madd (vec_unpackl_f16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&tb[4]), acc1);
+    }
+  return __VEC_PWR_IMP (vec_f16_sum_static) (acc0, acc1, acc2, acc3);
+}
+
+float
+__VEC_PWR_IMP (vec_dotbf16_array) (const unsigned short *a,
+				   const unsigned short *b, unsigned long n)
+{
+  const vf32_t zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+  unsigned short ta[8], tb[8];
+  vf32_t acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+  vui16_t va0, vb0, va1, vb1;
+  unsigned long i;
+
+  for (i = 0; (i + 16) <= n; i += 16)
+    {
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i]);
+      vb0 = __VEC_PWR_IMP (vec_f16_ld_static) (&b[i]);
+      va1 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i + 8]);
+      vb1 = __VEC_PWR_IMP (vec_f16_ld_static) (&b[i + 8]);
+      acc0 = vec_madd (vec_unpackh_bf16 (va0), vec_unpackh_bf16 (vb0), acc0);
+      acc1 = vec_madd (vec_unpackl_bf16 (va0), vec_unpackl_bf16 (vb0), acc1);
+      acc2 = vec_madd (vec_unpackh_bf16 (va1), vec_unpackh_bf16 (vb1), acc2);
+      acc3 = vec_madd (vec_unpackl_bf16 (va1), vec_unpackl_bf16 (vb1), acc3);
+    }
+  for (; i < n; i += 8)
+    {
+      memset (ta, 0, sizeof (ta));
+      memset (tb, 0, sizeof (tb));
+      memcpy (ta, &a[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (ta[0]));
+      memcpy (tb, &b[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (tb[0]));
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (ta);
+      vb0 = __VEC_PWR_IMP (vec_f16_ld_static) (tb);
+      acc0 = vec_madd (vec_unpackh_bf16 (va0), vec_unpackh_bf16 (vb0), acc0);
+      acc1 = vec_madd (vec_unpackl_bf16 (va0), vec_unpackl_bf16 (vb0), acc1);
+    }
+  return __VEC_PWR_IMP (vec_f16_sum_static) (acc0, acc1, acc2, acc3);
+}
+
+float
+__VEC_PWR_IMP (vec_dotbf16f32_array) (const unsigned short *a,
+				      const float *b, unsigned long n)
+{
+  const vf32_t zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+  unsigned short ta[8];
+  float tb[8];
+  vf32_t acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+  vui16_t va0, va1;
+  unsigned long i;
+
+  for (i = 0; (i + 16) <= n; i += 16)
+    {
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i]);
+      va1 = __VEC_PWR_IMP (vec_f16_ld_static) (&a[i + 8]);
+      acc0 = vec_madd (vec_unpackh_bf16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i]), acc0);
+      acc1 = vec_madd (vec_unpackl_bf16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i + 4]), acc1);
+      acc2 = vec_madd (vec_unpackh_bf16 (va1),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i + 8]), acc2);
+      acc3 = vec_madd (vec_unpackl_bf16 (va1),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&b[i + 12]), acc3);
+    }
+  for (; i < n; i += 8)
+    {
+      memset (ta, 0, sizeof (ta));
+      memset (tb, 0, sizeof (tb));
+      memcpy (ta, &a[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (ta[0]));
+      memcpy (tb, &b[i], ((n - i) < 8 ? (n - i) : 8) * sizeof (tb[0]));
+      va0 = __VEC_PWR_IMP (vec_f16_ld_static) (ta);
+      acc0 = vec_madd (vec_unpackh_bf16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&tb[0]), acc0);
+      acc1 = vec_madd (vec_unpackl_bf16 (va0),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&tb[4]), acc1);
+    }
+  return __VEC_PWR_IMP (vec_f16_sum_static) (acc0, acc1, acc2, acc3);
+}
+
+#define VEC_F32MATH_ARRAY(FUNC) \
+  { \
+    float ta[8], tr[8]; \
+    vf32_t r0, r1; \
+    unsigned long i, j; \
+    for (i = 0; (i + 8) <= n; i += 8) \
+      { \
+	r0 = FUNC (__VEC_PWR_IMP (vec_f32_ld_static) (&a[i])); \
+	r1 = FUNC (__VEC_PWR_IMP (vec_f32_ld_static) (&a[i + 4])); \
+	memcpy (&r[i], &r0, sizeof (r0)); \
+	memcpy (&r[i + 4], &r1, sizeof (r1)); \
+      } \
+    if (i < n) \
+      { \
+	for (j = 0; j < 8; j++) \
+	  ta[j] = 1.0f; \
+	memcpy (ta, &a[i], (n - i) * sizeof (ta[0])); \
+	r0 = FUNC (__VEC_PWR_IMP (vec_f32_ld_static) (&ta[0])); \
+	r1 = FUNC (__VEC_PWR_IMP (vec_f32_ld_static) (&ta[4])); \
+	memcpy (&tr[0], &r0, sizeof (r0)); \
+	memcpy (&tr[4], &r1, sizeof (r1)); \
+	memcpy (&r[i], tr, (n - i) * sizeof (tr[0])); \
+      } \
+  }
+
+void
+__VEC_PWR_IMP (vec_cosf32_array) (float *r, const float *a,
+				  unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_cosf32);
+}
+
+void
+__VEC_PWR_IMP (vec_erff32_array) (float *r, const float *a,
+				  unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_erff32);
+}
+
+void
+__VEC_PWR_IMP (vec_exp2f32_array) (float *r, const float *a,
+				   unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_exp2f32);
+}
+
+void
+__VEC_PWR_IMP (vec_expf32_array) (float *r, const float *a,
+				  unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_expf32);
+}
+
+void
+__VEC_PWR_IMP (vec_log2f32_array) (float *r, const float *a,
+				   unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_log2f32);
+}
+
+void
+__VEC_PWR_IMP (vec_logf32_array) (float *r, const float *a,
+				  unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_logf32);
+}
+
+void
+__VEC_PWR_IMP (vec_sinf32_array) (float *r, const float *a,
+				  unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_sinf32);
+}
+
+void
+__VEC_PWR_IMP (vec_tanhf32_array) (float *r, const float *a,
+				   unsigned long n)
+{
+  VEC_F32MATH_ARRAY (vec_tanhf32);
+}
+
+void
+__VEC_PWR_IMP (vec_powf32_array) (float *r, const float *x,
+				  const float *y, unsigned long n)
+{
+  float tx[8], ty[8], tr[8];
+  vf32_t r0, r1;
+  unsigned long i;
+
+  for (i = 0; (i + 8) <= n; i += 8)
+    {
+      r0 = vec_powf32 (__VEC_PWR_IMP (vec_f32_ld_static) (&x[i]),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&y[i]));
+      r1 = vec_powf32 (__VEC_PWR_IMP (vec_f32_ld_static) (&x[i + 4]),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&y[i + 4]));
+      memcpy (&r[i], &r0, sizeof (r0));
+      memcpy (&r[i + 4], &r1, sizeof (r1));
+    }
+  if (i < n)
+    {
+      unsigned long j;
+
+      for (j = 0; j < 8; j++)
+	tx[j] = ty[j] = 1.0f;
+      memcpy (tx, &x[i], (n - i) * sizeof (tx[0]));
+      memcpy (ty, &y[i], (n - i) * sizeof (ty[0]));
+      r0 = vec_powf32 (__VEC_PWR_IMP (vec_f32_ld_static) (&tx[0]),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&ty[0]));
+      r1 = vec_powf32 (__VEC_PWR_IMP (vec_f32_ld_static) (&tx[4]),
+		       __VEC_PWR_IMP (vec_f32_ld_static) (&ty[4]));
+      memcpy (&tr[0], &r0, sizeof (r0));
+      memcpy (&tr[4], &r1, sizeof (r1));
+      memcpy (&r[i], tr, (n - i) * sizeof (tr[0]));
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_f64_runtime.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/* Out-of-line, platform suffixed (__VEC_PWR_IMP) implementations of
+   the elementary function and polynomial arrays of vec_f64_ppc.h.
+   Included by vec_runtime_PWR7/8/9/10.c, so each platform gets the fused
+   multiply-add, gather and conversion sequences of its -mcpu.
+
+   Each iteration evaluates 2 independent vectors, which hides most of
+   the latency of the polynomials. The arrays have no alignment
+   requirement, so the vectors are loaded and stored with memcpy. A
+   partial vector at the end is copied through a buffer padded with
+   1.0, which is in the domain of all the functions.  */
+
+#include <string.h>
+#include <pveclib/vec_f64_ppc.h>
+
+static inline vf64_t
+__VEC_PWR_IMP (vec_f64_ld_static) (const double *a)
+{
+  vf64_t v;
+  memcpy (&v, a, sizeof (v));
+  return v;
+}
+
+#define VEC_F64MATH_ARRAY(FUNC) \
+  { \
+    double ta[4], tr[4]; \
+    vf64_t r0, r1; \
+    unsigned long i; \
+    for (i = 0; (i + 4) <= n; i += 4) \
+      { \
+	r0 = FUNC (__VEC_PWR_IMP (vec_f64_ld_static) (&a[i])); \
+	r1 = FUNC (__VEC_PWR_IMP (vec_f64_ld_static) (&a[i + 2])); \
+	memcpy (&r[i], &r0, sizeof (r0)); \
+	memcpy (&r[i + 2], &r1, sizeof (r1)); \
+      } \
+    if (i < n) \
+      { \
+	ta[0] = ta[1] = ta[2] = ta[3] = 1.0; \
+	memcpy (ta, &a[i], (n - i) * sizeof (ta[0])); \
+	r0 = FUNC (__VEC_PWR_IMP (vec_f64_ld_static) (&ta[0])); \
+	r1 = FUNC (__VEC_PWR_IMP (vec_f64_ld_static) (&ta[2])); \
+	memcpy (&tr[0], &r0, sizeof (r0)); \
+	memcpy (&tr[2], &r1, sizeof (r1)); \
+	memcpy (&r[i], tr, (n - i) * sizeof (tr[0])); \
+      } \
+  }
+
+void
+__VEC_PWR_IMP (vec_cosf64_array) (double *r, const double *a,
+				  unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_cosf64);
+}
+
+void
+__VEC_PWR_IMP (vec_erff64_array) (double *r, const double *a,
+				  unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_erff64);
+}
+
+void
+__VEC_PWR_IMP (vec_exp2f64_array) (double *r, const double *a,
+				   unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_exp2f64);
+}
+
+void
+__VEC_PWR_IMP (vec_expf64_array) (double *r, const double *a,
+				  unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_expf64);
+}
+
+void
+__VEC_PWR_IMP (vec_log2f64_array) (double *r, const double *a,
+				   unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_log2f64);
+}
+
+void
+__VEC_PWR_IMP (vec_logf64_array) (double *r, const double *a,
+				  unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_logf64);
+}
+
+void
+__VEC_PWR_IMP (vec_sinf64_array) (double *r, const double *a,
+				  unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_sinf64);
+}
+
+void
+__VEC_PWR_IMP (vec_tanhf64_array) (double *r, const double *a,
+				   unsigned long n)
+{
+  VEC_F64MATH_ARRAY (vec_tanhf64);
+}
+
+void
+__VEC_PWR_IMP (vec_powf64_array) (double *r, const double *x,
+				  const double *y, unsigned long n)
+{
+  double tx[4], ty[4], tr[4];
+  vf64_t r0, r1;
+  unsigned long i;
+
+  for (i = 0; (i + 4) <= n; i += 4)
+    {
+      r0 = vec_powf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&x[i]),
+		       __VEC_PWR_IMP (vec_f64_ld_static) (&y[i]));
+      r1 = vec_powf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&x[i + 2]),
+		       __VEC_PWR_IMP (vec_f64_ld_static) (&y[i + 2]));
+      memcpy (&r[i], &r0, sizeof (r0));
+      memcpy (&r[i + 2], &r1, sizeof (r1));
+    }
+  if (i < n)
+    {
+      tx[0] = tx[1] = tx[2] = tx[3] = 1.0;
+      ty[0] = ty[1] = ty[2] = ty[3] = 1.0;
+      memcpy (tx, &x[i], (n - i) * sizeof (tx[0]));
+      memcpy (ty, &y[i], (n - i) * sizeof (ty[0]));
+      r0 = vec_powf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&tx[0]),
+		       __VEC_PWR_IMP (vec_f64_ld_static) (&ty[0]));
+      r1 = vec_powf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&tx[2]),
+		       __VEC_PWR_IMP (vec_f64_ld_static) (&ty[2]));
+      memcpy (&tr[0], &r0, sizeof (r0));
+      memcpy (&tr[2], &r1, sizeof (r1));
+      memcpy (&r[i], tr, (n - i) * sizeof (tr[0]));
+    }
+}
+
+/* The polynomial arrays. These are vec_polyf64() and vec_polyf64_dd()
+   over the array, with the same loop as VEC_F64MATH_ARRAY.  */
+void
+__VEC_PWR_IMP (vec_polyf64_array) (double *r, const double *x,
+				   const double *c, unsigned long deg,
+				   unsigned long n)
+{
+  double tx[4], tr[4];
+  vf64_t r0, r1;
+  unsigned long i;
+
+  for (i = 0; (i + 4) <= n; i += 4)
+    {
+      r0 = vec_polyf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&x[i]), c, deg);
+      r1 = vec_polyf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&x[i + 2]), c,
+			deg);
+      memcpy (&r[i], &r0, sizeof (r0));
+      memcpy (&r[i + 2], &r1, sizeof (r1));
+    }
+  if (i < n)
+    {
+      tx[0] = tx[1] = tx[2] = tx[3] = 1.0;
+      memcpy (tx, &x[i], (n - i) * sizeof (tx[0]));
+      r0 = vec_polyf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&tx[0]), c, deg);
+      r1 = vec_polyf64 (__VEC_PWR_IMP (vec_f64_ld_static) (&tx[2]), c, deg);
+      memcpy (&tr[0], &r0, sizeof (r0));
+      memcpy (&tr[2], &r1, sizeof (r1));
+      memcpy (&r[i], tr, (n - i) * sizeof (tr[0]));
+    }
+}
+
+/* Store the double-doubles (h[0], l[0]) and (h[1], l[1]) as 4
+   doubles, high part first.  */
+static inline void
+__VEC_PWR_IMP (vec_f64_st_dd_static) (double *r, vf64_t h, vf64_t l)
+{
+  double th[2], tl[2];
+
+  memcpy (th, &h, sizeof (th));
+  memcpy (tl, &l, sizeof (tl));
+  r[0] = th[0];
+  r[1] = tl[0];
+  r[2] = th[1];
+  r[3] = tl[1];
+}
+
+void
+__VEC_PWR_IMP (vec_polyf64_dd_array) (double *r, const double *x,
+				      const double *c, unsigned long deg,
+				      unsigned long n)
+{
+  double tx[4], tr[8];
+  vf64_t h0, l0, h1, l1;
+  unsigned long i;
+
+  for (i = 0; (i + 4) <= n; i += 4)
+    {
+      h0 = vec_polyf64_dd (__VEC_PWR_IMP (vec_f64_ld_static) (&x[i]), c,
+			   deg, &l0);
+      h1 = vec_polyf64_dd (__VEC_PWR_IMP (vec_f64_ld_static) (&x[i + 2]), c,
+			   deg, &l1);
+      __VEC_PWR_IMP (vec_f64_st_dd_static) (&r[2 * i], h0, l0);
+      __VEC_PWR_IMP (vec_f64_st_dd_static) (&r[2 * i + 4], h1, l1);
+    }
+  if (i < n)
+    {
+      tx[0] = tx[1] = tx[2] = tx[3] = 1.0;
+      memcpy (tx, &x[i], (n - i) * sizeof (tx[0]));
+      h0 = vec_polyf64_dd (__VEC_PWR_IMP (vec_f64_ld_static) (&tx[0]), c,
+			   deg, &l0);
+      h1 = vec_polyf64_dd (__VEC_PWR_IMP (vec_f64_ld_static) (&tx[2]), c,
+			   deg, &l1);
+      __VEC_PWR_IMP (vec_f64_st_dd_static) (&tr[0], h0, l0);
+      __VEC_PWR_IMP (vec_f64_st_dd_static) (&tr[4], h1, l1);
+      memcpy (&r[2 * i], tr, 2 * (n - i) * sizeof (tr[0]));
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_int128_runtime.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/* Out-of-line, platform suffixed (__VEC_PWR_IMP) implementations of
+   the heavier vec_int128_ppc.h operations. Included by
+   vec_runtime_PWR7/8/9/10.c, which are compiled with the matching
+   -mcpu=. libpvec exports IFUNC selectors (FNAME_dyn) over these.  */
+
+#include <pveclib/vec_int128_ppc.h>
+
+vui128_t
+__VEC_PWR_IMP (vec_divuq_10e31) (vui128_t vra)
+{
+  return vec_divuq_10e31 (vra);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_divuq_10e32) (vui128_t vra)
+{
+  return vec_divuq_10e32 (vra);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_moduq_10e31) (vui128_t vra, vui128_t q)
+{
+  return vec_moduq_10e31 (vra, q);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_moduq_10e32) (vui128_t vra, vui128_t q)
+{
+  return vec_moduq_10e32 (vra, q);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_divudq_10e31) (vui128_t *qh, vui128_t vra, vui128_t vrb)
+{
+  return vec_divudq_10e31 (qh, vra, vrb);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_divudq_10e32) (vui128_t *qh, vui128_t vra, vui128_t vrb)
+{
+  return vec_divudq_10e32 (qh, vra, vrb);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_modudq_10e31) (vui128_t vra, vui128_t vrb, vui128_t *ql)
+{
+  return vec_modudq_10e31 (vra, vrb, ql);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_modudq_10e32) (vui128_t vra, vui128_t vrb, vui128_t *ql)
+{
+  return vec_modudq_10e32 (vra, vrb, ql);
+}
+
+vi128_t
+__VEC_PWR_IMP (vec_divsq_10e31) (vi128_t vra)
+{
+  return vec_divsq_10e31 (vra);
+}
+
+vi128_t
+__VEC_PWR_IMP (vec_modsq_10e31) (vi128_t vra, vi128_t q)
+{
+  return vec_modsq_10e31 (vra, q);
+}
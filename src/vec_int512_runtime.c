@@ -883,3 +883,123 @@ __VEC_PWR_IMP (vec_mul512_byMN) (__VEC_U_512 *p,
     }
 }
 
+
+vui128_t __attribute__((flatten ))
+__VEC_PWR_IMP (vec_mul10k_byN) (vui128_t *p, vui128_t *m, unsigned int k,
+				unsigned long N)
+{
+  const vui128_t ten_k = vtipowof10[k];
+  vui128_t c = (vui128_t) ((unsigned __int128) 0);
+  unsigned long nx = N;
+  unsigned long i;
+
+  for (i = 0; i < nx; i++)
+    p[__NDX(i)] = vec_madduq (&c, m[__NDX(i)], ten_k, c);
+
+  return c;
+}
+
+vui128_t __attribute__((flatten ))
+__VEC_PWR_IMP (vec_div10k_byN) (vui128_t *q, vui128_t *n, unsigned int k,
+				vec_round_t rnd, unsigned long N)
+{
+  const vui128_t zero = (vui128_t) ((unsigned __int128) 0);
+  const vui128_t one = (vui128_t) CONST_VINT128_W (0, 0, 0, 1);
+  unsigned long nx = N;
+  unsigned long i;
+  vui128_t r, c, ni, qi, vk, vkl, vshl;
+  __VEC_U_256 t;
+  __VEC_U_512 pq;
+
+  r = zero;
+  if (k == 0)
+    {
+      for (i = 0; i < nx; i++)
+	q[__NDX(i)] = n[__NDX(i)];
+      return r;
+    }
+
+  /* Shift counts for (r || n[i]) >> k and (high 256 bits) >> sh,
+     as left double shifts by (128 - k) and (128 - sh).  */
+  vk = (vui128_t) vec_splats ((unsigned char) k);
+  vkl = (vui128_t) vec_splats ((unsigned char) (128 - k));
+  vshl = (vui128_t) vec_splats ((unsigned char) (128 - vec_recipof10_sh[k]));
+
+  for (i = nx; i-- > 0;)
+    {
+      /* r < 10**k, so each quotient quadword fits in 128 bits.  */
+      ni = n[__NDX(i)];
+      t.vx0 = vec_sldq (r, ni, vkl);
+      t.vx1 = vec_srq (r, vk);
+      pq = __VEC_PWR_IMP (vec_mul256x256) (t, vec256_recipof10[k]);
+      qi = vec_sldq (pq.vx3, pq.vx2, vshl);
+      r = vec_subuqm (ni, vec_mulluq (qi, vtipowof10[k]));
+      q[__NDX(i)] = qi;
+    }
+
+  if (nx > 0 && vec_rnd10k_uq (q[__NDX(0)], r, k, rnd))
+    {
+      c = one;
+      for (i = 0; i < nx && vec_cmpuq_all_ne (c, zero); i++)
+	{
+	  qi = q[__NDX(i)];
+	  q[__NDX(i)] = vec_adduqm (qi, c);
+	  c = vec_addcuq (qi, c);
+	}
+    }
+
+  return r;
+}
+
+long __attribute__((flatten ))
+__VEC_PWR_IMP (vec_rescalesq_array) (vi128_t *r, vi128_t *a, int k,
+				     vec_round_t rnd, unsigned char *ovf,
+				     unsigned long n)
+{
+  const vui128_t zero = (vui128_t) ((unsigned __int128) 0);
+  const vui128_t smax = (vui128_t) CONST_VINT128_W (0x7fffffff, -1, -1, -1);
+  const vui128_t one = (vui128_t) CONST_VINT128_W (0, 0, 0, 1);
+  unsigned long i;
+  unsigned int kx, kk;
+  long novf = 0;
+  vui128_t m, lo, hi, lim;
+  int neg, of;
+
+  if (k <= 0)
+    {
+      kx = -k;
+      for (i = 0; i < n; i++)
+	r[i] = vec_div10k_rnd_sq (a[i], kx, rnd);
+      if (ovf)
+	for (i = 0; i < n; i++)
+	  ovf[i] = 0;
+      return 0;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      neg = vec_cmpsq_all_lt (a[i], (vi128_t) zero);
+      m = (vui128_t) vec_abssq (a[i]);
+      /* 10**k for k > 38 exceeds 128 bits, so any nonzero value
+         overflows. Keep the low order bits of the product.  */
+      of = 0;
+      lo = m;
+      for (kx = k; kx > 0; kx -= kk)
+	{
+	  kk = (kx > 38) ? 38 : kx;
+	  lo = vec_cmul10k_cuq (&hi, lo, kk);
+	  if (vec_cmpuq_all_ne (hi, zero))
+	    of = 1;
+	}
+      /* The magnitude of a negative result may be 2**127.  */
+      lim = neg ? vec_adduqm (smax, one) : smax;
+      if (vec_cmpuq_all_gt (lo, lim))
+	of = 1;
+      r[i] = neg ? vec_negsq ((vi128_t) lo) : (vi128_t) lo;
+      if (ovf)
+	ovf[i] = of;
+      novf += of;
+    }
+
+  return novf;
+}
@@ -48,21 +48,234 @@
  *
  * If __BUILTIN_CPU_SUPPORTS__ is not defined we default to the
  * appropriate (for the platform endian) base platform.
+ *
+ * For testing and performance comparison the environment variable
+ * PVECLIB_CPU (power7, power8, power9, power10) forces the resolvers
+ * to select that platform variant. The override is ignored if the
+ * variant is not built for this endian or the hardware can not
+ * execute it, so it can only select an equal or older platform.
+ * For example:
+ * \code
+ * PVECLIB_CPU=power8 ./my_application
+ * \endcode
+ *
+ * If configured with --enable-profile (PVECLIB_PROFILE) the IFUNC
+ * symbols are renamed FNAME_ifunc and hidden, and the exported
+ * functions become thin wrappers that count calls and timebase ticks
+ * per thread (see vec_profile_ppc.h). Otherwise the exported
+ * functions are the IFUNC symbols and there is no added overhead.
  */
 
+#include <fcntl.h>
+#include <sys/syscall.h>
+
 #include <pveclib/vec_int512_ppc.h>
+#include <pveclib/vec_f128_ppc.h>
+#include <pveclib/vec_bcd_ppc.h>
+#include <pveclib/vec_f32_ppc.h>
+#include "vec_runtime_dispatch.h"
+#ifdef PVECLIB_PROFILE
+#include "vec_runtime_profile.h"
+#endif
+
+#ifdef __BUILTIN_CPU_SUPPORTS__
+/*! \brief Environment variable used to force a platform variant.  */
+#define VEC_DYN_CPU_ENV "PVECLIB_CPU="
+
+/*! \brief Cached result of vec_dyn_cpu_override(), -1 until probed.
+ *
+ * Accessed only with relaxed __atomic loads and stores, as the
+ * resolvers and vec_dispatch_table() may run concurrently. Each
+ * probe computes the same value, so a race only repeats the scan.  */
+static int vec_dyn_cpu_forced = -1;
+
+/*! \brief Linux system call with up to 3 arguments.
+ *
+ * The IFUNC resolvers may run before libc is relocated (static
+ * linking, LD_BIND_NOW or a different relocation order), so they
+ * can not call libc through the PLT or touch errno (TLS). This
+ * issues the sc instruction directly and returns the result, or
+ * -errno on failure (CR0[SO] set).  */
+static long
+vec_dyn_syscall3 (long nr, long arg1, long arg2, long arg3)
+{
+  register long r0 __asm__ ("r0") = nr;
+  register long r3 __asm__ ("r3") = arg1;
+  register long r4 __asm__ ("r4") = arg2;
+  register long r5 __asm__ ("r5") = arg3;
+
+  __asm__ __volatile__ (
+      "sc\n\t"
+      "bns+ 1f\n\t"
+      "neg %1,%1\n"
+      "1:"
+      : "+r" (r0), "+r" (r3), "+r" (r4), "+r" (r5)
+      :
+      : "r6", "r7", "r8", "r9", "r10", "r11", "r12",
+	"cr0", "ctr", "memory");
+  return r3;
+}
+
+/*! \brief Convert a PVECLIB_CPU value (power9, pwr9, POWER9, 9)
+ * to a platform number. Returns 0 if the value is not recognized.  */
+static int
+vec_dyn_parse_cpu (const char *val)
+{
+  int pwr = 0;
+
+  while (*val != '\0' && (*val < '0' || *val > '9'))
+    val++;
+  while (*val >= '0' && *val <= '9')
+    pwr = (pwr * 10) + (*val++ - '0');
+
+  if (pwr < 7 || pwr > 10)
+    pwr = 0;
+  return pwr;
+}
+
+/*! \brief Return the platform variant forced by PVECLIB_CPU.
+ *
+ * IFUNC resolvers run while the dynamic linker is still relocating
+ * the process, before libc has initialized environ. So getenv() is
+ * not reliable here, and calling libc at all is unsafe. Instead scan
+ * /proc/self/environ with raw system calls (vec_dyn_syscall3()),
+ * once, and cache the result for the remaining resolvers.
+ * A constructor would run too late, after the IFUNC relocations.
+ *
+ * The forced variant is only honored if the library provides it and
+ * the host can execute it (for example PVECLIB_CPU=power8 on POWER10
+ * hardware). Otherwise return 0 and let the resolver select the
+ * variant matching the hardware. Without __BUILTIN_CPU_SUPPORTS__
+ * there is only the base variant and no override.
+ */
+static int
+vec_dyn_cpu_override (void)
+{
+  static const char name[] = VEC_DYN_CPU_ENV;
+  char buf[512];
+  char val[16];
+  long fd, n, i;
+  int pwr;
+  int match = 0, vlen = -1;
+
+  pwr = __atomic_load_n (&vec_dyn_cpu_forced, __ATOMIC_RELAXED);
+  if (pwr >= 0)
+    return pwr;
+
+  fd = vec_dyn_syscall3 (__NR_openat, AT_FDCWD,
+			 (long) "/proc/self/environ", O_RDONLY);
+  if (fd < 0)
+    {
+      __atomic_store_n (&vec_dyn_cpu_forced, 0, __ATOMIC_RELAXED);
+      return 0;
+    }
+
+  /* Entries are NUL terminated NAME=value strings. Match the name
+     from the start of each entry then collect the value.  */
+  while (vlen < (int) sizeof (val)
+	 && (n = vec_dyn_syscall3 (__NR_read, fd, (long) buf,
+				   sizeof (buf))) > 0)
+    {
+      for (i = 0; i < n; i++)
+	{
+	  char c = buf[i];
+
+	  if (vlen >= 0)
+	    {
+	      if (c == '\0' || vlen == (int) sizeof (val) - 1)
+		{
+		  val[vlen] = '\0';
+		  vlen = sizeof (val);
+		  break;
+		}
+	      val[vlen++] = c;
+	    }
+	  else if (c == '\0')
+	    match = 0;
+	  else if (match >= 0)
+	    {
+	      if (c == name[match])
+		{
+		  match++;
+		  if (name[match] == '\0')
+		    vlen = 0;
+		}
+	      else
+		match = -1;
+	    }
+	}
+    }
+  vec_dyn_syscall3 (__NR_close, fd, 0, 0);
+
+  if (vlen < 0)
+    {
+      __atomic_store_n (&vec_dyn_cpu_forced, 0, __ATOMIC_RELAXED);
+      return 0;
+    }
+  if (vlen < (int) sizeof (val))
+    val[vlen] = '\0';
+
+  pwr = vec_dyn_parse_cpu (val);
+  switch (pwr)
+    {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#ifndef PVECLIB_DISABLE_POWER7
+    case 7:
+      break;
+#endif
+#else
+#ifndef PVECLIB_DISABLE_POWER10
+    case 10:
+      if (!__builtin_cpu_supports ("arch_3_1"))
+	pwr = 0;
+      break;
+#endif
+#endif
+#ifndef PVECLIB_DISABLE_POWER9
+    case 9:
+      if (!__builtin_cpu_supports ("arch_3_00"))
+	pwr = 0;
+      break;
+#endif
+    case 8:
+      if (!__builtin_cpu_supports ("arch_2_07"))
+	pwr = 0;
+      break;
+    default:
+      pwr = 0;
+    }
+  __atomic_store_n (&vec_dyn_cpu_forced, pwr, __ATOMIC_RELAXED);
+  return pwr;
+}
+#endif /* __BUILTIN_CPU_SUPPORTS__ */
 
-/*! \brief Macro to expand the parameterize resolver. */
+/*! \brief Macro to expand the parameterize resolver.
+ *
+ * The PVECLIB_CPU environment variable (see vec_dyn_cpu_override())
+ * takes precedence over the hardware platform.  */
 #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
 #ifdef __BUILTIN_CPU_SUPPORTS__
 #ifdef PVECLIB_DISABLE_POWER9
 #define VEC_DYN_RESOLVER(FNAME) \
+  switch (vec_dyn_cpu_override ()) \
+    { \
+    case 8: return FNAME ## _PWR8; \
+    case 7: return FNAME ## _PWR7; \
+    default: break; \
+    } \
   if (__builtin_cpu_is ("power8")) \
     return FNAME ## _PWR8; \
   else \
     return FNAME ## _PWR7;
 #else
 #define VEC_DYN_RESOLVER(FNAME) \
+  switch (vec_dyn_cpu_override ()) \
+    { \
+    case 9: return FNAME ## _PWR9; \
+    case 8: return FNAME ## _PWR8; \
+    case 7: return FNAME ## _PWR7; \
+    default: break; \
+    } \
   if (__builtin_cpu_is ("power9")) \
     return FNAME ## _PWR9; \
   else if (__builtin_cpu_is ("power8")) \
@@ -78,12 +291,25 @@
 #ifdef  __BUILTIN_CPU_SUPPORTS__
 #ifdef PVECLIB_DISABLE_POWER10
 #define VEC_DYN_RESOLVER(FNAME) \
+  switch (vec_dyn_cpu_override ()) \
+    { \
+    case 9: return FNAME ## _PWR9; \
+    case 8: return FNAME ## _PWR8; \
+    default: break; \
+    } \
   if (__builtin_cpu_is ("power9")) \
     return FNAME ## _PWR9; \
   else \
     return FNAME ## _PWR8;
 #else
 #define VEC_DYN_RESOLVER(FNAME) \
+  switch (vec_dyn_cpu_override ()) \
+    { \
+    case 10: return FNAME ## _PWR10; \
+    case 9: return FNAME ## _PWR9; \
+    case 8: return FNAME ## _PWR8; \
+    default: break; \
+    } \
   if (__builtin_cpu_is ("power10")) \
     return FNAME ## _PWR10; \
   else if (__builtin_cpu_is ("power9")) \
@@ -131,6 +357,18 @@ extern void
 vec_mul512_byMN_PWR7 (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
+
+extern vui128_t
+vec_mul10k_byN_PWR7 (vui128_t *p, vui128_t *m, unsigned int k,
+                     unsigned long N);
+
+extern vui128_t
+vec_div10k_byN_PWR7 (vui128_t *q, vui128_t *n, unsigned int k,
+                     vec_round_t rnd, unsigned long N);
+
+extern long
+vec_rescalesq_array_PWR7 (vi128_t *r, vi128_t *a, int k, vec_round_t rnd,
+                          unsigned char *ovf, unsigned long n);
 #endif
 
 extern __VEC_U_256
@@ -164,6 +402,18 @@ vec_mul512_byMN_PWR8 (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
 
+extern vui128_t
+vec_mul10k_byN_PWR8 (vui128_t *p, vui128_t *m, unsigned int k,
+                     unsigned long N);
+
+extern vui128_t
+vec_div10k_byN_PWR8 (vui128_t *q, vui128_t *n, unsigned int k,
+                     vec_round_t rnd, unsigned long N);
+
+extern long
+vec_rescalesq_array_PWR8 (vi128_t *r, vi128_t *a, int k, vec_round_t rnd,
+                          unsigned char *ovf, unsigned long n);
+
 #ifndef PVECLIB_DISABLE_POWER9
 /* Older distros running Big Endian are unlikely to support PWR9.
  * So declare PWR9 externs only for LE.  */
@@ -198,6 +448,18 @@ extern void
 vec_mul512_byMN_PWR9 (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
+
+extern vui128_t
+vec_mul10k_byN_PWR9 (vui128_t *p, vui128_t *m, unsigned int k,
+                     unsigned long N);
+
+extern vui128_t
+vec_div10k_byN_PWR9 (vui128_t *q, vui128_t *n, unsigned int k,
+                     vec_round_t rnd, unsigned long N);
+
+extern long
+vec_rescalesq_array_PWR9 (vi128_t *r, vi128_t *a, int k, vec_round_t rnd,
+                          unsigned char *ovf, unsigned long n);
 #endif
 
 #ifndef PVECLIB_DISABLE_POWER10
@@ -234,6 +496,30 @@ extern void
 vec_mul512_byMN_PWR10 (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
+
+extern vui128_t
+vec_mul10k_byN_PWR10 (vui128_t *p, vui128_t *m, unsigned int k,
+                      unsigned long N);
+
+extern vui128_t
+vec_div10k_byN_PWR10 (vui128_t *q, vui128_t *n, unsigned int k,
+                      vec_round_t rnd, unsigned long N);
+
+extern long
+vec_rescalesq_array_PWR10 (vi128_t *r, vi128_t *a, int k, vec_round_t rnd,
+                           unsigned char *ovf, unsigned long n);
+#endif
+
+#ifdef PVECLIB_PROFILE
+/* Profiled builds keep the IFUNC symbols (FNAME_ifunc) local to
+   libpvec and export the wrappers defined below and at the end of
+   this file.  */
+#define VEC_DYN_IFUNC(FNAME) FNAME ## _ifunc
+#define VEC_DYN_IFUNC_VIS __attribute__ ((visibility ("hidden")))
+#pragma GCC visibility push(hidden)
+#else
+#define VEC_DYN_IFUNC(FNAME) FNAME
+#define VEC_DYN_IFUNC_VIS
 #endif
 
 static
@@ -244,7 +530,7 @@ __VEC_U_256
 }
 
 __VEC_U_256
-vec_mul128x128 (vui128_t, vui128_t)
+VEC_DYN_IFUNC (vec_mul128x128) (vui128_t, vui128_t)
 __attribute__ ((ifunc ("resolve_vec_mul128x128")));
 
 static
@@ -255,7 +541,7 @@ __VEC_U_512
 }
 
 __VEC_U_512
-vec_mul256x256 (__VEC_U_256, __VEC_U_256)
+VEC_DYN_IFUNC (vec_mul256x256) (__VEC_U_256, __VEC_U_256)
 __attribute__ ((ifunc ("resolve_vec_mul256x256")));
 
 static
@@ -266,7 +552,7 @@ __VEC_U_640
 }
 
 __VEC_U_640
-vec_mul512x128 (__VEC_U_512, vui128_t)
+VEC_DYN_IFUNC (vec_mul512x128) (__VEC_U_512, vui128_t)
 __attribute__ ((ifunc ("resolve_vec_mul512x128")));
 
 static
@@ -277,7 +563,7 @@ __VEC_U_640
 }
 
 __VEC_U_640
-vec_madd512x128a512 (__VEC_U_512, vui128_t, __VEC_U_512)
+VEC_DYN_IFUNC (vec_madd512x128a512) (__VEC_U_512, vui128_t, __VEC_U_512)
 __attribute__ ((ifunc ("resolve_vec_madd512x128a512")));
 
 static
@@ -288,7 +574,7 @@ __VEC_U_1024
 }
 
 __VEC_U_1024
-vec_mul512x512 (__VEC_U_512, __VEC_U_512)
+VEC_DYN_IFUNC (vec_mul512x512) (__VEC_U_512, __VEC_U_512)
 __attribute__ ((ifunc ("resolve_vec_mul512x512")));
 
 static
@@ -300,7 +586,7 @@ void
 }
 
 void
-vec_mul1024x1024 (__VEC_U_2048 *, __VEC_U_1024 *, __VEC_U_1024 *)
+VEC_DYN_IFUNC (vec_mul1024x1024) (__VEC_U_2048 *, __VEC_U_1024 *, __VEC_U_1024 *)
 __attribute__ ((ifunc ("resolve_vec_mul1024x1024")));
 
 static
@@ -312,7 +598,7 @@ void
 }
 
 void
-vec_mul2048x2048 (__VEC_U_4096 *, __VEC_U_2048 *, __VEC_U_2048 *)
+VEC_DYN_IFUNC (vec_mul2048x2048) (__VEC_U_4096 *, __VEC_U_2048 *, __VEC_U_2048 *)
 __attribute__ ((ifunc ("resolve_vec_mul2048x2048")));
 
 static
@@ -325,7 +611,7 @@ void
 }
 
 void
-vec_mul128_byMN (vui128_t *p, vui128_t *m1, vui128_t *m2,
+VEC_DYN_IFUNC (vec_mul128_byMN) (vui128_t *p, vui128_t *m1, vui128_t *m2,
 		  unsigned long M, unsigned long N)
 __attribute__ ((ifunc ("resolve_vec_mul128_byMN")));
 
@@ -339,7 +625,386 @@ void
 }
 
 void
-vec_mul512_byMN (__VEC_U_512 *p, __VEC_U_512 *m1, __VEC_U_512 *m2,
+VEC_DYN_IFUNC (vec_mul512_byMN) (__VEC_U_512 *p, __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N)
 __attribute__ ((ifunc ("resolve_vec_mul512_byMN")));
 
+#ifdef PVECLIB_PROFILE
+#pragma GCC visibility pop
+
+/* Exported wrappers counting calls and timebase ticks per thread.
+   See vec_profile_ppc.h and vec_runtime_profile.c.  */
+
+__VEC_U_256
+vec_mul128x128 (vui128_t m1, vui128_t m2)
+{
+  __VEC_U_256 result;
+  VEC_PROF_BEGIN (VEC_PROF_MUL128X128);
+  result = vec_mul128x128_ifunc (m1, m2);
+  VEC_PROF_END (VEC_PROF_MUL128X128);
+  return result;
+}
+
+__VEC_U_512
+vec_mul256x256 (__VEC_U_256 m1, __VEC_U_256 m2)
+{
+  __VEC_U_512 result;
+  VEC_PROF_BEGIN (VEC_PROF_MUL256X256);
+  result = vec_mul256x256_ifunc (m1, m2);
+  VEC_PROF_END (VEC_PROF_MUL256X256);
+  return result;
+}
+
+__VEC_U_640
+vec_mul512x128 (__VEC_U_512 m1, vui128_t m2)
+{
+  __VEC_U_640 result;
+  VEC_PROF_BEGIN (VEC_PROF_MUL512X128);
+  result = vec_mul512x128_ifunc (m1, m2);
+  VEC_PROF_END (VEC_PROF_MUL512X128);
+  return result;
+}
+
+__VEC_U_640
+vec_madd512x128a512 (__VEC_U_512 m1, vui128_t m2, __VEC_U_512 a2)
+{
+  __VEC_U_640 result;
+  VEC_PROF_BEGIN (VEC_PROF_MADD512X128A512);
+  result = vec_madd512x128a512_ifunc (m1, m2, a2);
+  VEC_PROF_END (VEC_PROF_MADD512X128A512);
+  return result;
+}
+
+__VEC_U_1024
+vec_mul512x512 (__VEC_U_512 m1, __VEC_U_512 m2)
+{
+  __VEC_U_1024 result;
+  VEC_PROF_BEGIN (VEC_PROF_MUL512X512);
+  result = vec_mul512x512_ifunc (m1, m2);
+  VEC_PROF_END (VEC_PROF_MUL512X512);
+  return result;
+}
+
+void
+vec_mul1024x1024 (__VEC_U_2048 *p2048, __VEC_U_1024 *m1, __VEC_U_1024 *m2)
+{
+  VEC_PROF_BEGIN (VEC_PROF_MUL1024X1024);
+  vec_mul1024x1024_ifunc (p2048, m1, m2);
+  VEC_PROF_END (VEC_PROF_MUL1024X1024);
+}
+
+void
+vec_mul2048x2048 (__VEC_U_4096 *p4096, __VEC_U_2048 *m1, __VEC_U_2048 *m2)
+{
+  VEC_PROF_BEGIN (VEC_PROF_MUL2048X2048);
+  vec_mul2048x2048_ifunc (p4096, m1, m2);
+  VEC_PROF_END (VEC_PROF_MUL2048X2048);
+}
+
+void
+vec_mul128_byMN (vui128_t *p, vui128_t *m1, vui128_t *m2,
+		  unsigned long M, unsigned long N)
+{
+  VEC_PROF_BEGIN (VEC_PROF_MUL128_BYMN);
+  vec_mul128_byMN_ifunc (p, m1, m2, M, N);
+  VEC_PROF_END (VEC_PROF_MUL128_BYMN);
+  __prof->mul128_byMN[vec_prof_bucket (M)][vec_prof_bucket (N)]++;
+}
+
+void
+vec_mul512_byMN (__VEC_U_512 *p, __VEC_U_512 *m1, __VEC_U_512 *m2,
+		  unsigned long M, unsigned long N)
+{
+  VEC_PROF_BEGIN (VEC_PROF_MUL512_BYMN);
+  vec_mul512_byMN_ifunc (p, m1, m2, M, N);
+  VEC_PROF_END (VEC_PROF_MUL512_BYMN);
+  __prof->mul512_byMN[vec_prof_bucket (M)][vec_prof_bucket (N)]++;
+}
+#endif
+
+/* The N quadword scale by 10**k and the quadword array rescale
+   operations. These and the VEC_DYN_OPS below are profiled by the
+   wrappers generated from VEC_DYN_OPS_PROF at the end of this file.  */
+static
+vui128_t
+(*resolve_vec_mul10k_byN (void))
+(vui128_t *p, vui128_t *m, unsigned int k, unsigned long N)
+{
+  VEC_DYN_RESOLVER(vec_mul10k_byN);
+}
+
+VEC_DYN_IFUNC_VIS vui128_t
+VEC_DYN_IFUNC (vec_mul10k_byN) (vui128_t *p, vui128_t *m, unsigned int k,
+				unsigned long N)
+__attribute__ ((ifunc ("resolve_vec_mul10k_byN")));
+
+static
+vui128_t
+(*resolve_vec_div10k_byN (void))
+(vui128_t *q, vui128_t *n, unsigned int k, vec_round_t rnd,
+ unsigned long N)
+{
+  VEC_DYN_RESOLVER(vec_div10k_byN);
+}
+
+VEC_DYN_IFUNC_VIS vui128_t
+VEC_DYN_IFUNC (vec_div10k_byN) (vui128_t *q, vui128_t *n, unsigned int k,
+				vec_round_t rnd, unsigned long N)
+__attribute__ ((ifunc ("resolve_vec_div10k_byN")));
+
+static
+long
+(*resolve_vec_rescalesq_array (void))
+(vi128_t *r, vi128_t *a, int k, vec_round_t rnd, unsigned char *ovf,
+ unsigned long n)
+{
+  VEC_DYN_RESOLVER(vec_rescalesq_array);
+}
+
+VEC_DYN_IFUNC_VIS long
+VEC_DYN_IFUNC (vec_rescalesq_array) (vi128_t *r, vi128_t *a, int k,
+				     vec_round_t rnd, unsigned char *ovf,
+				     unsigned long n)
+__attribute__ ((ifunc ("resolve_vec_rescalesq_array")));
+
+/* IFUNC exports (FNAME_dyn) for the heavier inline operations of
+   vec_int128_ppc.h, vec_f128_ppc.h and vec_bcd_ppc.h, listed in
+   vec_runtime_dispatch.h (VEC_DYN_OPS). The platform implementations
+   are in vec_int128_runtime.c, vec_f128_runtime.c and
+   vec_bcd_runtime.c.  */
+#define VEC_DYN_EXTERN_PWR7(RTYPE, FNAME, PARMS, ARGS) \
+  extern RTYPE FNAME ## _PWR7 PARMS;
+#define VEC_DYN_EXTERN_PWR8(RTYPE, FNAME, PARMS, ARGS) \
+  extern RTYPE FNAME ## _PWR8 PARMS;
+#define VEC_DYN_EXTERN_PWR9(RTYPE, FNAME, PARMS, ARGS) \
+  extern RTYPE FNAME ## _PWR9 PARMS;
+#define VEC_DYN_EXTERN_PWR10(RTYPE, FNAME, PARMS, ARGS) \
+  extern RTYPE FNAME ## _PWR10 PARMS;
+
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_DYN_OPS (VEC_DYN_EXTERN_PWR7)
+#endif
+VEC_DYN_OPS (VEC_DYN_EXTERN_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_DYN_OPS (VEC_DYN_EXTERN_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_DYN_OPS (VEC_DYN_EXTERN_PWR10)
+#endif
+
+/* Same pattern as the int512 resolvers above, exported as
+   FNAME_dyn so the name does not collide with the static inline
+   operation.  */
+#define VEC_DYN_IFUNC_OP(RTYPE, FNAME, PARMS, ARGS) \
+  static \
+  RTYPE \
+  (*resolve_ ## FNAME (void)) PARMS \
+  { \
+    VEC_DYN_RESOLVER(FNAME); \
+  } \
+  \
+  VEC_DYN_IFUNC_VIS RTYPE \
+  VEC_DYN_IFUNC (FNAME ## _dyn) PARMS \
+  __attribute__ ((ifunc ("resolve_" #FNAME)));
+
+VEC_DYN_OPS (VEC_DYN_IFUNC_OP)
+
+/* The N quadword signed BCD operations, exported under their own
+   names. The implementations are in vec_bcd_runtime.c.  */
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_DYN_OPS_BCDN (VEC_DYN_EXTERN_PWR7)
+VEC_DYN_OPS_BCDN_VOID (VEC_DYN_EXTERN_PWR7)
+#endif
+VEC_DYN_OPS_BCDN (VEC_DYN_EXTERN_PWR8)
+VEC_DYN_OPS_BCDN_VOID (VEC_DYN_EXTERN_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_DYN_OPS_BCDN (VEC_DYN_EXTERN_PWR9)
+VEC_DYN_OPS_BCDN_VOID (VEC_DYN_EXTERN_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_DYN_OPS_BCDN (VEC_DYN_EXTERN_PWR10)
+VEC_DYN_OPS_BCDN_VOID (VEC_DYN_EXTERN_PWR10)
+#endif
+
+#define VEC_DYN_IFUNC_NAMED(RTYPE, FNAME, PARMS, ARGS) \
+  static \
+  RTYPE \
+  (*resolve_ ## FNAME (void)) PARMS \
+  { \
+    VEC_DYN_RESOLVER(FNAME); \
+  } \
+  \
+  VEC_DYN_IFUNC_VIS RTYPE \
+  VEC_DYN_IFUNC (FNAME) PARMS \
+  __attribute__ ((ifunc ("resolve_" #FNAME)));
+
+VEC_DYN_OPS_BCDN (VEC_DYN_IFUNC_NAMED)
+VEC_DYN_OPS_BCDN_VOID (VEC_DYN_IFUNC_NAMED)
+
+/* The binary16 and bfloat16 arrays, exported under their own names.
+   The implementations are in vec_f32_runtime.c.  */
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_DYN_OPS_F32N (VEC_DYN_EXTERN_PWR7)
+VEC_DYN_OPS_F32N_VOID (VEC_DYN_EXTERN_PWR7)
+#endif
+VEC_DYN_OPS_F32N (VEC_DYN_EXTERN_PWR8)
+VEC_DYN_OPS_F32N_VOID (VEC_DYN_EXTERN_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_DYN_OPS_F32N (VEC_DYN_EXTERN_PWR9)
+VEC_DYN_OPS_F32N_VOID (VEC_DYN_EXTERN_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_DYN_OPS_F32N (VEC_DYN_EXTERN_PWR10)
+VEC_DYN_OPS_F32N_VOID (VEC_DYN_EXTERN_PWR10)
+#endif
+
+VEC_DYN_OPS_F32N (VEC_DYN_IFUNC_NAMED)
+VEC_DYN_OPS_F32N_VOID (VEC_DYN_IFUNC_NAMED)
+
+/* The binary128 array conversions, exported under their own names.
+   The implementations are in vec_f128_runtime.c.  */
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_DYN_OPS_F128N_VOID (VEC_DYN_EXTERN_PWR7)
+#endif
+VEC_DYN_OPS_F128N_VOID (VEC_DYN_EXTERN_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_DYN_OPS_F128N_VOID (VEC_DYN_EXTERN_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_DYN_OPS_F128N_VOID (VEC_DYN_EXTERN_PWR10)
+#endif
+
+VEC_DYN_OPS_F128N_VOID (VEC_DYN_IFUNC_NAMED)
+
+/* The elementary function arrays, exported under their own names.
+   The implementations are in vec_f64_runtime.c and vec_f32_runtime.c.  */
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_DYN_OPS_MATHN_VOID (VEC_DYN_EXTERN_PWR7)
+#endif
+VEC_DYN_OPS_MATHN_VOID (VEC_DYN_EXTERN_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_DYN_OPS_MATHN_VOID (VEC_DYN_EXTERN_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_DYN_OPS_MATHN_VOID (VEC_DYN_EXTERN_PWR10)
+#endif
+
+VEC_DYN_OPS_MATHN_VOID (VEC_DYN_IFUNC_NAMED)
+
+/* The binary128 linear algebra kernels, exported under their own
+   names. The implementations are in vec_f128_runtime.c.  */
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_DYN_OPS_F128LA (VEC_DYN_EXTERN_PWR7)
+VEC_DYN_OPS_F128LA_VOID (VEC_DYN_EXTERN_PWR7)
+#endif
+VEC_DYN_OPS_F128LA (VEC_DYN_EXTERN_PWR8)
+VEC_DYN_OPS_F128LA_VOID (VEC_DYN_EXTERN_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_DYN_OPS_F128LA (VEC_DYN_EXTERN_PWR9)
+VEC_DYN_OPS_F128LA_VOID (VEC_DYN_EXTERN_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_DYN_OPS_F128LA (VEC_DYN_EXTERN_PWR10)
+VEC_DYN_OPS_F128LA_VOID (VEC_DYN_EXTERN_PWR10)
+#endif
+
+VEC_DYN_OPS_F128LA (VEC_DYN_IFUNC_NAMED)
+VEC_DYN_OPS_F128LA_VOID (VEC_DYN_IFUNC_NAMED)
+
+/* The polynomial arrays, exported under their own names. The
+   implementations are in vec_f64_runtime.c and vec_f128_runtime.c.  */
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_DYN_OPS_POLYN_VOID (VEC_DYN_EXTERN_PWR7)
+#endif
+VEC_DYN_OPS_POLYN_VOID (VEC_DYN_EXTERN_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_DYN_OPS_POLYN_VOID (VEC_DYN_EXTERN_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_DYN_OPS_POLYN_VOID (VEC_DYN_EXTERN_PWR10)
+#endif
+
+VEC_DYN_OPS_POLYN_VOID (VEC_DYN_IFUNC_NAMED)
+
+#ifdef PVECLIB_PROFILE
+/* Exported wrappers for all the IFUNCs after the int512 multiplies,
+   generated from the VEC_DYN_OPS_PROF list. Same as the hand written
+   wrappers above.  */
+#define VEC_PROF_WRAP(RTYPE, FNAME, PARMS, ARGS) \
+  RTYPE \
+  FNAME PARMS \
+  { \
+    RTYPE result; \
+    VEC_PROF_BEGIN (VEC_PROF_ ## FNAME); \
+    result = FNAME ## _ifunc ARGS; \
+    VEC_PROF_END (VEC_PROF_ ## FNAME); \
+    return result; \
+  }
+
+#define VEC_PROF_WRAP_VOID(RTYPE, FNAME, PARMS, ARGS) \
+  void \
+  FNAME PARMS \
+  { \
+    VEC_PROF_BEGIN (VEC_PROF_ ## FNAME); \
+    FNAME ## _ifunc ARGS; \
+    VEC_PROF_END (VEC_PROF_ ## FNAME); \
+  }
+
+#define VEC_PROF_WRAP_DYN(RTYPE, FNAME, PARMS, ARGS) \
+  RTYPE \
+  FNAME ## _dyn PARMS \
+  { \
+    RTYPE result; \
+    VEC_PROF_BEGIN (VEC_PROF_ ## FNAME); \
+    result = FNAME ## _dyn_ifunc ARGS; \
+    VEC_PROF_END (VEC_PROF_ ## FNAME); \
+    return result; \
+  }
+
+VEC_DYN_OPS_PROF (VEC_PROF_WRAP, VEC_PROF_WRAP_VOID, VEC_PROF_WRAP_DYN)
+#endif
+
+/* Dispatch tables for vec_dispatch_table(). Each is an array of one
+   element so the name decays to a pointer and VEC_DYN_RESOLVER can
+   select between them like the function variants above.  */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ && !defined (PVECLIB_DISABLE_POWER7)
+#define VEC_DISPATCH_IMP(FNAME) FNAME ## _PWR7
+static const vec_dispatch_t vec_dispatch_PWR7[1] = { VEC_DISPATCH_INIT (7) };
+#undef VEC_DISPATCH_IMP
+#endif
+#define VEC_DISPATCH_IMP(FNAME) FNAME ## _PWR8
+static const vec_dispatch_t vec_dispatch_PWR8[1] = { VEC_DISPATCH_INIT (8) };
+#undef VEC_DISPATCH_IMP
+#ifndef PVECLIB_DISABLE_POWER9
+#define VEC_DISPATCH_IMP(FNAME) FNAME ## _PWR9
+static const vec_dispatch_t vec_dispatch_PWR9[1] = { VEC_DISPATCH_INIT (9) };
+#undef VEC_DISPATCH_IMP
+#endif
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && !defined (PVECLIB_DISABLE_POWER10)
+#define VEC_DISPATCH_IMP(FNAME) FNAME ## _PWR10
+static const vec_dispatch_t vec_dispatch_PWR10[1] = { VEC_DISPATCH_INIT (10) };
+#undef VEC_DISPATCH_IMP
+#endif
+
+static const vec_dispatch_t *
+vec_dispatch_select (void)
+{
+  VEC_DYN_RESOLVER(vec_dispatch);
+}
+
+const vec_dispatch_t *
+vec_dispatch_table (void)
+{
+  static const vec_dispatch_t *vec_dispatch_cached = NULL;
+  const vec_dispatch_t *table;
+
+  /* The selection is the same every time, so racing threads store
+     the same pointer.  */
+  table = __atomic_load_n (&vec_dispatch_cached, __ATOMIC_RELAXED);
+  if (__builtin_expect (table == NULL, 0))
+    {
+      table = vec_dispatch_select ();
+      __atomic_store_n (&vec_dispatch_cached, table, __ATOMIC_RELAXED);
+    }
+  return table;
+}
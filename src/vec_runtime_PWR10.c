@@ -25,6 +25,11 @@
    PWR10.  */
 
 #include "vec_int512_runtime.c"
+#include "vec_int128_runtime.c"
+#include "vec_f128_runtime.c"
+#include "vec_f64_runtime.c"
+#include "vec_f32_runtime.c"
+#include "vec_bcd_runtime.c"
 #endif
 
 
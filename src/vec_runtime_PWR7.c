@@ -24,4 +24,9 @@
 // POWER7 supports only BIG Endian. So build PWR7 runtime for BE only.
 
 #include "vec_int512_runtime.c"
+#include "vec_int128_runtime.c"
+#include "vec_f128_runtime.c"
+#include "vec_f64_runtime.c"
+#include "vec_f32_runtime.c"
+#include "vec_bcd_runtime.c"
 #endif
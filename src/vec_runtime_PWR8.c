@@ -21,3 +21,8 @@
  */
 
 #include "vec_int512_runtime.c"
+#include "vec_int128_runtime.c"
+#include "vec_f128_runtime.c"
+#include "vec_f64_runtime.c"
+#include "vec_f32_runtime.c"
+#include "vec_bcd_runtime.c"
@@ -24,3 +24,4 @@
 
 #include "decpowof2.c"
 #include "tipowof10.c"
+#include "powof10_512.c"
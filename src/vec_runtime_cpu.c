@@ -0,0 +1,127 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_runtime_cpu.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/*!
+ * \file  vec_runtime_cpu.c
+ * \brief Entry points of the per-CPU archives libpvec_pwr8.a,
+ * libpvec_pwr9.a, ...
+ *
+ * Compiled once for each -mcpu= target (configure
+ * <B>--enable-cpu-libs</B>). Defines the libpvec exported names
+ * (vec_mul128x128, ..., vec_bcdctuq_dyn) and vec_dispatch_table()
+ * as direct calls to the __VEC_PWR_IMP(FNAME) implementation of the
+ * same target. The implementations are the vec_staticrt_PWRn objects
+ * also used in libpvecstatic.a.
+ *
+ * A program built for a known platform can link the matching
+ * archive instead of libpvec.so, without source changes and without
+ * the IFUNC and PLT overhead. With link time optimization (-flto)
+ * these calls can be inlined into the caller.
+ */
+
+#include "vec_runtime_dispatch.h"
+
+#ifdef _ARCH_PWR10
+#define VEC_CPU_PLATFORM 10
+#ifdef PVECLIB_DISABLE_POWER10
+#define VEC_CPU_DISABLED 1
+#endif
+#elif defined (_ARCH_PWR9)
+#define VEC_CPU_PLATFORM 9
+#ifdef PVECLIB_DISABLE_POWER9
+#define VEC_CPU_DISABLED 1
+#endif
+#elif defined (_ARCH_PWR8)
+#define VEC_CPU_PLATFORM 8
+#ifdef PVECLIB_DISABLE_POWER8
+#define VEC_CPU_DISABLED 1
+#endif
+#else
+#define VEC_CPU_PLATFORM 7
+#ifdef PVECLIB_DISABLE_POWER7
+#define VEC_CPU_DISABLED 1
+#endif
+#endif
+
+// Like vec_runtime_PWRn.c, empty if this platform is disabled.
+#ifndef VEC_CPU_DISABLED
+
+#define VEC_CPU_EXTERN(RTYPE, FNAME, PARMS, ARGS) \
+  extern RTYPE __VEC_PWR_IMP (FNAME) PARMS;
+
+#define VEC_CPU_ENTRY(RTYPE, FNAME, PARMS, ARGS) \
+  RTYPE \
+  FNAME PARMS \
+  { \
+    return __VEC_PWR_IMP (FNAME) ARGS; \
+  }
+
+#define VEC_CPU_ENTRY_VOID(RTYPE, FNAME, PARMS, ARGS) \
+  void \
+  FNAME PARMS \
+  { \
+    __VEC_PWR_IMP (FNAME) ARGS; \
+  }
+
+#define VEC_CPU_ENTRY_DYN(RTYPE, FNAME, PARMS, ARGS) \
+  RTYPE \
+  FNAME ## _dyn PARMS \
+  { \
+    return __VEC_PWR_IMP (FNAME) ARGS; \
+  }
+
+VEC_DYN_OPS_INT512 (VEC_CPU_EXTERN)
+VEC_DYN_OPS_INT512_VOID (VEC_CPU_EXTERN)
+VEC_DYN_OPS (VEC_CPU_EXTERN)
+VEC_DYN_OPS_BCDN (VEC_CPU_EXTERN)
+VEC_DYN_OPS_BCDN_VOID (VEC_CPU_EXTERN)
+VEC_DYN_OPS_F32N (VEC_CPU_EXTERN)
+VEC_DYN_OPS_F32N_VOID (VEC_CPU_EXTERN)
+VEC_DYN_OPS_F128N_VOID (VEC_CPU_EXTERN)
+VEC_DYN_OPS_MATHN_VOID (VEC_CPU_EXTERN)
+VEC_DYN_OPS_F128LA (VEC_CPU_EXTERN)
+VEC_DYN_OPS_F128LA_VOID (VEC_CPU_EXTERN)
+VEC_DYN_OPS_POLYN_VOID (VEC_CPU_EXTERN)
+
+VEC_DYN_OPS_INT512 (VEC_CPU_ENTRY)
+VEC_DYN_OPS_INT512_VOID (VEC_CPU_ENTRY_VOID)
+VEC_DYN_OPS (VEC_CPU_ENTRY_DYN)
+VEC_DYN_OPS_BCDN (VEC_CPU_ENTRY)
+VEC_DYN_OPS_BCDN_VOID (VEC_CPU_ENTRY_VOID)
+VEC_DYN_OPS_F32N (VEC_CPU_ENTRY)
+VEC_DYN_OPS_F32N_VOID (VEC_CPU_ENTRY_VOID)
+VEC_DYN_OPS_F128N_VOID (VEC_CPU_ENTRY_VOID)
+VEC_DYN_OPS_MATHN_VOID (VEC_CPU_ENTRY_VOID)
+VEC_DYN_OPS_F128LA (VEC_CPU_ENTRY)
+VEC_DYN_OPS_F128LA_VOID (VEC_CPU_ENTRY_VOID)
+VEC_DYN_OPS_POLYN_VOID (VEC_CPU_ENTRY_VOID)
+
+#define VEC_DISPATCH_IMP(FNAME) __VEC_PWR_IMP (FNAME)
+static const vec_dispatch_t vec_dispatch_cpu =
+  VEC_DISPATCH_INIT (VEC_CPU_PLATFORM);
+
+const vec_dispatch_t *
+vec_dispatch_table (void)
+{
+  return &vec_dispatch_cpu;
+}
+#endif /* VEC_CPU_DISABLED */
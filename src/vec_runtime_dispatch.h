@@ -0,0 +1,439 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_runtime_dispatch.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_VEC_RUNTIME_DISPATCH_H_
+#define SRC_VEC_RUNTIME_DISPATCH_H_
+
+/* Internal lists of the libpvec exported functions, shared by the
+   IFUNC resolvers and dispatch tables of vec_runtime_DYN.c and the
+   per-CPU entry points of vec_runtime_cpu.c. Not installed.
+
+   X (RTYPE, FNAME, PARMS, ARGS)  */
+
+#include <pveclib/vec_dispatch_ppc.h>
+#include <pveclib/vec_bcd_ppc.h>
+#include <pveclib/vec_f32_ppc.h>
+
+/* The N quadword scale by 10**k and the quadword array rescale,
+   exported under their own names.  */
+#define VEC_DYN_OPS_INT128N(X) \
+  X (vui128_t, vec_mul10k_byN, \
+     (vui128_t *p, vui128_t *m, unsigned int k, unsigned long N), \
+     (p, m, k, N)) \
+  X (vui128_t, vec_div10k_byN, \
+     (vui128_t *q, vui128_t *n, unsigned int k, vec_round_t rnd, \
+      unsigned long N), (q, n, k, rnd, N)) \
+  X (long, vec_rescalesq_array, \
+     (vi128_t *r, vi128_t *a, int k, vec_round_t rnd, unsigned char *ovf, \
+      unsigned long n), (r, a, k, rnd, ovf, n))
+
+/* The int512 multiplies, plus VEC_DYN_OPS_INT128N, exported under
+   their own names.  */
+#define VEC_DYN_OPS_INT512(X) \
+  X (__VEC_U_256, vec_mul128x128, (vui128_t m1, vui128_t m2), (m1, m2)) \
+  X (__VEC_U_512, vec_mul256x256, (__VEC_U_256 m1, __VEC_U_256 m2), \
+     (m1, m2)) \
+  X (__VEC_U_640, vec_mul512x128, (__VEC_U_512 m1, vui128_t m2), (m1, m2)) \
+  X (__VEC_U_640, vec_madd512x128a512, \
+     (__VEC_U_512 m1, vui128_t m2, __VEC_U_512 a2), (m1, m2, a2)) \
+  X (__VEC_U_1024, vec_mul512x512, (__VEC_U_512 m1, __VEC_U_512 m2), \
+     (m1, m2)) \
+  VEC_DYN_OPS_INT128N (X)
+
+/* The int512 multiplies returning void.  */
+#define VEC_DYN_OPS_INT512_VOID(X) \
+  X (void, vec_mul1024x1024, \
+     (__VEC_U_2048 *p2048, __VEC_U_1024 *m1, __VEC_U_1024 *m2), \
+     (p2048, m1, m2)) \
+  X (void, vec_mul2048x2048, \
+     (__VEC_U_4096 *p4096, __VEC_U_2048 *m1, __VEC_U_2048 *m2), \
+     (p4096, m1, m2)) \
+  X (void, vec_mul128_byMN, \
+     (vui128_t *p, vui128_t *m1, vui128_t *m2, \
+      unsigned long M, unsigned long N), (p, m1, m2, M, N)) \
+  X (void, vec_mul512_byMN, \
+     (__VEC_U_512 *p, __VEC_U_512 *m1, __VEC_U_512 *m2, \
+      unsigned long M, unsigned long N), (p, m1, m2, M, N))
+
+/* The heavier inline operations of vec_int128_ppc.h, vec_f128_ppc.h
+   and vec_bcd_ppc.h, exported as FNAME_dyn.  */
+#define VEC_DYN_OPS_INT128(X) \
+  X (vui128_t, vec_divuq_10e31, (vui128_t vra), (vra)) \
+  X (vui128_t, vec_divuq_10e32, (vui128_t vra), (vra)) \
+  X (vui128_t, vec_moduq_10e31, (vui128_t vra, vui128_t q), (vra, q)) \
+  X (vui128_t, vec_moduq_10e32, (vui128_t vra, vui128_t q), (vra, q)) \
+  X (vui128_t, vec_divudq_10e31, \
+     (vui128_t *qh, vui128_t vra, vui128_t vrb), (qh, vra, vrb)) \
+  X (vui128_t, vec_divudq_10e32, \
+     (vui128_t *qh, vui128_t vra, vui128_t vrb), (qh, vra, vrb)) \
+  X (vui128_t, vec_modudq_10e31, \
+     (vui128_t vra, vui128_t vrb, vui128_t *ql), (vra, vrb, ql)) \
+  X (vui128_t, vec_modudq_10e32, \
+     (vui128_t vra, vui128_t vrb, vui128_t *ql), (vra, vrb, ql)) \
+  X (vi128_t, vec_divsq_10e31, (vi128_t vra), (vra)) \
+  X (vi128_t, vec_modsq_10e31, (vi128_t vra, vi128_t q), (vra, q))
+
+#ifndef PVECLIB_DISABLE_F128ARITH
+#define VEC_DYN_OPS_F128(X) \
+  X (__binary128, vec_xsaddqpo, (__binary128 vfa, __binary128 vfb), \
+     (vfa, vfb)) \
+  X (__binary128, vec_xssubqpo, (__binary128 vfa, __binary128 vfb), \
+     (vfa, vfb)) \
+  X (__binary128, vec_xsmulqpo, (__binary128 vfa, __binary128 vfb), \
+     (vfa, vfb)) \
+  X (vf64_t, vec_xscvqpdpo, (__binary128 f128), (f128)) \
+  X (vui64_t, vec_xscvqpudz, (__binary128 f128), (f128)) \
+  X (vui128_t, vec_xscvqpuqz, (__binary128 f128), (f128)) \
+  X (__binary128, vec_xsrqpi_rnd, (__binary128 f128, vec_round_t rnd), \
+     (f128, rnd)) \
+  X (__binary128, vec_fmodf128, (__binary128 f128x, __binary128 f128y), \
+     (f128x, f128y)) \
+  X (__binary128, vec_remainderf128, \
+     (__binary128 f128x, __binary128 f128y), (f128x, f128y))
+#else
+#define VEC_DYN_OPS_F128(X)
+#endif
+
+#ifndef PVECLIB_DISABLE_DFP
+#define VEC_DYN_OPS_BCD(X) \
+  X (vBCD_t, vec_bcdmul, (vBCD_t a, vBCD_t b), (a, b)) \
+  X (vBCD_t, vec_bcddiv, (vBCD_t a, vBCD_t b), (a, b)) \
+  X (vBCD_t, vec_bcdcfsq, (vi128_t vrb), (vrb)) \
+  X (vBCD_t, vec_bcdcfuq, (vui128_t vra), (vra)) \
+  X (vi128_t, vec_bcdctsq, (vBCD_t vra), (vra)) \
+  X (vui128_t, vec_bcdctuq, (vBCD_t vra), (vra)) \
+  X (vBCD_t, vec_bcdmulh, (vBCD_t a, vBCD_t b), (a, b)) \
+  X (vBCD_t, vec_bcddive, (vBCD_t a, vBCD_t b), (a, b))
+#else
+#define VEC_DYN_OPS_BCD(X)
+#endif
+
+/* The N quadword signed BCD operations, the record conversions, the
+   _Decimal128 conversions, the decimal rescales and the binary
+   floating point string conversions of vec_bcd_ppc.h. These have no
+   inline form and are exported under their own names.  */
+#ifndef PVECLIB_DISABLE_DFP
+#define VEC_DYN_OPS_BCDN(X) \
+  X (vBCD_t, vec_bcdadd_byN, \
+     (vBCD_t *r, vBCD_t *a, vBCD_t *b, unsigned long N), (r, a, b, N)) \
+  X (vBCD_t, vec_bcdsub_byN, \
+     (vBCD_t *r, vBCD_t *a, vBCD_t *b, unsigned long N), (r, a, b, N)) \
+  X (int, vec_bcdcmp_byN, (vBCD_t *a, vBCD_t *b, unsigned long N), \
+     (a, b, N)) \
+  X (long, vec_bcdrec_decode, \
+     (const unsigned char *rec, unsigned long reclen, unsigned long nrec, \
+      const vec_bcdrec_field_t *schema, unsigned long nfields), \
+     (rec, reclen, nrec, schema, nfields)) \
+  X (long, vec_bcdrec_encode, \
+     (unsigned char *rec, unsigned long reclen, unsigned long nrec, \
+      const vec_bcdrec_field_t *schema, unsigned long nfields), \
+     (rec, reclen, nrec, schema, nfields)) \
+  X (_Decimal128, vec_dfp128_cff64, (double f64), (f64)) \
+  X (double, vec_dfp128_ctf64, (_Decimal128 d128), (d128)) \
+  X (_Decimal128, vec_dfp128_cff128, (__binary128 f128), (f128)) \
+  X (__binary128, vec_dfp128_ctf128, (_Decimal128 d128), (d128)) \
+  X (long, vec_bcdrescale_array, \
+     (vBCD_t *r, vBCD_t *a, int k, vec_round_t rnd, unsigned char *ovf, \
+      unsigned long n), (r, a, k, rnd, ovf, n)) \
+  X (long, vec_dfp128_rescale_array, \
+     (_Decimal128 *r, _Decimal128 *a, unsigned int scale, vec_round_t rnd, \
+      unsigned char *ovf, unsigned long n), (r, a, scale, rnd, ovf, n)) \
+  X (int, vec_f128_ctstr, (char *buf, __binary128 f128), (buf, f128)) \
+  X (__binary128, vec_f128_cfstr, (const char *str, char **endptr), \
+     (str, endptr)) \
+  X (int, vec_f64_ctstr, (char *buf, double f64), (buf, f64)) \
+  X (int, vec_f32_ctstr, (char *buf, float f32), (buf, f32)) \
+  X (long, vec_f64_ctstr_array, \
+     (char *buf, const double *f64, unsigned long n, char sep), \
+     (buf, f64, n, sep)) \
+  X (long, vec_f32_ctstr_array, \
+     (char *buf, const float *f32, unsigned long n, char sep), \
+     (buf, f32, n, sep)) \
+  X (_Decimal128, vec_dfp128_sum_array, (_Decimal128 *a, unsigned long n), \
+     (a, n)) \
+  X (_Decimal128, vec_dfp128_dot_array, \
+     (_Decimal128 *a, _Decimal128 *b, unsigned long n), (a, b, n)) \
+  X (_Decimal128, vec_dfp64_sum_array, (_Decimal64 *a, unsigned long n), \
+     (a, n)) \
+  X (_Decimal128, vec_dfp64_dot_array, \
+     (_Decimal64 *a, _Decimal64 *b, unsigned long n), (a, b, n))
+
+#define VEC_DYN_OPS_BCDN_VOID(X) \
+  X (void, vec_bcdmul_byMN, \
+     (vBCD_t *p, vBCD_t *m1, vBCD_t *m2, unsigned long M, unsigned long N), \
+     (p, m1, m2, M, N)) \
+  X (void, vec_bcdsl_byN, \
+     (vBCD_t *r, vBCD_t *a, unsigned int k, unsigned long N), (r, a, k, N)) \
+  X (void, vec_bcdsr_byN, \
+     (vBCD_t *r, vBCD_t *a, unsigned int k, unsigned long N), (r, a, k, N)) \
+  X (void, vec_bcdsrr_byN, \
+     (vBCD_t *r, vBCD_t *a, unsigned int k, unsigned long N), (r, a, k, N)) \
+  X (void, vec_dfp128_cfsq_array, \
+     (_Decimal128 *r, vi128_t *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_cfuq_array, \
+     (_Decimal128 *r, vui128_t *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_cff64_array, \
+     (_Decimal128 *r, double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_cff128_array, \
+     (_Decimal128 *r, __binary128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_ctsqz_array, \
+     (vi128_t *r, _Decimal128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_ctuqz_array, \
+     (vui128_t *r, _Decimal128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_ctf64_array, \
+     (double *r, _Decimal128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_ctf128_array, \
+     (__binary128 *r, _Decimal128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_dfp128_scale_array, \
+     (_Decimal128 *r, _Decimal128 *a, _Decimal128 s, unsigned long n), \
+     (r, a, s, n)) \
+  X (void, vec_dfp64_scale_array, \
+     (_Decimal64 *r, _Decimal64 *a, _Decimal64 s, unsigned long n), \
+     (r, a, s, n))
+#else
+#define VEC_DYN_OPS_BCDN(X)
+#define VEC_DYN_OPS_BCDN_VOID(X)
+#endif
+
+/* The binary16 and bfloat16 array conversions and dot products of
+   vec_f32_ppc.h, exported under their own names.  */
+#define VEC_DYN_OPS_F32N(X) \
+  X (float, vec_dotf16_array, \
+     (const unsigned short *a, const unsigned short *b, unsigned long n), \
+     (a, b, n)) \
+  X (float, vec_dotf16f32_array, \
+     (const unsigned short *a, const float *b, unsigned long n), (a, b, n)) \
+  X (float, vec_dotbf16_array, \
+     (const unsigned short *a, const unsigned short *b, unsigned long n), \
+     (a, b, n)) \
+  X (float, vec_dotbf16f32_array, \
+     (const unsigned short *a, const float *b, unsigned long n), (a, b, n))
+
+#define VEC_DYN_OPS_F32N_VOID(X) \
+  X (void, vec_cvf16f32_array, \
+     (float *r, const unsigned short *a, unsigned long n), (r, a, n)) \
+  X (void, vec_cvf32f16_array, \
+     (unsigned short *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_cvbf16f32_array, \
+     (float *r, const unsigned short *a, unsigned long n), (r, a, n)) \
+  X (void, vec_cvf32bf16_array, \
+     (unsigned short *r, const float *a, unsigned long n), (r, a, n))
+
+/* The binary128 array conversions of vec_f128_ppc.h, exported under
+   their own names.  */
+#ifndef PVECLIB_DISABLE_F128ARITH
+#define VEC_DYN_OPS_F128N_VOID(X) \
+  X (void, vec_f128_cff64_array, \
+     (__binary128 *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctf64_array, \
+     (double *r, const __binary128 *a, vec_round_t rnd, unsigned long n), \
+     (r, a, rnd, n)) \
+  X (void, vec_f128_cff32_array, \
+     (__binary128 *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctf32_array, \
+     (float *r, const __binary128 *a, vec_round_t rnd, unsigned long n), \
+     (r, a, rnd, n)) \
+  X (void, vec_f128_cfsw_array, \
+     (__binary128 *r, const int *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctswz_array, \
+     (int *r, const __binary128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_cfuw_array, \
+     (__binary128 *r, const unsigned int *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctuwz_array, \
+     (unsigned int *r, const __binary128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_cfsd_array, \
+     (__binary128 *r, const long long *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctsdz_array, \
+     (long long *r, const __binary128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_cfud_array, \
+     (__binary128 *r, const unsigned long long *a, unsigned long n), \
+     (r, a, n)) \
+  X (void, vec_f128_ctudz_array, \
+     (unsigned long long *r, const __binary128 *a, unsigned long n), \
+     (r, a, n)) \
+  X (void, vec_f128_cfsq_array, \
+     (__binary128 *r, const vi128_t *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctsqz_array, \
+     (vi128_t *r, const __binary128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_cfuq_array, \
+     (__binary128 *r, const vui128_t *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctuqz_array, \
+     (vui128_t *r, const __binary128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_cfibm_array, \
+     (__binary128 *r, const __IBM128 *a, unsigned long n), (r, a, n)) \
+  X (void, vec_f128_ctibm_array, \
+     (__IBM128 *r, const __binary128 *a, unsigned long n), (r, a, n))
+#else
+#define VEC_DYN_OPS_F128N_VOID(X)
+#endif
+
+/* The binary128 linear algebra kernels of vec_f128_ppc.h, exported
+   under their own names.  */
+#ifndef PVECLIB_DISABLE_F128ARITH
+#define VEC_DYN_OPS_F128LA(X) \
+  X (__binary128, vec_f128_dot_array, \
+     (const __binary128 *a, const __binary128 *b, unsigned long n), \
+     (a, b, n)) \
+  X (__binary128, vec_f128_dotf64_array, \
+     (const double *a, const double *b, unsigned long n), (a, b, n))
+
+#define VEC_DYN_OPS_F128LA_VOID(X) \
+  X (void, vec_f128_gemv, \
+     (unsigned long m, unsigned long n, __binary128 alpha, \
+      const __binary128 *A, unsigned long lda, const __binary128 *x, \
+      __binary128 beta, __binary128 *y), \
+     (m, n, alpha, A, lda, x, beta, y)) \
+  X (void, vec_f128_gemvf64, \
+     (unsigned long m, unsigned long n, __binary128 alpha, \
+      const double *A, unsigned long lda, const double *x, \
+      __binary128 beta, __binary128 *y), \
+     (m, n, alpha, A, lda, x, beta, y)) \
+  X (void, vec_f128_gemm, \
+     (unsigned long m, unsigned long n, unsigned long k, \
+      __binary128 alpha, const __binary128 *A, unsigned long lda, \
+      const __binary128 *B, unsigned long ldb, __binary128 beta, \
+      __binary128 *C, unsigned long ldc), \
+     (m, n, k, alpha, A, lda, B, ldb, beta, C, ldc)) \
+  X (void, vec_f128_gemmf64, \
+     (unsigned long m, unsigned long n, unsigned long k, \
+      __binary128 alpha, const double *A, unsigned long lda, \
+      const double *B, unsigned long ldb, __binary128 beta, \
+      __binary128 *C, unsigned long ldc), \
+     (m, n, k, alpha, A, lda, B, ldb, beta, C, ldc))
+#else
+#define VEC_DYN_OPS_F128LA(X)
+#define VEC_DYN_OPS_F128LA_VOID(X)
+#endif
+
+/* The elementary function arrays of vec_f64_ppc.h and vec_f32_ppc.h,
+   exported under their own names.  */
+#define VEC_DYN_OPS_MATHN_VOID(X) \
+  X (void, vec_cosf64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_erff64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_exp2f64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_expf64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_log2f64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_logf64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_sinf64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_tanhf64_array, \
+     (double *r, const double *a, unsigned long n), (r, a, n)) \
+  X (void, vec_powf64_array, \
+     (double *r, const double *x, const double *y, unsigned long n), \
+     (r, x, y, n)) \
+  X (void, vec_cosf32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_erff32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_exp2f32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_expf32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_log2f32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_logf32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_sinf32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_tanhf32_array, \
+     (float *r, const float *a, unsigned long n), (r, a, n)) \
+  X (void, vec_powf32_array, \
+     (float *r, const float *x, const float *y, unsigned long n), \
+     (r, x, y, n))
+
+/* The polynomial arrays of vec_f64_ppc.h and vec_f128_ppc.h,
+   exported under their own names.  */
+#ifndef PVECLIB_DISABLE_F128ARITH
+#define VEC_DYN_OPS_POLYN_F128_VOID(X) \
+  X (void, vec_polyf128_array, \
+     (__binary128 *r, const __binary128 *x, const __binary128 *c, \
+      unsigned long deg, unsigned long n), (r, x, c, deg, n)) \
+  X (void, vec_polyf128f64_array, \
+     (double *r, const double *x, const __binary128 *c, \
+      unsigned long deg, vec_round_t rnd, unsigned long n), \
+     (r, x, c, deg, rnd, n))
+#else
+#define VEC_DYN_OPS_POLYN_F128_VOID(X)
+#endif
+
+#define VEC_DYN_OPS_POLYN_VOID(X) \
+  X (void, vec_polyf64_array, \
+     (double *r, const double *x, const double *c, unsigned long deg, \
+      unsigned long n), (r, x, c, deg, n)) \
+  X (void, vec_polyf64_dd_array, \
+     (double *r, const double *x, const double *c, unsigned long deg, \
+      unsigned long n), (r, x, c, deg, n)) \
+  VEC_DYN_OPS_POLYN_F128_VOID (X)
+
+#define VEC_DYN_OPS(X) \
+  VEC_DYN_OPS_INT128 (X) \
+  VEC_DYN_OPS_F128 (X) \
+  VEC_DYN_OPS_BCD (X)
+
+/* The exported functions profiled (PVECLIB_PROFILE) by generated
+   wrappers, in the order of their vec_prof_func counters. X expands
+   the functions returning a value, XVOID those returning void and
+   XDYN the FNAME_dyn exports of VEC_DYN_OPS. The int512 multiplies
+   have hand written wrappers in vec_runtime_DYN.c.  */
+#define VEC_DYN_OPS_PROF(X, XVOID, XDYN) \
+  VEC_DYN_OPS_INT128N (X) \
+  VEC_DYN_OPS_BCDN (X) \
+  VEC_DYN_OPS_BCDN_VOID (XVOID) \
+  VEC_DYN_OPS_F32N (X) \
+  VEC_DYN_OPS_F32N_VOID (XVOID) \
+  VEC_DYN_OPS_F128N_VOID (XVOID) \
+  VEC_DYN_OPS_MATHN_VOID (XVOID) \
+  VEC_DYN_OPS_F128LA (X) \
+  VEC_DYN_OPS_F128LA_VOID (XVOID) \
+  VEC_DYN_OPS_POLYN_VOID (XVOID) \
+  VEC_DYN_OPS (XDYN)
+
+/* Initializer for a vec_dispatch_t of the given platform number.
+   The user defines VEC_DISPATCH_IMP(FNAME) to name the platform
+   implementation of FNAME before expanding it.  */
+#define VEC_DISPATCH_ENTRY(RTYPE, FNAME, PARMS, ARGS) \
+  .FNAME = VEC_DISPATCH_IMP (FNAME),
+
+#define VEC_DISPATCH_INIT(PLATFORM) \
+  { \
+    .platform = PLATFORM, \
+    VEC_DYN_OPS_INT512 (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_INT512_VOID (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_BCDN (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_BCDN_VOID (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_F32N (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_F32N_VOID (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_F128N_VOID (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_MATHN_VOID (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_F128LA (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_F128LA_VOID (VEC_DISPATCH_ENTRY) \
+    VEC_DYN_OPS_POLYN_VOID (VEC_DISPATCH_ENTRY) \
+  }
+
+#endif /* SRC_VEC_RUNTIME_DISPATCH_H_ */
@@ -0,0 +1,253 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_runtime_profile.c
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+/*!
+ * \file  vec_runtime_profile.c
+ * \brief Counter registry and report for the optional libpvec call
+ * profiling (PVECLIB_PROFILE). See vec_profile_ppc.h.
+ *
+ * Each thread allocates its counter block on the first profiled call
+ * and pushes it onto a lock free list. Blocks are never freed, so
+ * the counts of threads that have exited remain visible to
+ * vec_prof_snapshot().
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <pveclib/vec_profile_ppc.h>
+#include "vec_runtime_profile.h"
+
+/* Fails to compile if the exported functions outgrow the counter
+   table of vec_prof_stats_t.  */
+typedef char vec_prof_nfuncs_check[(VEC_PROF_OPS_END <= VEC_PROF_NFUNCS)
+				   ? 1 : -1];
+
+#define VEC_PROF_NAME(RTYPE, FNAME, PARMS, ARGS) #FNAME,
+#define VEC_PROF_NAME_DYN(RTYPE, FNAME, PARMS, ARGS) #FNAME "_dyn",
+
+static const char *vec_prof_names[VEC_PROF_NFUNCS] =
+{
+  "vec_mul128x128",
+  "vec_mul256x256",
+  "vec_mul512x128",
+  "vec_madd512x128a512",
+  "vec_mul512x512",
+  "vec_mul1024x1024",
+  "vec_mul2048x2048",
+  "vec_mul128_byMN",
+  "vec_mul512_byMN",
+  VEC_DYN_OPS_PROF (VEC_PROF_NAME, VEC_PROF_NAME, VEC_PROF_NAME_DYN)
+};
+
+const char *
+vec_prof_name (int func)
+{
+  if (func < 0 || func >= VEC_PROF_OPS_END)
+    return "";
+  return vec_prof_names[func];
+}
+
+#ifdef PVECLIB_PROFILE
+
+typedef struct vec_prof_block
+{
+  vec_prof_stats_t stats;
+  struct vec_prof_block *next;
+} vec_prof_block_t;
+
+static vec_prof_block_t *vec_prof_blocks = NULL;
+
+__thread vec_prof_stats_t *vec_prof_tls = NULL;
+
+/* Used if malloc fails, so the wrappers never see NULL.  */
+static vec_prof_block_t vec_prof_overflow;
+
+vec_prof_stats_t *
+vec_prof_register (void)
+{
+  vec_prof_block_t *blk;
+
+  blk = calloc (1, sizeof (*blk));
+  if (blk == NULL)
+    {
+      /* Shared (and unsynchronized) but better than no counts.  */
+      vec_prof_tls = &vec_prof_overflow.stats;
+      return vec_prof_tls;
+    }
+
+  blk->next = __atomic_load_n (&vec_prof_blocks, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n (&vec_prof_blocks, &blk->next, blk,
+				       0, __ATOMIC_RELEASE,
+				       __ATOMIC_RELAXED))
+    ;
+  vec_prof_tls = &blk->stats;
+  return vec_prof_tls;
+}
+
+static void
+vec_prof_add (vec_prof_stats_t *sum, const vec_prof_stats_t *stats)
+{
+  int i, j;
+
+  for (i = 0; i < VEC_PROF_NFUNCS; i++)
+    {
+      sum->func[i].calls += stats->func[i].calls;
+      sum->func[i].ticks += stats->func[i].ticks;
+    }
+  for (i = 0; i < VEC_PROF_HIST_BUCKETS; i++)
+    for (j = 0; j < VEC_PROF_HIST_BUCKETS; j++)
+      {
+	sum->mul128_byMN[i][j] += stats->mul128_byMN[i][j];
+	sum->mul512_byMN[i][j] += stats->mul512_byMN[i][j];
+      }
+}
+
+int
+vec_prof_enabled (void)
+{
+  return 1;
+}
+
+void
+vec_prof_snapshot (vec_prof_stats_t *stats)
+{
+  vec_prof_block_t *blk;
+
+  memset (stats, 0, sizeof (*stats));
+  for (blk = __atomic_load_n (&vec_prof_blocks, __ATOMIC_ACQUIRE);
+       blk != NULL; blk = blk->next)
+    vec_prof_add (stats, &blk->stats);
+  vec_prof_add (stats, &vec_prof_overflow.stats);
+}
+
+void
+vec_prof_reset (void)
+{
+  vec_prof_block_t *blk;
+
+  for (blk = __atomic_load_n (&vec_prof_blocks, __ATOMIC_ACQUIRE);
+       blk != NULL; blk = blk->next)
+    memset (&blk->stats, 0, sizeof (blk->stats));
+  memset (&vec_prof_overflow.stats, 0, sizeof (vec_prof_overflow.stats));
+}
+
+static const char *vec_prof_dump_file = NULL;
+
+static void
+vec_prof_atexit (void)
+{
+  FILE *f = stderr;
+
+  if (vec_prof_dump_file[0] != '\0'
+      && strcmp (vec_prof_dump_file, "stderr") != 0)
+    {
+      f = fopen (vec_prof_dump_file, "w");
+      if (f == NULL)
+	{
+	  perror (vec_prof_dump_file);
+	  return;
+	}
+    }
+  vec_prof_dump (f);
+  if (f != stderr)
+    fclose (f);
+}
+
+static void __attribute__ ((constructor))
+vec_prof_init (void)
+{
+  vec_prof_dump_file = getenv ("PVECLIB_PROFILE_DUMP");
+  if (vec_prof_dump_file != NULL)
+    atexit (vec_prof_atexit);
+}
+#else
+int
+vec_prof_enabled (void)
+{
+  return 0;
+}
+
+void
+vec_prof_snapshot (vec_prof_stats_t *stats)
+{
+  memset (stats, 0, sizeof (*stats));
+}
+
+void
+vec_prof_reset (void)
+{
+}
+#endif
+
+/* Print the non-zero cells of a byMN histogram, labeled with the
+   upper bound of each bucket.  */
+static void
+vec_prof_dump_hist (FILE *f, const char *name,
+		    unsigned long long hist[VEC_PROF_HIST_BUCKETS][VEC_PROF_HIST_BUCKETS])
+{
+  int i, j;
+
+  fprintf (f, "%s M/N sizes (bucket upper bound):\n", name);
+  for (i = 0; i < VEC_PROF_HIST_BUCKETS; i++)
+    for (j = 0; j < VEC_PROF_HIST_BUCKETS; j++)
+      {
+	if (hist[i][j] == 0)
+	  continue;
+	fprintf (f, "  M %s%6lu  N %s%6lu  %14llu\n",
+		 (i == VEC_PROF_HIST_BUCKETS - 1) ? ">" : "<=",
+		 (i == VEC_PROF_HIST_BUCKETS - 1) ? 1UL << (i - 1) : 1UL << i,
+		 (j == VEC_PROF_HIST_BUCKETS - 1) ? ">" : "<=",
+		 (j == VEC_PROF_HIST_BUCKETS - 1) ? 1UL << (j - 1) : 1UL << j,
+		 hist[i][j]);
+      }
+}
+
+void
+vec_prof_dump (FILE *f)
+{
+  vec_prof_stats_t stats;
+  int i;
+
+  if (!vec_prof_enabled ())
+    {
+      fprintf (f, "libpvec built without PVECLIB_PROFILE\n");
+      return;
+    }
+
+  vec_prof_snapshot (&stats);
+  fprintf (f, "libpvec profile (timebase ticks)\n");
+  fprintf (f, "%-26s %14s %16s %12s\n", "function", "calls", "ticks",
+	   "ticks/call");
+  for (i = 0; i < VEC_PROF_OPS_END; i++)
+    {
+      if (stats.func[i].calls == 0)
+	continue;
+      fprintf (f, "%-26s %14llu %16llu %12.2f\n", vec_prof_names[i],
+	       stats.func[i].calls, stats.func[i].ticks,
+	       (double) stats.func[i].ticks / (double) stats.func[i].calls);
+    }
+  if (stats.func[VEC_PROF_MUL128_BYMN].calls != 0)
+    vec_prof_dump_hist (f, "vec_mul128_byMN", stats.mul128_byMN);
+  if (stats.func[VEC_PROF_MUL512_BYMN].calls != 0)
+    vec_prof_dump_hist (f, "vec_mul512_byMN", stats.mul512_byMN);
+}
@@ -0,0 +1,86 @@
+/*
+ Copyright (c) [2026] IBM Corporation.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_runtime_profile.h
+
+ Contributors:
+      IBM Corporation
+      Created on: Oct 17, 2026
+ */
+
+#ifndef SRC_VEC_RUNTIME_PROFILE_H_
+#define SRC_VEC_RUNTIME_PROFILE_H_
+
+/* Internal interface between the profiled IFUNC wrappers in
+   vec_runtime_DYN.c and the counter registry in
+   vec_runtime_profile.c. Not installed. The counters are only
+   defined with PVECLIB_PROFILE.  */
+
+#include <pveclib/vec_profile_ppc.h>
+#include "vec_runtime_dispatch.h"
+
+/* Counter indexes of the functions with generated wrappers
+   (VEC_DYN_OPS_PROF), following the int512 multiplies.  */
+#define VEC_PROF_ID(RTYPE, FNAME, PARMS, ARGS) VEC_PROF_ ## FNAME,
+
+enum vec_prof_ops
+{
+  VEC_PROF_OPS_BASE = VEC_PROF_MUL512_BYMN,
+  VEC_DYN_OPS_PROF (VEC_PROF_ID, VEC_PROF_ID, VEC_PROF_ID)
+  VEC_PROF_OPS_END
+};
+
+/* This thread's counter block, NULL until the first profiled call.  */
+extern __thread vec_prof_stats_t *vec_prof_tls
+  __attribute__ ((visibility ("hidden")));
+
+/* Allocate and register the counter block for this thread.  */
+extern vec_prof_stats_t *
+vec_prof_register (void) __attribute__ ((visibility ("hidden")));
+
+static inline vec_prof_stats_t *
+vec_prof_thread (void)
+{
+  vec_prof_stats_t *stats = vec_prof_tls;
+
+  if (__builtin_expect (stats == NULL, 0))
+    stats = vec_prof_register ();
+  return stats;
+}
+
+/* Histogram bucket for an M or N operand size.  */
+static inline unsigned int
+vec_prof_bucket (unsigned long size)
+{
+  unsigned int b;
+
+  if (size <= 1)
+    return 0;
+  b = 64 - __builtin_clzl (size - 1);
+  if (b >= VEC_PROF_HIST_BUCKETS)
+    b = VEC_PROF_HIST_BUCKETS - 1;
+  return b;
+}
+
+/* Start/end a profiled call of function ID.  */
+#define VEC_PROF_BEGIN(ID) \
+  vec_prof_stats_t *__prof = vec_prof_thread (); \
+  unsigned long long __prof_tb = __builtin_ppc_get_timebase ()
+
+#define VEC_PROF_END(ID) \
+  __prof->func[ID].ticks += __builtin_ppc_get_timebase () - __prof_tb; \
+  __prof->func[ID].calls++
+
+#endif /* SRC_VEC_RUNTIME_PROFILE_H_ */